@@ -0,0 +1,13 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_conc_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("deps")
+subdirs("src/obclient")
+subdirs("src/observer")
+subdirs("test/perf")
+subdirs("benchmark")
+subdirs("tools")
+subdirs("unittest")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmark/bplus_tree_concurrency_test.cpp" "benchmark/CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o" "gcc" "benchmark/CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_conc_build/deps/common/CMakeFiles/common.dir/DependInfo.cmake"
+  "/root/repo/_conc_build/src/observer/CMakeFiles/observer_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
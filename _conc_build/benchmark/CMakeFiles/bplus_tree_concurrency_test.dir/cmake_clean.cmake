@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bplus_tree_concurrency_test"
+  "../bin/bplus_tree_concurrency_test.pdb"
+  "CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o"
+  "CMakeFiles/bplus_tree_concurrency_test.dir/bplus_tree_concurrency_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bplus_tree_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
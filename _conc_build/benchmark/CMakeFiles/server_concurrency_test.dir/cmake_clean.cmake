@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/server_concurrency_test"
+  "../bin/server_concurrency_test.pdb"
+  "CMakeFiles/server_concurrency_test.dir/server_concurrency_test.cpp.o"
+  "CMakeFiles/server_concurrency_test.dir/server_concurrency_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/server_concurrency_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
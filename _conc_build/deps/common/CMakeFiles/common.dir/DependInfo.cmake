@@ -0,0 +1,63 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/deps/common/conf/ini.cpp" "deps/common/CMakeFiles/common.dir/conf/ini.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/conf/ini.cpp.o.d"
+  "/root/repo/deps/common/io/io.cpp" "deps/common/CMakeFiles/common.dir/io/io.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/io/io.cpp.o.d"
+  "/root/repo/deps/common/io/roll_select_dir.cpp" "deps/common/CMakeFiles/common.dir/io/roll_select_dir.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/io/roll_select_dir.cpp.o.d"
+  "/root/repo/deps/common/lang/bitmap.cpp" "deps/common/CMakeFiles/common.dir/lang/bitmap.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/bitmap.cpp.o.d"
+  "/root/repo/deps/common/lang/bloom_filter.cpp" "deps/common/CMakeFiles/common.dir/lang/bloom_filter.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/bloom_filter.cpp.o.d"
+  "/root/repo/deps/common/lang/comparator.cpp" "deps/common/CMakeFiles/common.dir/lang/comparator.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/comparator.cpp.o.d"
+  "/root/repo/deps/common/lang/mutex.cpp" "deps/common/CMakeFiles/common.dir/lang/mutex.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/mutex.cpp.o.d"
+  "/root/repo/deps/common/lang/roaring_bitmap.cpp" "deps/common/CMakeFiles/common.dir/lang/roaring_bitmap.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/roaring_bitmap.cpp.o.d"
+  "/root/repo/deps/common/lang/string.cpp" "deps/common/CMakeFiles/common.dir/lang/string.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/lang/string.cpp.o.d"
+  "/root/repo/deps/common/log/log.cpp" "deps/common/CMakeFiles/common.dir/log/log.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/log/log.cpp.o.d"
+  "/root/repo/deps/common/math/hyperloglog.cpp" "deps/common/CMakeFiles/common.dir/math/hyperloglog.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/math/hyperloglog.cpp.o.d"
+  "/root/repo/deps/common/math/md5.cpp" "deps/common/CMakeFiles/common.dir/math/md5.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/math/md5.cpp.o.d"
+  "/root/repo/deps/common/math/random_generator.cpp" "deps/common/CMakeFiles/common.dir/math/random_generator.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/math/random_generator.cpp.o.d"
+  "/root/repo/deps/common/math/regex.cpp" "deps/common/CMakeFiles/common.dir/math/regex.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/math/regex.cpp.o.d"
+  "/root/repo/deps/common/metrics/console_reporter.cpp" "deps/common/CMakeFiles/common.dir/metrics/console_reporter.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/console_reporter.cpp.o.d"
+  "/root/repo/deps/common/metrics/histogram_snapshot.cpp" "deps/common/CMakeFiles/common.dir/metrics/histogram_snapshot.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/histogram_snapshot.cpp.o.d"
+  "/root/repo/deps/common/metrics/log_reporter.cpp" "deps/common/CMakeFiles/common.dir/metrics/log_reporter.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/log_reporter.cpp.o.d"
+  "/root/repo/deps/common/metrics/metrics.cpp" "deps/common/CMakeFiles/common.dir/metrics/metrics.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/metrics.cpp.o.d"
+  "/root/repo/deps/common/metrics/metrics_registry.cpp" "deps/common/CMakeFiles/common.dir/metrics/metrics_registry.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/metrics_registry.cpp.o.d"
+  "/root/repo/deps/common/metrics/reporter.cpp" "deps/common/CMakeFiles/common.dir/metrics/reporter.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/reporter.cpp.o.d"
+  "/root/repo/deps/common/metrics/reservoir.cpp" "deps/common/CMakeFiles/common.dir/metrics/reservoir.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/reservoir.cpp.o.d"
+  "/root/repo/deps/common/metrics/sampler.cpp" "deps/common/CMakeFiles/common.dir/metrics/sampler.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/sampler.cpp.o.d"
+  "/root/repo/deps/common/metrics/timer_snapshot.cpp" "deps/common/CMakeFiles/common.dir/metrics/timer_snapshot.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/timer_snapshot.cpp.o.d"
+  "/root/repo/deps/common/metrics/uniform_reservoir.cpp" "deps/common/CMakeFiles/common.dir/metrics/uniform_reservoir.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/metrics/uniform_reservoir.cpp.o.d"
+  "/root/repo/deps/common/mm/mem_pool.cpp" "deps/common/CMakeFiles/common.dir/mm/mem_pool.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/mm/mem_pool.cpp.o.d"
+  "/root/repo/deps/common/os/os.cpp" "deps/common/CMakeFiles/common.dir/os/os.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/os.cpp.o.d"
+  "/root/repo/deps/common/os/path.cpp" "deps/common/CMakeFiles/common.dir/os/path.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/path.cpp.o.d"
+  "/root/repo/deps/common/os/pidfile.cpp" "deps/common/CMakeFiles/common.dir/os/pidfile.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/pidfile.cpp.o.d"
+  "/root/repo/deps/common/os/process.cpp" "deps/common/CMakeFiles/common.dir/os/process.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/process.cpp.o.d"
+  "/root/repo/deps/common/os/process_param.cpp" "deps/common/CMakeFiles/common.dir/os/process_param.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/process_param.cpp.o.d"
+  "/root/repo/deps/common/os/signal.cpp" "deps/common/CMakeFiles/common.dir/os/signal.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/os/signal.cpp.o.d"
+  "/root/repo/deps/common/seda/callback.cpp" "deps/common/CMakeFiles/common.dir/seda/callback.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/callback.cpp.o.d"
+  "/root/repo/deps/common/seda/event_dispatcher.cpp" "deps/common/CMakeFiles/common.dir/seda/event_dispatcher.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/event_dispatcher.cpp.o.d"
+  "/root/repo/deps/common/seda/example_stage.cpp" "deps/common/CMakeFiles/common.dir/seda/example_stage.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/example_stage.cpp.o.d"
+  "/root/repo/deps/common/seda/init.cpp" "deps/common/CMakeFiles/common.dir/seda/init.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/init.cpp.o.d"
+  "/root/repo/deps/common/seda/kill_thread.cpp" "deps/common/CMakeFiles/common.dir/seda/kill_thread.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/kill_thread.cpp.o.d"
+  "/root/repo/deps/common/seda/metrics_report_event.cpp" "deps/common/CMakeFiles/common.dir/seda/metrics_report_event.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/metrics_report_event.cpp.o.d"
+  "/root/repo/deps/common/seda/metrics_stage.cpp" "deps/common/CMakeFiles/common.dir/seda/metrics_stage.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/metrics_stage.cpp.o.d"
+  "/root/repo/deps/common/seda/seda_config.cpp" "deps/common/CMakeFiles/common.dir/seda/seda_config.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/seda_config.cpp.o.d"
+  "/root/repo/deps/common/seda/stage.cpp" "deps/common/CMakeFiles/common.dir/seda/stage.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/stage.cpp.o.d"
+  "/root/repo/deps/common/seda/stage_event.cpp" "deps/common/CMakeFiles/common.dir/seda/stage_event.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/stage_event.cpp.o.d"
+  "/root/repo/deps/common/seda/thread_pool.cpp" "deps/common/CMakeFiles/common.dir/seda/thread_pool.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/thread_pool.cpp.o.d"
+  "/root/repo/deps/common/seda/timer_stage.cpp" "deps/common/CMakeFiles/common.dir/seda/timer_stage.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/seda/timer_stage.cpp.o.d"
+  "/root/repo/deps/common/time/datetime.cpp" "deps/common/CMakeFiles/common.dir/time/datetime.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/time/datetime.cpp.o.d"
+  "/root/repo/deps/common/time/timeout_info.cpp" "deps/common/CMakeFiles/common.dir/time/timeout_info.cpp.o" "gcc" "deps/common/CMakeFiles/common.dir/time/timeout_info.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "../../lib/libcommon.a"
+  "../../lib/libcommon.pdb"
+  "CMakeFiles/common.dir/conf/ini.cpp.o"
+  "CMakeFiles/common.dir/conf/ini.cpp.o.d"
+  "CMakeFiles/common.dir/io/io.cpp.o"
+  "CMakeFiles/common.dir/io/io.cpp.o.d"
+  "CMakeFiles/common.dir/io/roll_select_dir.cpp.o"
+  "CMakeFiles/common.dir/io/roll_select_dir.cpp.o.d"
+  "CMakeFiles/common.dir/lang/bitmap.cpp.o"
+  "CMakeFiles/common.dir/lang/bitmap.cpp.o.d"
+  "CMakeFiles/common.dir/lang/bloom_filter.cpp.o"
+  "CMakeFiles/common.dir/lang/bloom_filter.cpp.o.d"
+  "CMakeFiles/common.dir/lang/comparator.cpp.o"
+  "CMakeFiles/common.dir/lang/comparator.cpp.o.d"
+  "CMakeFiles/common.dir/lang/mutex.cpp.o"
+  "CMakeFiles/common.dir/lang/mutex.cpp.o.d"
+  "CMakeFiles/common.dir/lang/roaring_bitmap.cpp.o"
+  "CMakeFiles/common.dir/lang/roaring_bitmap.cpp.o.d"
+  "CMakeFiles/common.dir/lang/string.cpp.o"
+  "CMakeFiles/common.dir/lang/string.cpp.o.d"
+  "CMakeFiles/common.dir/log/log.cpp.o"
+  "CMakeFiles/common.dir/log/log.cpp.o.d"
+  "CMakeFiles/common.dir/math/hyperloglog.cpp.o"
+  "CMakeFiles/common.dir/math/hyperloglog.cpp.o.d"
+  "CMakeFiles/common.dir/math/md5.cpp.o"
+  "CMakeFiles/common.dir/math/md5.cpp.o.d"
+  "CMakeFiles/common.dir/math/random_generator.cpp.o"
+  "CMakeFiles/common.dir/math/random_generator.cpp.o.d"
+  "CMakeFiles/common.dir/math/regex.cpp.o"
+  "CMakeFiles/common.dir/math/regex.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/console_reporter.cpp.o"
+  "CMakeFiles/common.dir/metrics/console_reporter.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/histogram_snapshot.cpp.o"
+  "CMakeFiles/common.dir/metrics/histogram_snapshot.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/log_reporter.cpp.o"
+  "CMakeFiles/common.dir/metrics/log_reporter.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/metrics.cpp.o"
+  "CMakeFiles/common.dir/metrics/metrics.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/metrics_registry.cpp.o"
+  "CMakeFiles/common.dir/metrics/metrics_registry.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/reporter.cpp.o"
+  "CMakeFiles/common.dir/metrics/reporter.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/reservoir.cpp.o"
+  "CMakeFiles/common.dir/metrics/reservoir.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/sampler.cpp.o"
+  "CMakeFiles/common.dir/metrics/sampler.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/timer_snapshot.cpp.o"
+  "CMakeFiles/common.dir/metrics/timer_snapshot.cpp.o.d"
+  "CMakeFiles/common.dir/metrics/uniform_reservoir.cpp.o"
+  "CMakeFiles/common.dir/metrics/uniform_reservoir.cpp.o.d"
+  "CMakeFiles/common.dir/mm/mem_pool.cpp.o"
+  "CMakeFiles/common.dir/mm/mem_pool.cpp.o.d"
+  "CMakeFiles/common.dir/os/os.cpp.o"
+  "CMakeFiles/common.dir/os/os.cpp.o.d"
+  "CMakeFiles/common.dir/os/path.cpp.o"
+  "CMakeFiles/common.dir/os/path.cpp.o.d"
+  "CMakeFiles/common.dir/os/pidfile.cpp.o"
+  "CMakeFiles/common.dir/os/pidfile.cpp.o.d"
+  "CMakeFiles/common.dir/os/process.cpp.o"
+  "CMakeFiles/common.dir/os/process.cpp.o.d"
+  "CMakeFiles/common.dir/os/process_param.cpp.o"
+  "CMakeFiles/common.dir/os/process_param.cpp.o.d"
+  "CMakeFiles/common.dir/os/signal.cpp.o"
+  "CMakeFiles/common.dir/os/signal.cpp.o.d"
+  "CMakeFiles/common.dir/seda/callback.cpp.o"
+  "CMakeFiles/common.dir/seda/callback.cpp.o.d"
+  "CMakeFiles/common.dir/seda/event_dispatcher.cpp.o"
+  "CMakeFiles/common.dir/seda/event_dispatcher.cpp.o.d"
+  "CMakeFiles/common.dir/seda/example_stage.cpp.o"
+  "CMakeFiles/common.dir/seda/example_stage.cpp.o.d"
+  "CMakeFiles/common.dir/seda/init.cpp.o"
+  "CMakeFiles/common.dir/seda/init.cpp.o.d"
+  "CMakeFiles/common.dir/seda/kill_thread.cpp.o"
+  "CMakeFiles/common.dir/seda/kill_thread.cpp.o.d"
+  "CMakeFiles/common.dir/seda/metrics_report_event.cpp.o"
+  "CMakeFiles/common.dir/seda/metrics_report_event.cpp.o.d"
+  "CMakeFiles/common.dir/seda/metrics_stage.cpp.o"
+  "CMakeFiles/common.dir/seda/metrics_stage.cpp.o.d"
+  "CMakeFiles/common.dir/seda/seda_config.cpp.o"
+  "CMakeFiles/common.dir/seda/seda_config.cpp.o.d"
+  "CMakeFiles/common.dir/seda/stage.cpp.o"
+  "CMakeFiles/common.dir/seda/stage.cpp.o.d"
+  "CMakeFiles/common.dir/seda/stage_event.cpp.o"
+  "CMakeFiles/common.dir/seda/stage_event.cpp.o.d"
+  "CMakeFiles/common.dir/seda/thread_pool.cpp.o"
+  "CMakeFiles/common.dir/seda/thread_pool.cpp.o.d"
+  "CMakeFiles/common.dir/seda/timer_stage.cpp.o"
+  "CMakeFiles/common.dir/seda/timer_stage.cpp.o.d"
+  "CMakeFiles/common.dir/time/datetime.cpp.o"
+  "CMakeFiles/common.dir/time/datetime.cpp.o.d"
+  "CMakeFiles/common.dir/time/timeout_info.cpp.o"
+  "CMakeFiles/common.dir/time/timeout_info.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/common.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
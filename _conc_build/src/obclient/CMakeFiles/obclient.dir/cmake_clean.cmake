@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/obclient"
+  "../../bin/obclient.pdb"
+  "CMakeFiles/obclient.dir/client.cpp.o"
+  "CMakeFiles/obclient.dir/client.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/obclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/observer"
+  "../../bin/observer.pdb"
+  "CMakeFiles/observer.dir/main.cpp.o"
+  "CMakeFiles/observer.dir/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/observer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,140 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/observer/common/global_context.cpp" "src/observer/CMakeFiles/observer_static.dir/common/global_context.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/global_context.cpp.o.d"
+  "/root/repo/src/observer/common/init.cpp" "src/observer/CMakeFiles/observer_static.dir/common/init.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/init.cpp.o.d"
+  "/root/repo/src/observer/common/rc.cpp" "src/observer/CMakeFiles/observer_static.dir/common/rc.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/common/rc.cpp.o.d"
+  "/root/repo/src/observer/event/session_event.cpp" "src/observer/CMakeFiles/observer_static.dir/event/session_event.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/session_event.cpp.o.d"
+  "/root/repo/src/observer/event/sql_debug.cpp" "src/observer/CMakeFiles/observer_static.dir/event/sql_debug.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/sql_debug.cpp.o.d"
+  "/root/repo/src/observer/event/sql_event.cpp" "src/observer/CMakeFiles/observer_static.dir/event/sql_event.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/event/sql_event.cpp.o.d"
+  "/root/repo/src/observer/main.cpp" "src/observer/CMakeFiles/observer_static.dir/main.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/main.cpp.o.d"
+  "/root/repo/src/observer/net/buffered_writer.cpp" "src/observer/CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o.d"
+  "/root/repo/src/observer/net/cli_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/communicator.cpp.o.d"
+  "/root/repo/src/observer/net/mysql_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/plain_communicator.cpp" "src/observer/CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o.d"
+  "/root/repo/src/observer/net/ring_buffer.cpp" "src/observer/CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o.d"
+  "/root/repo/src/observer/net/server.cpp" "src/observer/CMakeFiles/observer_static.dir/net/server.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/net/server.cpp.o.d"
+  "/root/repo/src/observer/session/session.cpp" "src/observer/CMakeFiles/observer_static.dir/session/session.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/session.cpp.o.d"
+  "/root/repo/src/observer/session/session_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/session/session_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/session_stage.cpp.o.d"
+  "/root/repo/src/observer/session/thread_data.cpp" "src/observer/CMakeFiles/observer_static.dir/session/thread_data.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/session/thread_data.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/analyze_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/command_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/create_index_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/create_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/desc_table_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/execute_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/load_data_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/show_stats_executor.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_stats_executor.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/show_stats_executor.cpp.o.d"
+  "/root/repo/src/observer/sql/executor/sql_result.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/chunk.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/chunk.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/chunk.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/expression.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o.d"
+  "/root/repo/src/observer/sql/expr/tuple_cell.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/aggregate_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/aggregate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/aggregate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/bitmap_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/bitmap_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/bitmap_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/delete_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/delete_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/explain_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/external_sorter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/external_sorter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/external_sorter.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/gather_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/gather_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/gather_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/hash_aggregate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_aggregate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_aggregate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/hash_join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/index_merge_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_merge_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_merge_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/index_nested_loop_join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_nested_loop_join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_nested_loop_join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/index_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/insert_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/insert_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/limit_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/limit_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/limit_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/limit_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/limit_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/limit_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/merge_join_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/merge_join_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/merge_join_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/morsel_scheduler.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/morsel_scheduler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/morsel_scheduler.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/parallel_hash_aggregate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/parallel_hash_aggregate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/parallel_hash_aggregate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/predicate_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/predicate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/project_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/project_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/sort_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/sort_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/sort_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/sort_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/sort_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/sort_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/stream_aggregate_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/stream_aggregate_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/stream_aggregate_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/table_get_logical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/table_scan_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/operator/top_n_physical_operator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/operator/top_n_physical_operator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/operator/top_n_physical_operator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/comparison_simplification_rule.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/conjunction_simplification_rule.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/expression_rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/join_order_optimizer.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/join_order_optimizer.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/join_order_optimizer.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/logical_plan_generator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/optimize_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/physical_plan_generator.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/predicate_pushdown_rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/predicate_rewrite.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o.d"
+  "/root/repo/src/observer/sql/optimizer/rewriter.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/lex_sql.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/parse.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/parse_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/resolve_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/value.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/value.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/value.cpp.o.d"
+  "/root/repo/src/observer/sql/parser/yacc_sql.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o.d"
+  "/root/repo/src/observer/sql/plan_cache/plan_cache_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/query_cache/query_cache_stage.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/analyze_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/create_index_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/create_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/delete_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/desc_table_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/explain_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/filter_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/insert_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/load_data_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/select_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/show_stats_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/show_stats_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/show_stats_stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o.d"
+  "/root/repo/src/observer/sql/stmt/update_stmt.cpp" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/disk_buffer_pool.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o.d"
+  "/root/repo/src/observer/storage/buffer/frame.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o.d"
+  "/root/repo/src/observer/storage/clog/clog.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/clog/clog.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/clog/clog.cpp.o.d"
+  "/root/repo/src/observer/storage/common/condition_filter.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o.d"
+  "/root/repo/src/observer/storage/common/meta_util.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o.d"
+  "/root/repo/src/observer/storage/db/db.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/db/db.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/db/db.cpp.o.d"
+  "/root/repo/src/observer/storage/default/default_handler.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o.d"
+  "/root/repo/src/observer/storage/field/field.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/field/field.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/field/field.cpp.o.d"
+  "/root/repo/src/observer/storage/field/field_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bitmap_index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bitmap_index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bitmap_index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o.d"
+  "/root/repo/src/observer/storage/index/bplus_tree_index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/extendible_hash.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/extendible_hash.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/extendible_hash.cpp.o.d"
+  "/root/repo/src/observer/storage/index/hash_index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/hash_index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/hash_index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index_bloom_filter.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_bloom_filter.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_bloom_filter.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_log.cpp.o.d"
+  "/root/repo/src/observer/storage/index/index_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/persist/persist.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o.d"
+  "/root/repo/src/observer/storage/record/record_manager.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o.d"
+  "/root/repo/src/observer/storage/table/index_build_log.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/index_build_log.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/index_build_log.cpp.o.d"
+  "/root/repo/src/observer/storage/table/table.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/table.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/table.cpp.o.d"
+  "/root/repo/src/observer/storage/table/table_meta.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o.d"
+  "/root/repo/src/observer/storage/table/table_stats.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_stats.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/table/table_stats.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/latch_memo.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/latch_memo.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/latch_memo.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/mvcc_trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o.d"
+  "/root/repo/src/observer/storage/trx/vacuous_trx.cpp" "src/observer/CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o" "gcc" "src/observer/CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_conc_build/deps/common/CMakeFiles/common.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,251 @@
+file(REMOVE_RECURSE
+  "../../lib/libobserver.a"
+  "../../lib/libobserver.pdb"
+  "CMakeFiles/observer_static.dir/common/global_context.cpp.o"
+  "CMakeFiles/observer_static.dir/common/global_context.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/init.cpp.o"
+  "CMakeFiles/observer_static.dir/common/init.cpp.o.d"
+  "CMakeFiles/observer_static.dir/common/rc.cpp.o"
+  "CMakeFiles/observer_static.dir/common/rc.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/session_event.cpp.o"
+  "CMakeFiles/observer_static.dir/event/session_event.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/sql_debug.cpp.o"
+  "CMakeFiles/observer_static.dir/event/sql_debug.cpp.o.d"
+  "CMakeFiles/observer_static.dir/event/sql_event.cpp.o"
+  "CMakeFiles/observer_static.dir/event/sql_event.cpp.o.d"
+  "CMakeFiles/observer_static.dir/main.cpp.o"
+  "CMakeFiles/observer_static.dir/main.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o"
+  "CMakeFiles/observer_static.dir/net/buffered_writer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/cli_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/mysql_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o"
+  "CMakeFiles/observer_static.dir/net/plain_communicator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o"
+  "CMakeFiles/observer_static.dir/net/ring_buffer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/net/server.cpp.o"
+  "CMakeFiles/observer_static.dir/net/server.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/session.cpp.o"
+  "CMakeFiles/observer_static.dir/session/session.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/session_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/session/session_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/session/thread_data.cpp.o"
+  "CMakeFiles/observer_static.dir/session/thread_data.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/analyze_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/command_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/create_index_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/create_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/desc_table_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/execute_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/load_data_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/show_stats_executor.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/show_stats_executor.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/executor/sql_result.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/chunk.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/chunk.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/expression.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/expr/tuple_cell.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/aggregate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/bitmap_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/bitmap_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/delete_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/explain_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/external_sorter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/external_sorter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/gather_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/gather_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_aggregate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_aggregate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/hash_join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/index_merge_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/index_merge_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/index_nested_loop_join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/index_nested_loop_join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/index_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/insert_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/limit_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/limit_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/limit_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/limit_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/merge_join_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/merge_join_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/morsel_scheduler.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/morsel_scheduler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/parallel_hash_aggregate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/parallel_hash_aggregate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/predicate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/project_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/project_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/sort_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/sort_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/sort_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/sort_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/stream_aggregate_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/stream_aggregate_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/table_get_logical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/table_scan_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/operator/top_n_physical_operator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/operator/top_n_physical_operator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/comparison_simplification_rule.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/conjunction_simplification_rule.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/expression_rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/join_order_optimizer.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/join_order_optimizer.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/logical_plan_generator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/optimize_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/physical_plan_generator.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_pushdown_rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/predicate_rewrite.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/optimizer/rewriter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/lex_sql.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/parse.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/parse_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/resolve_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/value.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/value.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/parser/yacc_sql.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/plan_cache/plan_cache_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/query_cache/query_cache_stage.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/analyze_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_index_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/create_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/delete_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/desc_table_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/explain_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/filter_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/insert_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/load_data_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/select_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/show_stats_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/show_stats_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o"
+  "CMakeFiles/observer_static.dir/sql/stmt/update_stmt.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/disk_buffer_pool.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/buffer/frame.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/clog/clog.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/clog/clog.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/condition_filter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/common/meta_util.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/db/db.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/db/db.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/default/default_handler.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/field/field.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/field/field.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/field/field_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bitmap_index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bitmap_index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/bplus_tree_index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/extendible_hash.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/extendible_hash.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/hash_index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/hash_index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index_bloom_filter.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index_bloom_filter.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/index/index_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/persist/persist.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/record/record_manager.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/index_build_log.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/index_build_log.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/table.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/table.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/table_meta.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/table/table_stats.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/table/table_stats.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/latch_memo.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/latch_memo.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/mvcc_trx.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/trx.cpp.o.d"
+  "CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o"
+  "CMakeFiles/observer_static.dir/storage/trx/vacuous_trx.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/observer_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/client_performance_test"
+  "../../bin/client_performance_test.pdb"
+  "CMakeFiles/client_performance_test.dir/client_performance_test.cpp.o"
+  "CMakeFiles/client_performance_test.dir/client_performance_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/client_performance_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/clog_reader"
+  "../bin/clog_reader.pdb"
+  "CMakeFiles/clog_reader.dir/clog_reader_cmd.cpp.o"
+  "CMakeFiles/clog_reader.dir/clog_reader_cmd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clog_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
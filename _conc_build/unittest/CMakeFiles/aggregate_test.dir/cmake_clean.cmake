@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/aggregate_test"
+  "../bin/aggregate_test.pdb"
+  "CMakeFiles/aggregate_test.dir/aggregate_test.cpp.o"
+  "CMakeFiles/aggregate_test.dir/aggregate_test.cpp.o.d"
+  "aggregate_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aggregate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
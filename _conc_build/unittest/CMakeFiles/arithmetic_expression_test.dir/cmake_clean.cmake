@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/arithmetic_expression_test"
+  "../bin/arithmetic_expression_test.pdb"
+  "CMakeFiles/arithmetic_expression_test.dir/arithmetic_expression_test.cpp.o"
+  "CMakeFiles/arithmetic_expression_test.dir/arithmetic_expression_test.cpp.o.d"
+  "arithmetic_expression_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arithmetic_expression_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
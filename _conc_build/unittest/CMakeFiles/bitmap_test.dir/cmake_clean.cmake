@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/bitmap_test"
+  "../bin/bitmap_test.pdb"
+  "CMakeFiles/bitmap_test.dir/bitmap_test.cpp.o"
+  "CMakeFiles/bitmap_test.dir/bitmap_test.cpp.o.d"
+  "bitmap_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitmap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/bloom_filter_test"
+  "../bin/bloom_filter_test.pdb"
+  "CMakeFiles/bloom_filter_test.dir/bloom_filter_test.cpp.o"
+  "CMakeFiles/bloom_filter_test.dir/bloom_filter_test.cpp.o.d"
+  "bloom_filter_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bloom_filter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
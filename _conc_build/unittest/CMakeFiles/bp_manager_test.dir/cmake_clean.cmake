@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/bp_manager_test"
+  "../bin/bp_manager_test.pdb"
+  "CMakeFiles/bp_manager_test.dir/bp_manager_test.cpp.o"
+  "CMakeFiles/bp_manager_test.dir/bp_manager_test.cpp.o.d"
+  "bp_manager_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bp_manager_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/bplus_tree_test"
+  "../bin/bplus_tree_test.pdb"
+  "CMakeFiles/bplus_tree_test.dir/bplus_tree_test.cpp.o"
+  "CMakeFiles/bplus_tree_test.dir/bplus_tree_test.cpp.o.d"
+  "bplus_tree_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bplus_tree_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/chunk_test"
+  "../bin/chunk_test.pdb"
+  "CMakeFiles/chunk_test.dir/chunk_test.cpp.o"
+  "CMakeFiles/chunk_test.dir/chunk_test.cpp.o.d"
+  "chunk_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chunk_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
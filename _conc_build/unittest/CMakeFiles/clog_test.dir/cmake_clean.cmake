@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/clog_test"
+  "../bin/clog_test.pdb"
+  "CMakeFiles/clog_test.dir/clog_test.cpp.o"
+  "CMakeFiles/clog_test.dir/clog_test.cpp.o.d"
+  "clog_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/clog_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
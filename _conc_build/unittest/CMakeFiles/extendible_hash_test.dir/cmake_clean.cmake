@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/extendible_hash_test"
+  "../bin/extendible_hash_test.pdb"
+  "CMakeFiles/extendible_hash_test.dir/extendible_hash_test.cpp.o"
+  "CMakeFiles/extendible_hash_test.dir/extendible_hash_test.cpp.o.d"
+  "extendible_hash_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/extendible_hash_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
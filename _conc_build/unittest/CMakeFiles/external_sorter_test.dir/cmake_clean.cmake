@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/external_sorter_test"
+  "../bin/external_sorter_test.pdb"
+  "CMakeFiles/external_sorter_test.dir/external_sorter_test.cpp.o"
+  "CMakeFiles/external_sorter_test.dir/external_sorter_test.cpp.o.d"
+  "external_sorter_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/external_sorter_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
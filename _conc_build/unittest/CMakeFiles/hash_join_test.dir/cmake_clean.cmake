@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/hash_join_test"
+  "../bin/hash_join_test.pdb"
+  "CMakeFiles/hash_join_test.dir/hash_join_test.cpp.o"
+  "CMakeFiles/hash_join_test.dir/hash_join_test.cpp.o.d"
+  "hash_join_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash_join_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/index_predicate_test"
+  "../bin/index_predicate_test.pdb"
+  "CMakeFiles/index_predicate_test.dir/index_predicate_test.cpp.o"
+  "CMakeFiles/index_predicate_test.dir/index_predicate_test.cpp.o.d"
+  "index_predicate_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/index_predicate_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
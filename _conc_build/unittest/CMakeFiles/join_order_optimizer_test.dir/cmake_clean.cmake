@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/join_order_optimizer_test"
+  "../bin/join_order_optimizer_test.pdb"
+  "CMakeFiles/join_order_optimizer_test.dir/join_order_optimizer_test.cpp.o"
+  "CMakeFiles/join_order_optimizer_test.dir/join_order_optimizer_test.cpp.o.d"
+  "join_order_optimizer_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_order_optimizer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/lower_bound_test"
+  "../bin/lower_bound_test.pdb"
+  "CMakeFiles/lower_bound_test.dir/lower_bound_test.cpp.o"
+  "CMakeFiles/lower_bound_test.dir/lower_bound_test.cpp.o.d"
+  "lower_bound_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lower_bound_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/md5_test"
+  "../bin/md5_test.pdb"
+  "CMakeFiles/md5_test.dir/md5_test.cpp.o"
+  "CMakeFiles/md5_test.dir/md5_test.cpp.o.d"
+  "md5_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/md5_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/mem_pool_test"
+  "../bin/mem_pool_test.pdb"
+  "CMakeFiles/mem_pool_test.dir/mem_pool_test.cpp.o"
+  "CMakeFiles/mem_pool_test.dir/mem_pool_test.cpp.o.d"
+  "mem_pool_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mem_pool_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/persist_test"
+  "../bin/persist_test.pdb"
+  "CMakeFiles/persist_test.dir/persist_test.cpp.o"
+  "CMakeFiles/persist_test.dir/persist_test.cpp.o.d"
+  "persist_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/persist_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
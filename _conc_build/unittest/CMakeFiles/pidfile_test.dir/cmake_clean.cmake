@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/pidfile_test"
+  "../bin/pidfile_test.pdb"
+  "CMakeFiles/pidfile_test.dir/pidfile_test.cpp.o"
+  "CMakeFiles/pidfile_test.dir/pidfile_test.cpp.o.d"
+  "pidfile_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pidfile_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/record_manager_test"
+  "../bin/record_manager_test.pdb"
+  "CMakeFiles/record_manager_test.dir/record_manager_test.cpp.o"
+  "CMakeFiles/record_manager_test.dir/record_manager_test.cpp.o.d"
+  "record_manager_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/record_manager_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
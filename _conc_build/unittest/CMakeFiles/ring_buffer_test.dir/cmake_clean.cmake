@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/ring_buffer_test"
+  "../bin/ring_buffer_test.pdb"
+  "CMakeFiles/ring_buffer_test.dir/ring_buffer_test.cpp.o"
+  "CMakeFiles/ring_buffer_test.dir/ring_buffer_test.cpp.o.d"
+  "ring_buffer_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ring_buffer_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/roaring_bitmap_test"
+  "../bin/roaring_bitmap_test.pdb"
+  "CMakeFiles/roaring_bitmap_test.dir/roaring_bitmap_test.cpp.o"
+  "CMakeFiles/roaring_bitmap_test.dir/roaring_bitmap_test.cpp.o.d"
+  "roaring_bitmap_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/roaring_bitmap_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
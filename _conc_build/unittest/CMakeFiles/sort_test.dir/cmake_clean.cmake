@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/sort_test"
+  "../bin/sort_test.pdb"
+  "CMakeFiles/sort_test.dir/sort_test.cpp.o"
+  "CMakeFiles/sort_test.dir/sort_test.cpp.o.d"
+  "sort_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sort_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../bin/table_stats_test"
+  "../bin/table_stats_test.pdb"
+  "CMakeFiles/table_stats_test.dir/table_stats_test.cpp.o"
+  "CMakeFiles/table_stats_test.dir/table_stats_test.cpp.o.d"
+  "table_stats_test[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/table_stats_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unittest
+# Build directory: /root/repo/_conc_build/unittest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_conc_build/unittest/aggregate_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/arithmetic_expression_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/bitmap_index_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/bitmap_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/bloom_filter_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/bp_manager_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/bplus_tree_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/chunk_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/clog_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/extendible_hash_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/external_sorter_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/hash_join_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/index_predicate_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/join_order_optimizer_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/log_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/lower_bound_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/md5_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/mem_pool_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/parallel_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/persist_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/pidfile_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/record_manager_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/ring_buffer_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/roaring_bitmap_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/sort_test[1]_include.cmake")
+include("/root/repo/_conc_build/unittest/table_stats_test[1]_include.cmake")
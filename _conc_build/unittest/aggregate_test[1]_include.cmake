@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/aggregate_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/aggregate_test[1]_tests.cmake")
+else()
+  add_test(aggregate_test_NOT_BUILT aggregate_test_NOT_BUILT)
+endif()
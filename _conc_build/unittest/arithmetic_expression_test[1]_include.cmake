@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/arithmetic_expression_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/arithmetic_expression_test[1]_tests.cmake")
+else()
+  add_test(arithmetic_expression_test_NOT_BUILT arithmetic_expression_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/bitmap_index_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/bitmap_index_test[1]_tests.cmake")
+else()
+  add_test(bitmap_index_test_NOT_BUILT bitmap_index_test_NOT_BUILT)
+endif()
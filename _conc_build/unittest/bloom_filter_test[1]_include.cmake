@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/bloom_filter_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/bloom_filter_test[1]_tests.cmake")
+else()
+  add_test(bloom_filter_test_NOT_BUILT bloom_filter_test_NOT_BUILT)
+endif()
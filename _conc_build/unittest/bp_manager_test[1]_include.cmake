@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/bp_manager_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/bp_manager_test[1]_tests.cmake")
+else()
+  add_test(bp_manager_test_NOT_BUILT bp_manager_test_NOT_BUILT)
+endif()
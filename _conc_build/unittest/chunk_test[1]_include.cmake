@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/chunk_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/chunk_test[1]_tests.cmake")
+else()
+  add_test(chunk_test_NOT_BUILT chunk_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/clog_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/clog_test[1]_tests.cmake")
+else()
+  add_test(clog_test_NOT_BUILT clog_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/extendible_hash_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/extendible_hash_test[1]_tests.cmake")
+else()
+  add_test(extendible_hash_test_NOT_BUILT extendible_hash_test_NOT_BUILT)
+endif()
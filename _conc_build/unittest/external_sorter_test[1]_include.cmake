@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/external_sorter_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/external_sorter_test[1]_tests.cmake")
+else()
+  add_test(external_sorter_test_NOT_BUILT external_sorter_test_NOT_BUILT)
+endif()
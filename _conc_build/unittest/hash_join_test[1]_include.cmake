@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/hash_join_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/hash_join_test[1]_tests.cmake")
+else()
+  add_test(hash_join_test_NOT_BUILT hash_join_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/index_predicate_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/index_predicate_test[1]_tests.cmake")
+else()
+  add_test(index_predicate_test_NOT_BUILT index_predicate_test_NOT_BUILT)
+endif()
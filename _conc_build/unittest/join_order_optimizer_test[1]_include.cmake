@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/join_order_optimizer_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/join_order_optimizer_test[1]_tests.cmake")
+else()
+  add_test(join_order_optimizer_test_NOT_BUILT join_order_optimizer_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/log_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/log_test[1]_tests.cmake")
+else()
+  add_test(log_test_NOT_BUILT log_test_NOT_BUILT)
+endif()
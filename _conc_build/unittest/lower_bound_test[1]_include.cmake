@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/lower_bound_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/lower_bound_test[1]_tests.cmake")
+else()
+  add_test(lower_bound_test_NOT_BUILT lower_bound_test_NOT_BUILT)
+endif()
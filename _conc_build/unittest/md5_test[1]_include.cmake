@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/md5_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/md5_test[1]_tests.cmake")
+else()
+  add_test(md5_test_NOT_BUILT md5_test_NOT_BUILT)
+endif()
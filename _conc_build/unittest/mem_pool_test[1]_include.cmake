@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/mem_pool_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/mem_pool_test[1]_tests.cmake")
+else()
+  add_test(mem_pool_test_NOT_BUILT mem_pool_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/persist_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/persist_test[1]_tests.cmake")
+else()
+  add_test(persist_test_NOT_BUILT persist_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/record_manager_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/record_manager_test[1]_tests.cmake")
+else()
+  add_test(record_manager_test_NOT_BUILT record_manager_test_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/ring_buffer_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/ring_buffer_test[1]_tests.cmake")
+else()
+  add_test(ring_buffer_test_NOT_BUILT ring_buffer_test_NOT_BUILT)
+endif()
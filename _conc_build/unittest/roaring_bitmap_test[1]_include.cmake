@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/roaring_bitmap_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/roaring_bitmap_test[1]_tests.cmake")
+else()
+  add_test(roaring_bitmap_test_NOT_BUILT roaring_bitmap_test_NOT_BUILT)
+endif()
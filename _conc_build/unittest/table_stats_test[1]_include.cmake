@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_conc_build/unittest/table_stats_test[1]_tests.cmake")
+  include("/root/repo/_conc_build/unittest/table_stats_test[1]_tests.cmake")
+else()
+  add_test(table_stats_test_NOT_BUILT table_stats_test_NOT_BUILT)
+endif()
@@ -150,15 +150,15 @@ public:
     }
   }
 
-  void Scan(uint32_t begin, uint32_t end, Stat &stat)
+  void Scan(uint32_t begin, uint32_t end, Stat &stat, bool reverse = false)
   {
     const char *begin_key = reinterpret_cast<const char *>(&begin);
     const char *end_key   = reinterpret_cast<const char *>(&end);
 
     BplusTreeScanner scanner(handler_);
 
-    RC rc =
-        scanner.open(begin_key, sizeof(begin_key), true /*inclusive*/, end_key, sizeof(end_key), true /*inclusive*/);
+    RC rc = scanner.open(
+        begin_key, sizeof(begin_key), true /*inclusive*/, end_key, sizeof(end_key), true /*inclusive*/, reverse);
     if (rc != RC::SUCCESS) {
       stat.scan_open_failed_count++;
     } else {
@@ -268,10 +268,10 @@ public:
   }
 };
 
-BENCHMARK_DEFINE_F(ScanBenchmark, Scan)(State &state)
+void ScanRandomRanges(ScanBenchmark &benchmark, State &state, bool reverse)
 {
   int              max_range_size = 100;
-  uint32_t         max            = GetRangeMax(state);
+  uint32_t         max            = benchmark.GetRangeMax(state);
   IntegerGenerator begin_generator(1, max - max_range_size);
   IntegerGenerator range_generator(1, max_range_size);
   Stat             stat;
@@ -279,7 +279,7 @@ BENCHMARK_DEFINE_F(ScanBenchmark, Scan)(State &state)
   for (auto _ : state) {
     uint32_t begin = static_cast<uint32_t>(begin_generator.next());
     uint32_t end   = begin + static_cast<uint32_t>(range_generator.next());
-    Scan(begin, end, stat);
+    benchmark.Scan(begin, end, stat, reverse);
   }
 
   state.counters["success"]               = Counter(stat.scan_success_count, Counter::kIsRate);
@@ -288,8 +288,14 @@ BENCHMARK_DEFINE_F(ScanBenchmark, Scan)(State &state)
   state.counters["other"]                 = Counter(stat.scan_other_count, Counter::kIsRate);
 }
 
+BENCHMARK_DEFINE_F(ScanBenchmark, Scan)(State &state) { ScanRandomRanges(*this, state, false /*reverse*/); }
+
 BENCHMARK_REGISTER_F(ScanBenchmark, Scan)->Threads(10)->Arg(4 * 10000);
 
+BENCHMARK_DEFINE_F(ScanBenchmark, ReverseScan)(State &state) { ScanRandomRanges(*this, state, true /*reverse*/); }
+
+BENCHMARK_REGISTER_F(ScanBenchmark, ReverseScan)->Threads(10)->Arg(4 * 10000);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 struct MixtureBenchmark : public BenchmarkBase
@@ -0,0 +1,105 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <atomic>
+
+#include "common/lang/bloom_filter.h"
+
+namespace common {
+
+void BlockedBloomFilter::init(size_t expected_keys)
+{
+  size_t block_count = (expected_keys * BITS_PER_KEY + BLOCK_BITS - 1) / BLOCK_BITS;
+  if (block_count == 0) {
+    block_count = 1;
+  }
+  blocks_.assign(block_count, Block{});
+}
+
+size_t BlockedBloomFilter::block_index(uint64_t hash) const
+{
+  // 用乘法代替取模，把高32位映射到[0, block_count)
+  return static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(blocks_.size())) >> 32);
+}
+
+void BlockedBloomFilter::add(uint64_t hash)
+{
+  if (blocks_.empty()) {
+    return;
+  }
+
+  Block &block = blocks_[block_index(hash)];
+  uint32_t h     = static_cast<uint32_t>(hash);
+  uint32_t delta = (h >> 17) | (h << 15);  // 双重哈希，参考 leveldb 的实现
+  for (int i = 0; i < PROBES; i++) {
+    const uint32_t bit = h % BLOCK_BITS;
+    std::atomic_ref<uint64_t>(block.words[bit / 64]).fetch_or(1ull << (bit % 64), std::memory_order_relaxed);
+    h += delta;
+  }
+}
+
+bool BlockedBloomFilter::may_contain(uint64_t hash) const
+{
+  if (blocks_.empty()) {
+    return true;
+  }
+
+  Block &block = const_cast<Block &>(blocks_[block_index(hash)]);
+  uint32_t h     = static_cast<uint32_t>(hash);
+  uint32_t delta = (h >> 17) | (h << 15);
+  for (int i = 0; i < PROBES; i++) {
+    const uint32_t bit = h % BLOCK_BITS;
+    const uint64_t word = std::atomic_ref<uint64_t>(block.words[bit / 64]).load(std::memory_order_relaxed);
+    if ((word & (1ull << (bit % 64))) == 0) {
+      return false;
+    }
+    h += delta;
+  }
+  return true;
+}
+
+void BlockedBloomFilter::serialize(std::string &buf) const
+{
+  buf.assign(reinterpret_cast<const char *>(blocks_.data()), blocks_.size() * sizeof(Block));
+}
+
+bool BlockedBloomFilter::deserialize(const char *buf, size_t size)
+{
+  if (size == 0 || size % sizeof(Block) != 0) {
+    return false;
+  }
+  blocks_.resize(size / sizeof(Block));
+  memcpy(blocks_.data(), buf, size);
+  return true;
+}
+
+uint64_t BlockedBloomFilter::hash_bytes(const void *data, size_t size)
+{
+  // FNV-1a，再用murmur3的64位finalizer打散，高位和低位都要用到
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  uint64_t hash = 14695981039346656037ull;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb53a1d2b2ca3ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace common
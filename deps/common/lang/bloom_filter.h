@@ -0,0 +1,86 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace common {
+
+/**
+ * @brief 分块的布隆过滤器(Blocked Bloom Filter)
+ * @details 位数组按照缓存行(64字节)分成多个块，一个值的所有探测位都在同一个块中，
+ * 查询最多访问一个缓存行。代价是误判率比普通的布隆过滤器略高。
+ * 值由调用者先计算好64位的哈希值，高32位选择块，低32位生成块内的探测位置。
+ * add 和 may_contain 可以并发调用，位数组使用原子操作修改。
+ */
+class BlockedBloomFilter
+{
+public:
+  static constexpr int BLOCK_BITS   = 512;  ///< 每个块的位数，正好一个缓存行
+  static constexpr int BITS_PER_KEY = 10;   ///< 每个值平均占用的位数，误判率大约1%
+  static constexpr int PROBES       = 7;    ///< 每个值在块中设置的位数
+
+public:
+  BlockedBloomFilter() = default;
+
+  /**
+   * @brief 按照预计的值的个数分配空间，原来的数据会被清空
+   */
+  void init(size_t expected_keys);
+
+  void add(uint64_t hash);
+
+  /**
+   * @return false 表示一定不存在，true 表示可能存在
+   */
+  bool may_contain(uint64_t hash) const;
+
+  /**
+   * @brief 可以容纳的值的个数，超过以后误判率会明显上升
+   */
+  size_t capacity() const { return blocks_.size() * BLOCK_BITS / BITS_PER_KEY; }
+  size_t block_count() const { return blocks_.size(); }
+
+  /**
+   * @brief 序列化的结果只是所有块的内容
+   */
+  void serialize(std::string &buf) const;
+
+  /**
+   * @return 数据的长度不是块大小的整数倍时返回false
+   */
+  bool deserialize(const char *buf, size_t size);
+
+  /**
+   * @brief 计算任意字节序列的64位哈希值
+   */
+  static uint64_t hash_bytes(const void *data, size_t size);
+
+private:
+  struct alignas(64) Block
+  {
+    uint64_t words[BLOCK_BITS / 64];
+  };
+
+  size_t block_index(uint64_t hash) const;
+
+private:
+  std::vector<Block> blocks_;
+};
+
+}  // namespace common
@@ -0,0 +1,371 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <algorithm>
+
+#include "common/lang/roaring_bitmap.h"
+
+namespace common {
+
+static constexpr int BITMAP_WORDS = RoaringContainer::CONTAINER_SIZE / 64;
+
+static int popcount_words(const std::vector<uint64_t> &words)
+{
+  int count = 0;
+  for (uint64_t word : words) {
+    count += __builtin_popcountll(word);
+  }
+  return count;
+}
+
+bool RoaringContainer::add(uint16_t value)
+{
+  if (type_ == Type::BITMAP) {
+    uint64_t &word = bitmap_[value / 64];
+    const uint64_t mask = 1ull << (value % 64);
+    if (word & mask) {
+      return false;
+    }
+    word |= mask;
+    cardinality_++;
+    return true;
+  }
+
+  auto iter = std::lower_bound(array_.begin(), array_.end(), value);
+  if (iter != array_.end() && *iter == value) {
+    return false;
+  }
+
+  if (cardinality_ >= ARRAY_MAX_SIZE) {
+    to_bitmap();
+    return add(value);
+  }
+
+  array_.insert(iter, value);
+  cardinality_++;
+  return true;
+}
+
+bool RoaringContainer::remove(uint16_t value)
+{
+  if (type_ == Type::BITMAP) {
+    uint64_t &word = bitmap_[value / 64];
+    const uint64_t mask = 1ull << (value % 64);
+    if (!(word & mask)) {
+      return false;
+    }
+    word &= ~mask;
+    cardinality_--;
+    if (cardinality_ <= ARRAY_MAX_SIZE) {
+      to_array();
+    }
+    return true;
+  }
+
+  auto iter = std::lower_bound(array_.begin(), array_.end(), value);
+  if (iter == array_.end() || *iter != value) {
+    return false;
+  }
+  array_.erase(iter);
+  cardinality_--;
+  return true;
+}
+
+bool RoaringContainer::contains(uint16_t value) const
+{
+  if (type_ == Type::BITMAP) {
+    return (bitmap_[value / 64] >> (value % 64)) & 1;
+  }
+  return std::binary_search(array_.begin(), array_.end(), value);
+}
+
+void RoaringContainer::and_with(const RoaringContainer &other)
+{
+  if (type_ == Type::BITMAP && other.type_ == Type::BITMAP) {
+    for (int i = 0; i < BITMAP_WORDS; i++) {
+      bitmap_[i] &= other.bitmap_[i];
+    }
+    cardinality_ = popcount_words(bitmap_);
+    if (cardinality_ <= ARRAY_MAX_SIZE) {
+      to_array();
+    }
+    return;
+  }
+
+  // 至少有一个是数组，结果一定可以用数组保存
+  std::vector<uint16_t> result;
+  if (type_ == Type::ARRAY && other.type_ == Type::ARRAY) {
+    std::set_intersection(
+        array_.begin(), array_.end(), other.array_.begin(), other.array_.end(), std::back_inserter(result));
+  } else {
+    const RoaringContainer &array_container = (type_ == Type::ARRAY) ? *this : other;
+    const RoaringContainer &bitmap_container = (type_ == Type::ARRAY) ? other : *this;
+    for (uint16_t value : array_container.array_) {
+      if (bitmap_container.contains(value)) {
+        result.push_back(value);
+      }
+    }
+  }
+
+  type_ = Type::ARRAY;
+  bitmap_.clear();
+  array_.swap(result);
+  cardinality_ = static_cast<int>(array_.size());
+}
+
+void RoaringContainer::or_with(const RoaringContainer &other)
+{
+  if (type_ == Type::ARRAY && other.type_ == Type::ARRAY &&
+      cardinality_ + other.cardinality_ <= ARRAY_MAX_SIZE) {
+    std::vector<uint16_t> result;
+    result.reserve(cardinality_ + other.cardinality_);
+    std::set_union(array_.begin(), array_.end(), other.array_.begin(), other.array_.end(), std::back_inserter(result));
+    array_.swap(result);
+    cardinality_ = static_cast<int>(array_.size());
+    return;
+  }
+
+  if (type_ == Type::ARRAY) {
+    to_bitmap();
+  }
+
+  if (other.type_ == Type::BITMAP) {
+    for (int i = 0; i < BITMAP_WORDS; i++) {
+      bitmap_[i] |= other.bitmap_[i];
+    }
+  } else {
+    for (uint16_t value : other.array_) {
+      bitmap_[value / 64] |= 1ull << (value % 64);
+    }
+  }
+
+  cardinality_ = popcount_words(bitmap_);
+  if (cardinality_ <= ARRAY_MAX_SIZE) {
+    to_array();
+  }
+}
+
+bool RoaringContainer::next(uint32_t &position, uint16_t &value) const
+{
+  if (type_ == Type::ARRAY) {
+    if (position >= array_.size()) {
+      return false;
+    }
+    value = array_[position++];
+    return true;
+  }
+
+  while (position < CONTAINER_SIZE) {
+    uint64_t word = bitmap_[position / 64] >> (position % 64);
+    if (word != 0) {
+      position += __builtin_ctzll(word);
+      value = static_cast<uint16_t>(position++);
+      return true;
+    }
+    position = (position / 64 + 1) * 64;
+  }
+  return false;
+}
+
+int RoaringContainer::serialized_size() const
+{
+  return type_ == Type::BITMAP ? CONTAINER_BYTES : cardinality_ * static_cast<int>(sizeof(uint16_t));
+}
+
+void RoaringContainer::serialize(char *buf) const
+{
+  if (type_ == Type::BITMAP) {
+    memcpy(buf, bitmap_.data(), CONTAINER_BYTES);
+  } else {
+    memcpy(buf, array_.data(), cardinality_ * sizeof(uint16_t));
+  }
+}
+
+void RoaringContainer::deserialize(Type type, int cardinality, const char *buf)
+{
+  type_ = type;
+  cardinality_ = cardinality;
+  if (type_ == Type::BITMAP) {
+    array_.clear();
+    bitmap_.resize(BITMAP_WORDS);
+    memcpy(bitmap_.data(), buf, CONTAINER_BYTES);
+  } else {
+    bitmap_.clear();
+    array_.resize(cardinality);
+    memcpy(array_.data(), buf, cardinality * sizeof(uint16_t));
+  }
+}
+
+void RoaringContainer::to_bitmap()
+{
+  bitmap_.assign(BITMAP_WORDS, 0);
+  for (uint16_t value : array_) {
+    bitmap_[value / 64] |= 1ull << (value % 64);
+  }
+  array_.clear();
+  array_.shrink_to_fit();
+  type_ = Type::BITMAP;
+}
+
+void RoaringContainer::to_array()
+{
+  array_.clear();
+  array_.reserve(cardinality_);
+  uint32_t position = 0;
+  uint16_t value = 0;
+  while (next(position, value)) {
+    array_.push_back(value);
+  }
+  bitmap_.clear();
+  bitmap_.shrink_to_fit();
+  type_ = Type::ARRAY;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+size_t RoaringBitmap::lower_bound(uint32_t key) const
+{
+  return std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin();
+}
+
+bool RoaringBitmap::add(uint32_t value)
+{
+  const uint32_t key = container_key(value);
+  const size_t index = lower_bound(key);
+  if (index == keys_.size() || keys_[index] != key) {
+    keys_.insert(keys_.begin() + index, key);
+    containers_.insert(containers_.begin() + index, RoaringContainer());
+  }
+  return containers_[index].add(container_value(value));
+}
+
+bool RoaringBitmap::remove(uint32_t value)
+{
+  const uint32_t key = container_key(value);
+  const size_t index = lower_bound(key);
+  if (index == keys_.size() || keys_[index] != key) {
+    return false;
+  }
+
+  bool removed = containers_[index].remove(container_value(value));
+  if (containers_[index].empty()) {
+    keys_.erase(keys_.begin() + index);
+    containers_.erase(containers_.begin() + index);
+  }
+  return removed;
+}
+
+bool RoaringBitmap::contains(uint32_t value) const
+{
+  const uint32_t key = container_key(value);
+  const size_t index = lower_bound(key);
+  if (index == keys_.size() || keys_[index] != key) {
+    return false;
+  }
+  return containers_[index].contains(container_value(value));
+}
+
+uint64_t RoaringBitmap::cardinality() const
+{
+  uint64_t count = 0;
+  for (const RoaringContainer &container : containers_) {
+    count += container.cardinality();
+  }
+  return count;
+}
+
+void RoaringBitmap::clear()
+{
+  keys_.clear();
+  containers_.clear();
+}
+
+void RoaringBitmap::and_with(const RoaringBitmap &other)
+{
+  std::vector<uint32_t> keys;
+  std::vector<RoaringContainer> containers;
+  size_t i = 0, j = 0;
+  while (i < keys_.size() && j < other.keys_.size()) {
+    if (keys_[i] < other.keys_[j]) {
+      i++;
+    } else if (keys_[i] > other.keys_[j]) {
+      j++;
+    } else {
+      containers_[i].and_with(other.containers_[j]);
+      if (!containers_[i].empty()) {
+        keys.push_back(keys_[i]);
+        containers.push_back(std::move(containers_[i]));
+      }
+      i++;
+      j++;
+    }
+  }
+  keys_.swap(keys);
+  containers_.swap(containers);
+}
+
+void RoaringBitmap::or_with(const RoaringBitmap &other)
+{
+  std::vector<uint32_t> keys;
+  std::vector<RoaringContainer> containers;
+  keys.reserve(keys_.size() + other.keys_.size());
+  containers.reserve(keys_.size() + other.keys_.size());
+
+  size_t i = 0, j = 0;
+  while (i < keys_.size() || j < other.keys_.size()) {
+    if (j == other.keys_.size() || (i < keys_.size() && keys_[i] < other.keys_[j])) {
+      keys.push_back(keys_[i]);
+      containers.push_back(std::move(containers_[i]));
+      i++;
+    } else if (i == keys_.size() || keys_[i] > other.keys_[j]) {
+      keys.push_back(other.keys_[j]);
+      containers.push_back(other.containers_[j]);
+      j++;
+    } else {
+      containers_[i].or_with(other.containers_[j]);
+      keys.push_back(keys_[i]);
+      containers.push_back(std::move(containers_[i]));
+      i++;
+      j++;
+    }
+  }
+  keys_.swap(keys);
+  containers_.swap(containers);
+}
+
+void RoaringBitmap::append_container(uint32_t key, RoaringContainer &&container)
+{
+  if (container.empty()) {
+    return;
+  }
+  keys_.push_back(key);
+  containers_.push_back(std::move(container));
+}
+
+bool RoaringBitmap::Iterator::next(uint32_t &value)
+{
+  while (container_index_ < bitmap_.containers_.size()) {
+    uint16_t low = 0;
+    if (bitmap_.containers_[container_index_].next(position_, low)) {
+      value = (bitmap_.keys_[container_index_] << RoaringContainer::CONTAINER_BITS) | low;
+      return true;
+    }
+    container_index_++;
+    position_ = 0;
+  }
+  return false;
+}
+
+}  // namespace common
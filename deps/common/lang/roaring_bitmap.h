@@ -0,0 +1,165 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace common {
+
+/**
+ * @brief 压缩位图(Roaring Bitmap)中的一个容器
+ * @details 管理 2^CONTAINER_BITS 个值，值比较少的时候使用有序数组保存，多了以后使用位图。
+ * 两种格式占用空间相同时转换，所以一个容器最多占用 CONTAINER_BYTES 字节。
+ */
+class RoaringContainer
+{
+public:
+  static constexpr int      CONTAINER_BITS  = 15;
+  static constexpr uint32_t CONTAINER_SIZE  = 1u << CONTAINER_BITS;          ///< 容器可以容纳的值的个数
+  static constexpr int      CONTAINER_BYTES = CONTAINER_SIZE / 8;            ///< 位图格式占用的字节数，4KB
+  static constexpr int      ARRAY_MAX_SIZE  = CONTAINER_BYTES / sizeof(uint16_t);  ///< 数组格式最多存放的值
+
+  enum class Type : uint16_t
+  {
+    ARRAY,
+    BITMAP,
+  };
+
+public:
+  RoaringContainer() = default;
+
+  Type type() const { return type_; }
+  int  cardinality() const { return cardinality_; }
+  bool empty() const { return cardinality_ == 0; }
+
+  /**
+   * @return 值已经存在时返回false
+   */
+  bool add(uint16_t value);
+
+  /**
+   * @return 值不存在时返回false
+   */
+  bool remove(uint16_t value);
+  bool contains(uint16_t value) const;
+
+  void and_with(const RoaringContainer &other);
+  void or_with(const RoaringContainer &other);
+
+  /**
+   * @brief 从position开始查找下一个值
+   * @param[in,out] position 遍历的位置。数组格式时是数组下标，位图格式时是值本身
+   * @return 没有更多的值时返回false
+   */
+  bool next(uint32_t &position, uint16_t &value) const;
+
+  /**
+   * @brief 序列化后的大小
+   */
+  int serialized_size() const;
+
+  /**
+   * @brief 序列化到buf中，buf的大小不能小于 serialized_size
+   */
+  void serialize(char *buf) const;
+
+  /**
+   * @brief 从 serialize 的结果中恢复数据
+   * @param cardinality 值的个数，序列化的数据中不包含这个信息
+   */
+  void deserialize(Type type, int cardinality, const char *buf);
+
+private:
+  void to_bitmap();
+  void to_array();
+
+private:
+  Type                  type_        = Type::ARRAY;
+  int                   cardinality_ = 0;
+  std::vector<uint16_t> array_;   ///< 数组格式，有序
+  std::vector<uint64_t> bitmap_;  ///< 位图格式
+};
+
+/**
+ * @brief 压缩位图
+ * @details 参考 Roaring Bitmap。32位的值按照高位分成多个容器，每个容器使用数组或者位图保存低位，
+ * 稀疏的数据和稠密的数据都可以高效地保存，交集、并集运算按照容器进行。
+ * 为了让位图格式的容器可以放在一个页面中，每个容器只管理 2^15 个值，不是原版的 2^16 个。
+ */
+class RoaringBitmap
+{
+public:
+  RoaringBitmap() = default;
+
+  bool     add(uint32_t value);
+  bool     remove(uint32_t value);
+  bool     contains(uint32_t value) const;
+  uint64_t cardinality() const;
+  bool     empty() const { return containers_.empty(); }
+  void     clear();
+
+  /**
+   * @brief 求交集，结果保存在当前对象中
+   */
+  void and_with(const RoaringBitmap &other);
+
+  /**
+   * @brief 求并集，结果保存在当前对象中
+   */
+  void or_with(const RoaringBitmap &other);
+
+  /**
+   * @brief 追加一个容器，容器的key必须比已有的都大
+   * @details 用于从磁盘加载数据
+   */
+  void append_container(uint32_t key, RoaringContainer &&container);
+
+  static uint32_t container_key(uint32_t value) { return value >> RoaringContainer::CONTAINER_BITS; }
+  static uint16_t container_value(uint32_t value)
+  {
+    return static_cast<uint16_t>(value & (RoaringContainer::CONTAINER_SIZE - 1));
+  }
+
+public:
+  /**
+   * @brief 按照从小到大的顺序遍历所有的值
+   */
+  class Iterator
+  {
+  public:
+    explicit Iterator(const RoaringBitmap &bitmap) : bitmap_(bitmap) {}
+
+    bool next(uint32_t &value);
+
+  private:
+    const RoaringBitmap &bitmap_;
+    size_t               container_index_ = 0;
+    uint32_t             position_        = 0;
+  };
+
+private:
+  /**
+   * @brief 查找key对应的容器的下标，没有找到时返回可以插入的位置
+   */
+  size_t lower_bound(uint32_t key) const;
+
+private:
+  std::vector<uint32_t>         keys_;        ///< 容器的key(值的高位)，有序
+  std::vector<RoaringContainer> containers_;  ///< 与keys_一一对应，不会有空的容器
+};
+
+}  // namespace common
@@ -0,0 +1,67 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <math.h>
+#include <algorithm>
+
+#include "common/math/hyperloglog.h"
+
+namespace common {
+
+HyperLogLog::HyperLogLog(int precision) : precision_(std::clamp(precision, 4, 18)), registers_(1 << precision_, 0)
+{}
+
+void HyperLogLog::add(uint64_t hash)
+{
+  const uint64_t index = hash >> (64 - precision_);
+  // 剩下的位中第一个1的位置，从1开始。最低位补1，全是0时不会越界
+  const uint64_t rest = (hash << precision_) | (1ull << (precision_ - 1));
+  const uint8_t  rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+  if (rank > registers_[index]) {
+    registers_[index] = rank;
+  }
+}
+
+void HyperLogLog::merge(const HyperLogLog &other)
+{
+  if (other.precision_ != precision_) {
+    return;
+  }
+  for (size_t i = 0; i < registers_.size(); i++) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+}
+
+double HyperLogLog::estimate() const
+{
+  const double m = static_cast<double>(registers_.size());
+  double sum = 0;
+  int zero_count = 0;
+  for (uint8_t reg : registers_) {
+    sum += ldexp(1.0, -reg);
+    if (reg == 0) {
+      zero_count++;
+    }
+  }
+
+  const double alpha = 0.7213 / (1 + 1.079 / m);
+  const double raw_estimate = alpha * m * m / sum;
+  // 值比较少时原始估算的偏差很大，还有空的寄存器时改用线性计数
+  if (raw_estimate <= 2.5 * m && zero_count > 0) {
+    return m * log(m / zero_count);
+  }
+  return raw_estimate;
+}
+
+}  // namespace common
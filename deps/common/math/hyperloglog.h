@@ -0,0 +1,55 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace common {
+
+/**
+ * @brief HyperLogLog，估算不同值的个数
+ * @details 64位哈希值的高 precision 位选择一个寄存器，寄存器中记录剩余位中第一个1出现位置的最大值。
+ * 使用 2^precision 个字节的内存，标准误差大约是 1.04/sqrt(2^precision)。
+ * 值比较少时使用线性计数(linear counting)修正。值由调用者先计算好64位的哈希值。
+ */
+class HyperLogLog
+{
+public:
+  static constexpr int DEFAULT_PRECISION = 12;  ///< 4096个寄存器，误差大约1.6%
+
+public:
+  explicit HyperLogLog(int precision = DEFAULT_PRECISION);
+
+  void add(uint64_t hash);
+
+  /**
+   * @brief 合并另一个精度相同的HyperLogLog，结果相当于两边的值都加到了这里
+   */
+  void merge(const HyperLogLog &other);
+
+  /**
+   * @brief 估算不同值的个数
+   */
+  double estimate() const;
+
+  int precision() const { return precision_; }
+
+private:
+  int                  precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace common
@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 #include "net/plain_communicator.h"
 #include "net/buffered_writer.h"
 #include "sql/expr/tuple.h"
+#include "sql/expr/chunk.h"
 #include "event/session_event.h"
 #include "session/session.h"
 #include "common/io/io.h"
@@ -165,6 +166,26 @@ RC PlainCommunicator::write_result(SessionEvent *event, bool &need_disconnect)
   return rc;
 }
 
+RC PlainCommunicator::write_cell(int index, const Value &value)
+{
+  RC rc = RC::SUCCESS;
+  if (index != 0) {
+    const char *delim = " | ";
+    rc = writer_->writen(delim, strlen(delim));
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to send data to client. err=%s", strerror(errno));
+      return rc;
+    }
+  }
+
+  std::string cell_str = value.to_string();
+  rc = writer_->writen(cell_str.data(), cell_str.size());
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to send data to client. err=%s", strerror(errno));
+  }
+  return rc;
+}
+
 RC PlainCommunicator::write_result_internal(SessionEvent *event, bool &need_disconnect)
 {
   RC rc = RC::SUCCESS;
@@ -220,45 +241,57 @@ RC PlainCommunicator::write_result_internal(SessionEvent *event, bool &need_disc
   }
 
   rc = RC::SUCCESS;
-  Tuple *tuple = nullptr;
-  while (RC::SUCCESS == (rc = sql_result->next_tuple(tuple))) {
-    assert(tuple != nullptr);
+  const char newline = '\n';
+  Value value;
+  if (sql_result->support_chunk()) {
+    // 按批获取数据，减少每一行的虚函数调用
+    Chunk chunk;
+    while (RC::SUCCESS == (rc = sql_result->next_chunk(chunk))) {
+      for (int row : chunk.selection()) {
+        for (int i = 0; i < chunk.column_num(); i++) {
+          chunk.column(i).get_value(row, value);
+          rc = write_cell(i, value);
+          if (OB_FAIL(rc)) {
+            sql_result->close();
+            return rc;
+          }
+        }
 
-    int cell_num = tuple->cell_num();
-    for (int i = 0; i < cell_num; i++) {
-      if (i != 0) {
-        const char *delim = " | ";
-        rc = writer_->writen(delim, strlen(delim));
+        rc = writer_->writen(&newline, 1);
         if (OB_FAIL(rc)) {
           LOG_WARN("failed to send data to client. err=%s", strerror(errno));
           sql_result->close();
           return rc;
         }
       }
+    }
+  } else {
+    Tuple *tuple = nullptr;
+    while (RC::SUCCESS == (rc = sql_result->next_tuple(tuple))) {
+      assert(tuple != nullptr);
+
+      int cell_num = tuple->cell_num();
+      for (int i = 0; i < cell_num; i++) {
+        rc = tuple->cell_at(i, value);
+        if (rc != RC::SUCCESS) {
+          sql_result->close();
+          return rc;
+        }
 
-      Value value;
-      rc = tuple->cell_at(i, value);
-      if (rc != RC::SUCCESS) {
-        sql_result->close();
-        return rc;
+        rc = write_cell(i, value);
+        if (OB_FAIL(rc)) {
+          sql_result->close();
+          return rc;
+        }
       }
 
-      std::string cell_str = value.to_string();
-      rc = writer_->writen(cell_str.data(), cell_str.size());
+      rc = writer_->writen(&newline, 1);
       if (OB_FAIL(rc)) {
         LOG_WARN("failed to send data to client. err=%s", strerror(errno));
         sql_result->close();
         return rc;
       }
     }
-
-    char newline = '\n';
-    rc = writer_->writen(&newline, 1);
-    if (OB_FAIL(rc)) {
-      LOG_WARN("failed to send data to client. err=%s", strerror(errno));
-      sql_result->close();
-      return rc;
-    }
   }
 
   if (rc == RC::RECORD_EOF) {
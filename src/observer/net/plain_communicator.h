@@ -18,6 +18,8 @@ See the Mulan PSL v2 for more details. */
 
 #include "net/communicator.h"
 
+class Value;
+
 /**
  * @brief 与客户端进行通讯
  * @ingroup Communicator
@@ -37,6 +39,11 @@ private:
   RC write_debug(SessionEvent *event, bool &need_disconnect);
   RC write_result_internal(SessionEvent *event, bool &need_disconnect);
 
+  /**
+   * @brief 写一行中的一个值，不是第一个值时先写分隔符
+   */
+  RC write_cell(int index, const Value &value);
+
 protected:
   std::vector<char> send_message_delimiter_; ///< 发送消息分隔符
   std::vector<char> debug_message_prefix_; ///< 调试信息前缀
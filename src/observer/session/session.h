@@ -26,6 +26,9 @@ class SessionEvent;
  */
 class Session 
 {
+public:
+  static constexpr int MAX_PARALLEL_DEGREE = 64;
+
 public:
   /**
    * @brief 获取默认的会话数据，新生成的会话都基于默认会话设置参数
@@ -79,6 +82,13 @@ public:
   void set_sql_debug(bool sql_debug) { sql_debug_ = sql_debug; }
   bool sql_debug_on() const { return sql_debug_; }
 
+  /**
+   * @brief 查询的并行度，即一个查询最多使用多少个工作线程执行
+   * @details 为1时查询完全在处理当前会话的线程中执行
+   */
+  void set_parallel_degree(int parallel_degree) { parallel_degree_ = parallel_degree; }
+  int  parallel_degree() const { return parallel_degree_; }
+
   /**
    * @brief 将指定会话设置到线程变量中
    * 
@@ -97,4 +107,5 @@ private:
   SessionEvent *current_request_ = nullptr; ///< 当前正在处理的请求
   bool trx_multi_operation_mode_ = false;   ///< 当前事务的模式，是否多语句模式. 单语句模式自动提交
   bool sql_debug_ = false;                  ///< 是否输出SQL调试信息
+  int parallel_degree_ = 1;                 ///< 查询的并行度
 };
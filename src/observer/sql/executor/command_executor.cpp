@@ -18,6 +18,8 @@ See the Mulan PSL v2 for more details. */
 #include "sql/executor/create_index_executor.h"
 #include "sql/executor/create_table_executor.h"
 #include "sql/executor/desc_table_executor.h"
+#include "sql/executor/analyze_table_executor.h"
+#include "sql/executor/show_stats_executor.h"
 #include "sql/executor/help_executor.h"
 #include "sql/executor/show_tables_executor.h"
 #include "sql/executor/trx_begin_executor.h"
@@ -46,6 +48,16 @@ RC CommandExecutor::execute(SQLStageEvent *sql_event)
       return executor.execute(sql_event);
     }
 
+    case StmtType::ANALYZE_TABLE: {
+      AnalyzeTableExecutor executor;
+      return executor.execute(sql_event);
+    }
+
+    case StmtType::SHOW_STATS: {
+      ShowStatsExecutor executor;
+      return executor.execute(sql_event);
+    }
+
     case StmtType::HELP: {
       HelpExecutor executor;
       return executor.execute(sql_event);
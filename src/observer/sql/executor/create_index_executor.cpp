@@ -19,6 +19,7 @@ See the Mulan PSL v2 for more details. */
 #include "session/session.h"
 #include "common/log/log.h"
 #include "storage/table/table.h"
+#include "storage/trx/trx.h"
 
 RC CreateIndexExecutor::execute(SQLStageEvent *sql_event)
 {
@@ -29,7 +30,26 @@ RC CreateIndexExecutor::execute(SQLStageEvent *sql_event)
 
   CreateIndexStmt *create_index_stmt = static_cast<CreateIndexStmt *>(stmt);
   
+  // 创建索引时扫描表中所有的数据，不会阻塞其它事务的修改。唯一索引检查冲突时使用事务判断记录是否已经删除，
+  // 事务没有启动时事务号还是上一个事务的
   Trx *trx = session->current_trx();
+  RC rc = trx->start_if_need();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to start trx. rc=%s", strrc(rc));
+    return rc;
+  }
+
   Table *table = create_index_stmt->table();
-  return table->create_index(trx, create_index_stmt->field_meta(), create_index_stmt->index_name().c_str());
+  rc = table->create_index(trx, create_index_stmt->field_meta(), create_index_stmt->index_name().c_str(),
+                           create_index_stmt->unique(), create_index_stmt->index_type(),
+                           create_index_stmt->bloom_filter(), create_index_stmt->predicates());
+
+  // 创建索引没有修改表中的数据，这里只是结束事务
+  if (!session->is_trx_multi_operation_mode()) {
+    RC rc2 = trx->commit();
+    if (rc2 != RC::SUCCESS) {
+      LOG_WARN("failed to commit trx. rc=%s", strrc(rc2));
+    }
+  }
+  return rc;
 }
\ No newline at end of file
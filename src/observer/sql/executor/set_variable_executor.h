@@ -49,6 +49,15 @@ public:
 
       session->set_sql_debug(bool_value);
       LOG_TRACE("set sql_debug to %d", bool_value);
+    } else if (strcasecmp(var_name, "parallel_degree") == 0) {
+      if (var_value.attr_type() != AttrType::INTS || var_value.get_int() < 1 ||
+          var_value.get_int() > Session::MAX_PARALLEL_DEGREE) {
+        LOG_WARN("invalid parallel degree. value=%s, max=%d", var_value.to_string().c_str(), Session::MAX_PARALLEL_DEGREE);
+        return RC::VARIABLE_NOT_VALID;
+      }
+
+      session->set_parallel_degree(var_value.get_int());
+      LOG_TRACE("set parallel_degree to %d", var_value.get_int());
     } else {
       rc = RC::VARIABLE_NOT_EXISTS;
     }
@@ -0,0 +1,71 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+
+#include <iomanip>
+#include <sstream>
+
+#include "sql/executor/show_stats_executor.h"
+#include "sql/stmt/show_stats_stmt.h"
+#include "sql/operator/string_list_physical_operator.h"
+#include "event/sql_event.h"
+#include "event/session_event.h"
+#include "common/log/log.h"
+#include "storage/table/table.h"
+
+using namespace std;
+
+RC ShowStatsExecutor::execute(SQLStageEvent *sql_event)
+{
+  Stmt *stmt = sql_event->stmt();
+  ASSERT(stmt->type() == StmtType::SHOW_STATS,
+         "show stats executor can not run this command: %d", static_cast<int>(stmt->type()));
+
+  ShowStatsStmt *show_stats_stmt = static_cast<ShowStatsStmt *>(stmt);
+  SqlResult *sql_result = sql_event->session_event()->sql_result();
+
+  TupleSchema tuple_schema;
+  for (const char *name : {"Field", "Rows", "Pages", "Distinct", "Null_Fraction", "Histogram"}) {
+    tuple_schema.append_cell(TupleCellSpec("", name, name));
+  }
+  sql_result->set_tuple_schema(tuple_schema);
+
+  auto oper = new StringListPhysicalOperator;
+  const TableStats &stats = show_stats_stmt->table()->table_meta().stats();
+  if (stats.analyzed()) {
+    for (const ColumnStats &column : stats.columns()) {
+      ostringstream null_fraction;
+      null_fraction << fixed << setprecision(4) << column.null_fraction();
+
+      // 直方图只输出桶的边界
+      string histogram;
+      for (size_t i = 0; i < column.bounds().size(); i++) {
+        if (i > 0) {
+          histogram += ",";
+        }
+        histogram += column.bounds()[i].to_string();
+      }
+
+      oper->append({column.field_name(),
+          to_string(stats.row_count()),
+          to_string(stats.page_count()),
+          to_string(column.distinct_count()),
+          null_fraction.str(),
+          histogram});
+    }
+  }
+
+  sql_result->set_operator(unique_ptr<PhysicalOperator>(oper));
+  return RC::SUCCESS;
+}
@@ -73,6 +73,11 @@ RC SqlResult::next_tuple(Tuple *&tuple)
   return rc;
 }
 
+RC SqlResult::next_chunk(Chunk &chunk)
+{
+  return operator_->next_chunk(chunk);
+}
+
 void SqlResult::set_operator(std::unique_ptr<PhysicalOperator> oper)
 {
   ASSERT(operator_ == nullptr, "current operator is not null. Result is not closed?");
@@ -69,6 +69,12 @@ public:
   RC close();
   RC next_tuple(Tuple *&tuple);
 
+  /**
+   * @brief 执行计划是否可以按批返回数据，参考 PhysicalOperator::support_chunk
+   */
+  bool support_chunk() const { return operator_ != nullptr && operator_->support_chunk(); }
+  RC next_chunk(Chunk &chunk);
+
 private:
   Session *session_ = nullptr; ///< 当前所属会话
   std::unique_ptr<PhysicalOperator> operator_;  ///< 执行计划
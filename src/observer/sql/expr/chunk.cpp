@@ -0,0 +1,113 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <algorithm>
+
+#include "sql/expr/chunk.h"
+
+using namespace std;
+
+Column::Column(const char *table_name, const char *field_name, AttrType attr_type, int attr_len, int capacity)
+    : table_name_(table_name != nullptr ? table_name : ""),
+      field_name_(field_name != nullptr ? field_name : ""),
+      attr_type_(attr_type),
+      attr_len_(attr_len)
+{
+  data_.reserve(static_cast<size_t>(capacity) * attr_len);
+}
+
+void Column::append(const char *data, int len)
+{
+  const size_t offset = static_cast<size_t>(count_) * attr_len_;
+  data_.resize(offset + attr_len_);
+  const int copy_len = std::min(len, attr_len_);
+  memcpy(data_.data() + offset, data, copy_len);
+  if (copy_len < attr_len_) {
+    memset(data_.data() + offset + copy_len, 0, attr_len_ - copy_len);
+  }
+  count_++;
+}
+
+void Column::append_value(const Value &value)
+{
+  if (value.length() > attr_len_) {
+    resize_attr_len(value.length());
+  }
+  append(value.data(), value.length());
+}
+
+void Column::get_value(int row, Value &value) const
+{
+  value.set_type(attr_type_);
+  value.set_data(data_at(row), attr_len_);
+}
+
+void Column::resize_attr_len(int attr_len)
+{
+  vector<char> data(static_cast<size_t>(count_) * attr_len, 0);
+  for (int i = 0; i < count_; i++) {
+    memcpy(data.data() + static_cast<size_t>(i) * attr_len, data_at(i), attr_len_);
+  }
+  data_.swap(data);
+  attr_len_ = attr_len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void Chunk::reset()
+{
+  columns_.clear();
+  selection_.clear();
+  rows_ = 0;
+}
+
+Column &Chunk::add_column(const char *table_name, const char *field_name, AttrType attr_type, int attr_len)
+{
+  columns_.emplace_back(table_name, field_name, attr_type, attr_len, capacity_);
+  return columns_.back();
+}
+
+void Chunk::add_column(Column &&column)
+{
+  columns_.emplace_back(std::move(column));
+}
+
+int Chunk::find_column(const char *table_name, const char *field_name) const
+{
+  for (size_t i = 0; i < columns_.size(); i++) {
+    const Column &column = columns_[i];
+    if (0 == strcmp(column.field_name(), field_name) && 0 == strcmp(column.table_name(), table_name)) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+void Chunk::set_rows(int rows)
+{
+  rows_ = rows;
+  selection_.resize(rows);
+  for (int i = 0; i < rows; i++) {
+    selection_[i] = i;
+  }
+}
+
+void Chunk::swap(Chunk &other)
+{
+  std::swap(capacity_, other.capacity_);
+  std::swap(rows_, other.rows_);
+  columns_.swap(other.columns_);
+  selection_.swap(other.selection_);
+}
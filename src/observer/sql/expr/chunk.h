@@ -0,0 +1,171 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/expr/tuple.h"
+#include "sql/parser/value.h"
+
+/**
+ * @brief 一列数据
+ * @ingroup Tuple
+ * @details 每个值占用固定的长度，连续存放。字符串不足的部分补0。
+ */
+class Column
+{
+public:
+  Column() = default;
+  Column(const char *table_name, const char *field_name, AttrType attr_type, int attr_len, int capacity);
+
+  const char *table_name() const { return table_name_.c_str(); }
+  const char *field_name() const { return field_name_.c_str(); }
+  AttrType    attr_type() const { return attr_type_; }
+  int         attr_len() const { return attr_len_; }
+  int         count() const { return count_; }
+
+  const char *data_at(int row) const { return data_.data() + static_cast<size_t>(row) * attr_len_; }
+
+  void append(const char *data, int len);
+
+  /**
+   * @brief 追加一个值。字符串比当前的长度长时，会把整列调整为更长的长度
+   */
+  void append_value(const Value &value);
+
+  void get_value(int row, Value &value) const;
+
+  void clear() { count_ = 0; }
+
+private:
+  void resize_attr_len(int attr_len);
+
+private:
+  std::string       table_name_;
+  std::string       field_name_;
+  AttrType          attr_type_ = UNDEFINED;
+  int               attr_len_ = 0;
+  int               count_ = 0;
+  std::vector<char> data_;
+};
+
+/**
+ * @brief 一批数据，按列存放
+ * @ingroup Tuple
+ * @details 批量执行时算子之间传递的数据。每列的行数相同，selection中是有效的行号(升序)，
+ * 过滤的时候只修改selection，不移动列中的数据。
+ * 表扫描产生的列带有表名和字段名，表达式根据它们找到对应的列。
+ */
+class Chunk
+{
+public:
+  static constexpr int DEFAULT_CAPACITY = 1024;
+
+public:
+  Chunk(int capacity = DEFAULT_CAPACITY) : capacity_(capacity) {}
+
+  int capacity() const { return capacity_; }
+
+  /**
+   * @brief 清空所有的列
+   */
+  void reset();
+
+  Column &add_column(const char *table_name, const char *field_name, AttrType attr_type, int attr_len);
+  void    add_column(Column &&column);
+
+  int           column_num() const { return static_cast<int>(columns_.size()); }
+  Column       &column(int index) { return columns_[index]; }
+  const Column &column(int index) const { return columns_[index]; }
+
+  /**
+   * @brief 根据表名和字段名查找列，找不到时返回-1
+   */
+  int find_column(const char *table_name, const char *field_name) const;
+
+  /**
+   * @brief 列中的数据追加完成以后调用，所有的行都有效
+   */
+  void set_rows(int rows);
+  int  rows() const { return rows_; }
+
+  /**
+   * @brief 有效的行数
+   */
+  int size() const { return static_cast<int>(selection_.size()); }
+
+  std::vector<int>       &selection() { return selection_; }
+  const std::vector<int> &selection() const { return selection_; }
+
+  /**
+   * @brief 与另一个Chunk交换所有的数据，不复制列中的数据
+   */
+  void swap(Chunk &other);
+
+private:
+  int                 capacity_ = DEFAULT_CAPACITY;
+  int                 rows_ = 0;
+  std::vector<Column> columns_;
+  std::vector<int>    selection_;
+};
+
+/**
+ * @brief Chunk中的一行，给不支持批量计算的表达式使用
+ * @ingroup Tuple
+ */
+class ChunkRowTuple : public Tuple
+{
+public:
+  ChunkRowTuple(const Chunk &chunk) : chunk_(chunk) {}
+  virtual ~ChunkRowTuple() = default;
+
+  void set_row(int row) { row_ = row; }
+
+  int cell_num() const override { return chunk_.column_num(); }
+
+  RC cell_at(int index, Value &cell) const override
+  {
+    if (index < 0 || index >= chunk_.column_num()) {
+      return RC::INVALID_ARGUMENT;
+    }
+    chunk_.column(index).get_value(row_, cell);
+    return RC::SUCCESS;
+  }
+
+  RC find_cell(const TupleCellSpec &spec, Value &cell) const override
+  {
+    const int index = chunk_.find_column(spec.table_name(), spec.field_name());
+    if (index < 0) {
+      return RC::NOTFOUND;
+    }
+    return cell_at(index, cell);
+  }
+
+  RC cell_spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= chunk_.column_num()) {
+      return RC::INVALID_ARGUMENT;
+    }
+    const Column &column = chunk_.column(index);
+    spec = TupleCellSpec(column.table_name(), column.field_name());
+    return RC::SUCCESS;
+  }
+
+private:
+  const Chunk &chunk_;
+  int          row_ = 0;
+};
@@ -12,22 +12,69 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/07/05.
 //
 
+#include <algorithm>
+#include <iterator>
+#include <strings.h>
+
 #include "sql/expr/expression.h"
 #include "sql/expr/tuple.h"
+#include "sql/expr/chunk.h"
+#include "common/lang/comparator.h"
 
 using namespace std;
 
+RC Expression::filter_chunk(const Chunk &chunk, vector<int> &selection) const
+{
+  ChunkRowTuple tuple(chunk);
+  Value value;
+  size_t count = 0;
+  for (int row : selection) {
+    tuple.set_row(row);
+    RC rc = get_value(tuple, value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    if (value.get_boolean()) {
+      selection[count++] = row;
+    }
+  }
+  selection.resize(count);
+  return RC::SUCCESS;
+}
+
+/**
+ * @brief 复制一个子表达式，子表达式可能为空
+ */
+static unique_ptr<Expression> copy_child(const unique_ptr<Expression> &child)
+{
+  return child ? child->copy() : nullptr;
+}
+
 RC FieldExpr::get_value(const Tuple &tuple, Value &value) const
 {
   return tuple.find_cell(TupleCellSpec(table_name(), field_name()), value);
 }
 
+unique_ptr<Expression> FieldExpr::copy() const
+{
+  auto expr = make_unique<FieldExpr>(field_);
+  expr->set_name(name());
+  return expr;
+}
+
 RC ValueExpr::get_value(const Tuple &tuple, Value &value) const
 {
   value = value_;
   return RC::SUCCESS;
 }
 
+unique_ptr<Expression> ValueExpr::copy() const
+{
+  auto expr = make_unique<ValueExpr>(value_);
+  expr->set_name(name());
+  return expr;
+}
+
 /////////////////////////////////////////////////////////////////////////////////
 CastExpr::CastExpr(unique_ptr<Expression> child, AttrType cast_type)
     : child_(std::move(child)), cast_type_(cast_type)
@@ -36,6 +83,13 @@ CastExpr::CastExpr(unique_ptr<Expression> child, AttrType cast_type)
 CastExpr::~CastExpr()
 {}
 
+unique_ptr<Expression> CastExpr::copy() const
+{
+  auto expr = make_unique<CastExpr>(copy_child(child_), cast_type_);
+  expr->set_name(name());
+  return expr;
+}
+
 RC CastExpr::cast(const Value &value, Value &cast_value) const
 {
   RC rc = RC::SUCCESS;
@@ -86,6 +140,13 @@ ComparisonExpr::ComparisonExpr(CompOp comp, unique_ptr<Expression> left, unique_
 ComparisonExpr::~ComparisonExpr()
 {}
 
+unique_ptr<Expression> ComparisonExpr::copy() const
+{
+  auto expr = make_unique<ComparisonExpr>(comp_, copy_child(left_), copy_child(right_));
+  expr->set_name(name());
+  return expr;
+}
+
 RC ComparisonExpr::compare_value(const Value &left, const Value &right, bool &result) const
 {
   RC rc = RC::SUCCESS;
@@ -164,11 +225,97 @@ RC ComparisonExpr::get_value(const Tuple &tuple, Value &value) const
   return rc;
 }
 
+/**
+ * @brief 在一列数据上过滤，compare返回列中的值与常量比较的结果
+ */
+template <typename Compare>
+static void filter_column(const Column &column, CompOp comp, vector<int> &selection, const Compare &compare)
+{
+  size_t count = 0;
+  for (int row : selection) {
+    const int cmp_result = compare(column.data_at(row));
+    bool result = false;
+    switch (comp) {
+      case EQUAL_TO: result = (0 == cmp_result); break;
+      case LESS_EQUAL: result = (cmp_result <= 0); break;
+      case NOT_EQUAL: result = (cmp_result != 0); break;
+      case LESS_THAN: result = (cmp_result < 0); break;
+      case GREAT_EQUAL: result = (cmp_result >= 0); break;
+      case GREAT_THAN: result = (cmp_result > 0); break;
+      default: break;
+    }
+    if (result) {
+      selection[count++] = row;
+    }
+  }
+  selection.resize(count);
+}
+
+RC ComparisonExpr::filter_chunk(const Chunk &chunk, vector<int> &selection) const
+{
+  const bool field_left = (left_->type() == ExprType::FIELD && right_->type() == ExprType::VALUE);
+  const bool field_right = (left_->type() == ExprType::VALUE && right_->type() == ExprType::FIELD);
+  if ((!field_left && !field_right) || comp_ > GREAT_THAN) {
+    return Expression::filter_chunk(chunk, selection);
+  }
+
+  const FieldExpr *field_expr = static_cast<const FieldExpr *>(field_left ? left_.get() : right_.get());
+  const Value &value = static_cast<const ValueExpr *>(field_left ? right_.get() : left_.get())->get_value();
+  const int index = chunk.find_column(field_expr->table_name(), field_expr->field_name());
+  if (index < 0 || chunk.column(index).attr_type() != value.attr_type()) {
+    return Expression::filter_chunk(chunk, selection);
+  }
+
+  // 与Value::compare的比较方式保持一致
+  const Column &column = chunk.column(index);
+  void *value_data = const_cast<char *>(value.data());
+  switch (value.attr_type()) {
+    case INTS: {
+      filter_column(column, comp_, selection, [field_left, value_data](const char *data) {
+        void *column_data = const_cast<char *>(data);
+        return field_left ? common::compare_int(column_data, value_data) : common::compare_int(value_data, column_data);
+      });
+    } break;
+    case FLOATS: {
+      filter_column(column, comp_, selection, [field_left, value_data](const char *data) {
+        void *column_data = const_cast<char *>(data);
+        return field_left ? common::compare_float(column_data, value_data)
+                          : common::compare_float(value_data, column_data);
+      });
+    } break;
+    case CHARS: {
+      const int value_len = value.length();
+      const int attr_len = column.attr_len();
+      filter_column(column, comp_, selection, [field_left, value_data, value_len, attr_len](const char *data) {
+        void *column_data = const_cast<char *>(data);
+        const int column_len = static_cast<int>(strnlen(data, attr_len));
+        return field_left ? common::compare_string(column_data, column_len, value_data, value_len)
+                          : common::compare_string(value_data, value_len, column_data, column_len);
+      });
+    } break;
+    default: {
+      return Expression::filter_chunk(chunk, selection);
+    }
+  }
+  return RC::SUCCESS;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ConjunctionExpr::ConjunctionExpr(Type type, vector<unique_ptr<Expression>> &children)
     : conjunction_type_(type), children_(std::move(children))
 {}
 
+unique_ptr<Expression> ConjunctionExpr::copy() const
+{
+  vector<unique_ptr<Expression>> children;
+  for (const unique_ptr<Expression> &child : children_) {
+    children.emplace_back(copy_child(child));
+  }
+  auto expr = make_unique<ConjunctionExpr>(conjunction_type_, children);
+  expr->set_name(name());
+  return expr;
+}
+
 RC ConjunctionExpr::get_value(const Tuple &tuple, Value &value) const
 {
   RC rc = RC::SUCCESS;
@@ -196,6 +343,53 @@ RC ConjunctionExpr::get_value(const Tuple &tuple, Value &value) const
   return rc;
 }
 
+RC ConjunctionExpr::filter_chunk(const Chunk &chunk, vector<int> &selection) const
+{
+  RC rc = RC::SUCCESS;
+  if (children_.empty()) {
+    return rc;
+  }
+
+  if (conjunction_type_ == Type::AND) {
+    for (const unique_ptr<Expression> &expr : children_) {
+      if (selection.empty()) {
+        break;
+      }
+      rc = expr->filter_chunk(chunk, selection);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+    return rc;
+  }
+
+  // OR: 每个子表达式只计算还没有满足条件的行，最后合并所有满足条件的行
+  vector<int> remain = selection;
+  vector<int> matched;
+  vector<int> child_selection;
+  vector<int> merged;
+  for (const unique_ptr<Expression> &expr : children_) {
+    if (remain.empty()) {
+      break;
+    }
+    child_selection = remain;
+    rc = expr->filter_chunk(chunk, child_selection);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    merged.clear();
+    set_union(matched.begin(), matched.end(), child_selection.begin(), child_selection.end(), back_inserter(merged));
+    matched.swap(merged);
+
+    merged.clear();
+    set_difference(remain.begin(), remain.end(), child_selection.begin(), child_selection.end(), back_inserter(merged));
+    remain.swap(merged);
+  }
+  selection.swap(matched);
+  return rc;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 ArithmeticExpr::ArithmeticExpr(ArithmeticExpr::Type type, Expression *left, Expression *right)
@@ -205,6 +399,13 @@ ArithmeticExpr::ArithmeticExpr(ArithmeticExpr::Type type, unique_ptr<Expression>
     : arithmetic_type_(type), left_(std::move(left)), right_(std::move(right))
 {}
 
+unique_ptr<Expression> ArithmeticExpr::copy() const
+{
+  auto expr = make_unique<ArithmeticExpr>(arithmetic_type_, copy_child(left_), copy_child(right_));
+  expr->set_name(name());
+  return expr;
+}
+
 AttrType ArithmeticExpr::value_type() const
 {
   if (!right_) {
@@ -327,4 +528,55 @@ RC ArithmeticExpr::try_get_value(Value &value) const
   }
 
   return calc_value(left_value, right_value, value);
-}
\ No newline at end of file
+}
+////////////////////////////////////////////////////////////////////////////////
+
+AggregateExpr::AggregateExpr(Type type, unique_ptr<Expression> child)
+    : aggregate_type_(type), child_(std::move(child))
+{}
+
+unique_ptr<Expression> AggregateExpr::copy() const
+{
+  auto expr = make_unique<AggregateExpr>(aggregate_type_, copy_child(child_));
+  expr->set_name(name());
+  return expr;
+}
+
+AttrType AggregateExpr::value_type() const
+{
+  switch (aggregate_type_) {
+    case Type::CNT: return INTS;
+    case Type::AVG: return FLOATS;
+    default: return child_ ? child_->value_type() : UNDEFINED;
+  }
+}
+
+RC AggregateExpr::get_value(const Tuple &tuple, Value &value) const
+{
+  // 聚合算子输出的元组中，聚合函数的值没有表名，字段名就是聚合函数的名字
+  return tuple.find_cell(TupleCellSpec(nullptr, name().c_str()), value);
+}
+
+RC AggregateExpr::type_from_string(const char *name, Type &type)
+{
+  static const Type types[] = {Type::CNT, Type::SUM, Type::AVG, Type::MAX, Type::MIN};
+  for (Type candidate : types) {
+    if (0 == strcasecmp(name, type_name(candidate))) {
+      type = candidate;
+      return RC::SUCCESS;
+    }
+  }
+  return RC::INVALID_ARGUMENT;
+}
+
+const char *AggregateExpr::type_name(Type type)
+{
+  switch (type) {
+    case Type::CNT: return "count";
+    case Type::SUM: return "sum";
+    case Type::AVG: return "avg";
+    case Type::MAX: return "max";
+    case Type::MIN: return "min";
+  }
+  return "unknown";
+}
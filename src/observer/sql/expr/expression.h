@@ -17,12 +17,14 @@ See the Mulan PSL v2 for more details. */
 #include <string.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "storage/field/field.h"
 #include "sql/parser/value.h"
 #include "common/log/log.h"
 
 class Tuple;
+class Chunk;
 
 /**
  * @defgroup Expression
@@ -43,6 +45,7 @@ enum class ExprType
   COMPARISON,   ///< 需要做比较的表达式
   CONJUNCTION,  ///< 多个表达式使用同一种关系(AND或OR)来联结
   ARITHMETIC,   ///< 算术运算
+  AGGREGATION,  ///< 聚合函数
 };
 
 /**
@@ -67,6 +70,13 @@ public:
    */
   virtual RC get_value(const Tuple &tuple, Value &value) const = 0;
 
+  /**
+   * @brief 批量执行时使用的过滤，从selection中去掉表达式的值不是true的行
+   * @details 默认逐行计算表达式的值。比较和联结表达式会直接在列上计算
+   * @param selection chunk中要计算的行号，计算完成后只剩下满足条件的行号
+   */
+  virtual RC filter_chunk(const Chunk &chunk, std::vector<int> &selection) const;
+
   /**
    * @brief 在没有实际运行的情况下，也就是无法获取tuple的情况下，尝试获取表达式的值
    * @details 有些表达式的值是固定的，比如ValueExpr，这种情况下可以直接获取值
@@ -88,6 +98,12 @@ public:
    */
   virtual AttrType value_type() const = 0;
 
+  /**
+   * @brief 复制一个相同的表达式，名字也相同
+   * @details 并行执行时每个工作线程使用自己的一份表达式
+   */
+  virtual std::unique_ptr<Expression> copy() const = 0;
+
   /**
    * @brief 表达式的名字，比如是字段名称，或者用户在执行SQL语句时输入的内容
    */
@@ -115,6 +131,7 @@ public:
 
   ExprType type() const override { return ExprType::FIELD; }
   AttrType value_type() const override { return field_.attr_type(); }
+  std::unique_ptr<Expression> copy() const override;
 
   Field &field() { return field_; }
 
@@ -147,6 +164,7 @@ public:
   RC try_get_value(Value &value) const override { value = value_; return RC::SUCCESS; }
 
   ExprType type() const override { return ExprType::VALUE; }
+  std::unique_ptr<Expression> copy() const override;
 
   AttrType value_type() const override { return value_.attr_type(); }
 
@@ -177,6 +195,7 @@ public:
   RC try_get_value(Value &value) const override;
 
   AttrType value_type() const override { return cast_type_; }
+  std::unique_ptr<Expression> copy() const override;
 
   std::unique_ptr<Expression> &child() { return child_; }
 
@@ -199,9 +218,15 @@ public:
   virtual ~ComparisonExpr();
 
   ExprType type() const override { return ExprType::COMPARISON; }
+  std::unique_ptr<Expression> copy() const override;
 
   RC get_value(const Tuple &tuple, Value &value) const override;
 
+  /**
+   * @brief 字段与常量比较，并且类型相同时，直接比较列中的数据
+   */
+  RC filter_chunk(const Chunk &chunk, std::vector<int> &selection) const override;
+
   AttrType value_type() const override { return BOOLEANS; }
 
   CompOp comp() const { return comp_; }
@@ -246,10 +271,12 @@ public:
   virtual ~ConjunctionExpr() = default;
 
   ExprType type() const override { return ExprType::CONJUNCTION; }
+  std::unique_ptr<Expression> copy() const override;
 
   AttrType value_type() const override { return BOOLEANS; }
 
   RC get_value(const Tuple &tuple, Value &value) const override;
+  RC filter_chunk(const Chunk &chunk, std::vector<int> &selection) const override;
 
   Type conjunction_type() const { return conjunction_type_; }
 
@@ -281,6 +308,7 @@ public:
   virtual ~ArithmeticExpr() = default;
 
   ExprType type() const override { return ExprType::ARITHMETIC; }
+  std::unique_ptr<Expression> copy() const override;
 
   AttrType value_type() const override;
 
@@ -299,4 +327,53 @@ private:
   Type arithmetic_type_;
   std::unique_ptr<Expression> left_;
   std::unique_ptr<Expression> right_;
-};
\ No newline at end of file
+};
+/**
+ * @brief 聚合函数
+ * @ingroup Expression
+ * @details 聚合函数的值由聚合算子计算，放在聚合算子输出的元组中，这里按照名字从元组中取值。
+ * COUNT(*)没有参数，其它聚合函数的参数是一个表达式，当前只支持字段。
+ */
+class AggregateExpr : public Expression 
+{
+public:
+  enum class Type {
+    CNT,  ///< COUNT，seda_defs.h 中有名为COUNT的宏
+    SUM,
+    AVG,
+    MAX,
+    MIN,
+  };
+
+public:
+  /**
+   * @param child 聚合函数的参数，COUNT(*)时为空
+   */
+  AggregateExpr(Type type, std::unique_ptr<Expression> child);
+  virtual ~AggregateExpr() = default;
+
+  ExprType type() const override { return ExprType::AGGREGATION; }
+  std::unique_ptr<Expression> copy() const override;
+
+  /**
+   * @details COUNT是整数，AVG是浮点数，其它与参数的类型相同
+   */
+  AttrType value_type() const override;
+
+  RC get_value(const Tuple &tuple, Value &value) const override;
+
+  Type aggregate_type() const { return aggregate_type_; }
+
+  std::unique_ptr<Expression> &child() { return child_; }
+  const std::unique_ptr<Expression> &child() const { return child_; }
+
+  /**
+   * @brief 根据函数名(不区分大小写)获取聚合函数的类型
+   */
+  static RC type_from_string(const char *name, Type &type);
+  static const char *type_name(Type type);
+
+private:
+  Type aggregate_type_;
+  std::unique_ptr<Expression> child_;
+};
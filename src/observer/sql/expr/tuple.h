@@ -108,6 +108,15 @@ public:
    */
   virtual RC find_cell(const TupleCellSpec &spec, Value &cell) const = 0;
 
+  /**
+   * @brief 获取指定位置的Cell的描述
+   * @details 需要把元组复制保存下来的算子(比如hash join)，根据它生成复制后元组的schema
+   */
+  virtual RC cell_spec_at(int index, TupleCellSpec &spec) const
+  {
+    return RC::UNIMPLENMENT;
+  }
+
   virtual std::string to_string() const
   {
     std::string str;
@@ -153,6 +162,11 @@ public:
   void set_schema(const Table *table, const std::vector<FieldMeta> *fields)
   {
     table_ = table;
+    // 算子重新打开时会再次设置
+    for (FieldExpr *spec : speces_) {
+      delete spec;
+    }
+    speces_.clear();
     this->speces_.reserve(fields->size());
     for (const FieldMeta &field : *fields) {
       speces_.push_back(new FieldExpr(table, &field));
@@ -196,17 +210,16 @@ public:
     return RC::NOTFOUND;
   }
 
-#if 0
-  RC cell_spec_at(int index, const TupleCellSpec *&spec) const override
+  RC cell_spec_at(int index, TupleCellSpec &spec) const override
   {
     if (index < 0 || index >= static_cast<int>(speces_.size())) {
       LOG_WARN("invalid argument. index=%d", index);
       return RC::INVALID_ARGUMENT;
     }
-    spec = speces_[index];
+    const Field &field = speces_[index]->field();
+    spec = TupleCellSpec(field.table_name(), field.field_name());
     return RC::SUCCESS;
   }
-#endif
 
   Record &record()
   {
@@ -275,16 +288,14 @@ public:
     return tuple_->find_cell(spec, cell);
   }
 
-#if 0
-  RC cell_spec_at(int index, const TupleCellSpec *&spec) const override
+  RC cell_spec_at(int index, TupleCellSpec &spec) const override
   {
     if (index < 0 || index >= static_cast<int>(speces_.size())) {
       return RC::NOTFOUND;
     }
-    spec = speces_[index];
+    spec = *speces_[index];
     return RC::SUCCESS;
   }
-#endif
 private:
   std::vector<TupleCellSpec *> speces_;
   Tuple *tuple_ = nullptr;
@@ -371,6 +382,104 @@ private:
   std::vector<Value> cells_;
 };
 
+/**
+ * @brief 复制保存下来的一行数据
+ * @ingroup Tuple
+ * @details 值和schema都由外部保存，多行数据可以共用一个schema，这里只是引用。
+ * 在需要先读取全部数据再输出的算子中使用，比如hash join的build端。
+ */
+class MaterializedTuple : public Tuple
+{
+public:
+  MaterializedTuple() = default;
+  virtual ~MaterializedTuple() = default;
+
+  void set_schema(const std::vector<TupleCellSpec> *speces)
+  {
+    speces_ = speces;
+  }
+
+  /**
+   * @brief 设置这一行的值，个数与schema中的个数相同
+   */
+  void set_cells(const Value *cells)
+  {
+    cells_ = cells;
+  }
+
+  int cell_num() const override
+  {
+    return static_cast<int>(speces_->size());
+  }
+
+  RC cell_at(int index, Value &cell) const override
+  {
+    if (index < 0 || index >= cell_num()) {
+      return RC::NOTFOUND;
+    }
+    cell = cells_[index];
+    return RC::SUCCESS;
+  }
+
+  RC find_cell(const TupleCellSpec &spec, Value &cell) const override
+  {
+    for (size_t i = 0; i < speces_->size(); i++) {
+      const TupleCellSpec &cell_spec = (*speces_)[i];
+      if (0 == strcmp(spec.field_name(), cell_spec.field_name()) &&
+          0 == strcmp(spec.table_name(), cell_spec.table_name())) {
+        cell = cells_[i];
+        return RC::SUCCESS;
+      }
+    }
+    return RC::NOTFOUND;
+  }
+
+  RC cell_spec_at(int index, TupleCellSpec &spec) const override
+  {
+    if (index < 0 || index >= cell_num()) {
+      return RC::NOTFOUND;
+    }
+    spec = (*speces_)[index];
+    return RC::SUCCESS;
+  }
+
+  /**
+   * @brief 复制元组中所有Cell的描述
+   */
+  static RC copy_schema(const Tuple &tuple, std::vector<TupleCellSpec> &speces)
+  {
+    speces.resize(tuple.cell_num());
+    for (int i = 0; i < static_cast<int>(speces.size()); i++) {
+      RC rc = tuple.cell_spec_at(i, speces[i]);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get cell spec. index=%d, rc=%s", i, strrc(rc));
+        return rc;
+      }
+    }
+    return RC::SUCCESS;
+  }
+
+  /**
+   * @brief 复制元组中所有的值
+   */
+  static RC copy_cells(const Tuple &tuple, std::vector<Value> &cells)
+  {
+    cells.resize(tuple.cell_num());
+    for (int i = 0; i < static_cast<int>(cells.size()); i++) {
+      RC rc = tuple.cell_at(i, cells[i]);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get cell. index=%d, rc=%s", i, strrc(rc));
+        return rc;
+      }
+    }
+    return RC::SUCCESS;
+  }
+
+private:
+  const std::vector<TupleCellSpec> *speces_ = nullptr;
+  const Value                      *cells_ = nullptr;
+};
+
 /**
  * @brief 将两个tuple合并为一个tuple
  * @ingroup Tuple
@@ -399,7 +508,7 @@ public:
   RC cell_at(int index, Value &value) const override
   {
     const int left_cell_num = left_->cell_num();
-    if (index > 0 && index < left_cell_num) {
+    if (index >= 0 && index < left_cell_num) {
       return left_->cell_at(index, value);
     }
 
@@ -420,6 +529,15 @@ public:
     return right_->find_cell(spec, value);
   }
 
+  RC cell_spec_at(int index, TupleCellSpec &spec) const override
+  {
+    const int left_cell_num = left_->cell_num();
+    if (index >= 0 && index < left_cell_num) {
+      return left_->cell_spec_at(index, spec);
+    }
+    return right_->cell_spec_at(index - left_cell_num, spec);
+  }
+
 private:
   Tuple *left_ = nullptr;
   Tuple *right_ = nullptr;
@@ -21,6 +21,7 @@ See the Mulan PSL v2 for more details. */
 class TupleCellSpec
 {
 public:
+  TupleCellSpec() = default;
   TupleCellSpec(const char *table_name, const char *field_name, const char *alias = nullptr);
   TupleCellSpec(const char *alias);
 
@@ -0,0 +1,22 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/aggregate_logical_operator.h"
+
+AggregateLogicalOperator::AggregateLogicalOperator(
+    std::vector<std::unique_ptr<Expression>> &&group_by_exprs, std::vector<std::unique_ptr<Expression>> &&exprs)
+    : group_by_exprs_(std::move(group_by_exprs))
+{
+  expressions_ = std::move(exprs);
+}
@@ -0,0 +1,48 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sql/operator/logical_operator.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 分组聚合逻辑算子
+ * @ingroup LogicalOperator
+ * @details 按照分组的表达式把输入分组，每个分组输出一行。expressions() 是输出的列，
+ * 按照查询列表的顺序，每一项是分组中的字段或者聚合函数。没有分组时所有的输入是一个分组。
+ */
+class AggregateLogicalOperator : public LogicalOperator 
+{
+public:
+  AggregateLogicalOperator(
+      std::vector<std::unique_ptr<Expression>> &&group_by_exprs, std::vector<std::unique_ptr<Expression>> &&exprs);
+  virtual ~AggregateLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::AGGREGATION;
+  }
+
+  std::vector<std::unique_ptr<Expression>> &group_by_exprs()
+  {
+    return group_by_exprs_;
+  }
+
+private:
+  std::vector<std::unique_ptr<Expression>> group_by_exprs_;
+};
@@ -0,0 +1,503 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+#include <limits>
+
+#include "sql/operator/aggregate_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+void Aggregator::init(const vector<AggregateExpr *> &aggregates)
+{
+  states_.clear();
+  states_.resize(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); i++) {
+    AggregateExpr *aggregate = aggregates[i];
+    states_[i].type = aggregate->aggregate_type();
+    if (aggregate->child()) {
+      states_[i].arg_type = aggregate->child()->value_type();
+    }
+  }
+  group_num_ = 0;
+}
+
+/**
+ * @brief 一个新的分组中数字的初始值
+ */
+static double initial_number(AggregateExpr::Type type)
+{
+  switch (type) {
+    case AggregateExpr::Type::MIN: return numeric_limits<double>::infinity();
+    case AggregateExpr::Type::MAX: return -numeric_limits<double>::infinity();
+    default: return 0;
+  }
+}
+
+void Aggregator::resize(int group_num)
+{
+  for (State &state : states_) {
+    state.counts.resize(group_num);
+    std::fill(state.counts.begin() + std::min(group_num_, group_num), state.counts.end(), 0);
+    if (state.type == AggregateExpr::Type::CNT) {
+      continue;
+    }
+
+    if (state.arg_type == CHARS) {
+      state.values.resize(group_num);
+      std::fill(state.values.begin() + std::min(group_num_, group_num), state.values.end(), Value());
+    } else {
+      state.numbers.resize(group_num);
+      std::fill(state.numbers.begin() + std::min(group_num_, group_num), state.numbers.end(),
+          initial_number(state.type));
+    }
+  }
+  group_num_ = group_num;
+}
+
+/**
+ * @brief 在一批数据上更新数字的和、最大值或者最小值
+ */
+template <typename GetNumber>
+static void update_numbers(
+    AggregateExpr::Type type, const Value *values, const int *groups, int rows, double *numbers, GetNumber get_number)
+{
+  switch (type) {
+    case AggregateExpr::Type::SUM:
+    case AggregateExpr::Type::AVG: {
+      for (int i = 0; i < rows; i++) {
+        numbers[groups[i]] += get_number(values[i]);
+      }
+    } break;
+    case AggregateExpr::Type::MIN: {
+      for (int i = 0; i < rows; i++) {
+        double &result = numbers[groups[i]];
+        result = std::min(result, get_number(values[i]));
+      }
+    } break;
+    case AggregateExpr::Type::MAX: {
+      for (int i = 0; i < rows; i++) {
+        double &result = numbers[groups[i]];
+        result = std::max(result, get_number(values[i]));
+      }
+    } break;
+    default: break;
+  }
+}
+
+void Aggregator::update(int index, const Value *values, const int *groups, int rows)
+{
+  State &state = states_[index];
+  int64_t *counts = state.counts.data();
+  for (int i = 0; i < rows; i++) {
+    counts[groups[i]]++;
+  }
+
+  if (state.type == AggregateExpr::Type::CNT) {
+    return;
+  }
+
+  switch (state.arg_type) {
+    case INTS: {
+      update_numbers(state.type, values, groups, rows, state.numbers.data(),
+          [](const Value &value) { return static_cast<double>(value.get_int()); });
+    } break;
+    case FLOATS: {
+      update_numbers(state.type, values, groups, rows, state.numbers.data(),
+          [](const Value &value) { return static_cast<double>(value.get_float()); });
+    } break;
+    default: {
+      // 字符串只有MIN和MAX
+      const int sign = (state.type == AggregateExpr::Type::MIN) ? -1 : 1;
+      Value *results = state.values.data();
+      for (int i = 0; i < rows; i++) {
+        Value &result = results[groups[i]];
+        if (result.attr_type() == UNDEFINED || values[i].compare(result) * sign > 0) {
+          result = values[i];
+        }
+      }
+    } break;
+  }
+}
+
+void Aggregator::copy_group(int from, int to)
+{
+  for (State &state : states_) {
+    state.counts[to] = state.counts[from];
+    if (!state.numbers.empty()) {
+      state.numbers[to] = state.numbers[from];
+    }
+    if (!state.values.empty()) {
+      state.values[to] = state.values[from];
+    }
+  }
+}
+
+void Aggregator::merge_group(const Aggregator &other, int from, int to)
+{
+  for (size_t i = 0; i < states_.size(); i++) {
+    State &state = states_[i];
+    const State &other_state = other.states_[i];
+    state.counts[to] += other_state.counts[from];
+    if (state.type == AggregateExpr::Type::CNT || other_state.counts[from] == 0) {
+      continue;
+    }
+
+    if (state.arg_type == CHARS) {
+      const int sign = (state.type == AggregateExpr::Type::MIN) ? -1 : 1;
+      const Value &value = other_state.values[from];
+      Value &result = state.values[to];
+      if (result.attr_type() == UNDEFINED || value.compare(result) * sign > 0) {
+        result = value;
+      }
+      continue;
+    }
+
+    const double number = other_state.numbers[from];
+    double &result = state.numbers[to];
+    switch (state.type) {
+      case AggregateExpr::Type::MIN: result = std::min(result, number); break;
+      case AggregateExpr::Type::MAX: result = std::max(result, number); break;
+      default: result += number; break;
+    }
+  }
+}
+
+void Aggregator::get_result(int index, int group, Value &value) const
+{
+  const State &state = states_[index];
+  const int64_t count = state.counts[group];
+  if (state.type == AggregateExpr::Type::CNT) {
+    value = Value(static_cast<int>(count));
+    return;
+  }
+
+  if (count == 0) {
+    value = Value();
+    return;
+  }
+
+  if (state.arg_type == CHARS) {
+    value = state.values[group];
+  } else if (state.type == AggregateExpr::Type::AVG) {
+    value = Value(static_cast<float>(state.numbers[group] / count));
+  } else if (state.arg_type == INTS) {
+    value = Value(static_cast<int>(state.numbers[group]));
+  } else {
+    value = Value(static_cast<float>(state.numbers[group]));
+  }
+}
+
+size_t Aggregator::group_size() const
+{
+  size_t size = 0;
+  for (const State &state : states_) {
+    size += sizeof(int64_t);
+    if (state.type != AggregateExpr::Type::CNT) {
+      size += (state.arg_type == CHARS) ? sizeof(Value) : sizeof(double);
+    }
+  }
+  return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void AggregateHashTable::init(int key_num)
+{
+  key_num_ = key_num;
+  keys_.clear();
+  hashes_.clear();
+  slots_.assign(16, Slot{0, -1});
+  mask_ = static_cast<uint32_t>(slots_.size() - 1);
+}
+
+int AggregateHashTable::find(const Value *keys, uint32_t hash) const
+{
+  for (uint32_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    const Slot &slot = slots_[pos];
+    if (slot.group < 0) {
+      return -1;
+    }
+    if (slot.hash == hash && key_equal(slot.group, keys)) {
+      return slot.group;
+    }
+  }
+}
+
+int AggregateHashTable::insert(const Value *keys, uint32_t hash)
+{
+  // 负载因子不超过0.5，线性探测的路径比较短
+  if ((hashes_.size() + 1) * 2 > slots_.size()) {
+    expand();
+  }
+
+  const int group = group_num();
+  keys_.insert(keys_.end(), keys, keys + key_num_);
+  hashes_.push_back(hash);
+
+  uint32_t pos = hash & mask_;
+  while (slots_[pos].group >= 0) {
+    pos = (pos + 1) & mask_;
+  }
+  slots_[pos] = Slot{hash, group};
+  return group;
+}
+
+void AggregateHashTable::expand()
+{
+  slots_.assign(slots_.size() * 2, Slot{0, -1});
+  mask_ = static_cast<uint32_t>(slots_.size() - 1);
+  for (int group = 0; group < group_num(); group++) {
+    const uint32_t hash = hashes_[group];
+    uint32_t pos = hash & mask_;
+    while (slots_[pos].group >= 0) {
+      pos = (pos + 1) & mask_;
+    }
+    slots_[pos] = Slot{hash, group};
+  }
+}
+
+bool AggregateHashTable::key_equal(int group, const Value *keys) const
+{
+  const Value *group_keys = this->keys(group);
+  for (int i = 0; i < key_num_; i++) {
+    if (group_keys[i].compare(keys[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t AggregateHashTable::memory_size() const
+{
+  return keys_.capacity() * sizeof(Value) + hashes_.capacity() * sizeof(uint32_t) + slots_.size() * sizeof(Slot);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+AggregatePhysicalOperator::AggregatePhysicalOperator(
+    vector<unique_ptr<Expression>> &&group_by_exprs, vector<unique_ptr<Expression>> &&exprs)
+    : group_by_exprs_(std::move(group_by_exprs)), exprs_(std::move(exprs))
+{
+  for (unique_ptr<Expression> &expr : exprs_) {
+    if (expr->type() == ExprType::AGGREGATION) {
+      aggregates_.push_back(static_cast<AggregateExpr *>(expr.get()));
+    }
+  }
+}
+
+static string key_name(const Expression &expr)
+{
+  if (expr.type() == ExprType::FIELD) {
+    const Field &field = static_cast<const FieldExpr &>(expr).field();
+    return string(field.table_name()) + "." + field.field_name();
+  }
+  return expr.name();
+}
+
+string AggregatePhysicalOperator::param() const
+{
+  string param;
+  for (const unique_ptr<Expression> &expr : group_by_exprs_) {
+    param += param.empty() ? "GROUP BY " : ", ";
+    param += key_name(*expr);
+  }
+  return param;
+}
+
+RC AggregatePhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  for (const unique_ptr<Expression> &expr : exprs_) {
+    schema.append_cell(expr->name().c_str());
+  }
+  return RC::SUCCESS;
+}
+
+RC AggregatePhysicalOperator::open_child(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("aggregate operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  RC rc = init_output();
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  rc = children_[0]->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+  }
+  return rc;
+}
+
+RC AggregatePhysicalOperator::init_output()
+{
+  // 输出中的字段对应分组中的哪个key
+  output_index_.clear();
+  speces_.clear();
+  int aggregate_index = 0;
+  for (const unique_ptr<Expression> &expr : exprs_) {
+    if (expr->type() == ExprType::AGGREGATION) {
+      output_index_.push_back(-(aggregate_index + 1));
+      speces_.emplace_back(nullptr, expr->name().c_str());
+      aggregate_index++;
+      continue;
+    }
+
+    auto iter = std::find_if(group_by_exprs_.begin(), group_by_exprs_.end(), [&expr](const unique_ptr<Expression> &key) {
+      return key_name(*key) == key_name(*expr);
+    });
+    if (iter == group_by_exprs_.end()) {
+      LOG_WARN("output expression is neither aggregated nor grouped. expr=%s", expr->name().c_str());
+      return RC::INTERNAL;
+    }
+    output_index_.push_back(static_cast<int>(iter - group_by_exprs_.begin()));
+    if (expr->type() == ExprType::FIELD) {
+      const FieldExpr &field_expr = static_cast<const FieldExpr &>(*expr);
+      speces_.emplace_back(field_expr.table_name(), field_expr.field_name());
+    } else {
+      speces_.emplace_back(nullptr, expr->name().c_str());
+    }
+  }
+
+  cells_.resize(exprs_.size());
+  tuple_.set_schema(&speces_);
+  tuple_.set_cells(cells_.data());
+
+  batch_rows_ = 0;
+  batch_keys_.clear();
+  arg_columns_.assign(aggregates_.size(), vector<Value>());
+  return RC::SUCCESS;
+}
+
+RC AggregatePhysicalOperator::eval_chunk(const Expression &expr, Value *values, int stride)
+{
+  const vector<int> &selection = chunk_.selection();
+  const int rows = static_cast<int>(selection.size());
+  if (expr.type() == ExprType::FIELD) {
+    const FieldExpr &field_expr = static_cast<const FieldExpr &>(expr);
+    const int index = chunk_.find_column(field_expr.table_name(), field_expr.field_name());
+    if (index >= 0) {
+      const Column &column = chunk_.column(index);
+      for (int i = 0; i < rows; i++) {
+        column.get_value(selection[i], values[static_cast<size_t>(i) * stride]);
+      }
+      return RC::SUCCESS;
+    }
+  }
+
+  ChunkRowTuple tuple(chunk_);
+  for (int i = 0; i < rows; i++) {
+    tuple.set_row(selection[i]);
+    RC rc = expr.get_value(tuple, values[static_cast<size_t>(i) * stride]);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get value of expression. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC AggregatePhysicalOperator::fetch_batch()
+{
+  PhysicalOperator *child = children_[0].get();
+  const int key_num = this->key_num();
+  RC rc = RC::SUCCESS;
+
+  if (child->support_chunk()) {
+    rc = child->next_chunk(chunk_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    batch_rows_ = chunk_.size();
+    batch_keys_.resize(static_cast<size_t>(batch_rows_) * key_num);
+    for (int i = 0; i < key_num; i++) {
+      rc = eval_chunk(*group_by_exprs_[i], batch_keys_.data() + i, key_num);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+    for (size_t i = 0; i < aggregates_.size(); i++) {
+      if (!aggregates_[i]->child()) {
+        continue;
+      }
+      arg_columns_[i].resize(batch_rows_);
+      rc = eval_chunk(*aggregates_[i]->child(), arg_columns_[i].data(), 1);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+    return RC::SUCCESS;
+  }
+
+  // 下层算子不支持批量执行时，逐行读取凑成一批
+  const int capacity = chunk_.capacity();
+  batch_keys_.resize(static_cast<size_t>(capacity) * key_num);
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    if (aggregates_[i]->child()) {
+      arg_columns_[i].resize(capacity);
+    }
+  }
+
+  batch_rows_ = 0;
+  while (batch_rows_ < capacity && RC::SUCCESS == (rc = child->next())) {
+    Tuple *tuple = child->current_tuple();
+    if (nullptr == tuple) {
+      LOG_WARN("failed to get current tuple of child operator");
+      return RC::INTERNAL;
+    }
+
+    for (int i = 0; i < key_num && rc == RC::SUCCESS; i++) {
+      rc = group_by_exprs_[i]->get_value(*tuple, batch_keys_[static_cast<size_t>(batch_rows_) * key_num + i]);
+    }
+    for (size_t i = 0; i < aggregates_.size() && rc == RC::SUCCESS; i++) {
+      if (aggregates_[i]->child()) {
+        rc = aggregates_[i]->child()->get_value(*tuple, arg_columns_[i][batch_rows_]);
+      }
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to evaluate aggregate input. rc=%s", strrc(rc));
+      return rc;
+    }
+    batch_rows_++;
+  }
+
+  if (rc != RC::SUCCESS && rc != RC::RECORD_EOF) {
+    return rc;
+  }
+  return batch_rows_ > 0 ? RC::SUCCESS : RC::RECORD_EOF;
+}
+
+void AggregatePhysicalOperator::update_aggregates(Aggregator &aggregator, const int *groups, int rows)
+{
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    aggregator.update(static_cast<int>(i), arg_columns_[i].data(), groups, rows);
+  }
+}
+
+void AggregatePhysicalOperator::set_output(const Value *keys, const Aggregator &aggregator, int group)
+{
+  for (size_t i = 0; i < output_index_.size(); i++) {
+    const int index = output_index_[i];
+    if (index >= 0) {
+      cells_[i] = keys[index];
+    } else {
+      aggregator.get_result(-index - 1, group, cells_[i]);
+    }
+  }
+}
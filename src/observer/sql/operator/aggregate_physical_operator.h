@@ -0,0 +1,210 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/chunk.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 聚合函数的中间状态
+ * @ingroup PhysicalOperator
+ * @details 按列保存所有分组的状态：每个聚合函数有自己的数组，分组的编号就是数组的下标。
+ * 更新时一次处理一批数据，按聚合函数逐个在数组上循环，类型的判断放在循环的外面。
+ * 数字的和、最大值、最小值使用double保存，字符串的最大值、最小值使用Value保存。
+ * 当前没有NULL，一个分组中的行数就是每个聚合函数的计数。
+ */
+class Aggregator
+{
+public:
+  void init(const std::vector<AggregateExpr *> &aggregates);
+
+  int group_num() const { return group_num_; }
+
+  /**
+   * @brief 调整分组的个数，新的分组是初始状态
+   */
+  void resize(int group_num);
+
+  /**
+   * @brief 使用一批数据更新一个聚合函数的状态
+   * @param index 第几个聚合函数
+   * @param values 每行参数的值，COUNT(*)时不使用
+   * @param groups 每行所属的分组
+   */
+  void update(int index, const Value *values, const int *groups, int rows);
+
+  /**
+   * @brief 把一个分组的状态复制到另一个分组
+   */
+  void copy_group(int from, int to);
+
+  /**
+   * @brief 把另一个聚合状态中的一个分组合并到这里的一个分组
+   * @details 并行聚合时合并各个工作线程的局部结果，两边的聚合函数必须相同
+   */
+  void merge_group(const Aggregator &other, int from, int to);
+
+  /**
+   * @brief 聚合函数的结果。除了COUNT，没有输入时结果是未定义的值
+   */
+  void get_result(int index, int group, Value &value) const;
+
+  /**
+   * @brief 每个分组的状态大约占用的内存
+   */
+  size_t group_size() const;
+
+private:
+  struct State
+  {
+    AggregateExpr::Type  type;
+    AttrType             arg_type = UNDEFINED;
+    std::vector<int64_t> counts;
+    std::vector<double>  numbers;
+    std::vector<Value>   values;  ///< 字符串的最大值、最小值
+  };
+
+  std::vector<State> states_;
+  int                group_num_ = 0;
+};
+
+/**
+ * @brief 分组聚合使用的hash表
+ * @ingroup PhysicalOperator
+ * @details 与 JoinHashTable 相同，使用开放地址(线性探测)的槽位数组，每个槽位8个字节，保存哈希值和分组的编号，
+ * 分组的key按照编号连续存放。分组的个数超过槽位的一半时槽位数组扩大一倍，使用保存的哈希值重新插入。
+ */
+class AggregateHashTable
+{
+public:
+  void init(int key_num);
+
+  /**
+   * @brief 查找key相同的分组，没有时返回-1
+   */
+  int find(const Value *keys, uint32_t hash) const;
+
+  /**
+   * @brief 增加一个分组，调用前需要确认key不存在
+   * @return 新分组的编号，从0开始
+   */
+  int insert(const Value *keys, uint32_t hash);
+
+  int          group_num() const { return static_cast<int>(hashes_.size()); }
+  const Value *keys(int group) const { return keys_.data() + static_cast<size_t>(group) * key_num_; }
+
+  /**
+   * @brief 大约占用的内存
+   */
+  size_t memory_size() const;
+
+private:
+  struct Slot
+  {
+    uint32_t hash;
+    int32_t  group;  ///< -1 表示空的槽位
+  };
+
+  void expand();
+  bool key_equal(int group, const Value *keys) const;
+
+private:
+  int                   key_num_ = 0;
+  std::vector<Value>    keys_;
+  std::vector<uint32_t> hashes_;
+  std::vector<Slot>     slots_;
+  uint32_t              mask_ = 0;
+};
+
+/**
+ * @brief 分组聚合算子的公共部分
+ * @ingroup PhysicalOperator
+ * @details 输出的列按照查询列表的顺序，每一项是分组中的字段或者聚合函数。
+ * 输入按批读取：下层算子支持批量执行时直接使用Chunk中的列，否则逐行读取凑成一批。
+ * 每批数据计算出分组的key(按行存放)和聚合函数的参数(按列存放)，由子类决定每行属于哪个分组。
+ */
+class AggregatePhysicalOperator : public PhysicalOperator
+{
+public:
+  AggregatePhysicalOperator(
+      std::vector<std::unique_ptr<Expression>> &&group_by_exprs, std::vector<std::unique_ptr<Expression>> &&exprs);
+  virtual ~AggregatePhysicalOperator() = default;
+
+  std::string param() const override;
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+  const std::vector<std::unique_ptr<Expression>> &group_by_expressions() const { return group_by_exprs_; }
+  const std::vector<std::unique_ptr<Expression>> &expressions() const { return exprs_; }
+
+protected:
+  /**
+   * @brief 打开下层算子，准备输出的元组
+   */
+  RC open_child(Trx *trx);
+
+  /**
+   * @brief 准备输出的元组，不打开下层算子
+   */
+  RC init_output();
+
+  /**
+   * @brief 从下层算子读取一批数据
+   * @return 没有数据时返回RECORD_EOF
+   */
+  RC fetch_batch();
+
+  /**
+   * @brief 按照这批数据中每行所属的分组更新所有的聚合函数
+   */
+  void update_aggregates(Aggregator &aggregator, const int *groups, int rows);
+
+  /**
+   * @brief 设置输出的一行
+   */
+  void set_output(const Value *keys, const Aggregator &aggregator, int group);
+
+  int key_num() const { return static_cast<int>(group_by_exprs_.size()); }
+
+  const Value *batch_keys(int row) const { return batch_keys_.data() + static_cast<size_t>(row) * key_num(); }
+
+private:
+  RC eval_chunk(const Expression &expr, Value *values, int stride);
+
+protected:
+  std::vector<std::unique_ptr<Expression>> group_by_exprs_;
+  std::vector<std::unique_ptr<Expression>> exprs_;
+  std::vector<AggregateExpr *>             aggregates_;  ///< exprs_ 中的聚合函数
+
+  int                             batch_rows_ = 0;
+  std::vector<Value>              batch_keys_;   ///< 每行的key连续存放
+  std::vector<std::vector<Value>> arg_columns_;  ///< 每个聚合函数的参数，COUNT(*)没有
+
+private:
+  std::vector<int> output_index_;  ///< 输出的每一列，大于等于0时是第几个key，否则是 -(第几个聚合函数+1)
+
+  Chunk                      chunk_;
+  std::vector<TupleCellSpec> speces_;
+  std::vector<Value>         cells_;
+  MaterializedTuple          tuple_;
+};
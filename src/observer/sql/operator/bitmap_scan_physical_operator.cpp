@@ -0,0 +1,193 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/bitmap_scan_physical_operator.h"
+#include "storage/index/bitmap_index.h"
+#include "storage/table/table.h"
+#include "storage/trx/trx.h"
+
+using namespace std;
+using namespace common;
+
+RC BitmapScanPhysicalOperator::open(Trx *trx)
+{
+  if (nullptr == table_ || terms_.empty()) {
+    return RC::INTERNAL;
+  }
+
+  record_handler_ = table_->record_handler();
+  if (nullptr == record_handler_) {
+    LOG_WARN("invalid record handler");
+    return RC::INTERNAL;
+  }
+
+  RC rc = build_bitmap();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to build bitmap. table=%s, rc=%s", table_->name(), strrc(rc));
+    return rc;
+  }
+  iterator_ = make_unique<RoaringBitmap::Iterator>(bitmap_);
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+
+  tuple_.set_schema(table_, table_->table_meta().field_metas());
+
+  trx_ = trx;
+  return RC::SUCCESS;
+}
+
+RC BitmapScanPhysicalOperator::build_bitmap()
+{
+  bitmap_.clear();
+  for (size_t i = 0; i < terms_.size(); i++) {
+    RoaringBitmap term_bitmap;
+    for (Lookup &lookup : terms_[i]) {
+      RoaringBitmap lookup_bitmap;
+      RC rc = lookup.index->get_bitmap(lookup.value.data(), lookup.value.length(), lookup_bitmap);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get bitmap from index. index=%s, rc=%s", lookup.index->index_meta().name(), strrc(rc));
+        return rc;
+      }
+      term_bitmap.or_with(lookup_bitmap);
+    }
+
+    if (i == 0) {
+      bitmap_ = std::move(term_bitmap);
+    } else {
+      bitmap_.and_with(term_bitmap);
+    }
+
+    if (bitmap_.empty()) {
+      break;
+    }
+  }
+
+  LOG_TRACE("bitmap scan got %lu rows. table=%s", bitmap_.cardinality(), table_->name());
+  return RC::SUCCESS;
+}
+
+RC BitmapScanPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  uint32_t row_id = 0;
+  bool filter_result = false;
+  while (iterator_->next(row_id)) {
+    // 位图是按照记录的物理位置排序的，同一个页面上的数据是连续的
+    rc = fetch_record(BitmapIndex::row_id_to_rid(row_id));
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    tuple_.set_record(&current_record_);
+    rc = filter(tuple_, filter_result);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    if (!filter_result) {
+      continue;
+    }
+
+    rc = trx_->visit_record(table_, current_record_, readonly_);
+    if (rc == RC::RECORD_INVISIBLE) {
+      continue;
+    } else {
+      return rc;
+    }
+  }
+
+  return RC::RECORD_EOF;
+}
+
+RC BitmapScanPhysicalOperator::fetch_record(const RID &rid)
+{
+  if (fetched_page_num_ == rid.page_num) {
+    return record_page_handler_.get_record(&rid, &current_record_);
+  }
+
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+
+  RC rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
+  if (rc == RC::SUCCESS) {
+    fetched_page_num_ = rid.page_num;
+  }
+  return rc;
+}
+
+RC BitmapScanPhysicalOperator::close()
+{
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+  iterator_.reset();
+  bitmap_.clear();
+  return RC::SUCCESS;
+}
+
+Tuple *BitmapScanPhysicalOperator::current_tuple()
+{
+  tuple_.set_record(&current_record_);
+  return &tuple_;
+}
+
+void BitmapScanPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs)
+{
+  predicates_ = std::move(exprs);
+}
+
+RC BitmapScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
+{
+  RC rc = RC::SUCCESS;
+  Value value;
+  for (unique_ptr<Expression> &expr : predicates_) {
+    rc = expr->get_value(tuple, value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    bool tmp_result = value.get_boolean();
+    if (!tmp_result) {
+      result = false;
+      return rc;
+    }
+  }
+
+  result = true;
+  return rc;
+}
+
+string BitmapScanPhysicalOperator::param() const
+{
+  string param;
+  for (size_t i = 0; i < terms_.size(); i++) {
+    if (i > 0) {
+      param += " AND ";
+    }
+    const Term &term = terms_[i];
+    if (term.size() > 1) {
+      param += "(";
+    }
+    for (size_t j = 0; j < term.size(); j++) {
+      if (j > 0) {
+        param += " OR ";
+      }
+      param += term[j].index->index_meta().name();
+    }
+    if (term.size() > 1) {
+      param += ")";
+    }
+  }
+  param += " ON ";
+  param += table_->name();
+  return param;
+}
@@ -0,0 +1,93 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/tuple.h"
+#include "storage/record/record_manager.h"
+#include "common/lang/roaring_bitmap.h"
+
+class BitmapIndex;
+
+/**
+ * @brief 位图扫描物理算子
+ * @ingroup PhysicalOperator
+ * @details 先用位图索引计算出满足条件的记录的位图，再按照记录的物理位置回表。
+ * 条件由多个term组成，term之间是AND的关系，每个term中的多个等值查找之间是OR的关系。
+ * 位图索引中已经删除的数据(MVCC)还在，回表以后仍然需要使用所有的谓词过滤。
+ */
+class BitmapScanPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @brief 在位图索引中查找等于value的数据
+   */
+  struct Lookup
+  {
+    BitmapIndex *index = nullptr;
+    Value        value;
+  };
+
+  /// 一个term中的多个查找之间是OR的关系
+  using Term = std::vector<Lookup>;
+
+public:
+  BitmapScanPhysicalOperator(Table *table, bool readonly) : table_(table), readonly_(readonly) {}
+
+  virtual ~BitmapScanPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::BITMAP_SCAN; }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  Tuple *current_tuple() override;
+
+  void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
+
+  /**
+   * @brief 增加一个term，与已有的term之间是AND的关系
+   */
+  void add_term(Term &&term) { terms_.emplace_back(std::move(term)); }
+  const std::vector<Term> &terms() const { return terms_; }
+
+private:
+  RC build_bitmap();
+  RC fetch_record(const RID &rid);
+
+  // 与TableScanPhysicalOperator代码相同，可以优化
+  RC filter(RowTuple &tuple, bool &result);
+
+private:
+  Trx               *trx_ = nullptr;
+  Table             *table_ = nullptr;
+  bool               readonly_ = false;
+  RecordFileHandler *record_handler_ = nullptr;
+
+  std::vector<Term> terms_;
+
+  common::RoaringBitmap                            bitmap_;    ///< 满足条件的记录
+  std::unique_ptr<common::RoaringBitmap::Iterator> iterator_;
+
+  RecordPageHandler record_page_handler_;
+  PageNum           fetched_page_num_ = BP_INVALID_PAGE_NUM;  ///< record_page_handler_ 当前持有的页面
+  Record            current_record_;
+  RowTuple          tuple_;
+
+  std::vector<std::unique_ptr<Expression>> predicates_;
+};
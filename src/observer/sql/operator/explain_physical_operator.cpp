@@ -99,6 +99,11 @@ void ExplainPhysicalOperator::to_string(
   if (!param.empty()) {
     os << "(" << param << ")";
   }
+  if (oper->estimated_rows() >= 0) {
+    char estimate[64];
+    snprintf(estimate, sizeof(estimate), " [rows=%.0f, cost=%.2f]", oper->estimated_rows(), oper->estimated_cost());
+    os << estimate;
+  }
   os << '\n';
 
   if (static_cast<int>(ends.size()) < level + 2) {
@@ -0,0 +1,432 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+
+#include "sql/operator/external_sorter.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/buffer/frame.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+static void append_uint32(string &key, uint32_t value, bool asc)
+{
+  char bytes[4];
+  for (int i = 0; i < 4; i++) {
+    bytes[i] = static_cast<char>((value >> (24 - i * 8)) & 0xFF);
+  }
+  if (!asc) {
+    for (char &byte : bytes) {
+      byte = ~byte;
+    }
+  }
+  key.append(bytes, sizeof(bytes));
+}
+
+void SortKey::append(string &key, const Value &value, bool asc)
+{
+  switch (value.attr_type()) {
+    case INTS: {
+      append_uint32(key, static_cast<uint32_t>(value.get_int()) ^ 0x80000000u, asc);
+    } break;
+    case FLOATS: {
+      float f = value.get_float();
+      uint32_t bits = 0;
+      memcpy(&bits, &f, sizeof(bits));
+      // 负数所有的位取反，正数只设置符号位，这样可以按照无符号整数比较
+      bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+      append_uint32(key, bits, asc);
+    } break;
+    case BOOLEANS: {
+      const char byte = value.get_boolean() ? 1 : 0;
+      key.push_back(asc ? byte : ~byte);
+    } break;
+    default: {
+      // 字符串中不会有'\0'，以'\0'结尾可以保证前缀排在前面
+      const char *data = value.data();
+      const size_t len = strlen(data);
+      const size_t start = key.size();
+      key.append(data, len);
+      key.push_back('\0');
+      if (!asc) {
+        for (size_t i = start; i < key.size(); i++) {
+          key[i] = ~key[i];
+        }
+      }
+    } break;
+  }
+}
+
+int SortKey::compare(const char *key1, int len1, const char *key2, int len2)
+{
+  const int result = memcmp(key1, key2, std::min(len1, len2));
+  if (result != 0) {
+    return result;
+  }
+  return len1 - len2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * 序列化的一行数据：
+ * | key_len(4) | key | cell_num(4) | type(1) len(4) data | type(1) len(4) data | ...
+ * 写到临时文件中时，每行前面再加上4个字节的长度
+ */
+
+template <typename T>
+static void append_pod(string &buf, T value)
+{
+  buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T>
+static T read_pod(const char *data)
+{
+  T value;
+  memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+ExternalSorter::~ExternalSorter()
+{
+  reset();
+}
+
+void ExternalSorter::init(const string &temp_dir, size_t memory_limit)
+{
+  reset();
+  temp_dir_ = temp_dir;
+  memory_limit_ = memory_limit;
+}
+
+RC ExternalSorter::add(const string &key, const Value *cells, int cell_num)
+{
+  string row;
+  append_pod<int32_t>(row, static_cast<int32_t>(key.size()));
+  row.append(key);
+  append_pod<int32_t>(row, cell_num);
+  for (int i = 0; i < cell_num; i++) {
+    const Value &cell = cells[i];
+    append_pod<uint8_t>(row, static_cast<uint8_t>(cell.attr_type()));
+    append_pod<int32_t>(row, cell.length());
+    row.append(cell.data(), cell.length());
+  }
+
+  memory_used_ += row.size() + sizeof(string);
+  rows_.emplace_back(std::move(row));
+  if (memory_used_ >= memory_limit_) {
+    return spill();
+  }
+  return RC::SUCCESS;
+}
+
+const char *ExternalSorter::row_key(const string &row, int &key_len)
+{
+  key_len = read_pod<int32_t>(row.data());
+  return row.data() + sizeof(int32_t);
+}
+
+bool ExternalSorter::row_less(const string &row1, const string &row2)
+{
+  int len1 = 0;
+  int len2 = 0;
+  const char *key1 = row_key(row1, len1);
+  const char *key2 = row_key(row2, len2);
+  return SortKey::compare(key1, len1, key2, len2) < 0;
+}
+
+void ExternalSorter::parse_row(const string &row, string &key, vector<Value> &cells)
+{
+  int key_len = 0;
+  const char *key_data = row_key(row, key_len);
+  key.assign(key_data, key_len);
+
+  const char *data = key_data + key_len;
+  const int cell_num = read_pod<int32_t>(data);
+  data += sizeof(int32_t);
+  cells.resize(cell_num);
+  for (int i = 0; i < cell_num; i++) {
+    const AttrType type = static_cast<AttrType>(read_pod<uint8_t>(data));
+    const int len = read_pod<int32_t>(data + sizeof(uint8_t));
+    data += sizeof(uint8_t) + sizeof(int32_t);
+
+    Value &cell = cells[i];
+    if (type == BOOLEANS) {
+      cell.set_boolean(*data != 0);
+    } else {
+      cell.set_type(type);
+      cell.set_data(data, len);
+    }
+    data += len;
+  }
+}
+
+RC ExternalSorter::open_temp_file()
+{
+  static atomic<int64_t> sequence{0};
+  file_name_ = temp_dir_ + "/sort_" + to_string(getpid()) + "_" + to_string(sequence++) + ".tmp";
+
+  BufferPoolManager &bpm = BufferPoolManager::instance();
+  RC rc = bpm.create_file(file_name_.c_str());
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to create sort temp file. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+    file_name_.clear();
+    return rc;
+  }
+
+  rc = bpm.open_file(file_name_.c_str(), buffer_pool_);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to open sort temp file. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+    ::unlink(file_name_.c_str());
+    file_name_.clear();
+    buffer_pool_ = nullptr;
+    return rc;
+  }
+  return rc;
+}
+
+RC ExternalSorter::write(Run &run, Frame *&frame, int &page_offset, const char *data, int len)
+{
+  while (len > 0) {
+    if (nullptr == frame || page_offset >= BP_PAGE_DATA_SIZE) {
+      if (nullptr != frame) {
+        frame->mark_dirty();
+        buffer_pool_->unpin_page(frame);
+        frame = nullptr;
+      }
+
+      RC rc = buffer_pool_->allocate_page(&frame);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to allocate page for sort run. rc=%s", strrc(rc));
+        return rc;
+      }
+      run.pages.push_back(frame->page_num());
+      page_offset = 0;
+    }
+
+    const int copy_len = std::min(len, BP_PAGE_DATA_SIZE - page_offset);
+    memcpy(frame->data() + page_offset, data, copy_len);
+    page_offset += copy_len;
+    data += copy_len;
+    len -= copy_len;
+    run.size += copy_len;
+  }
+  return RC::SUCCESS;
+}
+
+RC ExternalSorter::spill()
+{
+  RC rc = RC::SUCCESS;
+  if (nullptr == buffer_pool_) {
+    rc = open_temp_file();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  std::stable_sort(rows_.begin(), rows_.end(), row_less);
+
+  runs_.emplace_back();
+  Run &run = runs_.back();
+  Frame *frame = nullptr;
+  int page_offset = 0;
+  for (const string &row : rows_) {
+    const int32_t row_len = static_cast<int32_t>(row.size());
+    rc = write(run, frame, page_offset, reinterpret_cast<const char *>(&row_len), sizeof(row_len));
+    if (OB_SUCC(rc)) {
+      rc = write(run, frame, page_offset, row.data(), row_len);
+    }
+    if (OB_FAIL(rc)) {
+      break;
+    }
+  }
+
+  if (nullptr != frame) {
+    frame->mark_dirty();
+    buffer_pool_->unpin_page(frame);
+  }
+
+  LOG_TRACE("spill a sort run. rows=%d, bytes=%ld, pages=%d, rc=%s",
+            static_cast<int>(rows_.size()), run.size, static_cast<int>(run.pages.size()), strrc(rc));
+  rows_.clear();
+  memory_used_ = 0;
+  return rc;
+}
+
+RC ExternalSorter::sort()
+{
+  row_pos_ = 0;
+  if (runs_.empty()) {
+    std::stable_sort(rows_.begin(), rows_.end(), row_less);
+    return RC::SUCCESS;
+  }
+
+  RC rc = RC::SUCCESS;
+  if (!rows_.empty()) {
+    rc = spill();
+    if (OB_FAIL(rc)) {
+      return rc;
+    }
+  }
+
+  auto greater = [this](int reader1, int reader2) { return reader_greater(reader1, reader2); };
+
+  readers_.clear();
+  heap_.clear();
+  for (const Run &run : runs_) {
+    readers_.emplace_back(new RunReader(buffer_pool_, &run));
+    rc = readers_.back()->next();
+    if (rc == RC::SUCCESS) {
+      heap_.push_back(static_cast<int>(readers_.size()) - 1);
+      std::push_heap(heap_.begin(), heap_.end(), greater);
+    } else if (rc != RC::RECORD_EOF) {
+      LOG_WARN("failed to read sort run. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+bool ExternalSorter::reader_greater(int reader1, int reader2) const
+{
+  // key相同时段的编号小的在前，保证输出的顺序与添加的顺序相同
+  const string &row1 = readers_[reader1]->row();
+  const string &row2 = readers_[reader2]->row();
+  if (row_less(row2, row1)) {
+    return true;
+  }
+  return !row_less(row1, row2) && reader1 > reader2;
+}
+
+RC ExternalSorter::merge_next(string &row)
+{
+  if (heap_.empty()) {
+    return RC::RECORD_EOF;
+  }
+
+  auto greater = [this](int reader1, int reader2) { return reader_greater(reader1, reader2); };
+
+  std::pop_heap(heap_.begin(), heap_.end(), greater);
+  const int reader = heap_.back();
+  heap_.pop_back();
+  row = readers_[reader]->row();
+
+  RC rc = readers_[reader]->next();
+  if (rc == RC::SUCCESS) {
+    heap_.push_back(reader);
+    std::push_heap(heap_.begin(), heap_.end(), greater);
+  } else if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to read sort run. rc=%s", strrc(rc));
+    return rc;
+  }
+  return RC::SUCCESS;
+}
+
+RC ExternalSorter::next(string &key, vector<Value> &cells)
+{
+  if (runs_.empty()) {
+    if (row_pos_ >= rows_.size()) {
+      return RC::RECORD_EOF;
+    }
+    parse_row(rows_[row_pos_++], key, cells);
+    return RC::SUCCESS;
+  }
+
+  string row;
+  RC rc = merge_next(row);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  parse_row(row, key, cells);
+  return RC::SUCCESS;
+}
+
+void ExternalSorter::reset()
+{
+  heap_.clear();
+  readers_.clear();  // 释放读取时固定的页面
+  runs_.clear();
+  rows_.clear();
+  memory_used_ = 0;
+  row_pos_ = 0;
+
+  if (nullptr != buffer_pool_) {
+    BufferPoolManager::instance().close_file(file_name_.c_str());
+    ::unlink(file_name_.c_str());
+    buffer_pool_ = nullptr;
+    file_name_.clear();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExternalSorter::RunReader::~RunReader()
+{
+  if (nullptr != frame_) {
+    buffer_pool_->unpin_page(frame_);
+    frame_ = nullptr;
+  }
+}
+
+RC ExternalSorter::RunReader::read(char *data, int len)
+{
+  while (len > 0) {
+    if (page_offset_ >= BP_PAGE_DATA_SIZE) {
+      if (nullptr != frame_) {
+        buffer_pool_->unpin_page(frame_);
+        frame_ = nullptr;
+      }
+
+      page_index_++;
+      if (page_index_ >= static_cast<int>(run_->pages.size())) {
+        LOG_WARN("sort run is broken. pages=%d", static_cast<int>(run_->pages.size()));
+        return RC::INTERNAL;
+      }
+      RC rc = buffer_pool_->get_this_page(run_->pages[page_index_], &frame_);
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to get page of sort run. page=%d, rc=%s", run_->pages[page_index_], strrc(rc));
+        return rc;
+      }
+      page_offset_ = 0;
+    }
+
+    const int copy_len = std::min(len, BP_PAGE_DATA_SIZE - page_offset_);
+    memcpy(data, frame_->data() + page_offset_, copy_len);
+    page_offset_ += copy_len;
+    offset_ += copy_len;
+    data += copy_len;
+    len -= copy_len;
+  }
+  return RC::SUCCESS;
+}
+
+RC ExternalSorter::RunReader::next()
+{
+  if (offset_ >= run_->size) {
+    return RC::RECORD_EOF;
+  }
+
+  int32_t row_len = 0;
+  RC rc = read(reinterpret_cast<char *>(&row_len), sizeof(row_len));
+  if (OB_FAIL(rc)) {
+    return rc;
+  }
+  row_.resize(row_len);
+  return read(row_.data(), row_len);
+}
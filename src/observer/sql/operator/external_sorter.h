@@ -0,0 +1,151 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "sql/parser/value.h"
+#include "storage/buffer/page.h"
+
+class DiskBufferPool;
+class Frame;
+
+/**
+ * @brief 排序使用的二进制key
+ * @ingroup PhysicalOperator
+ * @details 把值转换成可以直接使用memcmp比较的字节序列，多个值的key依次拼接起来。
+ * 整数和浮点数转换成大端序并调整符号位，字符串以'\0'结尾。降序时把所有的字节取反。
+ */
+class SortKey
+{
+public:
+  static void append(std::string &key, const Value &value, bool asc = true);
+
+  /**
+   * @brief 比较两个key，与memcmp相同，一个是另一个的前缀时短的在前
+   */
+  static int compare(const char *key1, int len1, const char *key2, int len2);
+};
+
+/**
+ * @brief 外部排序
+ * @ingroup PhysicalOperator
+ * @details 每行数据由一个SortKey和若干个值组成。数据先缓存在内存中，超过内存限制时排序后作为一个
+ * 有序的段(run)写到临时文件中。临时文件通过buffer pool读写，所有的段都写在同一个文件中，
+ * 每个段记录自己使用的页面，段中的数据是连续的字节流，一行数据可以跨越页面。
+ * 全部数据添加完成以后，多个段使用多路归并输出。key相同的行保持添加的顺序。
+ */
+class ExternalSorter
+{
+public:
+  static constexpr size_t DEFAULT_MEMORY_LIMIT = 16 * 1024 * 1024;
+
+public:
+  ExternalSorter() = default;
+  ~ExternalSorter();
+
+  /**
+   * @param temp_dir 临时文件所在的目录
+   * @param memory_limit 内存中最多缓存的数据量
+   */
+  void init(const std::string &temp_dir, size_t memory_limit = DEFAULT_MEMORY_LIMIT);
+
+  RC add(const std::string &key, const Value *cells, int cell_num);
+
+  /**
+   * @brief 数据添加完成，开始输出
+   */
+  RC sort();
+
+  /**
+   * @brief 按照key的顺序获取下一行数据，没有数据时返回RECORD_EOF
+   */
+  RC next(std::string &key, std::vector<Value> &cells);
+
+  /**
+   * @brief 释放所有的数据，删除临时文件
+   */
+  void reset();
+
+  /**
+   * @brief 写到临时文件中的段的个数
+   */
+  int run_num() const { return static_cast<int>(runs_.size()); }
+
+private:
+  struct Run
+  {
+    std::vector<PageNum> pages;
+    int64_t              size = 0;  ///< 数据的字节数
+  };
+
+  /**
+   * @brief 按顺序读取一个段中的数据
+   */
+  class RunReader
+  {
+  public:
+    RunReader(DiskBufferPool *buffer_pool, const Run *run) : buffer_pool_(buffer_pool), run_(run) {}
+    ~RunReader();
+
+    /**
+     * @brief 读取下一行，读完以后返回RECORD_EOF
+     */
+    RC next();
+
+    const std::string &row() const { return row_; }
+
+  private:
+    RC read(char *data, int len);
+
+  private:
+    DiskBufferPool *buffer_pool_ = nullptr;
+    const Run      *run_ = nullptr;
+    Frame          *frame_ = nullptr;
+    int             page_index_ = -1;
+    int             page_offset_ = BP_PAGE_DATA_SIZE;
+    int64_t         offset_ = 0;
+    std::string     row_;
+  };
+
+  RC spill();
+  RC open_temp_file();
+  RC write(Run &run, Frame *&frame, int &page_offset, const char *data, int len);
+  RC merge_next(std::string &row);
+  bool reader_greater(int reader1, int reader2) const;
+
+  static const char *row_key(const std::string &row, int &key_len);
+  static bool        row_less(const std::string &row1, const std::string &row2);
+  static void        parse_row(const std::string &row, std::string &key, std::vector<Value> &cells);
+
+private:
+  std::string temp_dir_;
+  size_t      memory_limit_ = DEFAULT_MEMORY_LIMIT;
+
+  std::vector<std::string> rows_;  ///< 内存中的数据，每行是序列化以后的key和值
+  size_t                   memory_used_ = 0;
+  size_t                   row_pos_ = 0;
+
+  std::string      file_name_;
+  DiskBufferPool  *buffer_pool_ = nullptr;
+  std::vector<Run> runs_;
+
+  std::vector<std::unique_ptr<RunReader>> readers_;
+  std::vector<int>                        heap_;  ///< 归并时的最小堆，保存readers_中的下标
+};
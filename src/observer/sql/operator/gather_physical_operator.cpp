@@ -0,0 +1,159 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/gather_physical_operator.h"
+#include "storage/table/table.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+GatherPhysicalOperator::GatherPhysicalOperator(shared_ptr<MorselScheduler> scheduler, Table *table)
+    : scheduler_(std::move(scheduler)), table_(table)
+{}
+
+GatherPhysicalOperator::~GatherPhysicalOperator()
+{
+  close();
+}
+
+string GatherPhysicalOperator::param() const
+{
+  return "WORKERS " + to_string(children_.size());
+}
+
+RC GatherPhysicalOperator::open(Trx *trx)
+{
+  if (children_.empty()) {
+    LOG_WARN("gather operator must has at least one child");
+    return RC::INTERNAL;
+  }
+
+  if (scheduler_ && table_ != nullptr) {
+    scheduler_->init(table_->data_page_count());
+  }
+
+  trx_ = trx;
+  chunks_.clear();
+  cancelled_ = false;
+  worker_rc_ = RC::SUCCESS;
+  current_chunk_.reset();
+  current_index_ = 0;
+
+  running_workers_ = static_cast<int>(children_.size());
+  for (int i = 0; i < static_cast<int>(children_.size()); i++) {
+    threads_.emplace_back(&GatherPhysicalOperator::worker_main, this, i);
+  }
+  return RC::SUCCESS;
+}
+
+void GatherPhysicalOperator::worker_main(int worker)
+{
+  PhysicalOperator *child = children_[worker].get();
+  const size_t max_chunks = children_.size() * QUEUED_CHUNKS_PER_WORKER;
+
+  RC rc = child->open(trx_);
+  if (rc == RC::SUCCESS) {
+    Chunk chunk;
+    while (RC::SUCCESS == (rc = child->next_chunk(chunk))) {
+      unique_lock<mutex> guard(lock_);
+      not_full_.wait(guard, [this, max_chunks] { return cancelled_ || chunks_.size() < max_chunks; });
+      if (cancelled_) {
+        break;
+      }
+      chunks_.emplace_back();
+      chunks_.back().swap(chunk);
+      not_empty_.notify_one();
+    }
+
+    // 打开下层算子的线程负责关闭，页面上的锁要在同一个线程中释放
+    RC close_rc = child->close();
+    if (close_rc != RC::SUCCESS) {
+      LOG_WARN("failed to close worker operator. worker=%d, rc=%s", worker, strrc(close_rc));
+    }
+  } else {
+    LOG_WARN("failed to open worker operator. worker=%d, rc=%s", worker, strrc(rc));
+  }
+
+  lock_guard<mutex> guard(lock_);
+  if (rc != RC::SUCCESS && rc != RC::RECORD_EOF && !cancelled_ && worker_rc_ == RC::SUCCESS) {
+    worker_rc_ = rc;
+  }
+  running_workers_--;
+  not_empty_.notify_all();
+}
+
+RC GatherPhysicalOperator::pop_chunk(Chunk &chunk)
+{
+  unique_lock<mutex> guard(lock_);
+  not_empty_.wait(guard, [this] { return !chunks_.empty() || running_workers_ == 0 || worker_rc_ != RC::SUCCESS; });
+  if (worker_rc_ != RC::SUCCESS) {
+    return worker_rc_;
+  }
+  if (chunks_.empty()) {
+    return RC::RECORD_EOF;
+  }
+
+  chunk.swap(chunks_.front());
+  chunks_.pop_front();
+  not_full_.notify_one();
+  return RC::SUCCESS;
+}
+
+RC GatherPhysicalOperator::next_chunk(Chunk &chunk)
+{
+  return pop_chunk(chunk);
+}
+
+RC GatherPhysicalOperator::next()
+{
+  current_index_++;
+  while (current_index_ >= current_chunk_.size()) {
+    RC rc = pop_chunk(current_chunk_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    current_index_ = 0;
+  }
+
+  tuple_.set_row(current_chunk_.selection()[current_index_]);
+  return RC::SUCCESS;
+}
+
+Tuple *GatherPhysicalOperator::current_tuple()
+{
+  return &tuple_;
+}
+
+RC GatherPhysicalOperator::close()
+{
+  {
+    lock_guard<mutex> guard(lock_);
+    cancelled_ = true;
+    not_full_.notify_all();
+  }
+
+  for (thread &t : threads_) {
+    t.join();
+  }
+  threads_.clear();
+  chunks_.clear();
+  current_chunk_.reset();
+  current_index_ = 0;
+  return RC::SUCCESS;
+}
+
+RC GatherPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  return children_.empty() ? RC::UNIMPLENMENT : children_.front()->tuple_schema(schema);
+}
@@ -0,0 +1,94 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/operator/morsel_scheduler.h"
+#include "sql/expr/chunk.h"
+
+/**
+ * @brief 汇集多个工作线程数据的算子
+ * @ingroup PhysicalOperator
+ * @details 每个下层算子是一个工作线程执行的计划片段，比如并行扫描中的一个表扫描算子，它们的输出格式相同。
+ * open时为每个下层算子启动一个线程，线程中打开下层算子，按批读取数据放到一个有界的队列中，读完以后关闭下层算子。
+ * 上层算子从队列中按批或者逐行获取数据，行之间的顺序是不确定的。
+ * 队列满的时候工作线程等待，所以上层算子不再读取数据(比如LIMIT)时，工作线程也会停下来，close时通知它们退出。
+ * 工作线程不设置当前会话，不会输出SQL调试信息。
+ */
+class GatherPhysicalOperator : public PhysicalOperator
+{
+public:
+  /// 队列中最多缓存的批数是工作线程个数的倍数
+  static constexpr int QUEUED_CHUNKS_PER_WORKER = 4;
+
+public:
+  /**
+   * @param scheduler 下层的并行扫描共享的调度器，每次open时重新切分页面，可以为空
+   * @param table     扫描的表，用来获取页面个数
+   */
+  GatherPhysicalOperator(std::shared_ptr<MorselScheduler> scheduler, Table *table);
+  virtual ~GatherPhysicalOperator();
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::GATHER;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC next_chunk(Chunk &chunk) override;
+  bool support_chunk() const override { return true; }
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+private:
+  void worker_main(int worker);
+
+  /**
+   * @brief 从队列中取出一批数据，队列为空时等待
+   * @return 所有的工作线程都结束并且队列为空时返回RECORD_EOF，工作线程出错时返回错误
+   */
+  RC pop_chunk(Chunk &chunk);
+
+private:
+  std::shared_ptr<MorselScheduler> scheduler_;
+  Table                           *table_ = nullptr;
+  Trx                             *trx_ = nullptr;
+
+  std::vector<std::thread> threads_;
+  std::mutex               lock_;
+  std::condition_variable  not_empty_;
+  std::condition_variable  not_full_;
+  std::deque<Chunk>        chunks_;
+  int                      running_workers_ = 0;
+  bool                     cancelled_ = false;
+  RC                       worker_rc_ = RC::SUCCESS;  ///< 第一个出错的工作线程的错误码
+
+  Chunk         current_chunk_;
+  int           current_index_ = 0;  ///< 下一行在current_chunk_的selection中的位置
+  ChunkRowTuple tuple_{current_chunk_};
+};
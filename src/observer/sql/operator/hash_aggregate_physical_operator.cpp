@@ -0,0 +1,248 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+HashAggregatePhysicalOperator::HashAggregatePhysicalOperator(
+    vector<unique_ptr<Expression>> &&group_by_exprs, vector<unique_ptr<Expression>> &&exprs, const string &temp_dir)
+    : AggregatePhysicalOperator(std::move(group_by_exprs), std::move(exprs)), temp_dir_(temp_dir)
+{}
+
+string HashAggregatePhysicalOperator::param() const
+{
+  if (!partial_) {
+    return AggregatePhysicalOperator::param();
+  }
+  const string group_by = AggregatePhysicalOperator::param();
+  return group_by.empty() ? "PARTIAL" : "PARTIAL " + group_by;
+}
+
+RC HashAggregatePhysicalOperator::open(Trx *trx)
+{
+  RC rc = open_child(trx);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  reset_state();
+  rc = build();
+
+  // 局部聚合读完输入就关闭下层算子，与打开下层算子在同一个线程中
+  if (partial_) {
+    RC close_rc = children_[0]->close();
+    if (rc == RC::SUCCESS) {
+      rc = close_rc;
+    }
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to build aggregate hash table. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  return finish_build();
+}
+
+void HashAggregatePhysicalOperator::reset_state()
+{
+  hash_table_.init(key_num());
+  aggregator_.init(aggregates_);
+  full_ = false;
+  current_group_ = -1;
+  sorter_.init(temp_dir_);
+  spilled_rows_ = 0;
+  has_spilled_row_ = false;
+}
+
+RC HashAggregatePhysicalOperator::finish_build()
+{
+  if (spilled_rows_ > 0) {
+    RC rc = sorter_.sort();
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to sort spilled rows. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    rc = sorter_.next(sort_key_, spilled_cells_);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to read spilled rows. rc=%s", strrc(rc));
+      return rc;
+    }
+    has_spilled_row_ = true;
+    spilled_aggregator_.init(aggregates_);
+  }
+
+  LOG_TRACE("hash aggregate built. groups=%d, spilled rows=%ld, runs=%d",
+      hash_table_.group_num(), spilled_rows_, sorter_.run_num());
+  return RC::SUCCESS;
+}
+
+RC HashAggregatePhysicalOperator::build()
+{
+  const int key_num = this->key_num();
+  const size_t group_size = aggregator_.group_size() + key_num * sizeof(Value) + sizeof(uint32_t);
+
+  RC rc = RC::SUCCESS;
+  while (RC::SUCCESS == (rc = fetch_batch())) {
+    const int rows = batch_rows_;
+    hashes_.resize(rows);
+    groups_.resize(rows);
+
+    // 先计算所有行的哈希值，再查找分组，每个循环做的事情比较单一
+    for (int i = 0; i < rows; i++) {
+      hashes_[i] = JoinHashTable::hash(batch_keys(i), key_num);
+    }
+
+    bool has_spilled = false;
+    for (int i = 0; i < rows; i++) {
+      const Value *keys = batch_keys(i);
+      int group = hash_table_.find(keys, hashes_[i]);
+      if (group < 0 && !full_) {
+        group = hash_table_.insert(keys, hashes_[i]);
+        full_ = hash_table_.memory_size() + static_cast<size_t>(hash_table_.group_num()) * group_size > memory_limit_;
+      }
+      if (group < 0) {
+        rc = spill(i);
+        if (rc != RC::SUCCESS) {
+          return rc;
+        }
+        has_spilled = true;
+      }
+      groups_[i] = group;
+    }
+
+    // 溢出的行不在内存中聚合，把剩下的行移到前面
+    int valid_rows = rows;
+    if (has_spilled) {
+      valid_rows = 0;
+      for (int i = 0; i < rows; i++) {
+        if (groups_[i] < 0) {
+          continue;
+        }
+        groups_[valid_rows] = groups_[i];
+        for (vector<Value> &column : arg_columns_) {
+          if (!column.empty()) {
+            column[valid_rows] = column[i];
+          }
+        }
+        valid_rows++;
+      }
+    }
+
+    aggregator_.resize(hash_table_.group_num());
+    update_aggregates(aggregator_, groups_.data(), valid_rows);
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to read aggregate input. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  // 没有分组时，即使没有输入也要输出一行
+  if (key_num == 0 && hash_table_.group_num() == 0) {
+    hash_table_.insert(nullptr, JoinHashTable::hash(nullptr, 0));
+    aggregator_.resize(1);
+  }
+  return RC::SUCCESS;
+}
+
+RC HashAggregatePhysicalOperator::spill(int row)
+{
+  const Value *keys = batch_keys(row);
+  spilled_cells_.assign(keys, keys + key_num());
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    if (aggregates_[i]->child()) {
+      spilled_cells_.push_back(arg_columns_[i][row]);
+    }
+  }
+
+  sort_key_.clear();
+  for (int i = 0; i < key_num(); i++) {
+    SortKey::append(sort_key_, keys[i]);
+  }
+
+  RC rc = sorter_.add(sort_key_, spilled_cells_.data(), static_cast<int>(spilled_cells_.size()));
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to spill aggregate input. rc=%s", strrc(rc));
+    return rc;
+  }
+  spilled_rows_++;
+  return RC::SUCCESS;
+}
+
+RC HashAggregatePhysicalOperator::next()
+{
+  if (current_group_ + 1 < hash_table_.group_num()) {
+    current_group_++;
+    set_output(hash_table_.keys(current_group_), aggregator_, current_group_);
+    return RC::SUCCESS;
+  }
+  return next_spilled();
+}
+
+RC HashAggregatePhysicalOperator::next_spilled()
+{
+  if (!has_spilled_row_) {
+    return RC::RECORD_EOF;
+  }
+
+  // key相同的行是连续的，聚合到只有一个分组的状态中
+  const int key_num = this->key_num();
+  const string group_sort_key = sort_key_;
+  spilled_keys_.assign(spilled_cells_.begin(), spilled_cells_.begin() + key_num);
+  spilled_aggregator_.resize(0);
+  spilled_aggregator_.resize(1);
+
+  const int group = 0;
+  RC rc = RC::SUCCESS;
+  do {
+    update_group(spilled_aggregator_, spilled_cells_.data(), group);
+    rc = sorter_.next(sort_key_, spilled_cells_);
+  } while (rc == RC::SUCCESS && sort_key_ == group_sort_key);
+
+  if (rc == RC::RECORD_EOF) {
+    has_spilled_row_ = false;
+  } else if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to read spilled rows. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  set_output(spilled_keys_.data(), spilled_aggregator_, group);
+  return RC::SUCCESS;
+}
+
+void HashAggregatePhysicalOperator::update_group(Aggregator &aggregator, const Value *cells, int group)
+{
+  int offset = key_num();
+  for (size_t i = 0; i < aggregates_.size(); i++) {
+    if (aggregates_[i]->child()) {
+      aggregator.update(static_cast<int>(i), &cells[offset], &group, 1);
+      offset++;
+    } else {
+      aggregator.update(static_cast<int>(i), nullptr, &group, 1);
+    }
+  }
+}
+
+RC HashAggregatePhysicalOperator::close()
+{
+  hash_table_.init(key_num());
+  aggregator_.resize(0);
+  sorter_.reset();
+  has_spilled_row_ = false;
+  return partial_ ? RC::SUCCESS : children_[0]->close();
+}
@@ -0,0 +1,120 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "sql/operator/aggregate_physical_operator.h"
+#include "sql/operator/external_sorter.h"
+
+/**
+ * @brief hash分组聚合算子
+ * @ingroup PhysicalOperator
+ * @details open时读取全部输入：每批数据先计算所有行的哈希值，再在hash表中查找或者创建分组，
+ * 最后按列更新聚合函数的状态。分组占用的内存超过限制时不再创建新的分组，已有分组的行仍然在内存中聚合，
+ * 其它的行按照分组的key写到外部排序中，排序的数据超过内存限制时会写到临时文件。
+ * 输出时先输出内存中的分组，再按照key的顺序读取溢出的行，key相同的连续的行是一个分组，流式聚合后输出。
+ * 溢出的分组与内存中的分组没有重叠，所以结果是正确的。
+ */
+class HashAggregatePhysicalOperator : public AggregatePhysicalOperator
+{
+public:
+  static constexpr size_t DEFAULT_MEMORY_LIMIT = 16 * 1024 * 1024;
+
+public:
+  /**
+   * @param temp_dir 溢出时临时文件所在的目录
+   */
+  HashAggregatePhysicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_exprs,
+      std::vector<std::unique_ptr<Expression>> &&exprs, const std::string &temp_dir);
+  virtual ~HashAggregatePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::HASH_AGGREGATE;
+  }
+
+  std::string param() const override;
+
+  /**
+   * @brief 设置hash表最多使用的内存
+   */
+  void   set_memory_limit(size_t memory_limit) { memory_limit_ = memory_limit; }
+  size_t memory_limit() const { return memory_limit_; }
+
+  const std::string &temp_dir() const { return temp_dir_; }
+
+  /**
+   * @brief 设置为并行聚合中一个工作线程的局部聚合
+   * @details 局部聚合在open时读完输入就关闭下层算子，聚合的结果不通过next输出，
+   * 由 ParallelHashAggregatePhysicalOperator 合并
+   */
+  void set_partial(bool partial) { partial_ = partial; }
+  bool partial() const { return partial_; }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  /**
+   * @brief 溢出到外部排序中的行数
+   */
+  int64_t spilled_rows() const { return spilled_rows_; }
+
+protected:
+  /**
+   * @brief 清空hash表和溢出的数据，准备聚合
+   */
+  void reset_state();
+
+  /**
+   * @brief 所有的输入都聚合完以后，对溢出的行排序并读取第一行
+   */
+  RC finish_build();
+
+  /**
+   * @brief 使用溢出的一行(依次是key和聚合函数的参数)更新一个分组
+   */
+  void update_group(Aggregator &aggregator, const Value *cells, int group);
+
+private:
+  RC build();
+  RC spill(int row);
+  RC next_spilled();
+
+  friend class ParallelHashAggregatePhysicalOperator;
+
+protected:
+  std::string temp_dir_;
+  size_t      memory_limit_ = DEFAULT_MEMORY_LIMIT;
+  bool        partial_ = false;
+
+  AggregateHashTable    hash_table_;
+  Aggregator            aggregator_;
+  std::vector<uint32_t> hashes_;
+  std::vector<int>      groups_;
+  bool                  full_ = false;  ///< 内存已经用完，不再创建新的分组
+  int                   current_group_ = -1;
+
+  ExternalSorter     sorter_;
+  int64_t            spilled_rows_ = 0;
+  std::string        sort_key_;
+  std::vector<Value> spilled_cells_;  ///< 溢出的一行，依次是key和聚合函数的参数
+  std::vector<Value> spilled_keys_;   ///< 正在聚合的溢出分组的key
+  bool               has_spilled_row_ = false;
+  Aggregator         spilled_aggregator_;
+};
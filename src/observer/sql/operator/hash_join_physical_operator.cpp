@@ -0,0 +1,298 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+
+#include "sql/operator/hash_join_physical_operator.h"
+#include "common/lang/bloom_filter.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+void JoinHashTable::init(int key_num, int cell_num)
+{
+  key_num_  = key_num;
+  cell_num_ = cell_num;
+  keys_.clear();
+  cells_.clear();
+  hashes_.clear();
+  next_.clear();
+  slots_.clear();
+  mask_ = 0;
+}
+
+void JoinHashTable::append(const Value *keys, const Value *cells)
+{
+  keys_.insert(keys_.end(), keys, keys + key_num_);
+  cells_.insert(cells_.end(), cells, cells + cell_num_);
+  hashes_.push_back(hash(keys, key_num_));
+}
+
+void JoinHashTable::build()
+{
+  const int rows = row_num();
+  // 负载因子不超过0.5，线性探测的路径比较短
+  size_t capacity = 16;
+  while (capacity < static_cast<size_t>(rows) * 2) {
+    capacity <<= 1;
+  }
+  slots_.assign(capacity, Slot{0, -1});
+  mask_ = static_cast<uint32_t>(capacity - 1);
+  next_.assign(rows, -1);
+
+  // 倒序插入，key相同的行插入到链表头部，这样链表中的顺序与追加的顺序相同
+  for (int row = rows - 1; row >= 0; row--) {
+    const uint32_t hash = hashes_[row];
+    for (uint32_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+      Slot &slot = slots_[pos];
+      if (slot.row < 0) {
+        slot.hash = hash;
+        slot.row  = row;
+        break;
+      }
+      if (slot.hash == hash && key_equal(slot.row, keys_.data() + static_cast<size_t>(row) * key_num_)) {
+        next_[row] = slot.row;
+        slot.row   = row;
+        break;
+      }
+    }
+  }
+}
+
+int JoinHashTable::find(const Value *keys) const
+{
+  if (slots_.empty()) {
+    return -1;
+  }
+
+  const uint32_t hash = JoinHashTable::hash(keys, key_num_);
+  for (uint32_t pos = hash & mask_;; pos = (pos + 1) & mask_) {
+    const Slot &slot = slots_[pos];
+    if (slot.row < 0) {
+      return -1;
+    }
+    if (slot.hash == hash && key_equal(slot.row, keys)) {
+      return slot.row;
+    }
+  }
+}
+
+bool JoinHashTable::key_equal(int row, const Value *keys) const
+{
+  const Value *row_keys = keys_.data() + static_cast<size_t>(row) * key_num_;
+  for (int i = 0; i < key_num_; i++) {
+    if (row_keys[i].compare(keys[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint32_t JoinHashTable::hash(const Value *keys, int key_num)
+{
+  uint64_t hash = 0;
+  for (int i = 0; i < key_num; i++) {
+    const Value &key = keys[i];
+    // 字符串只比较'\0'之前的部分
+    const size_t length = (key.attr_type() == CHARS) ? strlen(key.data()) : static_cast<size_t>(key.length());
+    const uint64_t key_hash = common::BlockedBloomFilter::hash_bytes(key.data(), length);
+    hash ^= key_hash + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  }
+  return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+HashJoinPhysicalOperator::HashJoinPhysicalOperator(
+    vector<unique_ptr<Expression>> &&left_keys, vector<unique_ptr<Expression>> &&right_keys, bool build_left)
+    : left_keys_(std::move(left_keys)), right_keys_(std::move(right_keys)), build_left_(build_left)
+{}
+
+static string key_name(const Expression &expr)
+{
+  if (expr.type() == ExprType::FIELD) {
+    const Field &field = static_cast<const FieldExpr &>(expr).field();
+    return string(field.table_name()) + "." + field.field_name();
+  }
+  return expr.name();
+}
+
+string HashJoinPhysicalOperator::param() const
+{
+  string param;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (i > 0) {
+      param += " AND ";
+    }
+    param += key_name(*left_keys_[i]) + "=" + key_name(*right_keys_[i]);
+  }
+  param += build_left_ ? ", BUILD LEFT" : ", BUILD RIGHT";
+  return param;
+}
+
+RC HashJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 2) {
+    LOG_WARN("hash join operator should have 2 children");
+    return RC::INTERNAL;
+  }
+
+  build_ = children_[build_left_ ? 0 : 1].get();
+  probe_ = children_[build_left_ ? 1 : 0].get();
+  current_row_ = -1;
+
+  RC rc = build(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to build hash table. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = probe_->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open probe operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  build_tuple_.set_schema(&build_speces_);
+  if (build_left_) {
+    joined_tuple_.set_left(&build_tuple_);
+  } else {
+    joined_tuple_.set_right(&build_tuple_);
+  }
+  return rc;
+}
+
+RC HashJoinPhysicalOperator::build(Trx *trx)
+{
+  RC rc = build_->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open build operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  const vector<unique_ptr<Expression>> &key_exprs = build_left_ ? left_keys_ : right_keys_;
+  build_speces_.clear();
+  hash_table_.init(static_cast<int>(key_exprs.size()), 0);
+
+  vector<Value> keys;
+  vector<Value> cells;
+  while (RC::SUCCESS == (rc = build_->next())) {
+    Tuple *tuple = build_->current_tuple();
+    if (build_speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, build_speces_);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get schema of build tuple. rc=%s", strrc(rc));
+        build_->close();
+        return rc;
+      }
+      hash_table_.init(static_cast<int>(key_exprs.size()), tuple->cell_num());
+    }
+
+    rc = MaterializedTuple::copy_cells(*tuple, cells);
+    if (rc == RC::SUCCESS) {
+      rc = eval_keys(*tuple, key_exprs, keys);
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to copy build tuple. rc=%s", strrc(rc));
+      build_->close();
+      return rc;
+    }
+    hash_table_.append(keys.data(), cells.data());
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to fetch build tuple. rc=%s", strrc(rc));
+    build_->close();
+    return rc;
+  }
+
+  // 数据已经复制出来了，build端可以提前关闭
+  rc = build_->close();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to close build operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  hash_table_.build();
+  LOG_TRACE("hash join build done. rows=%d", hash_table_.row_num());
+  return RC::SUCCESS;
+}
+
+RC HashJoinPhysicalOperator::eval_keys(
+    const Tuple &tuple, const vector<unique_ptr<Expression>> &key_exprs, vector<Value> &keys)
+{
+  keys.resize(key_exprs.size());
+  for (size_t i = 0; i < key_exprs.size(); i++) {
+    RC rc = key_exprs[i]->get_value(tuple, keys[i]);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get join key. index=%d, rc=%s", static_cast<int>(i), strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC HashJoinPhysicalOperator::next()
+{
+  if (current_row_ >= 0) {
+    current_row_ = hash_table_.next(current_row_);
+  }
+
+  const vector<unique_ptr<Expression>> &key_exprs = build_left_ ? right_keys_ : left_keys_;
+  while (current_row_ < 0) {
+    if (hash_table_.row_num() == 0) {
+      return RC::RECORD_EOF;
+    }
+
+    RC rc = probe_->next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    Tuple *probe_tuple = probe_->current_tuple();
+    rc = eval_keys(*probe_tuple, key_exprs, probe_keys_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    current_row_ = hash_table_.find(probe_keys_.data());
+    if (build_left_) {
+      joined_tuple_.set_right(probe_tuple);
+    } else {
+      joined_tuple_.set_left(probe_tuple);
+    }
+  }
+
+  build_tuple_.set_cells(hash_table_.cells(current_row_));
+  return RC::SUCCESS;
+}
+
+RC HashJoinPhysicalOperator::close()
+{
+  if (nullptr == probe_) {
+    return RC::SUCCESS;
+  }
+
+  RC rc = probe_->close();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to close probe operator. rc=%s", strrc(rc));
+  }
+  hash_table_.init(0, 0);
+  return rc;
+}
+
+Tuple *HashJoinPhysicalOperator::current_tuple()
+{
+  return &joined_tuple_;
+}
@@ -0,0 +1,137 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief hash join使用的内存hash表
+ * @ingroup PhysicalOperator
+ * @details 数据按照追加的顺序连续存放，所有数据追加完成以后调用build建立索引。
+ * 索引是开放地址(线性探测)的槽位数组，每个槽位只有8个字节，保存哈希值和第一行的行号，
+ * 探测时先比较哈希值，大部分不相同的key不需要访问行数据。key相同的行通过next串起来，
+ * 顺序与追加的顺序相同。
+ */
+class JoinHashTable
+{
+public:
+  /**
+   * @param key_num 每行key的个数
+   * @param cell_num 每行值的个数
+   */
+  void init(int key_num, int cell_num);
+
+  void append(const Value *keys, const Value *cells);
+
+  /**
+   * @brief 建立索引，之后不能再追加数据
+   */
+  void build();
+
+  int row_num() const { return static_cast<int>(hashes_.size()); }
+
+  /**
+   * @brief 查找key相同的第一行，没有时返回-1
+   */
+  int find(const Value *keys) const;
+
+  /**
+   * @brief key相同的下一行，没有时返回-1
+   */
+  int next(int row) const { return next_[row]; }
+
+  const Value *cells(int row) const { return cells_.data() + static_cast<size_t>(row) * cell_num_; }
+
+  static uint32_t hash(const Value *keys, int key_num);
+
+private:
+  struct Slot
+  {
+    uint32_t hash;
+    int32_t  row;  ///< -1 表示空的槽位
+  };
+
+  bool key_equal(int row, const Value *keys) const;
+
+private:
+  int                   key_num_  = 0;
+  int                   cell_num_ = 0;
+  std::vector<Value>    keys_;
+  std::vector<Value>    cells_;
+  std::vector<uint32_t> hashes_;
+  std::vector<int>      next_;
+  std::vector<Slot>     slots_;
+  uint32_t              mask_ = 0;
+};
+
+/**
+ * @brief 等值连接的hash join算子
+ * @ingroup PhysicalOperator
+ * @details 先读取build端的全部数据建立hash表，再逐行读取probe端，在hash表中查找key相同的行。
+ * build端通常是估算行数较少的一端。输出的元组仍然是左表在前、右表在后，与NestedLoopJoin相同。
+ * 这里只处理等值的连接条件，其它的条件还需要上层的过滤算子计算。
+ * 浮点数的比较有误差，不能作为hash的key。
+ */
+class HashJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param left_keys 在左表元组上计算的key
+   * @param right_keys 在右表元组上计算的key，与left_keys一一对应
+   * @param build_left 是否使用左表建立hash表
+   */
+  HashJoinPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&left_keys,
+      std::vector<std::unique_ptr<Expression>> &&right_keys, bool build_left);
+  virtual ~HashJoinPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::HASH_JOIN;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+private:
+  RC build(Trx *trx);
+
+  static RC eval_keys(
+      const Tuple &tuple, const std::vector<std::unique_ptr<Expression>> &key_exprs, std::vector<Value> &keys);
+
+private:
+  std::vector<std::unique_ptr<Expression>> left_keys_;
+  std::vector<std::unique_ptr<Expression>> right_keys_;
+  bool                                     build_left_ = false;
+
+  PhysicalOperator *build_ = nullptr;
+  PhysicalOperator *probe_ = nullptr;
+
+  JoinHashTable              hash_table_;
+  std::vector<TupleCellSpec> build_speces_;  ///< build端元组的schema
+  std::vector<Value>         probe_keys_;
+  int                        current_row_ = -1;  ///< 当前匹配的build端的行
+
+  MaterializedTuple build_tuple_;
+  JoinedTuple       joined_tuple_;
+};
@@ -0,0 +1,221 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+
+#include "sql/operator/index_merge_scan_physical_operator.h"
+#include "storage/index/index.h"
+#include "storage/table/table.h"
+#include "storage/trx/trx.h"
+
+using namespace std;
+
+static bool rid_less(const RID &left, const RID &right) { return RID::compare(&left, &right) < 0; }
+
+RC IndexMergeScanPhysicalOperator::open(Trx *trx)
+{
+  if (nullptr == table_ || branches_.empty()) {
+    return RC::INTERNAL;
+  }
+
+  record_handler_ = table_->record_handler();
+  if (nullptr == record_handler_) {
+    LOG_WARN("invalid record handler");
+    return RC::INTERNAL;
+  }
+
+  RC rc = merge_rids();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to merge rids from indexes. table=%s, rc=%s", table_->name(), strrc(rc));
+    return rc;
+  }
+  rid_pos_ = 0;
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+
+  tuple_.set_schema(table_, table_->table_meta().field_metas());
+
+  trx_ = trx;
+  return RC::SUCCESS;
+}
+
+RC IndexMergeScanPhysicalOperator::scan_branch(const Branch &branch, vector<RID> &rids)
+{
+  const Value &left = branch.left_value;
+  const Value &right = branch.right_value;
+  const bool has_left = left.attr_type() != UNDEFINED;
+  const bool has_right = right.attr_type() != UNDEFINED;
+  IndexScanner *scanner = branch.index->create_scanner(has_left ? left.data() : nullptr,
+      has_left ? left.length() : 0,
+      branch.left_inclusive,
+      has_right ? right.data() : nullptr,
+      has_right ? right.length() : 0,
+      branch.right_inclusive,
+      false /*reverse*/);
+  if (nullptr == scanner) {
+    LOG_WARN("failed to create index scanner. index=%s", branch.index->index_meta().name());
+    return RC::INTERNAL;
+  }
+
+  rids.clear();
+  RC rc = RC::SUCCESS;
+  RID rid;
+  while (RC::SUCCESS == (rc = scanner->next_entry(&rid))) {
+    rids.push_back(rid);
+  }
+  scanner->destroy();
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to scan index. index=%s, rc=%s", branch.index->index_meta().name(), strrc(rc));
+    return rc;
+  }
+
+  sort(rids.begin(), rids.end(), rid_less);
+  rids.erase(unique(rids.begin(), rids.end()), rids.end());
+  return RC::SUCCESS;
+}
+
+RC IndexMergeScanPhysicalOperator::merge_rids()
+{
+  rids_.clear();
+  vector<RID> branch_rids;
+  vector<RID> merged;
+  for (size_t i = 0; i < branches_.size(); i++) {
+    RC rc = scan_branch(branches_[i], branch_rids);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    if (i == 0) {
+      rids_.swap(branch_rids);
+    } else {
+      merged.clear();
+      if (merge_type_ == MergeType::UNION) {
+        set_union(rids_.begin(), rids_.end(), branch_rids.begin(), branch_rids.end(), back_inserter(merged), rid_less);
+      } else {
+        set_intersection(
+            rids_.begin(), rids_.end(), branch_rids.begin(), branch_rids.end(), back_inserter(merged), rid_less);
+      }
+      rids_.swap(merged);
+    }
+
+    if (merge_type_ == MergeType::INTERSECTION && rids_.empty()) {
+      break;
+    }
+  }
+
+  LOG_TRACE("index merge got %lu rids. table=%s", rids_.size(), table_->name());
+  return RC::SUCCESS;
+}
+
+RC IndexMergeScanPhysicalOperator::next()
+{
+  RC rc = RC::SUCCESS;
+  bool filter_result = false;
+  while (rid_pos_ < rids_.size()) {
+    // RID是按照物理位置排序的，同一个页面上的数据是连续的
+    rc = fetch_record(rids_[rid_pos_++]);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    tuple_.set_record(&current_record_);
+    rc = filter(tuple_, filter_result);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    if (!filter_result) {
+      continue;
+    }
+
+    rc = trx_->visit_record(table_, current_record_, readonly_);
+    if (rc == RC::RECORD_INVISIBLE) {
+      continue;
+    } else {
+      return rc;
+    }
+  }
+
+  return RC::RECORD_EOF;
+}
+
+RC IndexMergeScanPhysicalOperator::fetch_record(const RID &rid)
+{
+  if (fetched_page_num_ == rid.page_num) {
+    return record_page_handler_.get_record(&rid, &current_record_);
+  }
+
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+
+  RC rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
+  if (rc == RC::SUCCESS) {
+    fetched_page_num_ = rid.page_num;
+  }
+  return rc;
+}
+
+RC IndexMergeScanPhysicalOperator::close()
+{
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+  rids_.clear();
+  rid_pos_ = 0;
+  return RC::SUCCESS;
+}
+
+Tuple *IndexMergeScanPhysicalOperator::current_tuple()
+{
+  tuple_.set_record(&current_record_);
+  return &tuple_;
+}
+
+void IndexMergeScanPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&exprs)
+{
+  predicates_ = std::move(exprs);
+}
+
+RC IndexMergeScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
+{
+  RC rc = RC::SUCCESS;
+  Value value;
+  for (unique_ptr<Expression> &expr : predicates_) {
+    rc = expr->get_value(tuple, value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    bool tmp_result = value.get_boolean();
+    if (!tmp_result) {
+      result = false;
+      return rc;
+    }
+  }
+
+  result = true;
+  return rc;
+}
+
+string IndexMergeScanPhysicalOperator::param() const
+{
+  string param = (merge_type_ == MergeType::UNION) ? "UNION(" : "INTERSECTION(";
+  for (size_t i = 0; i < branches_.size(); i++) {
+    if (i > 0) {
+      param += ", ";
+    }
+    param += branches_[i].index->index_meta().name();
+  }
+  param += ") ON ";
+  param += table_->name();
+  return param;
+}
@@ -0,0 +1,105 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/tuple.h"
+#include "storage/record/record_manager.h"
+
+class Index;
+
+/**
+ * @brief 索引合并扫描物理算子
+ * @ingroup PhysicalOperator
+ * @details 从多个索引(或者同一个索引的多个范围)中分别取出满足条件的RID，求并集(用于OR条件)
+ * 或者交集(用于多个选择性都不好的AND条件)，去重并按照记录的物理位置排序后再回表，每个页面只访问一次。
+ * 索引中可能有已经删除的数据(MVCC)，而且每个分支只使用了部分条件，回表以后仍然需要使用所有的谓词过滤。
+ */
+class IndexMergeScanPhysicalOperator : public PhysicalOperator
+{
+public:
+  enum class MergeType
+  {
+    UNION,         ///< 并集，满足任意一个分支的数据
+    INTERSECTION,  ///< 交集，满足所有分支的数据
+  };
+
+  /**
+   * @brief 一个分支，扫描索引中的一个范围
+   * @details 边界的类型是UNDEFINED时表示这一边没有限制
+   */
+  struct Branch
+  {
+    Index *index = nullptr;
+    Value  left_value;
+    bool   left_inclusive = false;
+    Value  right_value;
+    bool   right_inclusive = false;
+  };
+
+public:
+  IndexMergeScanPhysicalOperator(Table *table, MergeType merge_type, bool readonly)
+      : table_(table), merge_type_(merge_type), readonly_(readonly)
+  {}
+
+  virtual ~IndexMergeScanPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::INDEX_MERGE_SCAN; }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+  Tuple *current_tuple() override;
+
+  void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
+
+  void add_branch(Branch &&branch) { branches_.emplace_back(std::move(branch)); }
+  const std::vector<Branch> &branches() const { return branches_; }
+  MergeType merge_type() const { return merge_type_; }
+
+  /**
+   * @brief 从一个分支中获取所有的RID，结果按照物理位置排序并且去重
+   */
+  static RC scan_branch(const Branch &branch, std::vector<RID> &rids);
+
+private:
+  RC merge_rids();
+  RC fetch_record(const RID &rid);
+
+  // 与TableScanPhysicalOperator代码相同，可以优化
+  RC filter(RowTuple &tuple, bool &result);
+
+private:
+  Trx               *trx_ = nullptr;
+  Table             *table_ = nullptr;
+  MergeType          merge_type_ = MergeType::UNION;
+  bool               readonly_ = false;
+  RecordFileHandler *record_handler_ = nullptr;
+
+  std::vector<Branch> branches_;
+
+  std::vector<RID> rids_;         ///< 合并以后的RID，按照物理位置排序
+  size_t           rid_pos_ = 0;  ///< 下一个要回表的RID
+
+  RecordPageHandler record_page_handler_;
+  PageNum           fetched_page_num_ = BP_INVALID_PAGE_NUM;  ///< record_page_handler_ 当前持有的页面
+  Record            current_record_;
+  RowTuple          tuple_;
+
+  std::vector<std::unique_ptr<Expression>> predicates_;
+};
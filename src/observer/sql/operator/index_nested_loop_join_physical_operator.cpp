@@ -0,0 +1,225 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+
+#include "sql/operator/index_nested_loop_join_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+IndexNestedLoopJoinPhysicalOperator::IndexNestedLoopJoinPhysicalOperator(
+    unique_ptr<Expression> outer_key, unique_ptr<Expression> inner_key, int batch_size)
+    : outer_key_(std::move(outer_key)), inner_key_(std::move(inner_key)), batch_size_(batch_size)
+{}
+
+static string key_name(const Expression &expr)
+{
+  if (expr.type() == ExprType::FIELD) {
+    const Field &field = static_cast<const FieldExpr &>(expr).field();
+    return string(field.table_name()) + "." + field.field_name();
+  }
+  return expr.name();
+}
+
+string IndexNestedLoopJoinPhysicalOperator::param() const
+{
+  string param = key_name(*outer_key_) + "=" + key_name(*inner_key_);
+  if (batch_size_ > 0) {
+    param += ", BATCH " + to_string(batch_size_);
+  }
+  return param;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 2 || children_[1]->type() != PhysicalOperatorType::INDEX_SCAN) {
+    LOG_WARN("index nested loop join operator should have 2 children and the right one should be index scan");
+    return RC::INTERNAL;
+  }
+
+  outer_ = children_[0].get();
+  inner_ = static_cast<IndexScanPhysicalOperator *>(children_[1].get());
+
+  RC rc = outer_->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open outer operator. rc=%s", strrc(rc));
+    return rc;
+  }
+  outer_opened_ = true;
+
+  // 内表在拿到第一个key以后再打开，哈希索引不支持没有范围的扫描
+  trx_ = trx;
+  inner_valid_ = false;
+  outer_eof_ = false;
+  batch_pos_ = 0;
+  batch_order_.clear();
+  batch_speces_.clear();
+  batch_tuple_.set_schema(&batch_speces_);
+  return rc;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::fetch_batch()
+{
+  batch_cells_.clear();
+  batch_keys_.clear();
+  batch_order_.clear();
+  batch_pos_ = 0;
+
+  RC rc = RC::SUCCESS;
+  while (!outer_eof_ && static_cast<int>(batch_keys_.size()) < batch_size_) {
+    rc = outer_->next();
+    if (rc == RC::RECORD_EOF) {
+      outer_eof_ = true;
+      break;
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch outer tuple. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    Tuple *tuple = outer_->current_tuple();
+    if (batch_speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, batch_speces_);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    rc = MaterializedTuple::copy_cells(*tuple, cells_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    batch_cells_.insert(batch_cells_.end(), cells_.begin(), cells_.end());
+
+    batch_keys_.emplace_back();
+    rc = outer_key_->get_value(*tuple, batch_keys_.back());
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get outer key. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  for (int i = 0; i < static_cast<int>(batch_keys_.size()); i++) {
+    batch_order_.push_back(i);
+  }
+  std::stable_sort(batch_order_.begin(), batch_order_.end(), [this](int left, int right) {
+    return batch_keys_[left].compare(batch_keys_[right]) < 0;
+  });
+
+  return batch_order_.empty() ? RC::RECORD_EOF : RC::SUCCESS;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::outer_next()
+{
+  RC rc = RC::SUCCESS;
+  if (batch_size_ > 0) {
+    if (batch_pos_ >= batch_order_.size()) {
+      rc = fetch_batch();
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    const int row = batch_order_[batch_pos_++];
+    batch_tuple_.set_cells(batch_cells_.data() + static_cast<size_t>(row) * batch_speces_.size());
+    joined_tuple_.set_left(&batch_tuple_);
+    key_ = batch_keys_[row];
+  } else {
+    rc = outer_->next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    Tuple *tuple = outer_->current_tuple();
+    rc = outer_key_->get_value(*tuple, key_);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get outer key. rc=%s", strrc(rc));
+      return rc;
+    }
+    joined_tuple_.set_left(tuple);
+  }
+
+  if (!inner_opened_) {
+    inner_->set_range(&key_, true, &key_, true);
+    rc = inner_->open(trx_);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to open inner operator. rc=%s", strrc(rc));
+      return rc;
+    }
+    inner_opened_ = true;
+  } else {
+    rc = inner_->rescan(&key_, true, &key_, true);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to rescan inner index. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  inner_valid_ = true;
+  return rc;
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::next()
+{
+  while (true) {
+    if (inner_valid_) {
+      RC rc = inner_->next();
+      if (rc == RC::SUCCESS) {
+        joined_tuple_.set_right(inner_->current_tuple());
+        return rc;
+      }
+      if (rc != RC::RECORD_EOF) {
+        LOG_WARN("failed to fetch inner tuple. rc=%s", strrc(rc));
+        return rc;
+      }
+      inner_valid_ = false;
+    }
+
+    RC rc = outer_next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+}
+
+RC IndexNestedLoopJoinPhysicalOperator::close()
+{
+  RC rc = RC::SUCCESS;
+  if (outer_opened_) {
+    outer_opened_ = false;
+    rc = outer_->close();
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to close outer operator. rc=%s", strrc(rc));
+    }
+  }
+
+  if (inner_opened_) {
+    inner_opened_ = false;
+    RC rc2 = inner_->close();
+    if (rc2 != RC::SUCCESS) {
+      LOG_WARN("failed to close inner operator. rc=%s", strrc(rc2));
+      rc = rc2;
+    }
+  }
+
+  batch_cells_.clear();
+  batch_keys_.clear();
+  batch_order_.clear();
+  return rc;
+}
+
+Tuple *IndexNestedLoopJoinPhysicalOperator::current_tuple()
+{
+  return &joined_tuple_;
+}
@@ -0,0 +1,92 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/operator/index_scan_physical_operator.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 索引嵌套循环连接(index nested loop join)算子
+ * @ingroup PhysicalOperator
+ * @details 左表(外表)的每一行计算连接的key，使用key在右表(内表)的索引上做一次等值扫描，
+ * 不需要像 NestedLoopJoinPhysicalOperator 那样每次都扫描整个内表。右边的子算子必须是
+ * IndexScanPhysicalOperator，内表自己的过滤条件仍然由索引扫描计算。
+ * 设置了批量大小时，先读取一批外表数据，按照key排序以后再依次查找，相邻的查找访问的索引页面和
+ * 数据页面大多相同，可以减少随机访问。这时输出的数据在一批之内按照key有序。
+ */
+class IndexNestedLoopJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param outer_key 外表中连接的key，与内表索引字段的类型相同
+   * @param inner_key 内表中连接的key，只用来显示
+   * @param batch_size 外表数据批量排序的行数，0表示不使用批量
+   */
+  IndexNestedLoopJoinPhysicalOperator(
+      std::unique_ptr<Expression> outer_key, std::unique_ptr<Expression> inner_key, int batch_size);
+  virtual ~IndexNestedLoopJoinPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::INDEX_NESTED_LOOP_JOIN;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+private:
+  /**
+   * @brief 获取外表的下一行，并且使用它的key重新扫描内表
+   */
+  RC outer_next();
+
+  /**
+   * @brief 批量读取外表数据并按照key排序
+   */
+  RC fetch_batch();
+
+private:
+  std::unique_ptr<Expression> outer_key_;
+  std::unique_ptr<Expression> inner_key_;
+  int                         batch_size_ = 0;
+
+  Trx                       *trx_ = nullptr;
+  PhysicalOperator          *outer_ = nullptr;
+  IndexScanPhysicalOperator *inner_ = nullptr;
+  bool                       outer_opened_ = false;
+  bool                       inner_opened_ = false;
+  bool                       inner_valid_ = false;  ///< 内表当前的扫描是否还有数据
+
+  Value       key_;
+  JoinedTuple joined_tuple_;
+
+  std::vector<TupleCellSpec> batch_speces_;
+  std::vector<Value>         batch_cells_;  ///< 一批外表数据，每行的值依次存放
+  std::vector<Value>         batch_keys_;
+  std::vector<int>           batch_order_;  ///< 按照key排序后的行号
+  std::vector<Value>         cells_;
+  size_t                     batch_pos_ = 0;
+  bool                       outer_eof_ = false;
+  MaterializedTuple          batch_tuple_;
+};
@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/07/08.
 //
 
+#include <algorithm>
+
 #include "sql/operator/index_scan_physical_operator.h"
 #include "storage/index/index.h"
 #include "storage/trx/trx.h"
@@ -40,41 +42,111 @@ RC IndexScanPhysicalOperator::open(Trx *trx)
     return RC::INTERNAL;
   }
 
-  IndexScanner *index_scanner = index_->create_scanner(left_value_.data(),
-      left_value_.length(),
-      left_inclusive_,
-      right_value_.data(),
-      right_value_.length(),
-      right_inclusive_);
-  if (nullptr == index_scanner) {
-    LOG_WARN("failed to create index scanner");
-    return RC::INTERNAL;
+  RC rc = create_index_scanner();
+  if (rc != RC::SUCCESS) {
+    return rc;
   }
 
   record_handler_ = table_->record_handler();
   if (nullptr == record_handler_) {
     LOG_WARN("invalid record handler");
-    index_scanner->destroy();
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
     return RC::INTERNAL;
   }
-  index_scanner_ = index_scanner;
 
+  if (index_only_) {
+    // 只有索引字段是有效的，其它字段都不会被访问到
+    const int record_size = table_->table_meta().record_size();
+    char *record_data = (char *)malloc(record_size);
+    ASSERT(nullptr != record_data, "failed to malloc memory. record data size=%d", record_size);
+    memset(record_data, 0, record_size);
+    index_record_.set_data_owner(record_data, record_size);
+  }
+
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
   tuple_.set_schema(table_, table_->table_meta().field_metas());
 
   trx_ = trx;
   return RC::SUCCESS;
 }
 
+RC IndexScanPhysicalOperator::create_index_scanner()
+{
+  // 没有设置的边界表示这一边没有限制
+  const bool has_left = left_value_.attr_type() != UNDEFINED;
+  const bool has_right = right_value_.attr_type() != UNDEFINED;
+  IndexScanner *index_scanner = index_->create_scanner(has_left ? left_value_.data() : nullptr,
+      has_left ? left_value_.length() : 0,
+      left_inclusive_,
+      has_right ? right_value_.data() : nullptr,
+      has_right ? right_value_.length() : 0,
+      right_inclusive_,
+      reverse_);
+  if (nullptr == index_scanner) {
+    LOG_WARN("failed to create index scanner");
+    return RC::INTERNAL;
+  }
+  index_scanner_ = index_scanner;
+
+  rid_batch_.clear();
+  rid_batch_pos_ = 0;
+  index_eof_ = false;
+  return RC::SUCCESS;
+}
+
+RC IndexScanPhysicalOperator::rescan(
+    const Value *left_value, bool left_inclusive, const Value *right_value, bool right_inclusive)
+{
+  if (index_scanner_ != nullptr) {
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
+  }
+
+  set_range(left_value, left_inclusive, right_value, right_inclusive);
+  return create_index_scanner();
+}
+
+void IndexScanPhysicalOperator::set_range(
+    const Value *left_value, bool left_inclusive, const Value *right_value, bool right_inclusive)
+{
+  left_value_ = (left_value != nullptr) ? *left_value : Value();
+  right_value_ = (right_value != nullptr) ? *right_value : Value();
+  left_inclusive_ = left_inclusive;
+  right_inclusive_ = right_inclusive;
+}
+
 RC IndexScanPhysicalOperator::next()
 {
   RID rid;
   RC rc = RC::SUCCESS;
 
-  record_page_handler_.cleanup();
+  // 按RID排序回表时，同一个页面上的数据是连续的，保留页面的访问权
+  if (!sorted_rid_fetch()) {
+    record_page_handler_.cleanup();
+    fetched_page_num_ = BP_INVALID_PAGE_NUM;
+  }
 
   bool filter_result = false;
-  while (RC::SUCCESS == (rc = index_scanner_->next_entry(&rid))) {
-    rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
+  while (RC::SUCCESS == (rc = next_rid(rid))) {
+    if (index_only_ && record_handler_->is_page_all_visible(rid.page_num)) {
+      // 页面上的数据对所有事务都可见，不需要回表
+      index_record_.set_rid(rid);
+      tuple_.set_record(&index_record_);
+      rc = filter(tuple_, filter_result);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+
+      if (filter_result) {
+        current_from_index_ = true;
+        return rc;
+      }
+      continue;
+    }
+
+    current_from_index_ = false;
+    rc = fetch_record(rid);
     if (rc != RC::SUCCESS) {
       return rc;
     }
@@ -100,16 +172,88 @@ RC IndexScanPhysicalOperator::next()
   return rc;
 }
 
+RC IndexScanPhysicalOperator::next_rid(RID &rid)
+{
+  if (!sorted_rid_fetch()) {
+    return next_index_entry(rid);
+  }
+
+  if (rid_batch_pos_ >= rid_batch_.size()) {
+    if (index_eof_) {
+      return RC::RECORD_EOF;
+    }
+
+    rid_batch_.clear();
+    rid_batch_pos_ = 0;
+
+    RC rc = RC::SUCCESS;
+    RID batch_rid;
+    while (static_cast<int>(rid_batch_.size()) < rid_batch_size_ && RC::SUCCESS == (rc = next_index_entry(batch_rid))) {
+      rid_batch_.push_back(batch_rid);
+    }
+
+    if (rc == RC::RECORD_EOF) {
+      index_eof_ = true;
+    } else if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch rid from index. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    if (rid_batch_.empty()) {
+      return RC::RECORD_EOF;
+    }
+
+    std::sort(rid_batch_.begin(), rid_batch_.end(), [](const RID &left, const RID &right) {
+      return RID::compare(&left, &right) < 0;
+    });
+  }
+
+  rid = rid_batch_[rid_batch_pos_++];
+  return RC::SUCCESS;
+}
+
+RC IndexScanPhysicalOperator::fetch_record(const RID &rid)
+{
+  // 与上一条记录在同一个页面上，就不需要再重新访问页面
+  if (fetched_page_num_ == rid.page_num) {
+    return record_page_handler_.get_record(&rid, &current_record_);
+  }
+
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
+
+  RC rc = record_handler_->get_record(record_page_handler_, &rid, readonly_, &current_record_);
+  if (rc == RC::SUCCESS) {
+    fetched_page_num_ = rid.page_num;
+  }
+  return rc;
+}
+
+RC IndexScanPhysicalOperator::next_index_entry(RID &rid)
+{
+  if (!index_only_) {
+    return index_scanner_->next_entry(&rid);
+  }
+
+  char *key = index_record_.data() + index_->field_meta().offset();
+  return index_scanner_->next_entry(&rid, key);
+}
+
 RC IndexScanPhysicalOperator::close()
 {
-  index_scanner_->destroy();
-  index_scanner_ = nullptr;
+  // explain 时算子没有打开过，也会调用close
+  if (index_scanner_ != nullptr) {
+    index_scanner_->destroy();
+    index_scanner_ = nullptr;
+  }
+  record_page_handler_.cleanup();
+  fetched_page_num_ = BP_INVALID_PAGE_NUM;
   return RC::SUCCESS;
 }
 
 Tuple *IndexScanPhysicalOperator::current_tuple()
 {
-  tuple_.set_record(&current_record_);
+  tuple_.set_record(current_from_index_ ? &index_record_ : &current_record_);
   return &tuple_;
 }
 
@@ -141,5 +285,14 @@ RC IndexScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
 
 std::string IndexScanPhysicalOperator::param() const
 {
-  return std::string(index_->index_meta().name()) + " ON " + table_->name();
+  std::string param = std::string(index_->index_meta().name()) + " ON " + table_->name();
+  if (index_only_) {
+    param += ", INDEX ONLY";
+  } else if (sorted_rid_fetch()) {
+    param += ", SORTED RID FETCH";
+  }
+  if (reverse_) {
+    param += ", REVERSE";
+  }
+  return param;
 }
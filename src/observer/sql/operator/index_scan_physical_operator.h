@@ -46,7 +46,50 @@ public:
 
   void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
 
+  Table *table() const { return table_; }
+  Index *index() const { return index_; }
+
+  /**
+   * @brief 设置扫描的范围，在open之前调用。边界为空表示这一边没有限制
+   */
+  void set_range(const Value *left_value, bool left_inclusive, const Value *right_value, bool right_inclusive);
+
+  /**
+   * @brief 使用新的范围重新扫描索引，算子需要已经打开
+   * @details 用于index nested loop join，外表的每一行都用连接的key重新查找一次内表
+   */
+  RC rescan(const Value *left_value, bool left_inclusive, const Value *right_value, bool right_inclusive);
+
+  /**
+   * @brief 设置为索引覆盖扫描(index only scan)
+   * @details 查询用到的字段都在索引中时，可以直接使用索引中的键值构造记录，如果记录所在的页面
+   * 全部可见(参考 RecordFileHandler::is_page_all_visible)，就不再回表
+   */
+  void set_index_only(bool index_only) { index_only_ = index_only; }
+  bool index_only() const { return index_only_; }
+
+  /**
+   * @brief 设置为按RID排序回表(类似PostgreSQL的bitmap heap scan)
+   * @details 先从索引中批量获取RID，按照页面排序后再回表，每个页面只需要访问一次，
+   * 避免按照键值顺序回表时的随机IO。输出的数据不再按照索引键值有序。
+   * @param batch_size 每批获取的RID个数
+   */
+  void set_sorted_rid_fetch(int batch_size) { rid_batch_size_ = batch_size; }
+  bool sorted_rid_fetch() const { return rid_batch_size_ > 0; }
+
+  /**
+   * @brief 设置为反向扫描，按照索引键值从大到小输出数据
+   * @details 用于 ORDER BY ... DESC 这类需要逆序输出的查询。与按RID排序回表一起使用时输出是无序的
+   */
+  void set_reverse(bool reverse) { reverse_ = reverse; }
+  bool reverse() const { return reverse_; }
+
 private:
+  RC create_index_scanner();
+  RC next_index_entry(RID &rid);
+  RC next_rid(RID &rid);
+  RC fetch_record(const RID &rid);
+
   // 与TableScanPhysicalOperator代码相同，可以优化
   RC filter(RowTuple &tuple, bool &result);
 
@@ -62,6 +105,17 @@ private:
   Record current_record_;
   RowTuple tuple_;
 
+  bool index_only_ = false;
+  bool reverse_ = false;
+  bool current_from_index_ = false;  ///< 当前的数据是否直接从索引中获取的
+  Record index_record_;              ///< 索引覆盖扫描时，使用索引键值构造出来的记录
+
+  int rid_batch_size_ = 0;                      ///< 大于0时表示按RID排序回表，参考 set_sorted_rid_fetch
+  std::vector<RID> rid_batch_;                  ///< 当前这一批排好序的RID
+  size_t rid_batch_pos_ = 0;                    ///< 下一个要回表的RID在rid_batch_中的位置
+  bool index_eof_ = false;                      ///< 索引中的数据是否已经全部获取完
+  PageNum fetched_page_num_ = BP_INVALID_PAGE_NUM;  ///< record_page_handler_ 当前持有的页面
+
   Value left_value_;
   Value right_value_;
   bool left_inclusive_ = false;
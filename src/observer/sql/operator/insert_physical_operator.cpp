@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "sql/operator/insert_physical_operator.h"
+#include "sql/expr/chunk.h"
 #include "sql/stmt/insert_stmt.h"
 #include "storage/table/table.h"
 #include "storage/trx/trx.h"
@@ -44,6 +45,12 @@ RC InsertPhysicalOperator::next()
   return RC::RECORD_EOF;
 }
 
+RC InsertPhysicalOperator::next_chunk(Chunk &chunk)
+{
+  chunk.reset();
+  return RC::RECORD_EOF;
+}
+
 RC InsertPhysicalOperator::close()
 {
   return RC::SUCCESS;
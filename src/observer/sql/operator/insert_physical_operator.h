@@ -42,6 +42,12 @@ public:
 
   Tuple *current_tuple() override { return nullptr; }
 
+  /**
+   * @brief 数据在open时已经插入了，没有要返回的数据
+   */
+  RC next_chunk(Chunk &chunk) override;
+  bool support_chunk() const override { return true; }
+
 private:
   Table *table_ = nullptr;
   std::vector<Value> values_;
@@ -67,6 +67,11 @@ RC NestedLoopJoinPhysicalOperator::next()
 
 RC NestedLoopJoinPhysicalOperator::close()
 {
+  // explain 不会打开算子
+  if (nullptr == left_) {
+    return RC::SUCCESS;
+  }
+
   RC rc = left_->close();
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to close left oper. rc=%s", strrc(rc));
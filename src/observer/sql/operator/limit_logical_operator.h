@@ -0,0 +1,47 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include "sql/operator/logical_operator.h"
+
+/**
+ * @brief 限制输出行数的逻辑算子，对应 LIMIT ... OFFSET ...
+ * @ingroup LogicalOperator
+ * @details 下层是排序时，生成物理计划时可以合并成Top-N
+ */
+class LimitLogicalOperator : public LogicalOperator
+{
+public:
+  LimitLogicalOperator(int limit, int offset);
+  virtual ~LimitLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::LIMIT;
+  }
+
+  int limit() const
+  {
+    return limit_;
+  }
+  int offset() const
+  {
+    return offset_;
+  }
+
+private:
+  int limit_ = -1;  ///< 小于0时没有限制
+  int offset_ = 0;
+};
@@ -0,0 +1,79 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/limit_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+LimitPhysicalOperator::LimitPhysicalOperator(int64_t limit, int64_t offset) : limit_(limit), offset_(offset)
+{}
+
+string LimitPhysicalOperator::param() const
+{
+  string param = (limit_ >= 0) ? "LIMIT " + to_string(limit_) : string();
+  if (offset_ > 0) {
+    param += (param.empty() ? "OFFSET " : " OFFSET ") + to_string(offset_);
+  }
+  return param;
+}
+
+RC LimitPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("limit operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  skipped_ = 0;
+  returned_ = 0;
+  return children_[0]->open(trx);
+}
+
+RC LimitPhysicalOperator::next()
+{
+  if (limit_ >= 0 && returned_ >= limit_) {
+    return RC::RECORD_EOF;
+  }
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = RC::SUCCESS;
+  for (; skipped_ < offset_; skipped_++) {
+    rc = child->next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  rc = child->next();
+  if (rc == RC::SUCCESS) {
+    returned_++;
+  }
+  return rc;
+}
+
+RC LimitPhysicalOperator::close()
+{
+  return children_[0]->close();
+}
+
+Tuple *LimitPhysicalOperator::current_tuple()
+{
+  return children_[0]->current_tuple();
+}
+
+RC LimitPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  return children_[0]->tuple_schema(schema);
+}
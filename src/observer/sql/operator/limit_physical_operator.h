@@ -0,0 +1,56 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+
+#include "sql/operator/physical_operator.h"
+
+/**
+ * @brief 限制输出行数的算子，对应 LIMIT ... OFFSET ...
+ * @ingroup PhysicalOperator
+ * @details 先跳过offset行，输出limit行以后不再从下层算子获取数据。下层算子都是按需获取数据的，
+ * 所以提前结束会一直传递到最下层的扫描，比如按照索引顺序输出的查询只读取需要的索引项。
+ */
+class LimitPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param limit 最多输出的行数，小于0时没有限制
+   * @param offset 跳过前面的行数
+   */
+  LimitPhysicalOperator(int64_t limit, int64_t offset);
+  virtual ~LimitPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::LIMIT;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+private:
+  int64_t limit_ = -1;
+  int64_t offset_ = 0;
+  int64_t skipped_ = 0;
+  int64_t returned_ = 0;
+};
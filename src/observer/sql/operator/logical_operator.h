@@ -37,6 +37,9 @@ enum class LogicalOperatorType
   PREDICATE,  ///< 过滤，就是谓词
   PROJECTION, ///< 投影，就是select
   JOIN,       ///< 连接
+  AGGREGATION, ///< 分组聚合
+  SORT,       ///< 排序
+  LIMIT,      ///< 限制输出的行数
   INSERT,     ///< 插入
   DELETE,     ///< 删除，删除可能会有子查询
   EXPLAIN,    ///< 查看执行计划
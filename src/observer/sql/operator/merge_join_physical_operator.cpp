@@ -0,0 +1,323 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/merge_join_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+/**
+ * @brief 计算元组的key，转换成SortKey
+ */
+static RC make_key(const Tuple &tuple, const vector<unique_ptr<Expression>> &key_exprs, string &key)
+{
+  key.clear();
+  Value value;
+  for (const unique_ptr<Expression> &expr : key_exprs) {
+    RC rc = expr->get_value(tuple, value);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get join key. rc=%s", strrc(rc));
+      return rc;
+    }
+    SortKey::append(key, value);
+  }
+  return RC::SUCCESS;
+}
+
+void MergeJoinPhysicalOperator::Input::init(
+    PhysicalOperator *oper, vector<unique_ptr<Expression>> *keys, bool sorted, const string &temp_dir)
+{
+  oper_ = oper;
+  keys_ = keys;
+  sorted_ = sorted;
+  temp_dir_ = temp_dir;
+}
+
+RC MergeJoinPhysicalOperator::Input::open(Trx *trx)
+{
+  RC rc = oper_->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+  opened_ = true;
+
+  if (!sorted_) {
+    rc = sort();
+  }
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::Input::sort()
+{
+  sorter_.init(temp_dir_);
+  speces_.clear();
+
+  RC rc = RC::SUCCESS;
+  while (RC::SUCCESS == (rc = oper_->next())) {
+    Tuple *tuple = oper_->current_tuple();
+    if (speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, speces_);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    rc = MaterializedTuple::copy_cells(*tuple, cells_);
+    if (rc == RC::SUCCESS) {
+      rc = make_key(*tuple, *keys_, key_);
+    }
+    if (rc == RC::SUCCESS) {
+      rc = sorter_.add(key_, cells_.data(), static_cast<int>(cells_.size()));
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to add tuple to sorter. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to fetch tuple. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  // 数据都在排序器中了，下层算子可以提前关闭
+  opened_ = false;
+  rc = oper_->close();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to close child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = sorter_.sort();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to sort. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  LOG_TRACE("merge join input sorted. runs=%d", sorter_.run_num());
+  sorted_tuple_.set_schema(&speces_);
+  tuple_ = &sorted_tuple_;
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::Input::next()
+{
+  if (!sorted_) {
+    RC rc = sorter_.next(key_, cells_);
+    if (rc == RC::SUCCESS) {
+      sorted_tuple_.set_cells(cells_.data());
+    }
+    return rc;
+  }
+
+  RC rc = oper_->next();
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  tuple_ = oper_->current_tuple();
+  return make_key(*tuple_, *keys_, key_);
+}
+
+RC MergeJoinPhysicalOperator::Input::close()
+{
+  RC rc = RC::SUCCESS;
+  if (opened_) {
+    opened_ = false;
+    rc = oper_->close();
+  }
+  sorter_.reset();
+  return rc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+MergeJoinPhysicalOperator::MergeJoinPhysicalOperator(vector<unique_ptr<Expression>> &&left_keys,
+    vector<unique_ptr<Expression>> &&right_keys, bool left_sorted, bool right_sorted, const string &temp_dir)
+    : left_keys_(std::move(left_keys)),
+      right_keys_(std::move(right_keys)),
+      left_sorted_(left_sorted),
+      right_sorted_(right_sorted),
+      temp_dir_(temp_dir)
+{}
+
+static string key_name(const Expression &expr)
+{
+  if (expr.type() == ExprType::FIELD) {
+    const Field &field = static_cast<const FieldExpr &>(expr).field();
+    return string(field.table_name()) + "." + field.field_name();
+  }
+  return expr.name();
+}
+
+string MergeJoinPhysicalOperator::param() const
+{
+  string param;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (i > 0) {
+      param += " AND ";
+    }
+    param += key_name(*left_keys_[i]) + "=" + key_name(*right_keys_[i]);
+  }
+  if (!left_sorted_) {
+    param += ", SORT LEFT";
+  }
+  if (!right_sorted_) {
+    param += ", SORT RIGHT";
+  }
+  return param;
+}
+
+RC MergeJoinPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 2) {
+    LOG_WARN("merge join operator should have 2 children");
+    return RC::INTERNAL;
+  }
+
+  left_.init(children_[0].get(), &left_keys_, left_sorted_, temp_dir_);
+  right_.init(children_[1].get(), &right_keys_, right_sorted_, temp_dir_);
+
+  RC rc = left_.open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open left input. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rc = right_.open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open right input. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  group_key_.clear();
+  group_speces_.clear();
+  group_cells_.clear();
+  group_rows_ = 0;
+  group_pos_ = 0;
+  left_valid_ = false;
+  group_tuple_.set_schema(&group_speces_);
+  joined_tuple_.set_right(&group_tuple_);
+
+  right_valid_ = true;
+  return right_next();
+}
+
+RC MergeJoinPhysicalOperator::right_next()
+{
+  RC rc = right_.next();
+  if (rc == RC::RECORD_EOF) {
+    right_valid_ = false;
+    return RC::SUCCESS;
+  }
+  right_valid_ = (rc == RC::SUCCESS);
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::fetch_group()
+{
+  group_cells_.clear();
+  group_rows_ = 0;
+  group_pos_ = 0;
+  group_key_ = left_.key();
+
+  RC rc = RC::SUCCESS;
+  while (right_valid_ &&
+         SortKey::compare(right_.key().data(), right_.key().size(), group_key_.data(), group_key_.size()) < 0) {
+    rc = right_next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  while (right_valid_ && right_.key() == group_key_) {
+    Tuple *tuple = right_.tuple();
+    if (group_speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, group_speces_);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    rc = MaterializedTuple::copy_cells(*tuple, cells_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    group_cells_.insert(group_cells_.end(), cells_.begin(), cells_.end());
+    group_rows_++;
+
+    rc = right_next();
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+  return rc;
+}
+
+RC MergeJoinPhysicalOperator::next()
+{
+  while (true) {
+    if (left_valid_ && group_pos_ < group_rows_) {
+      group_tuple_.set_cells(group_cells_.data() + static_cast<size_t>(group_pos_) * group_speces_.size());
+      group_pos_++;
+      return RC::SUCCESS;
+    }
+
+    RC rc = left_.next();
+    if (rc != RC::SUCCESS) {
+      left_valid_ = false;
+      return rc;
+    }
+    left_valid_ = true;
+    joined_tuple_.set_left(left_.tuple());
+
+    // 左表中key相同的行使用同一组右表数据
+    if (group_rows_ > 0 && left_.key() == group_key_) {
+      group_pos_ = 0;
+      continue;
+    }
+
+    rc = fetch_group();
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch right group. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    if (group_rows_ == 0 && !right_valid_) {
+      // 右表已经读完了，左表后面的key更大，不会再有匹配的数据
+      return RC::RECORD_EOF;
+    }
+  }
+}
+
+RC MergeJoinPhysicalOperator::close()
+{
+  RC rc = left_.close();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to close left input. rc=%s", strrc(rc));
+  }
+
+  RC rc2 = right_.close();
+  if (rc2 != RC::SUCCESS) {
+    LOG_WARN("failed to close right input. rc=%s", strrc(rc2));
+    rc = rc2;
+  }
+  group_cells_.clear();
+  return rc;
+}
+
+Tuple *MergeJoinPhysicalOperator::current_tuple()
+{
+  return &joined_tuple_;
+}
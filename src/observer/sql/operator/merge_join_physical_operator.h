@@ -0,0 +1,124 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/operator/external_sorter.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 排序合并连接(sort-merge join)算子
+ * @ingroup PhysicalOperator
+ * @details 两边的数据都按照连接的key有序，依次向前推进，key相同的右表数据缓存下来，与左表中
+ * key相同的每一行关联。
+ * 下层算子已经按照key有序输出时(比如没有范围限制的B+树索引扫描)直接使用，否则先使用外部排序，
+ * 数据量超过内存限制时排序的中间结果写到临时文件中。所以适合两边的数据都很多，hash表放不下的情况。
+ * 与hash join一样，只计算等值的连接条件，浮点数不能作为key。
+ */
+class MergeJoinPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param left_sorted 左表是否已经按照left_keys有序
+   * @param right_sorted 右表是否已经按照right_keys有序
+   * @param temp_dir 外部排序使用的临时文件目录
+   */
+  MergeJoinPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&left_keys,
+      std::vector<std::unique_ptr<Expression>> &&right_keys, bool left_sorted, bool right_sorted,
+      const std::string &temp_dir);
+  virtual ~MergeJoinPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::MERGE_JOIN;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+private:
+  /**
+   * @brief 连接的一边，按照key的顺序输出数据
+   */
+  class Input
+  {
+  public:
+    void init(PhysicalOperator *oper, std::vector<std::unique_ptr<Expression>> *keys, bool sorted,
+        const std::string &temp_dir);
+
+    RC open(Trx *trx);
+    RC next();
+    RC close();
+
+    const std::string &key() const { return key_; }
+    Tuple             *tuple() { return tuple_; }
+    bool               sorted() const { return sorted_; }
+
+  private:
+    RC sort();
+
+  private:
+    PhysicalOperator                         *oper_ = nullptr;
+    std::vector<std::unique_ptr<Expression>> *keys_ = nullptr;
+    bool                                      sorted_ = false;  ///< 下层算子是否已经有序
+    bool                                      opened_ = false;  ///< 下层算子是否处于打开的状态
+    std::string                               temp_dir_;
+
+    ExternalSorter             sorter_;
+    std::vector<TupleCellSpec> speces_;
+    std::vector<Value>         cells_;
+    MaterializedTuple          sorted_tuple_;
+
+    std::string key_;
+    Tuple      *tuple_ = nullptr;
+  };
+
+  RC right_next();
+
+  /**
+   * @brief 从右表中读取key与左表当前行相同的一组数据
+   */
+  RC fetch_group();
+
+private:
+  std::vector<std::unique_ptr<Expression>> left_keys_;
+  std::vector<std::unique_ptr<Expression>> right_keys_;
+  bool                                     left_sorted_ = false;
+  bool                                     right_sorted_ = false;
+  std::string                              temp_dir_;
+
+  Input left_;
+  Input right_;
+  bool  right_valid_ = false;  ///< 右表当前是否有一行还没有处理的数据
+
+  std::string                group_key_;
+  std::vector<TupleCellSpec> group_speces_;
+  std::vector<Value>         group_cells_;  ///< 右表中key相同的一组数据
+  std::vector<Value>         cells_;
+  int                        group_rows_ = 0;
+  int                        group_pos_ = 0;  ///< 下一个要与左表当前行关联的行
+  bool                       left_valid_ = false;
+
+  MaterializedTuple group_tuple_;
+  JoinedTuple       joined_tuple_;
+};
@@ -0,0 +1,78 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+
+#include "sql/operator/morsel_scheduler.h"
+
+using namespace std;
+
+MorselScheduler::MorselScheduler(int worker_num, int morsel_pages) : morsel_pages_(std::max(morsel_pages, 1))
+{
+  for (int i = 0; i < std::max(worker_num, 1); i++) {
+    queues_.emplace_back(make_unique<WorkerQueue>());
+  }
+}
+
+void MorselScheduler::init(PageNum page_count)
+{
+  vector<Morsel> morsels;
+  for (PageNum begin = 1; begin < page_count; begin += morsel_pages_) {
+    Morsel morsel;
+    morsel.begin_page = begin;
+    morsel.end_page = std::min(begin + morsel_pages_, page_count);
+    morsels.push_back(morsel);
+  }
+
+  // 每个线程分到连续的一段，尽量顺序访问文件
+  const size_t worker_num = queues_.size();
+  for (size_t i = 0; i < worker_num; i++) {
+    WorkerQueue &queue = *queues_[i];
+    lock_guard<mutex> guard(queue.lock);
+    queue.morsels.assign(morsels.begin() + morsels.size() * i / worker_num,
+        morsels.begin() + morsels.size() * (i + 1) / worker_num);
+  }
+  steal_count_ = 0;
+}
+
+bool MorselScheduler::next(int worker, Morsel &morsel)
+{
+  WorkerQueue &queue = *queues_[worker];
+  {
+    lock_guard<mutex> guard(queue.lock);
+    if (!queue.morsels.empty()) {
+      morsel = queue.morsels.front();
+      queue.morsels.pop_front();
+      return true;
+    }
+  }
+  return steal(worker, morsel);
+}
+
+bool MorselScheduler::steal(int worker, Morsel &morsel)
+{
+  // 从下一个线程开始找，避免所有空闲的线程都去窃取同一个线程
+  const int worker_num = this->worker_num();
+  for (int i = 1; i < worker_num; i++) {
+    WorkerQueue &victim = *queues_[(worker + i) % worker_num];
+    lock_guard<mutex> guard(victim.lock);
+    if (!victim.morsels.empty()) {
+      morsel = victim.morsels.back();
+      victim.morsels.pop_back();
+      steal_count_++;
+      return true;
+    }
+  }
+  return false;
+}
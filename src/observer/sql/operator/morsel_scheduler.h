@@ -0,0 +1,84 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/types.h"
+
+/**
+ * @brief 并行扫描时把数据文件的页面切分成小段(morsel)，分给多个工作线程
+ * @ingroup PhysicalOperator
+ * @details 每个工作线程有自己的队列，开始时按照页号把连续的一段morsel放到一个线程的队列中。
+ * 工作线程先从自己队列的头部取，自己的队列空了以后从其它线程队列的尾部窃取，
+ * 这样处理得快的线程可以分担慢的线程的工作，自己的队列中仍然按照页号的顺序访问。
+ * 队列使用 std::mutex 保护，与编译时是否打开CONCURRENCY选项无关。
+ */
+class MorselScheduler
+{
+public:
+  static constexpr int DEFAULT_MORSEL_PAGES = 8;
+
+  /**
+   * @brief 一段连续的页面 [begin_page, end_page)
+   */
+  struct Morsel
+  {
+    PageNum begin_page = 0;
+    PageNum end_page = 0;
+  };
+
+public:
+  MorselScheduler(int worker_num, int morsel_pages = DEFAULT_MORSEL_PAGES);
+
+  /**
+   * @brief 重新切分页面，每次执行之前调用
+   * @param page_count 数据文件的页面个数，第0页是文件头，不需要扫描
+   */
+  void init(PageNum page_count);
+
+  /**
+   * @brief 给某个工作线程分配下一段页面
+   * @return 所有的页面都已经分配完时返回false
+   */
+  bool next(int worker, Morsel &morsel);
+
+  int worker_num() const { return static_cast<int>(queues_.size()); }
+  int morsel_pages() const { return morsel_pages_; }
+
+  /**
+   * @brief 从其它线程的队列中窃取的次数
+   */
+  int64_t steal_count() const { return steal_count_.load(); }
+
+private:
+  struct WorkerQueue
+  {
+    std::mutex         lock;
+    std::deque<Morsel> morsels;
+  };
+
+  bool steal(int worker, Morsel &morsel);
+
+private:
+  int                                       morsel_pages_ = DEFAULT_MORSEL_PAGES;
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::atomic<int64_t>                      steal_count_{0};
+};
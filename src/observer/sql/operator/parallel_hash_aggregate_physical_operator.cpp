@@ -0,0 +1,145 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <thread>
+
+#include "sql/operator/parallel_hash_aggregate_physical_operator.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "storage/table/table.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+ParallelHashAggregatePhysicalOperator::ParallelHashAggregatePhysicalOperator(
+    vector<unique_ptr<Expression>> &&group_by_exprs, vector<unique_ptr<Expression>> &&exprs, const string &temp_dir,
+    shared_ptr<MorselScheduler> scheduler, Table *table)
+    : HashAggregatePhysicalOperator(std::move(group_by_exprs), std::move(exprs), temp_dir),
+      scheduler_(std::move(scheduler)),
+      table_(table)
+{}
+
+string ParallelHashAggregatePhysicalOperator::param() const
+{
+  const string group_by = AggregatePhysicalOperator::param();
+  const string workers = "WORKERS " + to_string(children_.size());
+  return group_by.empty() ? workers : workers + " " + group_by;
+}
+
+RC ParallelHashAggregatePhysicalOperator::open(Trx *trx)
+{
+  if (children_.empty()) {
+    LOG_WARN("parallel aggregate operator must has at least one child");
+    return RC::INTERNAL;
+  }
+  for (unique_ptr<PhysicalOperator> &child : children_) {
+    if (child->type() != PhysicalOperatorType::HASH_AGGREGATE ||
+        !static_cast<HashAggregatePhysicalOperator &>(*child).partial()) {
+      LOG_WARN("child of parallel aggregate operator must be a partial hash aggregate. child=%s", child->name().c_str());
+      return RC::INTERNAL;
+    }
+  }
+
+  RC rc = init_output();
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  reset_state();
+
+  if (scheduler_ && table_ != nullptr) {
+    scheduler_->init(table_->data_page_count());
+  }
+
+  // 局部聚合在open时读取全部的输入
+  vector<RC>     worker_rcs(children_.size(), RC::SUCCESS);
+  vector<thread> threads;
+  for (size_t i = 0; i < children_.size(); i++) {
+    threads.emplace_back([this, trx, i, &worker_rcs] { worker_rcs[i] = children_[i]->open(trx); });
+  }
+  for (thread &t : threads) {
+    t.join();
+  }
+
+  for (size_t i = 0; i < children_.size(); i++) {
+    if (worker_rcs[i] != RC::SUCCESS) {
+      LOG_WARN("failed to run partial aggregate. worker=%d, rc=%s", static_cast<int>(i), strrc(worker_rcs[i]));
+      return worker_rcs[i];
+    }
+  }
+
+  for (unique_ptr<PhysicalOperator> &child : children_) {
+    rc = merge(static_cast<HashAggregatePhysicalOperator &>(*child));
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to merge partial aggregate. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    // 合并完就释放局部聚合占用的内存
+    child->close();
+  }
+
+  return finish_build();
+}
+
+RC ParallelHashAggregatePhysicalOperator::merge(HashAggregatePhysicalOperator &worker)
+{
+  const int key_num = this->key_num();
+  const AggregateHashTable &worker_table = worker.hash_table_;
+  for (int group = 0; group < worker_table.group_num(); group++) {
+    const Value   *keys = worker_table.keys(group);
+    const uint32_t hash = JoinHashTable::hash(keys, key_num);
+    int            to = hash_table_.find(keys, hash);
+    if (to < 0) {
+      to = hash_table_.insert(keys, hash);
+      aggregator_.resize(hash_table_.group_num());
+    }
+    aggregator_.merge_group(worker.aggregator_, group, to);
+  }
+
+  // 溢出的行：分组已经在hash表中时直接更新，否则溢出到这里的外部排序中
+  while (worker.has_spilled_row_) {
+    const Value *cells = worker.spilled_cells_.data();
+    const int    group = hash_table_.find(cells, JoinHashTable::hash(cells, key_num));
+    if (group >= 0) {
+      update_group(aggregator_, cells, group);
+    } else {
+      RC rc = sorter_.add(worker.sort_key_, cells, static_cast<int>(worker.spilled_cells_.size()));
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to spill aggregate input. rc=%s", strrc(rc));
+        return rc;
+      }
+      spilled_rows_++;
+    }
+
+    RC rc = worker.sorter_.next(worker.sort_key_, worker.spilled_cells_);
+    if (rc == RC::RECORD_EOF) {
+      worker.has_spilled_row_ = false;
+    } else if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to read spilled rows. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC ParallelHashAggregatePhysicalOperator::close()
+{
+  for (unique_ptr<PhysicalOperator> &child : children_) {
+    child->close();
+  }
+  hash_table_.init(key_num());
+  aggregator_.resize(0);
+  sorter_.reset();
+  has_spilled_row_ = false;
+  return RC::SUCCESS;
+}
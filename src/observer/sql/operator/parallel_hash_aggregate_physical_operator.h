@@ -0,0 +1,63 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/morsel_scheduler.h"
+
+/**
+ * @brief 并行hash分组聚合算子
+ * @ingroup PhysicalOperator
+ * @details 每个下层算子是一个工作线程中的局部hash聚合，它们各自读取并行扫描分到的页面，在自己的hash表中聚合。
+ * open时为每个下层算子启动一个线程，所有的线程完成后，在当前线程中把局部hash表中的分组合并到一个hash表中。
+ * 局部聚合溢出的行已经按照key排好序，key在合并后的hash表中时直接更新分组，否则放到这里的外部排序中，
+ * 之后与普通的hash聚合一样输出。每个局部聚合的内存限制是总的限制除以线程数，合并时不再检查内存。
+ */
+class ParallelHashAggregatePhysicalOperator : public HashAggregatePhysicalOperator
+{
+public:
+  /**
+   * @param scheduler 下层的并行扫描共享的调度器，每次open时重新切分页面，可以为空
+   * @param table     扫描的表，用来获取页面个数
+   */
+  ParallelHashAggregatePhysicalOperator(std::vector<std::unique_ptr<Expression>> &&group_by_exprs,
+      std::vector<std::unique_ptr<Expression>> &&exprs, const std::string &temp_dir,
+      std::shared_ptr<MorselScheduler> scheduler, Table *table);
+  virtual ~ParallelHashAggregatePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::PARALLEL_HASH_AGGREGATE;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC close() override;
+
+private:
+  /**
+   * @brief 合并一个局部聚合的结果
+   */
+  RC merge(HashAggregatePhysicalOperator &worker);
+
+private:
+  std::shared_ptr<MorselScheduler> scheduler_;
+  Table                           *table_ = nullptr;
+};
@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "sql/operator/physical_operator.h"
+#include "sql/expr/chunk.h"
 
 std::string physical_operator_type_name(PhysicalOperatorType type)
 {
@@ -21,8 +22,32 @@ std::string physical_operator_type_name(PhysicalOperatorType type)
       return "TABLE_SCAN";
     case PhysicalOperatorType::INDEX_SCAN:
       return "INDEX_SCAN";
+    case PhysicalOperatorType::BITMAP_SCAN:
+      return "BITMAP_SCAN";
+    case PhysicalOperatorType::INDEX_MERGE_SCAN:
+      return "INDEX_MERGE_SCAN";
     case PhysicalOperatorType::NESTED_LOOP_JOIN:
       return "NESTED_LOOP_JOIN";
+    case PhysicalOperatorType::HASH_JOIN:
+      return "HASH_JOIN";
+    case PhysicalOperatorType::MERGE_JOIN:
+      return "MERGE_JOIN";
+    case PhysicalOperatorType::INDEX_NESTED_LOOP_JOIN:
+      return "INDEX_NESTED_LOOP_JOIN";
+    case PhysicalOperatorType::HASH_AGGREGATE:
+      return "HASH_AGGREGATE";
+    case PhysicalOperatorType::STREAM_AGGREGATE:
+      return "STREAM_AGGREGATE";
+    case PhysicalOperatorType::PARALLEL_HASH_AGGREGATE:
+      return "PARALLEL_HASH_AGGREGATE";
+    case PhysicalOperatorType::GATHER:
+      return "GATHER";
+    case PhysicalOperatorType::SORT:
+      return "SORT";
+    case PhysicalOperatorType::TOP_N:
+      return "TOP_N";
+    case PhysicalOperatorType::LIMIT:
+      return "LIMIT";
     case PhysicalOperatorType::EXPLAIN:
       return "EXPLAIN";
     case PhysicalOperatorType::PREDICATE:
@@ -52,3 +77,40 @@ std::string PhysicalOperator::param() const
 {
   return "";
 }
+
+RC PhysicalOperator::next_chunk(Chunk &chunk)
+{
+  chunk.reset();
+
+  RC rc = RC::SUCCESS;
+  int rows = 0;
+  Value value;
+  while (rows < chunk.capacity() && RC::SUCCESS == (rc = next())) {
+    Tuple *tuple = current_tuple();
+    if (nullptr == tuple) {
+      LOG_WARN("failed to get current tuple. operator=%s", name().c_str());
+      return RC::INTERNAL;
+    }
+
+    const int cell_num = tuple->cell_num();
+    for (int i = 0; i < cell_num; i++) {
+      rc = tuple->cell_at(i, value);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get cell of tuple. index=%d, rc=%s", i, strrc(rc));
+        return rc;
+      }
+      if (0 == rows) {
+        chunk.add_column(nullptr, nullptr, value.attr_type(), value.length());
+      }
+      chunk.column(i).append_value(value);
+    }
+    rows++;
+  }
+
+  if (rc != RC::SUCCESS && rc != RC::RECORD_EOF) {
+    return rc;
+  }
+
+  chunk.set_rows(rows);
+  return rows > 0 ? RC::SUCCESS : RC::RECORD_EOF;
+}
@@ -24,6 +24,7 @@ See the Mulan PSL v2 for more details. */
 class Record;
 class TupleCellSpec;
 class Trx;
+class Chunk;
 
 /**
  * @brief 物理算子
@@ -39,7 +40,19 @@ enum class PhysicalOperatorType
 {
   TABLE_SCAN,
   INDEX_SCAN,
+  BITMAP_SCAN,
+  INDEX_MERGE_SCAN,
   NESTED_LOOP_JOIN,
+  HASH_JOIN,
+  MERGE_JOIN,
+  INDEX_NESTED_LOOP_JOIN,
+  HASH_AGGREGATE,
+  STREAM_AGGREGATE,
+  PARALLEL_HASH_AGGREGATE,
+  GATHER,
+  SORT,
+  TOP_N,
+  LIMIT,
   EXPLAIN,
   PREDICATE,
   PROJECT,
@@ -74,6 +87,26 @@ public:
 
   virtual Tuple *current_tuple() = 0;
 
+  /**
+   * @brief 输出结果的列名
+   * @details 输出的列与查询的字段不一一对应的算子，比如聚合，自己设置列名，其它的算子返回UNIMPLENMENT
+   */
+  virtual RC tuple_schema(TupleSchema &schema) const { return RC::UNIMPLENMENT; }
+
+  /**
+   * @brief 批量获取数据，每次最多返回chunk.capacity()行
+   * @details 默认的实现逐行调用next和current_tuple，把数据按照位置放到chunk中，列上没有表名和字段名。
+   * 返回的chunk中至少有一行有效的数据，没有数据时返回RECORD_EOF。
+   * 同一个算子只能使用next或者next_chunk中的一种方式获取数据。
+   */
+  virtual RC next_chunk(Chunk &chunk);
+
+  /**
+   * @brief 是否直接按批执行，而不是使用默认的逐行实现
+   * @details 上层算子只有在下层算子支持批量执行时，才会调用下层的next_chunk并在列上计算
+   */
+  virtual bool support_chunk() const { return false; }
+
   void add_child(std::unique_ptr<PhysicalOperator> oper)
   {
     children_.emplace_back(std::move(oper));
@@ -84,6 +117,20 @@ public:
     return children_;
   }
 
+  /**
+   * @brief 优化器估算的输出行数和代价，explain时显示。没有估算时小于0
+   */
+  void set_estimate(double rows, double cost)
+  {
+    estimated_rows_ = rows;
+    estimated_cost_ = cost;
+  }
+  double estimated_rows() const { return estimated_rows_; }
+  double estimated_cost() const { return estimated_cost_; }
+
 protected:
   std::vector<std::unique_ptr<PhysicalOperator>> children_;
+
+  double estimated_rows_ = -1;
+  double estimated_cost_ = -1;
 };
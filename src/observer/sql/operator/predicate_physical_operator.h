@@ -42,6 +42,9 @@ public:
 
   Tuple *current_tuple() override;
 
+  RC next_chunk(Chunk &chunk) override;
+  bool support_chunk() const override { return !children_.empty() && children_[0]->support_chunk(); }
+
 private:
   std::unique_ptr<Expression> expression_;
 };
@@ -60,4 +60,46 @@ void ProjectPhysicalOperator::add_projection(const Table *table, const FieldMeta
   // 对多表查询来说，展示的alias 需要带表名字
   TupleCellSpec *spec = new TupleCellSpec(table->name(), field_meta->name(), field_meta->name());
   tuple_.add_cell_spec(spec);
+  speces_.push_back(*spec);
+}
+
+RC ProjectPhysicalOperator::next_chunk(Chunk &chunk)
+{
+  if (!support_chunk()) {
+    return PhysicalOperator::next_chunk(chunk);
+  }
+
+  RC rc = children_[0]->next_chunk(child_chunk_);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  // 先找到所有的列再移动，移动以后的列就没有名字了
+  std::vector<int> indexes;
+  indexes.reserve(speces_.size());
+  for (const TupleCellSpec &spec : speces_) {
+    const int index = child_chunk_.find_column(spec.table_name(), spec.field_name());
+    if (index < 0) {
+      LOG_WARN("failed to find column in chunk. table=%s, field=%s", spec.table_name(), spec.field_name());
+      return RC::NOTFOUND;
+    }
+    indexes.push_back(index);
+  }
+
+  // 下层的列移动到结果中。同一个字段投影多次时，后面的复制前面已经移动过的列
+  std::vector<int> moved_to(child_chunk_.column_num(), -1);
+  chunk.reset();
+  for (int index : indexes) {
+    if (moved_to[index] < 0) {
+      moved_to[index] = chunk.column_num();
+      chunk.add_column(std::move(child_chunk_.column(index)));
+    } else {
+      Column column = chunk.column(moved_to[index]);
+      chunk.add_column(std::move(column));
+    }
+  }
+
+  chunk.set_rows(child_chunk_.rows());
+  chunk.selection().swap(child_chunk_.selection());
+  return rc;
 }
@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "sql/operator/physical_operator.h"
+#include "sql/expr/chunk.h"
 
 /**
  * @brief 选择/投影物理算子
@@ -50,6 +51,14 @@ public:
 
   Tuple *current_tuple() override;
 
+  /**
+   * @brief 从下层的chunk中按照投影的字段挑选出列，不复制数据
+   */
+  RC next_chunk(Chunk &chunk) override;
+  bool support_chunk() const override { return !children_.empty() && children_[0]->support_chunk(); }
+
 private:
   ProjectTuple tuple_;
+  std::vector<TupleCellSpec> speces_;  ///< 与tuple_中的一样，批量执行时使用
+  Chunk                      child_chunk_;
 };
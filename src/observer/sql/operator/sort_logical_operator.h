@@ -0,0 +1,46 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "sql/operator/logical_operator.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 排序逻辑算子
+ * @ingroup LogicalOperator
+ * @details expressions() 是排序的key，依次比较，asc() 中是每个key是否升序。
+ */
+class SortLogicalOperator : public LogicalOperator
+{
+public:
+  SortLogicalOperator(std::vector<std::unique_ptr<Expression>> &&exprs, const std::vector<bool> &asc);
+  virtual ~SortLogicalOperator() = default;
+
+  LogicalOperatorType type() const override
+  {
+    return LogicalOperatorType::SORT;
+  }
+
+  const std::vector<bool> &asc() const
+  {
+    return asc_;
+  }
+
+private:
+  std::vector<bool> asc_;
+};
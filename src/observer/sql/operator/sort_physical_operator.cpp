@@ -0,0 +1,144 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/sort_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+SortPhysicalOperator::SortPhysicalOperator(
+    vector<unique_ptr<Expression>> &&exprs, const vector<bool> &asc, const string &temp_dir)
+    : exprs_(std::move(exprs)), asc_(asc), temp_dir_(temp_dir)
+{}
+
+RC SortPhysicalOperator::make_key(
+    const Tuple &tuple, const vector<unique_ptr<Expression>> &exprs, const vector<bool> &asc, string &key)
+{
+  key.clear();
+  Value value;
+  for (size_t i = 0; i < exprs.size(); i++) {
+    RC rc = exprs[i]->get_value(tuple, value);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get sort key. expr=%s, rc=%s", exprs[i]->name().c_str(), strrc(rc));
+      return rc;
+    }
+    SortKey::append(key, value, asc[i]);
+  }
+  return RC::SUCCESS;
+}
+
+string SortPhysicalOperator::order_by_param(const vector<unique_ptr<Expression>> &exprs, const vector<bool> &asc)
+{
+  string param;
+  for (size_t i = 0; i < exprs.size(); i++) {
+    if (i > 0) {
+      param += ", ";
+    }
+    param += exprs[i]->name();
+    if (!asc[i]) {
+      param += " DESC";
+    }
+  }
+  return param;
+}
+
+string SortPhysicalOperator::param() const
+{
+  return order_by_param(exprs_, asc_);
+}
+
+RC SortPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("sort operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = child->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  sorter_.init(temp_dir_, memory_limit_);
+  speces_.clear();
+  while (RC::SUCCESS == (rc = child->next())) {
+    Tuple *tuple = child->current_tuple();
+    if (speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, speces_);
+      if (rc != RC::SUCCESS) {
+        break;
+      }
+    }
+
+    rc = MaterializedTuple::copy_cells(*tuple, cells_);
+    if (rc == RC::SUCCESS) {
+      rc = make_key(*tuple, exprs_, asc_, key_);
+    }
+    if (rc == RC::SUCCESS) {
+      rc = sorter_.add(key_, cells_.data(), static_cast<int>(cells_.size()));
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to add tuple to sorter. rc=%s", strrc(rc));
+      break;
+    }
+  }
+
+  // 数据都在排序器中了，下层算子可以提前关闭
+  RC close_rc = child->close();
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to fetch tuple. rc=%s", strrc(rc));
+    return rc;
+  }
+  if (close_rc != RC::SUCCESS) {
+    LOG_WARN("failed to close child operator. rc=%s", strrc(close_rc));
+    return close_rc;
+  }
+
+  rc = sorter_.sort();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to sort. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  LOG_TRACE("sort done. runs=%d", sorter_.run_num());
+  tuple_.set_schema(&speces_);
+  return RC::SUCCESS;
+}
+
+RC SortPhysicalOperator::next()
+{
+  RC rc = sorter_.next(key_, cells_);
+  if (rc == RC::SUCCESS) {
+    tuple_.set_cells(cells_.data());
+  }
+  return rc;
+}
+
+RC SortPhysicalOperator::close()
+{
+  sorter_.reset();
+  return RC::SUCCESS;
+}
+
+Tuple *SortPhysicalOperator::current_tuple()
+{
+  return &tuple_;
+}
+
+RC SortPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  return children_[0]->tuple_schema(schema);
+}
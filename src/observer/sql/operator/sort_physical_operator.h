@@ -0,0 +1,90 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/operator/external_sorter.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief 排序算子，对应 ORDER BY
+ * @ingroup PhysicalOperator
+ * @details open时读取全部输入，每行按照排序的表达式生成一个 SortKey，降序的key按字节取反，
+ * 排序时只需要memcmp比较。数据交给外部排序，超过内存限制时排好序的段写到临时文件中，
+ * 最后多路归并输出。key相同的行保持输入的顺序。
+ */
+class SortPhysicalOperator : public PhysicalOperator
+{
+public:
+  /**
+   * @param exprs 排序的表达式，依次比较
+   * @param asc 每个表达式是否升序
+   * @param temp_dir 外部排序使用的临时文件目录
+   */
+  SortPhysicalOperator(
+      std::vector<std::unique_ptr<Expression>> &&exprs, const std::vector<bool> &asc, const std::string &temp_dir);
+  virtual ~SortPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::SORT;
+  }
+
+  std::string param() const override;
+
+  /**
+   * @brief 设置外部排序在内存中最多缓存的数据量
+   */
+  void set_memory_limit(size_t memory_limit) { memory_limit_ = memory_limit; }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+  /**
+   * @brief 写到临时文件中的段的个数
+   */
+  int run_num() const { return sorter_.run_num(); }
+
+  /**
+   * @brief 计算一行数据排序使用的key
+   */
+  static RC make_key(const Tuple &tuple, const std::vector<std::unique_ptr<Expression>> &exprs,
+      const std::vector<bool> &asc, std::string &key);
+
+  /**
+   * @brief 排序的表达式的描述，比如 "id DESC, name"，explain时显示
+   */
+  static std::string order_by_param(const std::vector<std::unique_ptr<Expression>> &exprs, const std::vector<bool> &asc);
+
+private:
+  std::vector<std::unique_ptr<Expression>> exprs_;
+  std::vector<bool>                        asc_;
+  std::string                              temp_dir_;
+  size_t                                   memory_limit_ = ExternalSorter::DEFAULT_MEMORY_LIMIT;
+
+  ExternalSorter             sorter_;
+  std::vector<TupleCellSpec> speces_;
+  std::vector<Value>         cells_;
+  std::string                key_;
+  MaterializedTuple          tuple_;
+};
@@ -0,0 +1,110 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+StreamAggregatePhysicalOperator::StreamAggregatePhysicalOperator(
+    vector<unique_ptr<Expression>> &&group_by_exprs, vector<unique_ptr<Expression>> &&exprs)
+    : AggregatePhysicalOperator(std::move(group_by_exprs), std::move(exprs))
+{}
+
+RC StreamAggregatePhysicalOperator::open(Trx *trx)
+{
+  RC rc = open_child(trx);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  aggregator_.init(aggregates_);
+  group_keys_.clear();
+  ready_groups_ = 0;
+  output_group_ = 0;
+  finished_ = false;
+  return RC::SUCCESS;
+}
+
+bool StreamAggregatePhysicalOperator::key_equal(const Value *keys1, const Value *keys2) const
+{
+  for (int i = 0; i < key_num(); i++) {
+    if (keys1[i].compare(keys2[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+RC StreamAggregatePhysicalOperator::next()
+{
+  const int key_num = this->key_num();
+  while (true) {
+    if (output_group_ < ready_groups_) {
+      set_output(group_keys_.data() + static_cast<size_t>(output_group_) * key_num, aggregator_, output_group_);
+      output_group_++;
+      return RC::SUCCESS;
+    }
+
+    if (finished_) {
+      return RC::RECORD_EOF;
+    }
+
+    // 已经输出的分组不再需要，只保留最后一个还没有结束的分组
+    if (ready_groups_ > 0) {
+      aggregator_.copy_group(ready_groups_, 0);
+      aggregator_.resize(1);
+      group_keys_.erase(group_keys_.begin(), group_keys_.begin() + static_cast<size_t>(ready_groups_) * key_num);
+      ready_groups_ = 0;
+      output_group_ = 0;
+    }
+
+    RC rc = fetch_batch();
+    if (rc == RC::RECORD_EOF) {
+      // 最后一个分组也结束了。没有分组的key时，即使没有输入也要输出一行
+      finished_ = true;
+      if (key_num == 0 && aggregator_.group_num() == 0) {
+        aggregator_.resize(1);
+      }
+      ready_groups_ = aggregator_.group_num();
+      continue;
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to read aggregate input. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    int group_num = aggregator_.group_num();
+    groups_.resize(batch_rows_);
+    for (int i = 0; i < batch_rows_; i++) {
+      const Value *keys = batch_keys(i);
+      if (group_num == 0 || !key_equal(group_keys_.data() + static_cast<size_t>(group_num - 1) * key_num, keys)) {
+        group_keys_.insert(group_keys_.end(), keys, keys + key_num);
+        group_num++;
+      }
+      groups_[i] = group_num - 1;
+    }
+
+    aggregator_.resize(group_num);
+    update_aggregates(aggregator_, groups_.data(), batch_rows_);
+    ready_groups_ = group_num - 1;
+  }
+}
+
+RC StreamAggregatePhysicalOperator::close()
+{
+  aggregator_.resize(0);
+  group_keys_.clear();
+  return children_[0]->close();
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <vector>
+
+#include "sql/operator/aggregate_physical_operator.h"
+
+/**
+ * @brief 流式分组聚合算子
+ * @ingroup PhysicalOperator
+ * @details 输入已经按照分组的key有序，key相同的行是连续的。每批数据中key变化时开始一个新的分组，
+ * 除了最后一个分组，其它的分组都已经结束，可以输出；最后一个分组可能延续到下一批数据中。
+ * 只需要保存一批数据中的分组，不需要hash表。没有分组的key时所有的输入是一个分组。
+ */
+class StreamAggregatePhysicalOperator : public AggregatePhysicalOperator
+{
+public:
+  StreamAggregatePhysicalOperator(
+      std::vector<std::unique_ptr<Expression>> &&group_by_exprs, std::vector<std::unique_ptr<Expression>> &&exprs);
+  virtual ~StreamAggregatePhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::STREAM_AGGREGATE;
+  }
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+
+private:
+  bool key_equal(const Value *keys1, const Value *keys2) const;
+
+private:
+  Aggregator         aggregator_;
+  std::vector<Value> group_keys_;  ///< 当前每个分组的key连续存放
+  std::vector<int>   groups_;
+  int                ready_groups_ = 0;  ///< 前面这些分组已经结束
+  int                output_group_ = 0;  ///< 下一个输出的分组
+  bool               finished_ = false;
+};
@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "sql/operator/table_scan_physical_operator.h"
+#include "sql/expr/chunk.h"
 #include "storage/table/table.h"
 #include "event/sql_debug.h"
 
@@ -20,23 +21,43 @@ using namespace std;
 
 RC TableScanPhysicalOperator::open(Trx *trx)
 {
-  RC rc = table_->get_record_scanner(record_scanner_, trx, readonly_);
-  if (rc == RC::SUCCESS) {
-    tuple_.set_schema(table_, table_->table_meta().field_metas());
-  }
   trx_ = trx;
+  tuple_.set_schema(table_, table_->table_meta().field_metas());
+
+  // 并行扫描时在读取数据的时候才从调度器中取页面
+  scanner_opened_ = false;
+  if (scheduler_) {
+    return RC::SUCCESS;
+  }
+
+  RC rc = table_->get_record_scanner(record_scanner_, trx, readonly_);
+  scanner_opened_ = (rc == RC::SUCCESS);
   return rc;
 }
 
-RC TableScanPhysicalOperator::next()
+RC TableScanPhysicalOperator::prepare_next()
 {
-  if (!record_scanner_.has_next()) {
-    return RC::RECORD_EOF;
+  while (!scanner_opened_ || !record_scanner_.has_next()) {
+    MorselScheduler::Morsel morsel;
+    if (!scheduler_ || !scheduler_->next(worker_, morsel)) {
+      return RC::RECORD_EOF;
+    }
+
+    RC rc = table_->get_record_scanner(record_scanner_, trx_, readonly_, morsel.begin_page, morsel.end_page);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to scan morsel. table=%s, worker=%d, rc=%s", table_->name(), worker_, strrc(rc));
+      return rc;
+    }
+    scanner_opened_ = true;
   }
+  return RC::SUCCESS;
+}
 
+RC TableScanPhysicalOperator::next()
+{
   RC rc = RC::SUCCESS;
   bool filter_result = false;
-  while (record_scanner_.has_next()) {
+  while (RC::SUCCESS == (rc = prepare_next())) {
     rc = record_scanner_.next(current_record_);
     if (rc != RC::SUCCESS) {
       return rc;
@@ -50,17 +71,76 @@ RC TableScanPhysicalOperator::next()
 
     if (filter_result) {
       sql_debug("get a tuple: %s", tuple_.to_string().c_str());
-      break;
-    } else {
-      sql_debug("a tuple is filtered: %s", tuple_.to_string().c_str());
-      rc = RC::RECORD_EOF;
+      return RC::SUCCESS;
     }
+    sql_debug("a tuple is filtered: %s", tuple_.to_string().c_str());
   }
   return rc;
 }
 
+RC TableScanPhysicalOperator::next_chunk(Chunk &chunk)
+{
+  RC rc = RC::SUCCESS;
+  do {
+    rc = fill_chunk(chunk);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    for (unique_ptr<Expression> &expr : predicates_) {
+      rc = expr->filter_chunk(chunk, chunk.selection());
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to filter chunk. table=%s, rc=%s", table_->name(), strrc(rc));
+        return rc;
+      }
+      if (chunk.size() == 0) {
+        break;
+      }
+    }
+  } while (chunk.size() == 0);
+
+  sql_debug("get a chunk. rows=%d, selected=%d", chunk.rows(), chunk.size());
+  return rc;
+}
+
+RC TableScanPhysicalOperator::fill_chunk(Chunk &chunk)
+{
+  chunk.reset();
+  RC rc = prepare_next();
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const vector<FieldMeta> &field_metas = *table_->table_meta().field_metas();
+  for (const FieldMeta &field_meta : field_metas) {
+    chunk.add_column(table_->name(), field_meta.name(), field_meta.type(), field_meta.len());
+  }
+
+  int rows = 0;
+  while (rows < chunk.capacity() && RC::SUCCESS == (rc = prepare_next())) {
+    rc = record_scanner_.next(current_record_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    const char *data = current_record_.data();
+    for (size_t i = 0; i < field_metas.size(); i++) {
+      const FieldMeta &field_meta = field_metas[i];
+      chunk.column(static_cast<int>(i)).append(data + field_meta.offset(), field_meta.len());
+    }
+    rows++;
+  }
+  if (rc != RC::SUCCESS && rc != RC::RECORD_EOF) {
+    return rc;
+  }
+
+  chunk.set_rows(rows);
+  return rows > 0 ? RC::SUCCESS : RC::RECORD_EOF;
+}
+
 RC TableScanPhysicalOperator::close()
 {
+  scanner_opened_ = false;
   return record_scanner_.close_scan();
 }
 
@@ -80,6 +160,12 @@ void TableScanPhysicalOperator::set_predicates(vector<unique_ptr<Expression>> &&
   predicates_ = std::move(exprs);
 }
 
+void TableScanPhysicalOperator::set_morsel_scheduler(shared_ptr<MorselScheduler> scheduler, int worker)
+{
+  scheduler_ = std::move(scheduler);
+  worker_ = worker;
+}
+
 RC TableScanPhysicalOperator::filter(RowTuple &tuple, bool &result)
 {
   RC rc = RC::SUCCESS;
@@ -15,6 +15,7 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include "sql/operator/physical_operator.h"
+#include "sql/operator/morsel_scheduler.h"
 #include "storage/record/record_manager.h"
 #include "common/rc.h"
 
@@ -23,6 +24,8 @@ class Table;
 /**
  * @brief 表扫描物理算子
  * @ingroup PhysicalOperator
+ * @details 设置了MorselScheduler时是并行扫描中的一个工作线程，每次从调度器中取一段页面扫描，
+ * 扫描完了再取下一段，直到所有的页面都已经分配完。
  */
 class TableScanPhysicalOperator : public PhysicalOperator
 {
@@ -46,16 +49,41 @@ public:
 
   Tuple *current_tuple() override;
 
+  /**
+   * @brief 一次从表中取出一批记录，每个字段一列，然后在列上计算所有的谓词
+   */
+  RC next_chunk(Chunk &chunk) override;
+  bool support_chunk() const override { return true; }
+
   void set_predicates(std::vector<std::unique_ptr<Expression>> &&exprs);
 
+  /**
+   * @brief 作为并行扫描的第几个工作线程，只扫描调度器分配的页面
+   */
+  void set_morsel_scheduler(std::shared_ptr<MorselScheduler> scheduler, int worker);
+
+  Table *table() const { return table_; }
+  bool   readonly() const { return readonly_; }
+  const std::vector<std::unique_ptr<Expression>> &predicates() const { return predicates_; }
+
 private:
   RC filter(RowTuple &tuple, bool &result);
+  RC fill_chunk(Chunk &chunk);
+
+  /**
+   * @brief 确认还有记录可以读取，并行扫描时当前的一段页面扫描完了就打开下一段
+   * @return 没有记录时返回RECORD_EOF
+   */
+  RC prepare_next();
 
 private:
   Table *                                  table_ = nullptr;
   Trx *                                    trx_ = nullptr;
   bool                                     readonly_ = false;
   RecordFileScanner                        record_scanner_;
+  bool                                     scanner_opened_ = false;
+  std::shared_ptr<MorselScheduler>         scheduler_;
+  int                                      worker_ = 0;
   Record                                   current_record_;
   RowTuple                                 tuple_;
   std::vector<std::unique_ptr<Expression>> predicates_; // TODO chang predicate to table tuple filter
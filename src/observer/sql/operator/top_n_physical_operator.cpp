@@ -0,0 +1,151 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+
+#include "sql/operator/top_n_physical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "sql/operator/external_sorter.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+TopNPhysicalOperator::TopNPhysicalOperator(vector<unique_ptr<Expression>> &&exprs, const vector<bool> &asc, int64_t limit)
+    : exprs_(std::move(exprs)), asc_(asc), limit_(limit)
+{}
+
+string TopNPhysicalOperator::param() const
+{
+  return SortPhysicalOperator::order_by_param(exprs_, asc_) + ", LIMIT " + to_string(limit_);
+}
+
+bool TopNPhysicalOperator::row_less(const Row &row1, const Row &row2)
+{
+  const int result = SortKey::compare(row1.key.data(), static_cast<int>(row1.key.size()), row2.key.data(),
+      static_cast<int>(row2.key.size()));
+  return result < 0 || (result == 0 && row1.seq < row2.seq);
+}
+
+RC TopNPhysicalOperator::open(Trx *trx)
+{
+  if (children_.size() != 1) {
+    LOG_WARN("top-n operator must has one child");
+    return RC::INTERNAL;
+  }
+
+  PhysicalOperator *child = children_[0].get();
+  RC rc = child->open(trx);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open child operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  rows_.clear();
+  speces_.clear();
+  rc = fetch_all(*child);
+
+  RC close_rc = child->close();
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  if (close_rc != RC::SUCCESS) {
+    LOG_WARN("failed to close child operator. rc=%s", strrc(close_rc));
+    return close_rc;
+  }
+
+  std::sort_heap(rows_.begin(), rows_.end(), row_less);
+  pos_ = 0;
+  tuple_.set_schema(&speces_);
+  return RC::SUCCESS;
+}
+
+RC TopNPhysicalOperator::fetch_all(PhysicalOperator &child)
+{
+  // 不需要输出数据时不读取下层算子
+  if (limit_ <= 0) {
+    return RC::SUCCESS;
+  }
+
+  RC rc = RC::SUCCESS;
+  int64_t seq = 0;
+  while (RC::SUCCESS == (rc = child.next())) {
+    Tuple *tuple = child.current_tuple();
+    if (speces_.empty()) {
+      rc = MaterializedTuple::copy_schema(*tuple, speces_);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    rc = SortPhysicalOperator::make_key(*tuple, exprs_, asc_, key_);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    if (static_cast<int64_t>(rows_.size()) < limit_) {
+      rows_.emplace_back();
+    } else {
+      // 后面的行key相同时排在后面，所以比堆顶大或者相等时都可以丢弃
+      Row &top = rows_.front();
+      const int result = SortKey::compare(
+          key_.data(), static_cast<int>(key_.size()), top.key.data(), static_cast<int>(top.key.size()));
+      if (result >= 0) {
+        seq++;
+        continue;
+      }
+      std::pop_heap(rows_.begin(), rows_.end(), row_less);
+    }
+
+    Row &row = rows_.back();
+    row.key.swap(key_);
+    row.seq = seq++;
+    rc = MaterializedTuple::copy_cells(*tuple, row.cells);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to copy tuple. rc=%s", strrc(rc));
+      return rc;
+    }
+    std::push_heap(rows_.begin(), rows_.end(), row_less);
+  }
+
+  if (rc != RC::RECORD_EOF) {
+    LOG_WARN("failed to fetch tuple. rc=%s", strrc(rc));
+    return rc;
+  }
+  return RC::SUCCESS;
+}
+
+RC TopNPhysicalOperator::next()
+{
+  if (pos_ >= rows_.size()) {
+    return RC::RECORD_EOF;
+  }
+  tuple_.set_cells(rows_[pos_++].cells.data());
+  return RC::SUCCESS;
+}
+
+RC TopNPhysicalOperator::close()
+{
+  rows_.clear();
+  return RC::SUCCESS;
+}
+
+Tuple *TopNPhysicalOperator::current_tuple()
+{
+  return &tuple_;
+}
+
+RC TopNPhysicalOperator::tuple_schema(TupleSchema &schema) const
+{
+  return children_[0]->tuple_schema(schema);
+}
@@ -0,0 +1,84 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sql/operator/physical_operator.h"
+#include "sql/expr/expression.h"
+
+/**
+ * @brief Top-N算子，对应同时有 ORDER BY 和 LIMIT 的查询
+ * @ingroup PhysicalOperator
+ * @details 只保留排在最前面的N行：使用一个大小为N的最大堆，堆顶是当前保留的行中排在最后的一行，
+ * 新的一行比堆顶小时替换堆顶，否则直接丢弃，不复制数据。读完输入以后把堆排好序输出。
+ * key相同的行按照输入的顺序比较，与排序算子的结果一致。
+ * 只需要 O(N) 的内存，N很大时使用排序算子。
+ */
+class TopNPhysicalOperator : public PhysicalOperator
+{
+public:
+  /// N超过这个值时堆占用的内存太多，使用外部排序
+  static constexpr int64_t MAX_ROWS = 65536;
+
+public:
+  /**
+   * @param exprs 排序的表达式，依次比较
+   * @param asc 每个表达式是否升序
+   * @param limit 最多输出的行数
+   */
+  TopNPhysicalOperator(std::vector<std::unique_ptr<Expression>> &&exprs, const std::vector<bool> &asc, int64_t limit);
+  virtual ~TopNPhysicalOperator() = default;
+
+  PhysicalOperatorType type() const override
+  {
+    return PhysicalOperatorType::TOP_N;
+  }
+
+  std::string param() const override;
+
+  RC open(Trx *trx) override;
+  RC next() override;
+  RC close() override;
+  Tuple *current_tuple() override;
+
+  RC tuple_schema(TupleSchema &schema) const override;
+
+private:
+  struct Row
+  {
+    std::string        key;
+    int64_t            seq = 0;  ///< 输入中的位置，key相同时使用
+    std::vector<Value> cells;
+  };
+
+  static bool row_less(const Row &row1, const Row &row2);
+
+  RC fetch_all(PhysicalOperator &child);
+
+private:
+  std::vector<std::unique_ptr<Expression>> exprs_;
+  std::vector<bool>                        asc_;
+  int64_t                                  limit_ = 0;
+
+  std::vector<Row>           rows_;  ///< 读取数据时是最大堆，读完以后按顺序排列
+  size_t                     pos_ = 0;
+  std::vector<TupleCellSpec> speces_;
+  std::string                key_;
+  MaterializedTuple          tuple_;
+};
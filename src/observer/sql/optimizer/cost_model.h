@@ -0,0 +1,76 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief 代价模型的参数，以顺序读取一个页面的代价为单位
+ * @ingroup PhysicalOperator
+ */
+class CostModel
+{
+public:
+  static constexpr double SEQ_PAGE_COST        = 1.0;
+  static constexpr double RANDOM_PAGE_COST     = 4.0;
+  static constexpr double CPU_TUPLE_COST       = 0.01;
+  static constexpr double CPU_INDEX_TUPLE_COST = 0.005;
+  static constexpr double CPU_OPERATOR_COST    = 0.0025;  ///< 一次比较或者计算哈希值
+
+  /**
+   * @brief 全表扫描的代价
+   */
+  static double table_scan_cost(double rows, double pages)
+  {
+    return pages * SEQ_PAGE_COST + rows * CPU_TUPLE_COST;
+  }
+
+  /**
+   * @brief 估算索引扫描的代价
+   * @details 回表时随机读取数据页面。假设记录均匀分布在各个页面上，按照命中的记录数估算读取的不同页面个数，
+   * 重复访问的页面认为在缓冲池中
+   */
+  static double index_scan_cost(double hit_rows, double pages, bool index_only)
+  {
+    double cost = hit_rows * CPU_INDEX_TUPLE_COST;
+    if (index_only) {
+      return cost;
+    }
+
+    pages = std::max(pages, 1.0);
+    const double fetch_pages = pages * (1 - std::pow(1 - 1 / pages, hit_rows));
+    cost += hit_rows * CPU_TUPLE_COST + fetch_pages * RANDOM_PAGE_COST;
+    return cost;
+  }
+
+  /**
+   * @brief 对rows行数据排序的代价，只计算比较的次数
+   */
+  static double sort_cost(double rows)
+  {
+    rows = std::max(rows, 2.0);
+    return 2 * rows * std::log2(rows) * CPU_OPERATOR_COST;
+  }
+
+  /**
+   * @brief 从rows行数据中使用大小为n的堆选出最前面的n行的代价
+   */
+  static double top_n_cost(double rows, double n)
+  {
+    n = std::max(n, 2.0);
+    return rows * std::log2(n) * CPU_OPERATOR_COST;
+  }
+};
@@ -0,0 +1,304 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "sql/optimizer/join_order_optimizer.h"
+#include "sql/optimizer/cost_model.h"
+#include "common/log/log.h"
+
+using namespace std;
+
+static inline uint64_t relation_bit(int relation)
+{
+  return (uint64_t)1 << relation;
+}
+
+const char *JoinOrderOptimizer::algorithm_name(Algorithm algorithm)
+{
+  switch (algorithm) {
+    case Algorithm::NONE: return "NONE";
+    case Algorithm::NESTED_LOOP: return "NESTED_LOOP";
+    case Algorithm::HASH: return "HASH";
+    case Algorithm::MERGE: return "MERGE";
+    case Algorithm::INDEX_NESTED_LOOP: return "INDEX_NESTED_LOOP";
+  }
+  return "UNKNOWN";
+}
+
+int JoinOrderOptimizer::add_relation(const Relation &relation)
+{
+  relations_.push_back(relation);
+  return static_cast<int>(relations_.size()) - 1;
+}
+
+void JoinOrderOptimizer::add_edge(const Edge &edge)
+{
+  edges_.push_back(edge);
+}
+
+RC JoinOrderOptimizer::optimize()
+{
+  const int relation_num = static_cast<int>(relations_.size());
+  if (relation_num == 0 || relation_num > MAX_RELATIONS) {
+    LOG_WARN("invalid number of relations to join. relation num=%d", relation_num);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  plans_.clear();
+  best_plans_.clear();
+  best_plan_ = -1;
+  for (int i = 0; i < relation_num; i++) {
+    Plan plan;
+    plan.relations = relation_bit(i);
+    plan.rows = std::max(relations_[i].rows, 1.0);
+    plan.cost = relations_[i].cost;
+    plan.relation = i;
+    plans_.push_back(plan);
+  }
+
+  bool found = false;
+  if (relation_num == 1) {
+    best_plan_ = 0;
+    found = true;
+  } else if (relation_num <= DP_MAX_RELATIONS) {
+    // 连接图不连通时，只能使用笛卡尔积把各个部分连起来
+    found = optimize_dp(false /*allow_cross_product*/) || optimize_dp(true /*allow_cross_product*/);
+  } else {
+    found = optimize_greedy();
+  }
+
+  if (!found) {
+    LOG_WARN("failed to find a join order. relation num=%d", relation_num);
+    return RC::INTERNAL;
+  }
+
+  LOG_TRACE("join order chosen. relation num=%d, plans=%d, rows=%.0f, cost=%.2f",
+      relation_num, static_cast<int>(plans_.size()), plans_[best_plan_].rows, plans_[best_plan_].cost);
+  return RC::SUCCESS;
+}
+
+bool JoinOrderOptimizer::optimize_dp(bool allow_cross_product)
+{
+  const int relation_num = static_cast<int>(relations_.size());
+  plans_.resize(relation_num);
+  best_plans_.clear();
+
+  // sets[i] 是已经找到计划的包含i个表的集合
+  vector<vector<uint64_t>> sets(relation_num + 1);
+  for (int i = 0; i < relation_num; i++) {
+    best_plans_.emplace(relation_bit(i), i);
+    sets[1].push_back(relation_bit(i));
+  }
+
+  Plan plan;
+  for (int size = 2; size <= relation_num; size++) {
+    for (int left_size = 1; left_size < size; left_size++) {
+      for (uint64_t left : sets[left_size]) {
+        for (uint64_t right : sets[size - left_size]) {
+          if ((left & right) != 0 || (!allow_cross_product && !connected(left, right))) {
+            continue;
+          }
+
+          best_join(best_plans_[left], best_plans_[right], plan);
+
+          // 包含的表更少的集合都已经确定了，所以可以直接覆盖原来的计划
+          auto iter = best_plans_.find(left | right);
+          if (iter == best_plans_.end()) {
+            best_plans_.emplace(left | right, static_cast<int>(plans_.size()));
+            plans_.push_back(plan);
+            sets[size].push_back(left | right);
+          } else if (plan.cost < plans_[iter->second].cost) {
+            plans_[iter->second] = plan;
+          }
+        }
+      }
+    }
+  }
+
+  const uint64_t all = (relation_num == MAX_RELATIONS) ? ~(uint64_t)0 : relation_bit(relation_num) - 1;
+  auto iter = best_plans_.find(all);
+  if (iter == best_plans_.end()) {
+    return false;
+  }
+  best_plan_ = iter->second;
+  return true;
+}
+
+bool JoinOrderOptimizer::optimize_greedy()
+{
+  vector<int> current(relations_.size());
+  std::iota(current.begin(), current.end(), 0);
+
+  Plan plan;
+  while (current.size() > 1) {
+    Plan best;
+    int  best_left = -1;
+    int  best_right = -1;
+    for (bool allow_cross_product : {false, true}) {
+      for (size_t i = 0; i < current.size(); i++) {
+        for (size_t j = 0; j < current.size(); j++) {
+          if (i == j ||
+              (!allow_cross_product && !connected(plans_[current[i]].relations, plans_[current[j]].relations))) {
+            continue;
+          }
+
+          best_join(current[i], current[j], plan);
+          if (best_left < 0 || plan.cost < best.cost) {
+            best = plan;
+            best_left = static_cast<int>(i);
+            best_right = static_cast<int>(j);
+          }
+        }
+      }
+      if (best_left >= 0) {
+        break;
+      }
+    }
+
+    plans_.push_back(best);
+    current[best_left] = static_cast<int>(plans_.size()) - 1;
+    current.erase(current.begin() + best_right);
+  }
+
+  best_plan_ = current.front();
+  return true;
+}
+
+bool JoinOrderOptimizer::connected(uint64_t left, uint64_t right) const
+{
+  const uint64_t relations = left | right;
+  return std::any_of(edges_.begin(), edges_.end(), [left, right, relations](const Edge &edge) {
+    return (edge.relations & ~relations) == 0 && (edge.relations & left) != 0 && (edge.relations & right) != 0;
+  });
+}
+
+double JoinOrderOptimizer::estimate_rows(uint64_t relations) const
+{
+  double rows = 1;
+  for (size_t i = 0; i < relations_.size(); i++) {
+    if (relations & relation_bit(static_cast<int>(i))) {
+      rows *= std::max(relations_[i].rows, 1.0);
+    }
+  }
+  for (const Edge &edge : edges_) {
+    if ((edge.relations & ~relations) == 0) {
+      rows *= edge.selectivity;
+    }
+  }
+  return std::max(rows, 1.0);
+}
+
+void JoinOrderOptimizer::best_join(int left_plan, int right_plan, Plan &plan) const
+{
+  const Plan &left = plans_[left_plan];
+  const Plan &right = plans_[right_plan];
+
+  plan = Plan();
+  plan.relations = left.relations | right.relations;
+  plan.rows = estimate_rows(plan.relations);
+  plan.left = left_plan;
+  plan.right = right_plan;
+
+  const double output_cost = plan.rows * CostModel::CPU_TUPLE_COST;
+
+  // nested loop join，外表的每一行都重新读取一次内表，所有的组合都要计算一次连接条件
+  plan.algorithm = Algorithm::NESTED_LOOP;
+  plan.cost = left.cost + left.rows * right.cost + left.rows * right.rows * CostModel::CPU_TUPLE_COST;
+
+  bool has_equi_edge = false;
+  for (size_t i = 0; i < edges_.size(); i++) {
+    const Edge &edge = edges_[i];
+    if (!edge.equi) {
+      continue;
+    }
+
+    // outer_side 是条件中属于左边子计划的一侧
+    int outer_side = 0;
+    if ((left.relations & relation_bit(edge.left)) && (right.relations & relation_bit(edge.right))) {
+      outer_side = 0;
+    } else if ((left.relations & relation_bit(edge.right)) && (right.relations & relation_bit(edge.left))) {
+      outer_side = 1;
+    } else {
+      continue;
+    }
+    has_equi_edge = true;
+
+    const int inner_side = 1 - outer_side;
+    const int outer_relation = (outer_side == 0) ? edge.left : edge.right;
+    const int inner_relation = (inner_side == 0) ? edge.left : edge.right;
+
+    // index nested loop join，内表必须是一个可以用索引查找的表。假设外表的key重复访问的页面都在缓冲池中
+    if (right.relation == inner_relation && edge.indexed[inner_side]) {
+      const Relation &inner = relations_[inner_relation];
+      const double    hit_rows = left.rows * inner.table_rows * edge.selectivity;
+      const double    cost = left.cost + left.rows * std::log2(inner.table_rows + 1) * CostModel::CPU_OPERATOR_COST +
+                          CostModel::index_scan_cost(hit_rows, inner.pages, false /*index_only*/) + output_cost;
+      if (cost < plan.cost) {
+        plan.algorithm = Algorithm::INDEX_NESTED_LOOP;
+        plan.cost = cost;
+        plan.key_edge = static_cast<int>(i);
+        plan.left_sorted = plan.right_sorted = false;
+      }
+    }
+
+    // sort-merge join，叶子节点可以按照这个条件中的字段顺序读取时不需要排序
+    double left_input = left.cost + CostModel::sort_cost(left.rows);
+    double right_input = right.cost + CostModel::sort_cost(right.rows);
+    bool   left_sorted = false;
+    bool   right_sorted = false;
+    if (left.relation == outer_relation && edge.ordered_cost[outer_side] >= 0 &&
+        edge.ordered_cost[outer_side] < left_input) {
+      left_input = edge.ordered_cost[outer_side];
+      left_sorted = true;
+    }
+    if (right.relation == inner_relation && edge.ordered_cost[inner_side] >= 0 &&
+        edge.ordered_cost[inner_side] < right_input) {
+      right_input = edge.ordered_cost[inner_side];
+      right_sorted = true;
+    }
+    const double merge_cost =
+        left_input + right_input + (left.rows + right.rows) * CostModel::CPU_OPERATOR_COST + output_cost;
+    if (merge_cost < plan.cost) {
+      plan.algorithm = Algorithm::MERGE;
+      plan.cost = merge_cost;
+      plan.key_edge = static_cast<int>(i);
+      plan.left_sorted = left_sorted;
+      plan.right_sorted = right_sorted;
+    }
+  }
+
+  if (!has_equi_edge) {
+    return;
+  }
+
+  // hash join，使用估算行数较少的一边建立hash表，相同时使用右边，与nested loop join的内表一致
+  const bool   build_left = left.rows < right.rows;
+  const double build_rows = build_left ? left.rows : right.rows;
+  const double probe_rows = build_left ? right.rows : left.rows;
+  if (build_rows <= HASH_JOIN_MAX_BUILD_ROWS) {
+    const double cost = left.cost + right.cost +
+                        build_rows * (CostModel::CPU_TUPLE_COST + CostModel::CPU_OPERATOR_COST) +
+                        probe_rows * CostModel::CPU_OPERATOR_COST + output_cost;
+    if (cost < plan.cost) {
+      plan.algorithm = Algorithm::HASH;
+      plan.cost = cost;
+      plan.key_edge = -1;
+      plan.build_left = build_left;
+      plan.left_sorted = plan.right_sorted = false;
+    }
+  }
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/rc.h"
+
+/**
+ * @brief 基于代价的连接顺序选择
+ * @ingroup PhysicalOperator
+ * @details 输入是连接图：每个参与连接的表(或者其它的子计划)是一个节点，带有估算的行数和读取代价；
+ * 每个连接条件是一条边，带有选择率。输出是一棵连接树，每个连接节点选好了连接算法，hash join
+ * 选好了建立hash表的一边。
+ * 表不多的时候使用动态规划(DPsize)，按照集合大小从小到大，枚举两个不相交并且有连接条件的子集，
+ * 计算每种连接算法的代价，保留每个集合代价最小的计划，可以生成浓密树(bushy tree)。
+ * 表很多的时候动态规划的代价太大，改用贪心算法：每次选择代价最小的一对子计划连接起来。
+ * 只有在没有连接条件可用的时候才考虑笛卡尔积。
+ * 一个集合的输出行数是所有表的行数与集合内所有连接条件选择率的乘积，与连接顺序无关。
+ */
+class JoinOrderOptimizer
+{
+public:
+  /// 表的个数不超过这个值时使用动态规划，否则使用贪心算法
+  static constexpr int DP_MAX_RELATIONS = 10;
+  /// 最多可以连接的表的个数，表的集合使用64位的位图表示
+  static constexpr int MAX_RELATIONS = 64;
+  /// 建立hash表的一边估算的行数超过这个值时，hash表可能放不下，不使用hash join
+  static constexpr double HASH_JOIN_MAX_BUILD_ROWS = 65536;
+
+  enum class Algorithm
+  {
+    NONE,  ///< 叶子节点，不是连接
+    NESTED_LOOP,
+    HASH,
+    MERGE,
+    INDEX_NESTED_LOOP,
+  };
+
+  /**
+   * @brief 参与连接的一个输入
+   */
+  struct Relation
+  {
+    double rows = 1;        ///< 经过自己的过滤条件以后输出的行数
+    double cost = 0;        ///< 读取数据的代价
+    double table_rows = 1;  ///< 过滤以前的行数，用索引查找时使用
+    double pages = 1;       ///< 数据页面的个数
+  };
+
+  /**
+   * @brief 一个连接条件
+   * @details 两个表的字段等值比较可以作为hash join、merge join的key，这时left和right是两边的表，
+   * indexed表示那一边的字段上是否有可以做等值查找的索引，ordered_cost是那一边按照字段的顺序
+   * 读取整个表的代价，小于0表示不能按顺序读取。
+   */
+  struct Edge
+  {
+    uint64_t relations = 0;  ///< 条件中用到的表
+    double   selectivity = 1;
+    bool     equi = false;
+    int      left = -1;
+    int      right = -1;
+    bool     indexed[2] = {false, false};
+    double   ordered_cost[2] = {-1, -1};
+  };
+
+  /**
+   * @brief 连接树上的一个节点
+   */
+  struct Plan
+  {
+    uint64_t  relations = 0;
+    double    rows = 1;
+    double    cost = 0;
+    Algorithm algorithm = Algorithm::NONE;
+    int       relation = -1;  ///< 叶子节点对应的输入
+    int       left = -1;      ///< 子节点在 plans() 中的位置
+    int       right = -1;
+    int       key_edge = -1;  ///< index nested loop join查找索引使用的条件，merge join按顺序读取时使用的条件
+    bool      build_left = false;   ///< hash join是否使用左边建立hash表
+    bool      left_sorted = false;  ///< merge join的左边是否直接按顺序读取，不需要排序
+    bool      right_sorted = false;
+  };
+
+public:
+  JoinOrderOptimizer() = default;
+
+  /**
+   * @return 输入的编号，从0开始
+   */
+  int  add_relation(const Relation &relation);
+  void add_edge(const Edge &edge);
+
+  RC optimize();
+
+  /**
+   * @brief 代价最小的完整的连接树的根节点
+   */
+  int         best() const { return best_plan_; }
+  const Plan &plan(int index) const { return plans_[index]; }
+
+  const std::vector<Relation> &relations() const { return relations_; }
+  const std::vector<Edge>     &edges() const { return edges_; }
+
+  static const char *algorithm_name(Algorithm algorithm);
+
+private:
+  bool optimize_dp(bool allow_cross_product);
+  bool optimize_greedy();
+
+  /**
+   * @brief 计算 left 与 right 两个子计划连接的各种算法的代价，选出最好的一个
+   * @param left_plan,right_plan 子计划在 plans_ 中的位置，连接有方向，left是外表
+   */
+  void best_join(int left_plan, int right_plan, Plan &plan) const;
+
+  bool   connected(uint64_t left, uint64_t right) const;
+  double estimate_rows(uint64_t relations) const;
+
+private:
+  std::vector<Relation> relations_;
+  std::vector<Edge>     edges_;
+
+  std::vector<Plan>                 plans_;
+  std::unordered_map<uint64_t, int> best_plans_;  ///< 每个表的集合代价最小的计划
+  int                               best_plan_ = -1;
+};
@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2023/08/16.
 //
 
+#include <algorithm>
+
 #include "sql/optimizer/logical_plan_generator.h"
 
 #include "sql/operator/logical_operator.h"
@@ -24,6 +26,9 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/join_logical_operator.h"
 #include "sql/operator/project_logical_operator.h"
 #include "sql/operator/explain_logical_operator.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/sort_logical_operator.h"
+#include "sql/operator/limit_logical_operator.h"
 
 #include "sql/stmt/stmt.h"
 #include "sql/stmt/calc_stmt.h"
@@ -83,10 +88,30 @@ RC LogicalPlanGenerator::create_plan(
 
   const std::vector<Table *> &tables = select_stmt->tables();
   const std::vector<Field> &all_fields = select_stmt->query_fields();
+
+  // 过滤条件中用到的字段也需要从表中获取
+  std::vector<Field> referred_fields(all_fields);
+  select_stmt->filter_stmt()->visit_fields([&referred_fields](const Field &field) {
+    referred_fields.push_back(field);
+  });
+
+  // 没有聚合时在投影之前排序，排序的字段不一定在查询列表中
+  if (!select_stmt->has_aggregation()) {
+    for (const unique_ptr<Expression> &expr : select_stmt->order_by_exprs()) {
+      referred_fields.push_back(static_cast<FieldExpr &>(*expr).field());
+    }
+  }
+
   for (Table *table : tables) {
     std::vector<Field> fields;
-    for (const Field &field : all_fields) {
-      if (0 == strcmp(field.table_name(), table->name())) {
+    for (const Field &field : referred_fields) {
+      if (0 != strcmp(field.table_name(), table->name())) {
+        continue;
+      }
+      auto iter = std::find_if(fields.begin(), fields.end(), [&field](const Field &other) {
+        return other.meta() == field.meta();
+      });
+      if (iter == fields.end()) {
         fields.push_back(field);
       }
     }
@@ -109,28 +134,75 @@ RC LogicalPlanGenerator::create_plan(
     return rc;
   }
 
-  unique_ptr<LogicalOperator> project_oper(new ProjectLogicalOperator(all_fields));
   if (predicate_oper) {
     if (table_oper) {
       predicate_oper->add_child(std::move(table_oper));
     }
-    project_oper->add_child(std::move(predicate_oper));
-  } else {
-    if (table_oper) {
-      project_oper->add_child(std::move(table_oper));
+    table_oper = std::move(predicate_oper);
+  }
+
+  // 有聚合时由聚合算子按照查询列表的顺序输出，不需要投影
+  unique_ptr<LogicalOperator> top_oper = std::move(table_oper);
+  if (select_stmt->has_aggregation()) {
+    vector<unique_ptr<Expression>> group_by_exprs;
+    for (const Field &field : select_stmt->group_by_fields()) {
+      group_by_exprs.emplace_back(new FieldExpr(field));
+    }
+    unique_ptr<LogicalOperator> aggregate_oper(
+        new AggregateLogicalOperator(std::move(group_by_exprs), std::move(select_stmt->query_exprs())));
+    if (top_oper) {
+      aggregate_oper->add_child(std::move(top_oper));
     }
+    top_oper = std::move(aggregate_oper);
+  }
+
+  if (!select_stmt->order_by_exprs().empty()) {
+    unique_ptr<LogicalOperator> sort_oper(
+        new SortLogicalOperator(std::move(select_stmt->order_by_exprs()), select_stmt->order_by_asc()));
+    sort_oper->add_child(std::move(top_oper));
+    top_oper = std::move(sort_oper);
+  }
+
+  if (select_stmt->limit() >= 0 || select_stmt->offset() > 0) {
+    unique_ptr<LogicalOperator> limit_oper(new LimitLogicalOperator(select_stmt->limit(), select_stmt->offset()));
+    limit_oper->add_child(std::move(top_oper));
+    top_oper = std::move(limit_oper);
   }
 
-  logical_operator.swap(project_oper);
+  if (!select_stmt->has_aggregation()) {
+    unique_ptr<LogicalOperator> project_oper(new ProjectLogicalOperator(all_fields));
+    if (top_oper) {
+      project_oper->add_child(std::move(top_oper));
+    }
+    top_oper = std::move(project_oper);
+  }
+
+  logical_operator.swap(top_oper);
   return RC::SUCCESS;
 }
 
-RC LogicalPlanGenerator::create_plan(
-    FilterStmt *filter_stmt, unique_ptr<LogicalOperator> &logical_operator)
+/**
+ * @brief 把过滤条件转换成表达式，条件之间是AND的关系
+ */
+static void create_filter_expressions(const FilterStmt *filter_stmt, std::vector<unique_ptr<Expression>> &cmp_exprs)
 {
-  std::vector<unique_ptr<Expression>> cmp_exprs;
   const std::vector<FilterUnit *> &filter_units = filter_stmt->filter_units();
   for (const FilterUnit *filter_unit : filter_units) {
+    if (filter_unit->is_disjunction()) {
+      std::vector<unique_ptr<Expression>> disjunct_exprs;
+      for (const FilterStmt *disjunct : filter_unit->disjuncts()) {
+        std::vector<unique_ptr<Expression>> conjunct_exprs;
+        create_filter_expressions(disjunct, conjunct_exprs);
+        if (conjunct_exprs.size() == 1) {
+          disjunct_exprs.emplace_back(std::move(conjunct_exprs.front()));
+        } else {
+          disjunct_exprs.emplace_back(new ConjunctionExpr(ConjunctionExpr::Type::AND, conjunct_exprs));
+        }
+      }
+      cmp_exprs.emplace_back(new ConjunctionExpr(ConjunctionExpr::Type::OR, disjunct_exprs));
+      continue;
+    }
+
     const FilterObj &filter_obj_left = filter_unit->left();
     const FilterObj &filter_obj_right = filter_unit->right();
 
@@ -145,6 +217,13 @@ RC LogicalPlanGenerator::create_plan(
     ComparisonExpr *cmp_expr = new ComparisonExpr(filter_unit->comp(), std::move(left), std::move(right));
     cmp_exprs.emplace_back(cmp_expr);
   }
+}
+
+RC LogicalPlanGenerator::create_plan(
+    FilterStmt *filter_stmt, unique_ptr<LogicalOperator> &logical_operator)
+{
+  std::vector<unique_ptr<Expression>> cmp_exprs;
+  create_filter_expressions(filter_stmt, cmp_exprs);
 
   unique_ptr<PredicateLogicalOperator> predicate_oper;
   if (!cmp_exprs.empty()) {
@@ -27,6 +27,7 @@ See the Mulan PSL v2 for more details. */
 #include "sql/stmt/stmt.h"
 #include "event/sql_event.h"
 #include "event/session_event.h"
+#include "session/session.h"
 
 using namespace std;
 using namespace common;
@@ -61,6 +62,13 @@ RC OptimizeStage::handle_request(SQLStageEvent *sql_event)
     return rc;
   }
 
+  Session *session = sql_event->session_event()->session();
+  rc = physical_plan_generator_.parallelize(physical_operator, session->parallel_degree());
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to parallelize physical plan. rc=%s", strrc(rc));
+    return rc;
+  }
+
   sql_event->set_operator(std::move(physical_operator));
 
   return rc;
@@ -12,12 +12,16 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/12/14.
 //
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "sql/optimizer/physical_plan_generator.h"
 #include "sql/operator/table_get_logical_operator.h"
 #include "sql/operator/table_scan_physical_operator.h"
 #include "sql/operator/index_scan_physical_operator.h"
+#include "sql/operator/bitmap_scan_physical_operator.h"
+#include "sql/operator/index_merge_scan_physical_operator.h"
 #include "sql/operator/predicate_logical_operator.h"
 #include "sql/operator/predicate_physical_operator.h"
 #include "sql/operator/project_logical_operator.h"
@@ -30,13 +34,1006 @@ See the Mulan PSL v2 for more details. */
 #include "sql/operator/explain_physical_operator.h"
 #include "sql/operator/join_logical_operator.h"
 #include "sql/operator/join_physical_operator.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "sql/operator/merge_join_physical_operator.h"
+#include "sql/operator/index_nested_loop_join_physical_operator.h"
 #include "sql/operator/calc_logical_operator.h"
 #include "sql/operator/calc_physical_operator.h"
+#include "sql/operator/aggregate_logical_operator.h"
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "sql/operator/parallel_hash_aggregate_physical_operator.h"
+#include "sql/operator/gather_physical_operator.h"
+#include "sql/operator/morsel_scheduler.h"
+#include "sql/operator/sort_logical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "sql/operator/top_n_physical_operator.h"
+#include "sql/operator/limit_logical_operator.h"
+#include "sql/operator/limit_physical_operator.h"
+#include "sql/optimizer/cost_model.h"
+#include "sql/optimizer/join_order_optimizer.h"
 #include "sql/expr/expression.h"
+#include "storage/index/index.h"
+#include "storage/index/bitmap_index.h"
+#include "storage/table/table.h"
 #include "common/log/log.h"
 
 using namespace std;
 
+/// 索引扫描命中的记录数超过这个值时，按RID排序后再回表
+static constexpr int SORTED_RID_FETCH_THRESHOLD = 256;
+/// 按RID排序回表时，每批收集的RID个数
+static constexpr int SORTED_RID_FETCH_BATCH_SIZE = 4096;
+/// 估算索引合并的分支命中的记录数时，最多统计的索引项个数。超过这个数就认为分支的选择性太差
+static constexpr int INDEX_MERGE_ESTIMATE_LIMIT = 4096;
+/// 估算表中的记录数时，最多统计的索引项个数
+static constexpr int TABLE_ROWS_ESTIMATE_LIMIT = 65536;
+/// 没有统计信息也没有B+树索引时，估算表中的记录数使用的默认值
+static constexpr double DEFAULT_TABLE_ROWS = 1000;
+/// 没有统计信息时等值条件的选择率
+static constexpr double DEFAULT_EQUAL_SELECTIVITY = 0.1;
+/// 没有统计信息时其它条件的选择率
+static constexpr double DEFAULT_SELECTIVITY = 1.0 / 3;
+/// index nested loop join外表估算的行数超过这个值时，批量读取外表数据并按照key排序以后再查找内表
+static constexpr int INDEX_NESTED_LOOP_JOIN_BATCH_SIZE = 1024;
+/// 表的页面至少能切分成这么多个morsel时才并行扫描，页面太少时启动线程的开销比扫描还大
+static constexpr int PARALLEL_SCAN_MIN_MORSELS = 2;
+/// 索引合并预计命中的记录数不超过表中记录数的 1/INDEX_MERGE_SELECTIVITY_FACTOR 时才使用，否则全表扫描更快
+static constexpr int INDEX_MERGE_SELECTIVITY_FACTOR = 4;
+
+/**
+ * @brief 判断表达式是否是 field op value 形式的比较，value op field 会转换成 field op' value
+ */
+static bool get_field_comparison(Expression *expr, const Field *&field, const Value *&value, CompOp &comp)
+{
+  if (expr->type() != ExprType::COMPARISON) {
+    return false;
+  }
+
+  auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+  Expression *left_expr = comparison_expr->left().get();
+  Expression *right_expr = comparison_expr->right().get();
+  comp = comparison_expr->comp();
+  if (left_expr->type() == ExprType::VALUE) {
+    std::swap(left_expr, right_expr);
+    switch (comp) {
+      case LESS_THAN: comp = GREAT_THAN; break;
+      case LESS_EQUAL: comp = GREAT_EQUAL; break;
+      case GREAT_THAN: comp = LESS_THAN; break;
+      case GREAT_EQUAL: comp = LESS_EQUAL; break;
+      default: break;
+    }
+  }
+  if (left_expr->type() != ExprType::FIELD || right_expr->type() != ExprType::VALUE) {
+    return false;
+  }
+
+  field = &static_cast<FieldExpr *>(left_expr)->field();
+  value = &static_cast<ValueExpr *>(right_expr)->get_value();
+  return true;
+}
+
+/**
+ * @brief 收集 字段 op 常量 形式的条件，用来判断部分索引是否可以使用
+ */
+static void collect_index_conditions(vector<unique_ptr<Expression>> &predicates, vector<IndexPredicate> &conditions)
+{
+  for (unique_ptr<Expression> &expr : predicates) {
+    const Field *field = nullptr;
+    const Value *value = nullptr;
+    CompOp comp = NO_OP;
+    if (!get_field_comparison(expr.get(), field, value, comp)) {
+      continue;
+    }
+
+    IndexPredicate condition;
+    if (RC::SUCCESS == condition.init(*field->meta(), comp, *value)) {
+      conditions.push_back(std::move(condition));
+    }
+  }
+}
+
+/**
+ * @brief 判断表达式是否是可以使用位图索引的等值比较，即 field = value，并且字段上有位图索引
+ */
+static bool get_bitmap_lookup(
+    Table *table, const vector<IndexPredicate> &conditions, Expression *expr, BitmapScanPhysicalOperator::Lookup &lookup)
+{
+  if (expr->type() != ExprType::COMPARISON) {
+    return false;
+  }
+
+  auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+  if (comparison_expr->comp() != EQUAL_TO) {
+    return false;
+  }
+
+  Expression *left_expr = comparison_expr->left().get();
+  Expression *right_expr = comparison_expr->right().get();
+  if (left_expr->type() == ExprType::VALUE) {
+    std::swap(left_expr, right_expr);
+  }
+  if (left_expr->type() != ExprType::FIELD || right_expr->type() != ExprType::VALUE) {
+    return false;
+  }
+
+  const Field &field = static_cast<FieldExpr *>(left_expr)->field();
+  const Value &value = static_cast<ValueExpr *>(right_expr)->get_value();
+  if (value.attr_type() != field.attr_type()) {
+    return false;
+  }
+
+  Index *index = table->find_index_by_field(field.field_name(), IndexType::BITMAP, &conditions);
+  if (nullptr == index) {
+    return false;
+  }
+
+  lookup.index = static_cast<BitmapIndex *>(index);
+  lookup.value = value;
+  return true;
+}
+
+/**
+ * @brief 把一个谓词转换成位图扫描中的term。可以是一个等值比较，也可以是多个等值比较的OR
+ */
+static bool get_bitmap_term(
+    Table *table, const vector<IndexPredicate> &conditions, Expression *expr, BitmapScanPhysicalOperator::Term &term)
+{
+  BitmapScanPhysicalOperator::Lookup lookup;
+  if (expr->type() == ExprType::CONJUNCTION) {
+    auto conjunction_expr = static_cast<ConjunctionExpr *>(expr);
+    if (conjunction_expr->conjunction_type() != ConjunctionExpr::Type::OR) {
+      return false;
+    }
+    for (unique_ptr<Expression> &child : conjunction_expr->children()) {
+      if (!get_bitmap_lookup(table, conditions, child.get(), lookup)) {
+        return false;
+      }
+      term.push_back(lookup);
+    }
+    return !term.empty();
+  }
+
+  if (!get_bitmap_lookup(table, conditions, expr, lookup)) {
+    return false;
+  }
+  term.push_back(lookup);
+  return true;
+}
+
+using IndexMergeBranch = IndexMergeScanPhysicalOperator::Branch;
+
+/**
+ * @brief 把 field op value 形式的比较转换成索引上的一个范围
+ * @details 等值比较可以使用B+树索引或者哈希索引，范围比较只能使用B+树索引
+ */
+static bool get_index_range(Table *table, const vector<IndexPredicate> &conditions, Expression *expr, IndexMergeBranch &branch)
+{
+  const Field *field_ptr = nullptr;
+  const Value *value_ptr = nullptr;
+  CompOp comp = NO_OP;
+  if (!get_field_comparison(expr, field_ptr, value_ptr, comp)) {
+    return false;
+  }
+
+  // 类型不同时，索引中按照字段类型的比较与谓词的比较结果不一致
+  const Field &field = *field_ptr;
+  const Value &value = *value_ptr;
+  if (value.attr_type() != field.attr_type()) {
+    return false;
+  }
+
+  Index *index = nullptr;
+  switch (comp) {
+    case EQUAL_TO: {
+      index = table->find_index_by_field(field.field_name(), true /*for_equality*/, &conditions);
+      branch.left_value = value;
+      branch.left_inclusive = true;
+      branch.right_value = value;
+      branch.right_inclusive = true;
+    } break;
+    case LESS_THAN:
+    case LESS_EQUAL: {
+      index = table->find_index_by_field(field.field_name(), false /*for_equality*/, &conditions);
+      branch.right_value = value;
+      branch.right_inclusive = (comp == LESS_EQUAL);
+    } break;
+    case GREAT_THAN:
+    case GREAT_EQUAL: {
+      index = table->find_index_by_field(field.field_name(), false /*for_equality*/, &conditions);
+      branch.left_value = value;
+      branch.left_inclusive = (comp == GREAT_EQUAL);
+    } break;
+    default: {
+      return false;
+    }
+  }
+
+  branch.index = index;
+  return index != nullptr;
+}
+
+/**
+ * @brief 估算索引范围内的记录数，最多统计到limit
+ * @details 有统计信息时根据直方图估算，否则在索引中计数
+ */
+static int estimate_branch_count(Table *table, const IndexMergeBranch &branch, int limit)
+{
+  const Value &left = branch.left_value;
+  const Value &right = branch.right_value;
+  const bool has_left = left.attr_type() != UNDEFINED;
+  const bool has_right = right.attr_type() != UNDEFINED;
+
+  const TableStats &stats = table->table_meta().stats();
+  double selectivity = 0;
+  if (stats.selectivity(branch.index->field_meta().name(), has_left ? &left : nullptr, branch.left_inclusive,
+          has_right ? &right : nullptr, branch.right_inclusive, selectivity)) {
+    return static_cast<int>(std::min<double>(selectivity * stats.row_count() + 0.5, limit));
+  }
+
+  int count = 0;
+  RC rc = branch.index->estimate_count(has_left ? left.data() : nullptr, has_left ? left.length() : 0,
+      branch.left_inclusive, has_right ? right.data() : nullptr, has_right ? right.length() : 0,
+      branch.right_inclusive, limit, count);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to estimate index range count. index=%s, rc=%s", branch.index->index_meta().name(), strrc(rc));
+    return limit;
+  }
+  return count;
+}
+
+/**
+ * @brief 估算表中的记录数，最多统计到limit
+ * @details 优先使用统计信息。没有统计信息时使用任意一个B+树索引(不包括部分索引)的索引项个数，也没有B+树索引时返回-1
+ */
+static int estimate_table_rows(Table *table, int limit)
+{
+  const TableMeta &table_meta = table->table_meta();
+  if (table_meta.stats().analyzed()) {
+    return static_cast<int>(std::min<int64_t>(table_meta.stats().row_count(), limit));
+  }
+
+  for (int i = 0; i < table_meta.index_num(); i++) {
+    const IndexMeta *index_meta = table_meta.index(i);
+    if (index_meta->type() != IndexType::BPLUS_TREE || index_meta->partial()) {
+      continue;
+    }
+
+    Index *index = table->find_index(index_meta->name());
+    int count = 0;
+    if (nullptr != index &&
+        RC::SUCCESS == index->estimate_count(nullptr, 0, false, nullptr, 0, false, limit, count)) {
+      return count;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief 从一个AND条件(或者单个比较)中选出命中记录最少的索引范围
+ */
+static bool get_best_index_range(
+    Table *table, const vector<IndexPredicate> &conditions, Expression *expr, IndexMergeBranch &branch, int &count)
+{
+  vector<Expression *> conjuncts;
+  if (expr->type() == ExprType::CONJUNCTION) {
+    auto conjunction_expr = static_cast<ConjunctionExpr *>(expr);
+    if (conjunction_expr->conjunction_type() != ConjunctionExpr::Type::AND) {
+      return false;
+    }
+    for (unique_ptr<Expression> &child : conjunction_expr->children()) {
+      conjuncts.push_back(child.get());
+    }
+  } else {
+    conjuncts.push_back(expr);
+  }
+
+  bool found = false;
+  for (Expression *conjunct : conjuncts) {
+    IndexMergeBranch candidate;
+    if (!get_index_range(table, conditions, conjunct, candidate)) {
+      continue;
+    }
+
+    const int candidate_count = estimate_branch_count(table, candidate, INDEX_MERGE_ESTIMATE_LIMIT + 1);
+    if (!found || candidate_count < count) {
+      branch = std::move(candidate);
+      count = candidate_count;
+      found = true;
+    }
+  }
+  return found;
+}
+
+/**
+ * @brief OR条件的每一个分支都可以使用索引时，生成求并集的各个分支
+ * @param count 所有分支估算的记录数之和
+ */
+static bool get_union_branches(Table *table, const vector<IndexPredicate> &conditions, ConjunctionExpr *or_expr,
+    vector<IndexMergeBranch> &branches, int &count)
+{
+  for (unique_ptr<Expression> &child : or_expr->children()) {
+    if (child->type() == ExprType::CONJUNCTION &&
+        static_cast<ConjunctionExpr *>(child.get())->conjunction_type() == ConjunctionExpr::Type::OR) {
+      if (!get_union_branches(table, conditions, static_cast<ConjunctionExpr *>(child.get()), branches, count)) {
+        return false;
+      }
+      continue;
+    }
+
+    IndexMergeBranch branch;
+    int branch_count = 0;
+    if (!get_best_index_range(table, conditions, child.get(), branch, branch_count) ||
+        branch_count > INDEX_MERGE_ESTIMATE_LIMIT) {
+      return false;
+    }
+    branches.emplace_back(std::move(branch));
+    count += branch_count;
+  }
+  return !branches.empty();
+}
+
+/**
+ * @brief 根据估算的命中记录数，判断是否使用索引合并
+ * @details 两种情况：
+ * - 并集：某个OR条件的每个分支都可以使用索引，并且合起来命中的记录比较少，也比单个索引的范围少；
+ * - 交集：有多个AND条件可以使用(不同的)索引，但是每个单独的选择性都不好，按照条件相互独立估算交集以后
+ *   命中的记录比较少。
+ * @param single_range 已经选好的单个索引的范围，可能为空
+ */
+static unique_ptr<IndexMergeScanPhysicalOperator> create_index_merge_scan(Table *table, const vector<IndexPredicate> &conditions,
+    vector<unique_ptr<Expression>> &predicates, const IndexMergeBranch *single_range, bool readonly)
+{
+  int single_count = -1;
+  if (nullptr != single_range) {
+    single_count = estimate_branch_count(table, *single_range, INDEX_MERGE_ESTIMATE_LIMIT + 1);
+  }
+
+  // 并集
+  vector<IndexMergeBranch> union_branches;
+  int union_count = -1;
+  for (unique_ptr<Expression> &expr : predicates) {
+    if (expr->type() != ExprType::CONJUNCTION ||
+        static_cast<ConjunctionExpr *>(expr.get())->conjunction_type() != ConjunctionExpr::Type::OR) {
+      continue;
+    }
+
+    vector<IndexMergeBranch> branches;
+    int count = 0;
+    if (!get_union_branches(table, conditions, static_cast<ConjunctionExpr *>(expr.get()), branches, count)) {
+      continue;
+    }
+    if (union_count < 0 || count < union_count) {
+      union_branches.swap(branches);
+      union_count = count;
+    }
+  }
+
+  if (union_count >= 0 && (single_count < 0 || union_count < single_count)) {
+    const int max_count = union_count * INDEX_MERGE_SELECTIVITY_FACTOR;
+    const int rows = estimate_table_rows(table, max_count + 1);
+    if (rows > max_count) {
+      LOG_TRACE("use index merge union. estimated count=%d, table rows>=%d", union_count, rows);
+      auto oper = make_unique<IndexMergeScanPhysicalOperator>(
+          table, IndexMergeScanPhysicalOperator::MergeType::UNION, readonly);
+      for (IndexMergeBranch &branch : union_branches) {
+        oper->add_branch(std::move(branch));
+      }
+      return oper;
+    }
+  }
+
+  // 交集。单个索引选择性足够好的时候直接使用它
+  if (single_count >= 0 && single_count <= SORTED_RID_FETCH_THRESHOLD) {
+    return nullptr;
+  }
+
+  vector<IndexMergeBranch> intersect_branches;
+  vector<int> intersect_counts;
+  for (unique_ptr<Expression> &expr : predicates) {
+    IndexMergeBranch branch;
+    if (!get_index_range(table, conditions, expr.get(), branch)) {
+      continue;
+    }
+
+    const int count = estimate_branch_count(table, branch, TABLE_ROWS_ESTIMATE_LIMIT);
+    auto iter = std::find_if(intersect_branches.begin(), intersect_branches.end(),
+        [&branch](const IndexMergeBranch &other) { return other.index == branch.index; });
+    if (iter == intersect_branches.end()) {
+      intersect_branches.emplace_back(std::move(branch));
+      intersect_counts.push_back(count);
+    } else if (count < intersect_counts[iter - intersect_branches.begin()]) {
+      // 同一个索引上的多个范围只保留最好的一个
+      intersect_counts[iter - intersect_branches.begin()] = count;
+      *iter = std::move(branch);
+    }
+  }
+
+  if (intersect_branches.size() < 2) {
+    return nullptr;
+  }
+
+  const int rows = estimate_table_rows(table, TABLE_ROWS_ESTIMATE_LIMIT);
+  if (rows <= 0) {
+    return nullptr;
+  }
+
+  double estimated = rows;
+  for (int count : intersect_counts) {
+    if (static_cast<double>(count) * INDEX_MERGE_SELECTIVITY_FACTOR <= rows) {
+      // 有单独选择性就足够好的条件，交集的意义不大
+      return nullptr;
+    }
+    estimated *= static_cast<double>(count) / rows;
+  }
+  if (estimated * INDEX_MERGE_SELECTIVITY_FACTOR > rows) {
+    return nullptr;
+  }
+
+  LOG_TRACE("use index merge intersection. estimated count=%d, table rows=%d", static_cast<int>(estimated), rows);
+  auto oper = make_unique<IndexMergeScanPhysicalOperator>(
+      table, IndexMergeScanPhysicalOperator::MergeType::INTERSECTION, readonly);
+  for (IndexMergeBranch &branch : intersect_branches) {
+    oper->add_branch(std::move(branch));
+  }
+  return oper;
+}
+
+/**
+ * @brief 收集所有可以使用索引的条件，同一个索引上的多个条件合并成一个范围
+ */
+static void collect_index_ranges(Table *table, const vector<IndexPredicate> &conditions,
+    vector<unique_ptr<Expression>> &predicates, vector<IndexMergeBranch> &ranges)
+{
+  for (unique_ptr<Expression> &expr : predicates) {
+    IndexMergeBranch range;
+    if (!get_index_range(table, conditions, expr.get(), range)) {
+      continue;
+    }
+
+    auto iter = std::find_if(ranges.begin(), ranges.end(),
+        [&range](const IndexMergeBranch &other) { return other.index == range.index; });
+    if (iter == ranges.end()) {
+      ranges.emplace_back(std::move(range));
+      continue;
+    }
+
+    // 哈希索引只能做等值查询，不能合并
+    if (range.index->index_meta().type() == IndexType::HASH) {
+      continue;
+    }
+
+    // 取更严格的边界
+    if (range.left_value.attr_type() != UNDEFINED) {
+      const int cmp = (iter->left_value.attr_type() == UNDEFINED) ? 1 : range.left_value.compare(iter->left_value);
+      if (cmp > 0 || (cmp == 0 && !range.left_inclusive)) {
+        iter->left_value = range.left_value;
+        iter->left_inclusive = range.left_inclusive;
+      }
+    }
+    if (range.right_value.attr_type() != UNDEFINED) {
+      const int cmp = (iter->right_value.attr_type() == UNDEFINED) ? -1 : range.right_value.compare(iter->right_value);
+      if (cmp < 0 || (cmp == 0 && !range.right_inclusive)) {
+        iter->right_value = range.right_value;
+        iter->right_inclusive = range.right_inclusive;
+      }
+    }
+  }
+
+  // 合并以后可能是空的范围，索引不接受这样的范围，留给全表扫描过滤
+  auto is_empty_range = [](const IndexMergeBranch &range) {
+    if (range.left_value.attr_type() == UNDEFINED || range.right_value.attr_type() == UNDEFINED) {
+      return false;
+    }
+    const int cmp = range.left_value.compare(range.right_value);
+    return cmp > 0 || (cmp == 0 && !(range.left_inclusive && range.right_inclusive));
+  };
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(), is_empty_range), ranges.end());
+}
+
+/**
+ * @brief 查询用到的字段都在索引中时，可以使用索引覆盖扫描
+ */
+static bool can_use_index_only(TableGetLogicalOperator &table_get_oper, Index *index)
+{
+  const vector<Field> &fields = table_get_oper.fields();
+  if (!table_get_oper.readonly() || fields.empty()) {
+    return false;
+  }
+  for (const Field &field : fields) {
+    if (0 != strcmp(field.field_name(), index->field_meta().name())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief 有统计信息时，比较全表扫描与每个可用索引的代价，选择代价最小的访问路径
+ * @return 使用索引时返回true，index_range 是选中的索引范围
+ */
+static bool choose_index_by_cost(Table *table, const vector<IndexPredicate> &conditions,
+    TableGetLogicalOperator &table_get_oper, vector<unique_ptr<Expression>> &predicates,
+    IndexMergeBranch &index_range)
+{
+  const TableStats &stats = table->table_meta().stats();
+  const double rows = std::max<double>(stats.row_count(), 1);
+  const double pages = std::max<double>(stats.page_count(), 1);
+  const double table_scan_cost = CostModel::table_scan_cost(rows, pages);
+
+  vector<IndexMergeBranch> ranges;
+  collect_index_ranges(table, conditions, predicates, ranges);
+
+  bool found = false;
+  double best_cost = table_scan_cost;
+  for (IndexMergeBranch &range : ranges) {
+    const bool has_left = range.left_value.attr_type() != UNDEFINED;
+    const bool has_right = range.right_value.attr_type() != UNDEFINED;
+    double selectivity = 1;
+    if (!stats.selectivity(range.index->field_meta().name(), has_left ? &range.left_value : nullptr,
+            range.left_inclusive, has_right ? &range.right_value : nullptr, range.right_inclusive, selectivity)) {
+      continue;
+    }
+
+    const double cost = CostModel::index_scan_cost(std::max(selectivity * rows, 1.0), pages,
+        can_use_index_only(table_get_oper, range.index));
+    LOG_TRACE("index scan cost. index=%s, selectivity=%.4f, cost=%.2f",
+        range.index->index_meta().name(), selectivity, cost);
+    if (cost < best_cost) {
+      best_cost = cost;
+      index_range = std::move(range);
+      found = true;
+    }
+  }
+
+  LOG_TRACE("choose access path by cost. table=%s, table scan cost=%.2f, best cost=%.2f, use index=%d",
+      table->name(), table_scan_cost, best_cost, found);
+  return found;
+}
+
+/**
+ * @brief 收集逻辑算子下面所有的表
+ */
+static void collect_tables(LogicalOperator &oper, vector<const Table *> &tables)
+{
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    tables.push_back(static_cast<TableGetLogicalOperator &>(oper).table());
+    return;
+  }
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    collect_tables(*child, tables);
+  }
+}
+
+/**
+ * @brief 把连续的连接算子展开，收集所有的输入和连接条件，AND连接的条件拆开
+ */
+static void flatten_join(
+    LogicalOperator &oper, vector<LogicalOperator *> &inputs, vector<unique_ptr<Expression>> &conditions)
+{
+  if (oper.type() != LogicalOperatorType::JOIN) {
+    inputs.push_back(&oper);
+    return;
+  }
+
+  vector<unique_ptr<Expression>> exprs;
+  exprs.swap(oper.expressions());
+  while (!exprs.empty()) {
+    unique_ptr<Expression> expr = std::move(exprs.back());
+    exprs.pop_back();
+    if (expr->type() == ExprType::CONJUNCTION &&
+        static_cast<ConjunctionExpr *>(expr.get())->conjunction_type() == ConjunctionExpr::Type::AND) {
+      for (unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr.get())->children()) {
+        exprs.emplace_back(std::move(child));
+      }
+      continue;
+    }
+    conditions.emplace_back(std::move(expr));
+  }
+
+  for (unique_ptr<LogicalOperator> &child : oper.children()) {
+    flatten_join(*child, inputs, conditions);
+  }
+}
+
+/**
+ * @return 表所在的输入的编号，找不到时返回-1
+ */
+static int find_relation(const vector<vector<const Table *>> &relation_tables, const char *table_name)
+{
+  for (size_t i = 0; i < relation_tables.size(); i++) {
+    for (const Table *table : relation_tables[i]) {
+      if (0 == strcmp(table->name(), table_name)) {
+        return static_cast<int>(i);
+      }
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief 计算表达式中用到的输入
+ * @return 有不认识的表达式或者表时返回false
+ */
+static bool get_relation_mask(Expression *expr, const vector<vector<const Table *>> &relation_tables, uint64_t &mask)
+{
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      const int relation = find_relation(relation_tables, static_cast<FieldExpr *>(expr)->table_name());
+      if (relation < 0) {
+        return false;
+      }
+      mask |= (uint64_t)1 << relation;
+      return true;
+    }
+    case ExprType::VALUE: {
+      return true;
+    }
+    case ExprType::CAST: {
+      return get_relation_mask(static_cast<CastExpr *>(expr)->child().get(), relation_tables, mask);
+    }
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      return get_relation_mask(comparison_expr->left().get(), relation_tables, mask) &&
+             get_relation_mask(comparison_expr->right().get(), relation_tables, mask);
+    }
+    case ExprType::CONJUNCTION: {
+      for (unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr)->children()) {
+        if (!get_relation_mask(child.get(), relation_tables, mask)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      return (!arithmetic_expr->left() || get_relation_mask(arithmetic_expr->left().get(), relation_tables, mask)) &&
+             (!arithmetic_expr->right() || get_relation_mask(arithmetic_expr->right().get(), relation_tables, mask));
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief 判断连接条件是否是两个字段的等值比较，可以作为hash join、merge join的key
+ * @details 两个字段的类型必须相同，浮点数的相等比较有误差，不能作为key。
+ * 作为key的条件复制一份，原来的条件仍然由连接上面的过滤算子计算。
+ */
+static bool get_equi_join_fields(Expression *expr, const Field *&left_field, const Field *&right_field)
+{
+  if (expr->type() != ExprType::COMPARISON) {
+    return false;
+  }
+
+  auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+  if (comparison_expr->comp() != EQUAL_TO || comparison_expr->left()->type() != ExprType::FIELD ||
+      comparison_expr->right()->type() != ExprType::FIELD) {
+    return false;
+  }
+
+  left_field = &static_cast<FieldExpr *>(comparison_expr->left().get())->field();
+  right_field = &static_cast<FieldExpr *>(comparison_expr->right().get())->field();
+  return left_field->attr_type() == right_field->attr_type() &&
+         (left_field->attr_type() == INTS || left_field->attr_type() == CHARS);
+}
+
+/**
+ * @brief 估算单个过滤条件的选择率
+ * @details 字段与常量的比较有统计信息时根据直方图估算，否则使用默认值。
+ * AND、OR的各个分支认为相互独立。
+ */
+static double estimate_selectivity(const Table *table, Expression *expr)
+{
+  if (expr->type() == ExprType::CONJUNCTION) {
+    auto conjunction_expr = static_cast<ConjunctionExpr *>(expr);
+    const bool is_and = conjunction_expr->conjunction_type() == ConjunctionExpr::Type::AND;
+    double selectivity = is_and ? 1 : 0;
+    for (unique_ptr<Expression> &child : conjunction_expr->children()) {
+      const double child_selectivity = estimate_selectivity(table, child.get());
+      selectivity = is_and ? selectivity * child_selectivity
+                           : selectivity + child_selectivity - selectivity * child_selectivity;
+    }
+    return selectivity;
+  }
+
+  const Field *field = nullptr;
+  const Value *value = nullptr;
+  CompOp comp = NO_OP;
+  if (!get_field_comparison(expr, field, value, comp)) {
+    return DEFAULT_SELECTIVITY;
+  }
+
+  const TableStats &stats = table->table_meta().stats();
+  const char *field_name = field->field_name();
+  double selectivity = 0;
+  bool estimated = false;
+  switch (comp) {
+    case EQUAL_TO:
+    case NOT_EQUAL: {
+      estimated = stats.selectivity(field_name, value, true, value, true, selectivity);
+      if (!estimated) {
+        selectivity = DEFAULT_EQUAL_SELECTIVITY;
+      }
+      return (comp == EQUAL_TO) ? selectivity : 1 - selectivity;
+    }
+    case LESS_THAN:
+    case LESS_EQUAL: {
+      estimated = stats.selectivity(field_name, nullptr, false, value, comp == LESS_EQUAL, selectivity);
+    } break;
+    case GREAT_THAN:
+    case GREAT_EQUAL: {
+      estimated = stats.selectivity(field_name, value, comp == GREAT_EQUAL, nullptr, false, selectivity);
+    } break;
+    default: break;
+  }
+  return estimated ? selectivity : DEFAULT_SELECTIVITY;
+}
+
+/**
+ * @brief 估算连接的一个输入的行数和读取代价
+ * @details 表没有统计信息时，使用B+树索引的索引项个数估算行数，也没有B+树索引时使用默认值。
+ * 读取代价按照全表扫描计算。
+ */
+static void estimate_relation(LogicalOperator &oper, JoinOrderOptimizer::Relation &relation)
+{
+  vector<const Table *> tables;
+  collect_tables(oper, tables);
+
+  double rows = 1;
+  double pages = 0;
+  for (const Table *table : tables) {
+    const TableStats &stats = table->table_meta().stats();
+    double table_rows = 0;
+    double table_pages = 0;
+    if (stats.analyzed()) {
+      table_rows = stats.row_count();
+      table_pages = stats.page_count();
+    } else {
+      const int count = estimate_table_rows(const_cast<Table *>(table), TABLE_ROWS_ESTIMATE_LIMIT);
+      table_rows = (count < 0) ? DEFAULT_TABLE_ROWS : count;
+      table_pages = std::ceil(table_rows * table->table_meta().record_size() / BP_PAGE_DATA_SIZE);
+    }
+    rows *= std::max(table_rows, 1.0);
+    pages += std::max(table_pages, 1.0);
+  }
+
+  relation.table_rows = rows;
+  relation.pages = std::max(pages, 1.0);
+  relation.cost = CostModel::table_scan_cost(relation.table_rows, relation.pages);
+  relation.rows = rows;
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+    for (unique_ptr<Expression> &predicate : table_get_oper.predicates()) {
+      relation.rows *= estimate_selectivity(table_get_oper.table(), predicate.get());
+    }
+  }
+  relation.rows = std::max(relation.rows, 1.0);
+}
+
+/**
+ * @brief 估算两个字段等值连接的选择率
+ * @details 假设不同值少的一边的每个值在另一边都存在，选择率是 1/max(两边不同值的个数)。
+ * 没有统计信息时认为字段上的值各不相同。
+ */
+static double estimate_join_selectivity(const Field &left_field, double left_rows, const Field &right_field,
+    double right_rows)
+{
+  auto distinct_count = [](const Field &field, double rows) {
+    const ColumnStats *column = field.table()->table_meta().stats().column(field.field_name());
+    return (nullptr != column && column->distinct_count() > 0) ? static_cast<double>(column->distinct_count()) : rows;
+  };
+  const double distinct = std::max(distinct_count(left_field, left_rows), distinct_count(right_field, right_rows));
+  return 1 / std::max(distinct, 1.0);
+}
+
+/**
+ * @brief 查找可以按照字段的顺序全量扫描表的索引
+ * @details 只考虑没有过滤条件的表，有过滤条件时按照过滤条件选择扫描方式。
+ * 字符串在索引中的比较方式与 SortKey 不一定相同，所以只考虑整数。
+ */
+static Index *find_ordered_index(LogicalOperator &oper, const Field &field)
+{
+  if (oper.type() != LogicalOperatorType::TABLE_GET) {
+    return nullptr;
+  }
+
+  auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+  if (!table_get_oper.predicates().empty() || field.attr_type() != INTS) {
+    return nullptr;
+  }
+  return table_get_oper.table()->find_index_by_field(field.field_name(), IndexType::BPLUS_TREE);
+}
+
+/**
+ * @brief 设置等值连接条件一边的表上可以使用的索引
+ * @param side 0是条件的左边，1是右边
+ */
+static void set_join_access(LogicalOperator &oper, const Field &field, const JoinOrderOptimizer::Relation &relation,
+    JoinOrderOptimizer::Edge &edge, int side)
+{
+  if (oper.type() != LogicalOperatorType::TABLE_GET) {
+    return;
+  }
+
+  auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+  edge.indexed[side] = nullptr != table_get_oper.table()->find_index_by_field(field.field_name(), true /*for_equality*/);
+
+  Index *index = find_ordered_index(oper, field);
+  if (nullptr != index) {
+    edge.ordered_cost[side] = CostModel::index_scan_cost(
+        relation.table_rows, relation.pages, can_use_index_only(table_get_oper, index));
+  }
+}
+
+/**
+ * @brief 根据选好的连接树生成物理算子时使用的信息
+ */
+struct JoinPlanContext
+{
+  JoinOrderOptimizer                         optimizer;
+  vector<LogicalOperator *>                  inputs;
+  vector<unique_ptr<Expression>>             conditions;   ///< 与optimizer中的边一一对应
+  vector<pair<const Field *, const Field *>> equi_fields;  ///< 等值条件两边的字段，与边的left、right对应
+  string                                     temp_dir;     ///< sort-merge join外部排序的临时文件目录
+};
+
+/**
+ * @brief 全量扫描一个表的B+树索引，按照索引字段的顺序输出
+ */
+static unique_ptr<PhysicalOperator> create_full_index_scan(LogicalOperator &oper, Index *index, bool with_predicates)
+{
+  auto &table_get_oper = static_cast<TableGetLogicalOperator &>(oper);
+  auto index_scan_oper = new IndexScanPhysicalOperator(
+      table_get_oper.table(), index, table_get_oper.readonly(), nullptr, false, nullptr, false);
+  index_scan_oper->set_index_only(can_use_index_only(table_get_oper, index));
+  if (with_predicates) {
+    index_scan_oper->set_predicates(std::move(table_get_oper.predicates()));
+  }
+  return unique_ptr<PhysicalOperator>(index_scan_oper);
+}
+
+/**
+ * @brief 按照连接树生成物理算子
+ * @details 连接条件放在包含条件中所有表的最下层的连接上，在连接以后计算。
+ */
+static RC create_join_tree(
+    PhysicalPlanGenerator &generator, JoinPlanContext &context, int plan_index, unique_ptr<PhysicalOperator> &oper)
+{
+  using Plan = JoinOrderOptimizer::Plan;
+  using Algorithm = JoinOrderOptimizer::Algorithm;
+
+  RC rc = RC::SUCCESS;
+  const Plan &plan = context.optimizer.plan(plan_index);
+  if (plan.relation >= 0) {
+    rc = generator.create(*context.inputs[plan.relation], oper);
+    if (rc == RC::SUCCESS) {
+      oper->set_estimate(plan.rows, plan.cost);
+    }
+    return rc;
+  }
+
+  const Plan &left = context.optimizer.plan(plan.left);
+  const Plan &right = context.optimizer.plan(plan.right);
+  const vector<JoinOrderOptimizer::Edge> &edges = context.optimizer.edges();
+
+  // 两边之间的等值条件作为key，选好的条件放在最前面
+  vector<unique_ptr<Expression>> left_keys;
+  vector<unique_ptr<Expression>> right_keys;
+  for (size_t i = 0; i < edges.size(); i++) {
+    const JoinOrderOptimizer::Edge &edge = edges[i];
+    if (!edge.equi) {
+      continue;
+    }
+
+    const Field *left_field = context.equi_fields[i].first;
+    const Field *right_field = context.equi_fields[i].second;
+    if ((left.relations & ((uint64_t)1 << edge.right)) && (right.relations & ((uint64_t)1 << edge.left))) {
+      std::swap(left_field, right_field);
+    } else if (!(left.relations & ((uint64_t)1 << edge.left)) || !(right.relations & ((uint64_t)1 << edge.right))) {
+      continue;
+    }
+
+    left_keys.emplace_back(new FieldExpr(*left_field));
+    right_keys.emplace_back(new FieldExpr(*right_field));
+    if (static_cast<int>(i) == plan.key_edge) {
+      std::swap(left_keys.front(), left_keys.back());
+      std::swap(right_keys.front(), right_keys.back());
+    }
+  }
+
+  unique_ptr<PhysicalOperator> left_oper;
+  unique_ptr<PhysicalOperator> right_oper;
+  if (plan.algorithm == Algorithm::MERGE && plan.left_sorted) {
+    const Field &field = static_cast<FieldExpr &>(*left_keys.front()).field();
+    LogicalOperator &input = *context.inputs[left.relation];
+    left_oper = create_full_index_scan(input, find_ordered_index(input, field), false /*with_predicates*/);
+  } else {
+    rc = create_join_tree(generator, context, plan.left, left_oper);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create left child of join. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (plan.algorithm == Algorithm::MERGE && plan.right_sorted) {
+    const Field &field = static_cast<FieldExpr &>(*right_keys.front()).field();
+    LogicalOperator &input = *context.inputs[right.relation];
+    right_oper = create_full_index_scan(input, find_ordered_index(input, field), false /*with_predicates*/);
+  } else if (plan.algorithm == Algorithm::INDEX_NESTED_LOOP) {
+    // 内表使用连接字段上的索引，每次查找时再设置范围，内表自己的过滤条件由索引扫描计算
+    const Field &field = static_cast<FieldExpr &>(*right_keys.front()).field();
+    auto &table_get_oper = static_cast<TableGetLogicalOperator &>(*context.inputs[right.relation]);
+    Index *index = table_get_oper.table()->find_index_by_field(field.field_name(), true /*for_equality*/);
+    right_oper = create_full_index_scan(table_get_oper, index, true /*with_predicates*/);
+  } else {
+    rc = create_join_tree(generator, context, plan.right, right_oper);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create right child of join. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  unique_ptr<PhysicalOperator> join_oper;
+  switch (plan.algorithm) {
+    case Algorithm::INDEX_NESTED_LOOP: {
+      const int batch_size = (left.rows > INDEX_NESTED_LOOP_JOIN_BATCH_SIZE) ? INDEX_NESTED_LOOP_JOIN_BATCH_SIZE : 0;
+      left_keys.resize(1);
+      right_keys.resize(1);
+      join_oper.reset(new IndexNestedLoopJoinPhysicalOperator(
+          std::move(left_keys.front()), std::move(right_keys.front()), batch_size));
+    } break;
+    case Algorithm::MERGE: {
+      if (plan.left_sorted || plan.right_sorted) {
+        // 下层只按照第一个key有序，其它的等值条件由上面的过滤算子计算
+        left_keys.resize(1);
+        right_keys.resize(1);
+      }
+      join_oper.reset(new MergeJoinPhysicalOperator(
+          std::move(left_keys), std::move(right_keys), plan.left_sorted, plan.right_sorted, context.temp_dir));
+    } break;
+    case Algorithm::HASH: {
+      join_oper.reset(new HashJoinPhysicalOperator(std::move(left_keys), std::move(right_keys), plan.build_left));
+    } break;
+    default: {
+      join_oper.reset(new NestedLoopJoinPhysicalOperator);
+    } break;
+  }
+  LOG_TRACE("create join. algorithm=%s, rows=%.0f, cost=%.2f",
+      JoinOrderOptimizer::algorithm_name(plan.algorithm), plan.rows, plan.cost);
+
+  join_oper->set_estimate(plan.rows, plan.cost);
+  join_oper->add_child(std::move(left_oper));
+  join_oper->add_child(std::move(right_oper));
+
+  // 连接算子只使用了等值条件中的一部分，所有的连接条件在连接以后再计算一次
+  vector<unique_ptr<Expression>> predicates;
+  for (size_t i = 0; i < edges.size(); i++) {
+    const uint64_t relations = edges[i].relations;
+    if ((relations & ~plan.relations) == 0 && (relations & ~left.relations) != 0 &&
+        (relations & ~right.relations) != 0 && context.conditions[i]) {
+      predicates.emplace_back(std::move(context.conditions[i]));
+    }
+  }
+
+  if (!predicates.empty()) {
+    unique_ptr<Expression> predicate;
+    if (predicates.size() == 1) {
+      predicate = std::move(predicates.front());
+    } else {
+      predicate.reset(new ConjunctionExpr(ConjunctionExpr::Type::AND, predicates));
+    }
+
+    unique_ptr<PhysicalOperator> predicate_oper(new PredicatePhysicalOperator(std::move(predicate)));
+    predicate_oper->add_child(std::move(join_oper));
+    join_oper = std::move(predicate_oper);
+  }
+
+  oper = std::move(join_oper);
+  return rc;
+}
+
 RC PhysicalPlanGenerator::create(LogicalOperator &logical_operator, unique_ptr<PhysicalOperator> &oper)
 {
   RC rc = RC::SUCCESS;
@@ -74,6 +1071,18 @@ RC PhysicalPlanGenerator::create(LogicalOperator &logical_operator, unique_ptr<P
       return create_plan(static_cast<JoinLogicalOperator &>(logical_operator), oper);
     } break;
 
+    case LogicalOperatorType::AGGREGATION: {
+      return create_plan(static_cast<AggregateLogicalOperator &>(logical_operator), oper);
+    } break;
+
+    case LogicalOperatorType::SORT: {
+      return create_plan(static_cast<SortLogicalOperator &>(logical_operator), oper);
+    } break;
+
+    case LogicalOperatorType::LIMIT: {
+      return create_plan(static_cast<LimitLogicalOperator &>(logical_operator), oper);
+    } break;
+
     default: {
       return RC::INVALID_ARGUMENT;
     }
@@ -87,58 +1096,121 @@ RC PhysicalPlanGenerator::create_plan(TableGetLogicalOperator &table_get_oper, u
   // 看看是否有可以用于索引查找的表达式
   Table *table = table_get_oper.table();
 
+  // 部分索引只有在查询条件能够推导出索引条件时才能使用
+  vector<IndexPredicate> conditions;
+  collect_index_conditions(predicates, conditions);
+
+  // 有统计信息时按照代价选择索引，否则使用第一个可以用于等值查询的索引
+  IndexMergeBranch index_range;
   Index *index = nullptr;
-  ValueExpr *value_expr = nullptr;
-  for (auto &expr : predicates) {
-    if (expr->type() == ExprType::COMPARISON) {
-      auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
-      // 简单处理，就找等值查询
-      if (comparison_expr->comp() != EQUAL_TO) {
-        continue;
-      }
+  if (table->table_meta().stats().analyzed()) {
+    if (choose_index_by_cost(table, conditions, table_get_oper, predicates, index_range)) {
+      index = index_range.index;
+    }
+  } else {
+    for (auto &expr : predicates) {
+      if (expr->type() == ExprType::COMPARISON) {
+        auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
+        // 简单处理，就找等值查询
+        if (comparison_expr->comp() != EQUAL_TO) {
+          continue;
+        }
 
-      unique_ptr<Expression> &left_expr = comparison_expr->left();
-      unique_ptr<Expression> &right_expr = comparison_expr->right();
-      // 左右比较的一边最少是一个值
-      if (left_expr->type() != ExprType::VALUE && right_expr->type() != ExprType::VALUE) {
-        continue;
-      }
+        unique_ptr<Expression> &left_expr = comparison_expr->left();
+        unique_ptr<Expression> &right_expr = comparison_expr->right();
+        // 左右比较的一边最少是一个值
+        if (left_expr->type() != ExprType::VALUE && right_expr->type() != ExprType::VALUE) {
+          continue;
+        }
 
-      FieldExpr *field_expr = nullptr;
-      if (left_expr->type() == ExprType::FIELD) {
-        ASSERT(right_expr->type() == ExprType::VALUE, "right expr should be a value expr while left is field expr");
-        field_expr = static_cast<FieldExpr *>(left_expr.get());
-        value_expr = static_cast<ValueExpr *>(right_expr.get());
-      } else if (right_expr->type() == ExprType::FIELD) {
-        ASSERT(left_expr->type() == ExprType::VALUE, "left expr should be a value expr while right is a field expr");
-        field_expr = static_cast<FieldExpr *>(right_expr.get());
-        value_expr = static_cast<ValueExpr *>(left_expr.get());
-      }
+        FieldExpr *field_expr = nullptr;
+        ValueExpr *value_expr = nullptr;
+        if (left_expr->type() == ExprType::FIELD) {
+          ASSERT(right_expr->type() == ExprType::VALUE, "right expr should be a value expr while left is field expr");
+          field_expr = static_cast<FieldExpr *>(left_expr.get());
+          value_expr = static_cast<ValueExpr *>(right_expr.get());
+        } else if (right_expr->type() == ExprType::FIELD) {
+          ASSERT(left_expr->type() == ExprType::VALUE, "left expr should be a value expr while right is a field expr");
+          field_expr = static_cast<FieldExpr *>(right_expr.get());
+          value_expr = static_cast<ValueExpr *>(left_expr.get());
+        }
 
-      if (field_expr == nullptr) {
-        continue;
-      }
+        if (field_expr == nullptr) {
+          continue;
+        }
 
-      const Field &field = field_expr->field();
-      index = table->find_index_by_field(field.field_name());
-      if (nullptr != index) {
-        break;
+        // 等值查询优先使用哈希索引。哈希索引直接对键值的二进制做哈希，值的类型与字段不同时就查不到数据
+        const Field &field = field_expr->field();
+        index = table->find_index_by_field(field.field_name(), true /*for_equality*/, &conditions);
+        if (nullptr != index && index->index_meta().type() == IndexType::HASH &&
+            value_expr->get_value().attr_type() != field.attr_type()) {
+          index = table->find_index_by_field(field.field_name(), false /*for_equality*/, &conditions);
+        }
+        if (nullptr != index) {
+          index_range.index = index;
+          index_range.left_value = value_expr->get_value();
+          index_range.left_inclusive = true;
+          index_range.right_value = value_expr->get_value();
+          index_range.right_inclusive = true;
+          break;
+        }
       }
     }
   }
 
-  if (index != nullptr) {
-    ASSERT(value_expr != nullptr, "got an index but value expr is null ?");
+  // 位图索引一般建在不同值很少的字段上，一个条件命中的数据很多，多个条件做位图运算以后才有比较好的过滤效果。
+  // 所以有多个条件可以使用位图索引，或者没有其它索引可用的时候，才使用位图扫描
+  vector<BitmapScanPhysicalOperator::Term> bitmap_terms;
+  for (auto &expr : predicates) {
+    BitmapScanPhysicalOperator::Term term;
+    if (get_bitmap_term(table, conditions, expr.get(), term)) {
+      bitmap_terms.emplace_back(std::move(term));
+    }
+  }
+
+  // 位图扫描可以处理多个条件的时候，不再考虑索引合并
+  unique_ptr<IndexMergeScanPhysicalOperator> index_merge_oper;
+  if (bitmap_terms.size() < 2) {
+    index_merge_oper = create_index_merge_scan(
+        table, conditions, predicates, index != nullptr ? &index_range : nullptr, table_get_oper.readonly());
+  }
 
-    const Value &value = value_expr->get_value();
+  if (index_merge_oper) {
+    index_merge_oper->set_predicates(std::move(predicates));
+    oper = std::move(index_merge_oper);
+  } else if (bitmap_terms.size() >= 2 || (!bitmap_terms.empty() && index == nullptr)) {
+    auto bitmap_scan_oper = new BitmapScanPhysicalOperator(table, table_get_oper.readonly());
+    for (BitmapScanPhysicalOperator::Term &term : bitmap_terms) {
+      bitmap_scan_oper->add_term(std::move(term));
+    }
+    bitmap_scan_oper->set_predicates(std::move(predicates));
+    oper = unique_ptr<PhysicalOperator>(bitmap_scan_oper);
+    LOG_TRACE("use bitmap scan. terms=%d", static_cast<int>(bitmap_scan_oper->terms().size()));
+  } else if (index != nullptr) {
+    const bool has_left = index_range.left_value.attr_type() != UNDEFINED;
+    const bool has_right = index_range.right_value.attr_type() != UNDEFINED;
     IndexScanPhysicalOperator *index_scan_oper = new IndexScanPhysicalOperator(
           table, index, table_get_oper.readonly(), 
-          &value, true /*left_inclusive*/, 
-          &value, true /*right_inclusive*/);
+          has_left ? &index_range.left_value : nullptr, index_range.left_inclusive, 
+          has_right ? &index_range.right_value : nullptr, index_range.right_inclusive);
           
     index_scan_oper->set_predicates(std::move(predicates));
+
+    // 查询用到的字段都在索引中，就可以使用索引覆盖扫描
+    const bool index_only = can_use_index_only(table_get_oper, index);
+    index_scan_oper->set_index_only(index_only);
+
+    // 需要回表且命中的记录比较多时，先收集一批RID并按照物理位置排序再回表，避免随机访问数据页。
+    // 命中数量根据统计信息估算，没有统计信息时通过有限步数的索引探测来估计
+    bool sorted_rid_fetch = false;
+    if (table_get_oper.readonly() && !index_only &&
+        estimate_branch_count(table, index_range, SORTED_RID_FETCH_THRESHOLD + 1) > SORTED_RID_FETCH_THRESHOLD) {
+      index_scan_oper->set_sorted_rid_fetch(SORTED_RID_FETCH_BATCH_SIZE);
+      sorted_rid_fetch = true;
+    }
+
     oper = unique_ptr<PhysicalOperator>(index_scan_oper);
-    LOG_TRACE("use index scan");
+    LOG_TRACE("use index scan. index only=%d, sorted rid fetch=%d", index_only, sorted_rid_fetch);
   } else {
     auto table_scan_oper = new TableScanPhysicalOperator(table, table_get_oper.readonly());
     table_scan_oper->set_predicates(std::move(predicates));
@@ -156,16 +1228,17 @@ RC PhysicalPlanGenerator::create_plan(PredicateLogicalOperator &pred_oper, uniqu
 
   LogicalOperator &child_oper = *children_opers.front();
 
+  vector<unique_ptr<Expression>> &expressions = pred_oper.expressions();
+  ASSERT(expressions.size() == 1, "predicate logical operator's children should be 1");
+
   unique_ptr<PhysicalOperator> child_phy_oper;
-  RC rc = create(child_oper, child_phy_oper);
+  RC rc = RC::SUCCESS;
+  rc = create(child_oper, child_phy_oper);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to create child operator of predicate operator. rc=%s", strrc(rc));
     return rc;
   }
 
-  vector<unique_ptr<Expression>> &expressions = pred_oper.expressions();
-  ASSERT(expressions.size() == 1, "predicate logical operator's children should be 1");
-
   unique_ptr<Expression> expression = std::move(expressions.front());
   oper = unique_ptr<PhysicalOperator>(new PredicatePhysicalOperator(std::move(expression)));
   oper->add_child(std::move(child_phy_oper));
@@ -260,27 +1333,202 @@ RC PhysicalPlanGenerator::create_plan(ExplainLogicalOperator &explain_oper, uniq
 
 RC PhysicalPlanGenerator::create_plan(JoinLogicalOperator &join_oper, unique_ptr<PhysicalOperator> &oper)
 {
-  RC rc = RC::SUCCESS;
+  // 连接条件由 PredicatePushdownRewriter 放到了连接算子上。把连续的连接展开，根据代价重新选择
+  // 连接的顺序、每个连接的算法以及hash join建立hash表的一边
+  JoinPlanContext context;
+  flatten_join(join_oper, context.inputs, context.conditions);
 
-  vector<unique_ptr<LogicalOperator>> &child_opers = join_oper.children();
-  if (child_opers.size() != 2) {
-    LOG_WARN("join operator should have 2 children, but have %d", child_opers.size());
-    return RC::INTERNAL;
+  const int relation_num = static_cast<int>(context.inputs.size());
+  if (relation_num > JoinOrderOptimizer::MAX_RELATIONS) {
+    LOG_WARN("too many tables to join. table num=%d", relation_num);
+    return RC::INVALID_ARGUMENT;
   }
 
-  unique_ptr<PhysicalOperator> join_physical_oper(new NestedLoopJoinPhysicalOperator);
-  for (auto &child_oper : child_opers) {
-    unique_ptr<PhysicalOperator> child_physical_oper;
-    rc = create(*child_oper, child_physical_oper);
+  vector<vector<const Table *>> relation_tables(relation_num);
+  for (int i = 0; i < relation_num; i++) {
+    collect_tables(*context.inputs[i], relation_tables[i]);
+    if (context.temp_dir.empty() && !relation_tables[i].empty()) {
+      context.temp_dir = relation_tables[i].front()->base_dir();
+    }
+
+    JoinOrderOptimizer::Relation relation;
+    estimate_relation(*context.inputs[i], relation);
+    context.optimizer.add_relation(relation);
+  }
+
+  // 涉及的表不到两个或者无法判断的条件，放到最上面的连接计算
+  const uint64_t all_relations =
+      (relation_num == JoinOrderOptimizer::MAX_RELATIONS) ? ~(uint64_t)0 : ((uint64_t)1 << relation_num) - 1;
+  const vector<JoinOrderOptimizer::Relation> &relations = context.optimizer.relations();
+  context.equi_fields.resize(context.conditions.size());
+  for (size_t i = 0; i < context.conditions.size(); i++) {
+    Expression *condition = context.conditions[i].get();
+
+    JoinOrderOptimizer::Edge edge;
+    edge.selectivity = DEFAULT_SELECTIVITY;
+    if (!get_relation_mask(condition, relation_tables, edge.relations) ||
+        (edge.relations & (edge.relations - 1)) == 0) {
+      edge.relations = all_relations;
+    }
+
+    const Field *left_field = nullptr;
+    const Field *right_field = nullptr;
+    if (get_equi_join_fields(condition, left_field, right_field)) {
+      const int left = find_relation(relation_tables, left_field->table_name());
+      const int right = find_relation(relation_tables, right_field->table_name());
+      if (left >= 0 && right >= 0 && left != right) {
+        edge.equi = true;
+        edge.left = left;
+        edge.right = right;
+        edge.selectivity = estimate_join_selectivity(
+            *left_field, relations[left].table_rows, *right_field, relations[right].table_rows);
+        set_join_access(*context.inputs[left], *left_field, relations[left], edge, 0);
+        set_join_access(*context.inputs[right], *right_field, relations[right], edge, 1);
+        context.equi_fields[i] = std::make_pair(left_field, right_field);
+      }
+    }
+    context.optimizer.add_edge(edge);
+  }
+
+  RC rc = context.optimizer.optimize();
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to choose join order. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  return create_join_tree(*this, context, context.optimizer.best(), oper);
+}
+
+RC PhysicalPlanGenerator::create_plan(AggregateLogicalOperator &aggregate_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = aggregate_oper.children();
+  ASSERT(child_opers.size() == 1, "aggregate logical operator's sub oper number should be 1");
+
+  LogicalOperator &child_oper = *child_opers.front();
+  vector<unique_ptr<Expression>> &group_by_exprs = aggregate_oper.group_by_exprs();
+
+  // 没有分组时所有的输入是一个分组，使用流式聚合。只有一个分组字段，并且可以按照这个字段的顺序读取整个表时，
+  // 比较按照索引的顺序读取后流式聚合与全表扫描后hash聚合的代价
+  bool stream = group_by_exprs.empty();
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  if (group_by_exprs.size() == 1 && group_by_exprs.front()->type() == ExprType::FIELD) {
+    const Field &field = static_cast<FieldExpr &>(*group_by_exprs.front()).field();
+    Index *index = find_ordered_index(child_oper, field);
+    if (nullptr != index) {
+      JoinOrderOptimizer::Relation relation;
+      estimate_relation(child_oper, relation);
+      const double ordered_cost = CostModel::index_scan_cost(relation.table_rows, relation.pages,
+          can_use_index_only(static_cast<TableGetLogicalOperator &>(child_oper), index));
+      const double hash_cost = relation.cost + relation.rows * (CostModel::CPU_TUPLE_COST + CostModel::CPU_OPERATOR_COST);
+      if (ordered_cost < hash_cost) {
+        child_phy_oper = create_full_index_scan(child_oper, index, false /*with_predicates*/);
+        stream = true;
+      }
+    }
+  }
+
+  RC rc = RC::SUCCESS;
+  if (!child_phy_oper) {
+    rc = create(child_oper, child_phy_oper);
     if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to create physical child oper. rc=%s", strrc(rc));
+      LOG_WARN("failed to create child operator of aggregate operator. rc=%s", strrc(rc));
       return rc;
     }
+  }
+
+  if (stream) {
+    oper.reset(new StreamAggregatePhysicalOperator(std::move(group_by_exprs), std::move(aggregate_oper.expressions())));
+  } else {
+    // 溢出的数据写到第一个表所在的目录
+    vector<const Table *> tables;
+    collect_tables(child_oper, tables);
+    const string temp_dir = tables.empty() ? string() : tables.front()->base_dir();
+    oper.reset(new HashAggregatePhysicalOperator(
+        std::move(group_by_exprs), std::move(aggregate_oper.expressions()), temp_dir));
+  }
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_plan(SortLogicalOperator &sort_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  return create_sort_plan(sort_oper, -1 /*fetch_rows*/, oper);
+}
+
+RC PhysicalPlanGenerator::create_sort_plan(
+    SortLogicalOperator &sort_oper, int64_t fetch_rows, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = sort_oper.children();
+  ASSERT(child_opers.size() == 1, "sort logical operator's sub oper number should be 1");
+
+  LogicalOperator &child_oper = *child_opers.front();
+  vector<unique_ptr<Expression>> &sort_exprs = sort_oper.expressions();
+  const bool top_n = fetch_rows >= 0 && fetch_rows <= TopNPhysicalOperator::MAX_ROWS;
+
+  // 只按照一个字段排序，并且可以按照这个字段的顺序读取整个表时，比较按照索引的顺序(降序时反向)读取与排序的代价。
+  // 只需要前面几行时，按索引顺序读取可以在读到需要的行数以后就结束
+  if (sort_exprs.size() == 1 && sort_exprs.front()->type() == ExprType::FIELD) {
+    const Field &field = static_cast<FieldExpr &>(*sort_exprs.front()).field();
+    Index *index = find_ordered_index(child_oper, field);
+    if (nullptr != index) {
+      JoinOrderOptimizer::Relation relation;
+      estimate_relation(child_oper, relation);
+      const double read_rows = (fetch_rows >= 0) ? std::min<double>(fetch_rows, relation.table_rows) : relation.table_rows;
+      const double ordered_cost = CostModel::index_scan_cost(read_rows, relation.pages,
+          can_use_index_only(static_cast<TableGetLogicalOperator &>(child_oper), index));
+      const double sort_cost = relation.cost + (top_n ? CostModel::top_n_cost(relation.rows, fetch_rows)
+                                                      : CostModel::sort_cost(relation.rows));
+      LOG_TRACE("order by cost. ordered index scan cost=%.2f, sort cost=%.2f", ordered_cost, sort_cost);
+      if (ordered_cost < sort_cost) {
+        oper = create_full_index_scan(child_oper, index, false /*with_predicates*/);
+        static_cast<IndexScanPhysicalOperator &>(*oper).set_reverse(!sort_oper.asc().front());
+        return RC::SUCCESS;
+      }
+    }
+  }
+
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = create(child_oper, child_phy_oper);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create child operator of sort operator. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  if (top_n) {
+    oper.reset(new TopNPhysicalOperator(std::move(sort_exprs), sort_oper.asc(), fetch_rows));
+  } else {
+    // 外部排序的临时文件写到第一个表所在的目录
+    vector<const Table *> tables;
+    collect_tables(child_oper, tables);
+    const string temp_dir = tables.empty() ? string() : tables.front()->base_dir();
+    oper.reset(new SortPhysicalOperator(std::move(sort_exprs), sort_oper.asc(), temp_dir));
+  }
+  oper->add_child(std::move(child_phy_oper));
+  return rc;
+}
+
+RC PhysicalPlanGenerator::create_plan(LimitLogicalOperator &limit_oper, unique_ptr<PhysicalOperator> &oper)
+{
+  vector<unique_ptr<LogicalOperator>> &child_opers = limit_oper.children();
+  ASSERT(child_opers.size() == 1, "limit logical operator's sub oper number should be 1");
 
-    join_physical_oper->add_child(std::move(child_physical_oper));
+  // 下层是排序时只需要排在前面的 offset + limit 行，可以使用Top-N
+  LogicalOperator &child_oper = *child_opers.front();
+  unique_ptr<PhysicalOperator> child_phy_oper;
+  RC rc = RC::SUCCESS;
+  if (child_oper.type() == LogicalOperatorType::SORT && limit_oper.limit() >= 0) {
+    const int64_t fetch_rows = static_cast<int64_t>(limit_oper.limit()) + limit_oper.offset();
+    rc = create_sort_plan(static_cast<SortLogicalOperator &>(child_oper), fetch_rows, child_phy_oper);
+  } else {
+    rc = create(child_oper, child_phy_oper);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to create child operator of limit operator. rc=%s", strrc(rc));
+    return rc;
   }
 
-  oper = std::move(join_physical_oper);
+  oper.reset(new LimitPhysicalOperator(limit_oper.limit(), limit_oper.offset()));
+  oper->add_child(std::move(child_phy_oper));
   return rc;
 }
 
@@ -292,3 +1540,132 @@ RC PhysicalPlanGenerator::create_plan(CalcLogicalOperator &logical_oper, std::un
   return rc;
 }
 
+
+static vector<unique_ptr<Expression>> copy_expressions(const vector<unique_ptr<Expression>> &exprs)
+{
+  vector<unique_ptr<Expression>> copies;
+  for (const unique_ptr<Expression> &expr : exprs) {
+    copies.emplace_back(expr->copy());
+  }
+  return copies;
+}
+
+/**
+ * @brief 并行扫描使用的线程数。只读的全表扫描并且表足够大时才可以并行，否则返回0
+ */
+static int parallel_scan_workers(PhysicalOperator &oper, int parallel_degree)
+{
+  if (oper.type() != PhysicalOperatorType::TABLE_SCAN) {
+    return 0;
+  }
+
+  auto &scan_oper = static_cast<TableScanPhysicalOperator &>(oper);
+  if (!scan_oper.readonly()) {
+    return 0;
+  }
+
+  // 第0页是文件头
+  const int morsel_pages = MorselScheduler::DEFAULT_MORSEL_PAGES;
+  const int morsels = (scan_oper.table()->data_page_count() - 1 + morsel_pages - 1) / morsel_pages;
+  if (morsels < PARALLEL_SCAN_MIN_MORSELS) {
+    return 0;
+  }
+  return std::min(parallel_degree, morsels);
+}
+
+/**
+ * @brief 并行扫描中一个工作线程使用的表扫描，谓词是原来的扫描中谓词的复制
+ */
+static unique_ptr<PhysicalOperator> create_worker_scan(
+    TableScanPhysicalOperator &scan_oper, const shared_ptr<MorselScheduler> &scheduler, int worker)
+{
+  auto worker_scan = make_unique<TableScanPhysicalOperator>(scan_oper.table(), scan_oper.readonly());
+  worker_scan->set_predicates(copy_expressions(scan_oper.predicates()));
+  worker_scan->set_morsel_scheduler(scheduler, worker);
+  return worker_scan;
+}
+
+RC PhysicalPlanGenerator::parallelize(unique_ptr<PhysicalOperator> &oper, int parallel_degree)
+{
+#ifndef CONCURRENCY
+  // 没有打开CONCURRENCY编译选项时，buffer pool等模块中的锁都是空操作，不能在多个线程中访问
+  parallel_degree = 1;
+#endif
+  if (parallel_degree <= 1 || !oper) {
+    return RC::SUCCESS;
+  }
+
+  switch (oper->type()) {
+    case PhysicalOperatorType::EXPLAIN:
+    case PhysicalOperatorType::PROJECT:
+    case PhysicalOperatorType::PREDICATE:
+    case PhysicalOperatorType::SORT:
+    case PhysicalOperatorType::TOP_N:
+    case PhysicalOperatorType::LIMIT: {
+      // 这些算子在汇集以后的数据上执行
+      if (oper->children().size() != 1) {
+        return RC::SUCCESS;
+      }
+      return parallelize(oper->children().front(), parallel_degree);
+    } break;
+
+    case PhysicalOperatorType::TABLE_SCAN: {
+      const int workers = parallel_scan_workers(*oper, parallel_degree);
+      if (workers <= 0) {
+        return RC::SUCCESS;
+      }
+
+      auto &scan_oper = static_cast<TableScanPhysicalOperator &>(*oper);
+      auto scheduler = make_shared<MorselScheduler>(workers);
+      auto gather_oper = make_unique<GatherPhysicalOperator>(scheduler, scan_oper.table());
+      for (int i = 0; i < workers; i++) {
+        gather_oper->add_child(create_worker_scan(scan_oper, scheduler, i));
+      }
+      gather_oper->set_estimate(oper->estimated_rows(), oper->estimated_cost());
+      LOG_TRACE("use parallel table scan. table=%s, workers=%d", scan_oper.table()->name(), workers);
+      oper = std::move(gather_oper);
+    } break;
+
+    case PhysicalOperatorType::HASH_AGGREGATE:
+    case PhysicalOperatorType::STREAM_AGGREGATE: {
+      // 流式聚合的下层是表扫描时没有分组字段，与只有一个分组的hash聚合相同
+      PhysicalOperator &child_oper = *oper->children().front();
+      const int workers = parallel_scan_workers(child_oper, parallel_degree);
+      if (workers <= 0) {
+        return RC::SUCCESS;
+      }
+
+      auto &aggregate_oper = static_cast<AggregatePhysicalOperator &>(*oper);
+      auto &scan_oper = static_cast<TableScanPhysicalOperator &>(child_oper);
+      string temp_dir = scan_oper.table()->base_dir();
+      size_t memory_limit = HashAggregatePhysicalOperator::DEFAULT_MEMORY_LIMIT;
+      if (oper->type() == PhysicalOperatorType::HASH_AGGREGATE) {
+        auto &hash_oper = static_cast<HashAggregatePhysicalOperator &>(*oper);
+        temp_dir = hash_oper.temp_dir();
+        memory_limit = hash_oper.memory_limit();
+      }
+
+      auto scheduler = make_shared<MorselScheduler>(workers);
+      auto parallel_oper = make_unique<ParallelHashAggregatePhysicalOperator>(
+          copy_expressions(aggregate_oper.group_by_expressions()), copy_expressions(aggregate_oper.expressions()),
+          temp_dir, scheduler, scan_oper.table());
+      for (int i = 0; i < workers; i++) {
+        auto partial_oper = make_unique<HashAggregatePhysicalOperator>(
+            copy_expressions(aggregate_oper.group_by_expressions()), copy_expressions(aggregate_oper.expressions()),
+            temp_dir);
+        partial_oper->set_partial(true);
+        partial_oper->set_memory_limit(memory_limit / workers);
+        partial_oper->add_child(create_worker_scan(scan_oper, scheduler, i));
+        parallel_oper->add_child(std::move(partial_oper));
+      }
+      parallel_oper->set_estimate(oper->estimated_rows(), oper->estimated_cost());
+      LOG_TRACE("use parallel hash aggregate. table=%s, workers=%d", scan_oper.table()->name(), workers);
+      oper = std::move(parallel_oper);
+    } break;
+
+    default: {
+      // 连接和修改数据的算子不并行执行
+    } break;
+  }
+  return RC::SUCCESS;
+}
@@ -28,6 +28,9 @@ class DeleteLogicalOperator;
 class ExplainLogicalOperator;
 class JoinLogicalOperator;
 class CalcLogicalOperator;
+class AggregateLogicalOperator;
+class SortLogicalOperator;
+class LimitLogicalOperator;
 
 /**
  * @brief 物理计划生成器
@@ -43,6 +46,15 @@ public:
 
   RC create(LogicalOperator &logical_operator, std::unique_ptr<PhysicalOperator> &oper);
 
+  /**
+   * @brief 把计划中单表的全表扫描，以及直接在它上面的聚合，改成多个工作线程并行执行
+   * @details 扫描改成汇集多个按morsel扫描的工作线程，聚合改成每个工作线程做局部聚合以后再合并。
+   * 扫描上面的投影、过滤、排序等算子在汇集以后的数据上执行。连接和修改数据的计划不变。
+   * 编译时没有打开CONCURRENCY选项时不修改计划。
+   * @param parallel_degree 最多使用的工作线程个数，小于等于1时不修改计划
+   */
+  RC parallelize(std::unique_ptr<PhysicalOperator> &oper, int parallel_degree);
+
 private:
   RC create_plan(TableGetLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(PredicateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
@@ -52,4 +64,13 @@ private:
   RC create_plan(ExplainLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(JoinLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
   RC create_plan(CalcLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(AggregateLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(SortLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+  RC create_plan(LimitLogicalOperator &logical_oper, std::unique_ptr<PhysicalOperator> &oper);
+
+  /**
+   * @brief 生成排序的物理计划
+   * @param fetch_rows 上层最多需要的行数，小于0表示需要全部数据
+   */
+  RC create_sort_plan(SortLogicalOperator &logical_oper, int64_t fetch_rows, std::unique_ptr<PhysicalOperator> &oper);
 };
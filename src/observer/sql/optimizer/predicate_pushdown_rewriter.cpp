@@ -12,9 +12,14 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/12/30.
 //
 
+#include <algorithm>
+#include <string.h>
+#include <stdint.h>
+
 #include "sql/optimizer/predicate_pushdown_rewriter.h"
 #include "sql/operator/logical_operator.h"
 #include "sql/operator/table_get_logical_operator.h"
+#include "sql/operator/join_logical_operator.h"
 #include "sql/expr/expression.h"
 
 RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bool &change_made)
@@ -29,6 +34,9 @@ RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bo
   }
 
   std::unique_ptr<LogicalOperator> &child_oper = oper->children().front();
+  if (child_oper->type() == LogicalOperatorType::JOIN) {
+    return pushdown_to_join(oper, change_made);
+  }
   if (child_oper->type() != LogicalOperatorType::TABLE_GET) {
     return rc;
   }
@@ -64,6 +72,277 @@ RC PredicatePushdownRewriter::rewrite(std::unique_ptr<LogicalOperator> &oper, bo
   return rc;
 }
 
+/**
+ * @brief 连接树的叶子节点都是table get算子时，按照从左到右的顺序收集起来
+ */
+static bool collect_table_gets(LogicalOperator &oper, std::vector<TableGetLogicalOperator *> &table_gets)
+{
+  if (oper.type() == LogicalOperatorType::TABLE_GET) {
+    table_gets.push_back(static_cast<TableGetLogicalOperator *>(&oper));
+    return true;
+  }
+
+  if (oper.type() != LogicalOperatorType::JOIN || oper.children().size() != 2) {
+    return false;
+  }
+  for (std::unique_ptr<LogicalOperator> &child : oper.children()) {
+    if (!collect_table_gets(*child, table_gets)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief 把连接树拆开，叶子节点放到leaves中，连接算子上已有的连接条件放到conjuncts中
+ */
+static void flatten_join(std::unique_ptr<LogicalOperator> oper, std::vector<std::unique_ptr<LogicalOperator>> &leaves,
+    std::vector<std::unique_ptr<Expression>> &conjuncts)
+{
+  if (oper->type() != LogicalOperatorType::JOIN) {
+    leaves.emplace_back(std::move(oper));
+    return;
+  }
+
+  for (std::unique_ptr<Expression> &expr : oper->expressions()) {
+    conjuncts.emplace_back(std::move(expr));
+  }
+  for (std::unique_ptr<LogicalOperator> &child : oper->children()) {
+    flatten_join(std::move(child), leaves, conjuncts);
+  }
+}
+
+/**
+ * @brief 把AND连接的表达式拆成多个条件
+ */
+static void split_conjuncts(std::unique_ptr<Expression> expr, std::vector<std::unique_ptr<Expression>> &conjuncts)
+{
+  if (expr->type() == ExprType::CONJUNCTION &&
+      static_cast<ConjunctionExpr *>(expr.get())->conjunction_type() == ConjunctionExpr::Type::AND) {
+    for (std::unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr.get())->children()) {
+      split_conjuncts(std::move(child), conjuncts);
+    }
+    return;
+  }
+  conjuncts.emplace_back(std::move(expr));
+}
+
+/**
+ * @brief 计算表达式用到了哪些表，第i位表示tables中的第i个表
+ * @return 表达式中有不能确定用到哪些表的部分时返回false
+ */
+static bool get_table_mask(
+    Expression *expr, const std::vector<TableGetLogicalOperator *> &tables, uint64_t &mask)
+{
+  switch (expr->type()) {
+    case ExprType::FIELD: {
+      const char *table_name = static_cast<FieldExpr *>(expr)->table_name();
+      for (size_t i = 0; i < tables.size(); i++) {
+        if (0 == strcmp(tables[i]->table()->name(), table_name)) {
+          mask |= (uint64_t)1 << i;
+          return true;
+        }
+      }
+      return false;
+    }
+    case ExprType::VALUE: {
+      return true;
+    }
+    case ExprType::CAST: {
+      return get_table_mask(static_cast<CastExpr *>(expr)->child().get(), tables, mask);
+    }
+    case ExprType::COMPARISON: {
+      auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+      return get_table_mask(comparison_expr->left().get(), tables, mask) &&
+             get_table_mask(comparison_expr->right().get(), tables, mask);
+    }
+    case ExprType::CONJUNCTION: {
+      for (std::unique_ptr<Expression> &child : static_cast<ConjunctionExpr *>(expr)->children()) {
+        if (!get_table_mask(child.get(), tables, mask)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    case ExprType::ARITHMETIC: {
+      auto arithmetic_expr = static_cast<ArithmeticExpr *>(expr);
+      return (!arithmetic_expr->left() || get_table_mask(arithmetic_expr->left().get(), tables, mask)) &&
+             (!arithmetic_expr->right() || get_table_mask(arithmetic_expr->right().get(), tables, mask));
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+RC PredicatePushdownRewriter::pushdown_to_join(std::unique_ptr<LogicalOperator> &oper, bool &change_made)
+{
+  RC rc = RC::SUCCESS;
+  std::vector<std::unique_ptr<Expression>> &predicate_oper_exprs = oper->expressions();
+  if (predicate_oper_exprs.size() != 1) {
+    return rc;
+  }
+
+  std::unique_ptr<LogicalOperator> &join_oper = oper->children().front();
+  std::vector<TableGetLogicalOperator *> table_gets;
+  if (!collect_table_gets(*join_oper, table_gets) || table_gets.size() > 64) {
+    return rc;
+  }
+  for (size_t i = 0; i < table_gets.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      if (0 == strcmp(table_gets[i]->table()->name(), table_gets[j]->table()->name())) {
+        return rc;
+      }
+    }
+  }
+
+  // 没有用到表的条件留在原来的位置，没有可以下推的条件时不做任何修改
+  std::vector<std::unique_ptr<Expression>> conjuncts;
+  split_conjuncts(std::move(predicate_oper_exprs.front()), conjuncts);
+
+  std::vector<std::unique_ptr<Expression>> remain_exprs;
+  std::vector<std::unique_ptr<Expression>> pushdown_exprs;
+  std::vector<uint64_t>                    masks;
+  for (std::unique_ptr<Expression> &conjunct : conjuncts) {
+    uint64_t mask = 0;
+    if (get_table_mask(conjunct.get(), table_gets, mask) && mask != 0) {
+      pushdown_exprs.emplace_back(std::move(conjunct));
+      masks.push_back(mask);
+    } else {
+      remain_exprs.emplace_back(std::move(conjunct));
+    }
+  }
+
+  if (remain_exprs.empty()) {
+    // 所有的条件都下推了，留下一个恒为真的条件，由 PredicateRewriteRule 删除
+    Value value((bool)true);
+    predicate_oper_exprs.front() = std::unique_ptr<Expression>(new ValueExpr(value));
+  } else if (remain_exprs.size() == 1) {
+    predicate_oper_exprs.front() = std::move(remain_exprs.front());
+  } else {
+    predicate_oper_exprs.front() = std::unique_ptr<Expression>(new ConjunctionExpr(ConjunctionExpr::Type::AND, remain_exprs));
+  }
+
+  if (pushdown_exprs.empty()) {
+    return rc;
+  }
+  change_made = true;
+
+  // 拆开连接树，原来的连接条件一起重新分配
+  std::vector<std::unique_ptr<LogicalOperator>> leaves;
+  std::vector<std::unique_ptr<Expression>>      join_exprs;
+  flatten_join(std::move(join_oper), leaves, join_exprs);
+  for (std::unique_ptr<Expression> &join_expr : join_exprs) {
+    uint64_t mask = 0;
+    get_table_mask(join_expr.get(), table_gets, mask);
+    pushdown_exprs.emplace_back(std::move(join_expr));
+    masks.push_back(mask);
+  }
+
+  // 按照FROM中的顺序依次选择与已经连接的表有连接条件的表，都没有连接条件时才产生笛卡尔积
+  const size_t table_num = leaves.size();
+  std::vector<size_t>   order = {0};
+  std::vector<bool>     used(table_num, false);
+  uint64_t              joined_mask = 1;
+  used[0] = true;
+  while (order.size() < table_num) {
+    size_t pick = table_num;
+    for (size_t i = 0; i < table_num && pick == table_num; i++) {
+      if (used[i]) {
+        continue;
+      }
+      const uint64_t table_mask = (uint64_t)1 << i;
+      for (uint64_t mask : masks) {
+        if ((mask & table_mask) && (mask & joined_mask) && (mask & ~(joined_mask | table_mask)) == 0) {
+          pick = i;
+          break;
+        }
+      }
+    }
+
+    if (pick == table_num) {
+      pick = std::find(used.begin(), used.end(), false) - used.begin();
+      LOG_TRACE("no join condition for table %s, use cross product", table_gets[pick]->table()->name());
+    }
+    order.push_back(pick);
+    used[pick] = true;
+    joined_mask |= (uint64_t)1 << pick;
+  }
+
+  // 重新生成左深树，joins[k]连接order中的前k+2个表
+  std::vector<JoinLogicalOperator *> joins;
+  std::vector<uint64_t>              join_masks;
+  std::unique_ptr<LogicalOperator>   tree = std::move(leaves[order[0]]);
+  uint64_t                           tree_mask = (uint64_t)1 << order[0];
+  for (size_t k = 1; k < table_num; k++) {
+    JoinLogicalOperator *join = new JoinLogicalOperator;
+    join->add_child(std::move(tree));
+    join->add_child(std::move(leaves[order[k]]));
+    tree = std::unique_ptr<LogicalOperator>(join);
+    tree_mask |= (uint64_t)1 << order[k];
+    joins.push_back(join);
+    join_masks.push_back(tree_mask);
+  }
+  join_oper = std::move(tree);
+
+  // 单表的条件尽量下推到table get算子，其它条件放到包含所有用到的表的最下层连接
+  for (size_t i = 0; i < pushdown_exprs.size(); i++) {
+    std::unique_ptr<Expression> &expr = pushdown_exprs[i];
+    const uint64_t mask = masks[i];
+    if ((mask & (mask - 1)) == 0) {
+      const size_t table_index = __builtin_ctzll(mask);
+      std::vector<std::unique_ptr<Expression>> table_exprs;
+      rc = get_exprs_can_pushdown(expr, table_exprs);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to get pushdown expressions. rc=%s", strrc(rc));
+        return rc;
+      }
+      for (std::unique_ptr<Expression> &table_expr : table_exprs) {
+        table_gets[table_index]->predicates().emplace_back(std::move(table_expr));
+      }
+      if (!expr) {
+        continue;
+      }
+    }
+
+    for (size_t k = 0; k < joins.size(); k++) {
+      if ((join_masks[k] & mask) == mask) {
+        joins[k]->expressions().emplace_back(std::move(expr));
+        break;
+      }
+    }
+  }
+  return rc;
+}
+
+/**
+ * @brief OR表达式只能整体下推，要求其中所有的比较都只涉及字段和常量
+ */
+static bool can_pushdown_disjunction(Expression *expr)
+{
+  if (expr->type() == ExprType::CONJUNCTION) {
+    auto conjunction_expr = static_cast<ConjunctionExpr *>(expr);
+    for (std::unique_ptr<Expression> &child : conjunction_expr->children()) {
+      if (!can_pushdown_disjunction(child.get())) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (expr->type() != ExprType::COMPARISON) {
+    return false;
+  }
+
+  auto comparison_expr = static_cast<ComparisonExpr *>(expr);
+  for (const Expression *side : {comparison_expr->left().get(), comparison_expr->right().get()}) {
+    if (side->type() != ExprType::FIELD && side->type() != ExprType::VALUE) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /**
  * 查看表达式是否可以直接下放到table get算子的filter
  * @param expr 是当前的表达式。如果可以下放给table get 算子，执行完成后expr就失效了
@@ -76,8 +355,11 @@ RC PredicatePushdownRewriter::get_exprs_can_pushdown(
   RC rc = RC::SUCCESS;
   if (expr->type() == ExprType::CONJUNCTION) {
     ConjunctionExpr *conjunction_expr = static_cast<ConjunctionExpr *>(expr.get());
-    // 或 操作的比较，太复杂，现在不考虑
+    // 或 操作不能拆开，所有的分支都可以在table get算子中计算时整体下推，可以用于索引合并
     if (conjunction_expr->conjunction_type() == ConjunctionExpr::Type::OR) {
+      if (can_pushdown_disjunction(expr.get())) {
+        pushdown_exprs.emplace_back(std::move(expr));
+      }
       return rc;
     }
 
@@ -101,8 +383,8 @@ RC PredicatePushdownRewriter::get_exprs_can_pushdown(
     // 如果是比较操作，并且比较的左边或右边是表某个列值，那么就下推下去
     auto comparison_expr = static_cast<ComparisonExpr *>(expr.get());
     CompOp comp = comparison_expr->comp();
-    if (comp != EQUAL_TO) {
-      // 简单处理，仅取等值比较。当然还可以取一些范围比较，还有 like % 等操作
+    if (comp == NO_OP) {
+      // 等值比较可以用于索引查找，有统计信息时范围比较也可以用于索引扫描。还可以取一些 like % 等操作
       // 其它的还有 is null 等
       return rc;
     }
@@ -20,7 +20,10 @@ See the Mulan PSL v2 for more details. */
 /**
  * @brief 将一些谓词表达式下推到表数据扫描中
  * @ingroup Rewriter
- * @details 这样可以提前过滤一些数据
+ * @details 这样可以提前过滤一些数据。
+ * 过滤条件下面是连接时，只涉及一个表的条件下推到这个表的table get算子，涉及多个表的条件放到
+ * 包含这些表的最下层的连接算子中，作为连接条件。同时调整左深树中表的顺序，尽量让每次连接的
+ * 表都与前面的表有连接条件，避免出现笛卡尔积。
  */
 class PredicatePushdownRewriter : public RewriteRule 
 {
@@ -31,6 +34,8 @@ public:
   RC rewrite(std::unique_ptr<LogicalOperator> &oper, bool &change_made) override;
 
 private:
+  RC pushdown_to_join(std::unique_ptr<LogicalOperator> &oper, bool &change_made);
+
   RC get_exprs_can_pushdown(
       std::unique_ptr<Expression> &expr, std::vector<std::unique_ptr<Expression>> &pushdown_exprs);
 };
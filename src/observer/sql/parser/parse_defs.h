@@ -38,6 +38,17 @@ struct RelAttrSqlNode
 {
   std::string relation_name;   ///< relation name (may be NULL) 表名
   std::string attribute_name;  ///< attribute name              属性名
+  std::string aggregation;     ///< 聚合函数的名字，比如count，不是聚合函数时为空。这时上面是函数的参数
+};
+
+/**
+ * @brief 描述ORDER BY中的一项
+ * @ingroup SQLParser
+ */
+struct OrderBySqlNode
+{
+  RelAttrSqlNode attr;        ///< 排序的字段或者聚合函数
+  bool           asc = true;  ///< 是否升序
 };
 
 /**
@@ -62,6 +73,7 @@ enum CompOp
  * 一个条件比较是有两部分组成的，称为左边和右边。
  * 左边和右边理论上都可以是任意的数据，比如是字段（属性，列），也可以是数值常量。
  * 这个结构中记录的仅仅支持字段和值。
+ * 多个条件之间的OR使用disjuncts表示，比如 a=1 OR (b=2 AND c=3)，这时不使用比较相关的字段。
  */
 struct ConditionSqlNode
 {
@@ -74,6 +86,9 @@ struct ConditionSqlNode
                                    ///< 1时，操作符右边是属性名，0时，是属性值
   RelAttrSqlNode  right_attr;      ///< right-hand side attribute if right_is_attr = TRUE 右边的属性
   Value           right_value;     ///< right-hand side value if right_is_attr = FALSE
+
+  /// 不为空时，这个条件是多个条件列表的OR，每个列表中的条件之间是AND的关系
+  std::vector<std::vector<ConditionSqlNode>> disjuncts;
 };
 
 /**
@@ -82,6 +97,7 @@ struct ConditionSqlNode
  * @details 一个正常的select语句描述起来比这个要复杂很多，这里做了简化。
  * 一个select语句由三部分组成，分别是select, from, where。
  * select部分表示要查询的字段，from部分表示要查询的表，where部分表示查询的条件。
+ * 另外可以有 group by，select部分可以有聚合函数。最后可以有 order by 和 limit。
  * 比如 from 中可以是多个表，也可以是另一个查询语句，这里仅仅支持表，也就是 relations。
  * where 条件 conditions，这里表示使用AND串联起来多个条件。正常的SQL语句会有OR，NOT等，
  * 甚至可以包含复杂的表达式。
@@ -92,6 +108,10 @@ struct SelectSqlNode
   std::vector<RelAttrSqlNode>     attributes;    ///< attributes in select clause
   std::vector<std::string>        relations;     ///< 查询的表
   std::vector<ConditionSqlNode>   conditions;    ///< 查询条件，使用AND串联起来多个条件
+  std::vector<RelAttrSqlNode>     group_by;      ///< 分组的字段
+  std::vector<OrderBySqlNode>     order_by;      ///< 排序的字段
+  int                             limit = -1;    ///< 最多输出的行数，-1表示没有限制
+  int                             offset = 0;    ///< 跳过前面的行数
 };
 
 /**
@@ -183,6 +203,10 @@ struct CreateIndexSqlNode
   std::string index_name;      ///< Index name
   std::string relation_name;   ///< Relation name
   std::string attribute_name;  ///< Attribute name
+  bool        unique = false;  ///< 是否是唯一索引(CREATE UNIQUE INDEX)
+  std::string index_type;      ///< 索引类型(USING xxx)，为空表示默认的B+树
+  std::string index_option;    ///< 索引选项(WITH xxx)，目前只有 bloom_filter
+  std::vector<ConditionSqlNode> conditions;  ///< 部分索引的条件(WHERE xxx)，为空表示索引所有记录
 };
 
 /**
@@ -205,6 +229,26 @@ struct DescTableSqlNode
   std::string relation_name;
 };
 
+/**
+ * @brief 描述一个analyze table语句
+ * @ingroup SQLParser
+ * @details 收集表的统计信息，保存在表的元数据中
+ */
+struct AnalyzeTableSqlNode
+{
+  std::string relation_name;
+};
+
+/**
+ * @brief 描述一个show stats语句
+ * @ingroup SQLParser
+ * @details 查看 analyze table 收集到的统计信息
+ */
+struct ShowStatsSqlNode
+{
+  std::string relation_name;
+};
+
 /**
  * @brief 描述一个load data语句
  * @ingroup SQLParser
@@ -281,6 +325,8 @@ enum SqlCommandFlag
   SCF_EXIT,
   SCF_EXPLAIN,
   SCF_SET_VARIABLE, ///< 设置变量
+  SCF_ANALYZE_TABLE,
+  SCF_SHOW_STATS,
 };
 /**
  * @brief 表示一个SQL语句
@@ -304,6 +350,8 @@ public:
   LoadDataSqlNode           load_data;
   ExplainSqlNode            explain;
   SetVariableSqlNode        set_variable;
+  AnalyzeTableSqlNode       analyze_table;
+  ShowStatsSqlNode          show_stats;
 
 public:
   ParsedSqlNode();
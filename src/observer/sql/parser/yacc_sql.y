@@ -85,12 +85,24 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
         FROM
         WHERE
         AND
+        OR
         SET
         ON
         LOAD
         DATA
         INFILE
         EXPLAIN
+        UNIQUE
+        USING
+        WITH
+        ANALYZE
+        STATS
+        GROUP
+        BY
+        ORDER
+        ASC
+        LIMIT
+        OFFSET
         EQ
         LT
         GT
@@ -112,6 +124,9 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
   std::vector<Value> *              value_list;
   std::vector<ConditionSqlNode> *   condition_list;
   std::vector<RelAttrSqlNode> *     rel_attr_list;
+  OrderBySqlNode *                  order_by_item;
+  std::vector<OrderBySqlNode> *     order_by_list;
+  std::pair<int, int> *             limit_offset;
   std::vector<std::string> *        relation_list;
   char *                            string;
   int                               number;
@@ -129,16 +144,27 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %type <condition>           condition
 %type <value>               value
 %type <number>              number
+%type <number>              opt_unique
+%type <string>              opt_index_type
+%type <string>              opt_index_option
 %type <comp>                comp_op
 %type <rel_attr>            rel_attr
+%type <rel_attr>            aggr_arg
 %type <attr_infos>          attr_def_list
 %type <attr_info>           attr_def
 %type <value_list>          value_list
 %type <condition_list>      where
 %type <condition_list>      condition_list
+%type <condition_list>      or_condition_list
 %type <rel_attr_list>       select_attr
 %type <relation_list>       rel_list
 %type <rel_attr_list>       attr_list
+%type <rel_attr_list>       group_by
+%type <order_by_item>       order_by_item
+%type <order_by_list>       order_by
+%type <order_by_list>       order_by_list
+%type <limit_offset>        limit
+%type <number>              opt_asc
 %type <expression>          expression
 %type <expression_list>     expression_list
 %type <sql_node>            calc_stmt
@@ -150,6 +176,8 @@ ArithmeticExpr *create_arithmetic_expression(ArithmeticExpr::Type type,
 %type <sql_node>            drop_table_stmt
 %type <sql_node>            show_tables_stmt
 %type <sql_node>            desc_table_stmt
+%type <sql_node>            analyze_table_stmt
+%type <sql_node>            show_stats_stmt
 %type <sql_node>            create_index_stmt
 %type <sql_node>            drop_index_stmt
 %type <sql_node>            sync_stmt
@@ -187,6 +215,8 @@ command_wrapper:
   | drop_table_stmt
   | show_tables_stmt
   | desc_table_stmt
+  | analyze_table_stmt
+  | show_stats_stmt
   | create_index_stmt
   | drop_index_stmt
   | sync_stmt
@@ -256,17 +286,79 @@ desc_table_stmt:
     }
     ;
 
+analyze_table_stmt:
+    ANALYZE TABLE ID {
+      $$ = new ParsedSqlNode(SCF_ANALYZE_TABLE);
+      $$->analyze_table.relation_name = $3;
+      free($3);
+    }
+    ;
+
+show_stats_stmt:
+    SHOW STATS ID {
+      $$ = new ParsedSqlNode(SCF_SHOW_STATS);
+      $$->show_stats.relation_name = $3;
+      free($3);
+    }
+    ;
+
 create_index_stmt:    /*create index 语句的语法解析树*/
-    CREATE INDEX ID ON ID LBRACE ID RBRACE
+    CREATE opt_unique INDEX ID ON ID LBRACE ID RBRACE opt_index_type opt_index_option where
     {
       $$ = new ParsedSqlNode(SCF_CREATE_INDEX);
       CreateIndexSqlNode &create_index = $$->create_index;
-      create_index.index_name = $3;
-      create_index.relation_name = $5;
-      create_index.attribute_name = $7;
-      free($3);
-      free($5);
-      free($7);
+      create_index.index_name = $4;
+      create_index.relation_name = $6;
+      create_index.attribute_name = $8;
+      create_index.unique = ($2 != 0);
+      if ($10 != nullptr) {
+        create_index.index_type = $10;
+        free($10);
+      }
+      if ($11 != nullptr) {
+        create_index.index_option = $11;
+        free($11);
+      }
+      if ($12 != nullptr) {
+        create_index.conditions.swap(*$12);
+        delete $12;
+      }
+      free($4);
+      free($6);
+      free($8);
+    }
+    ;
+
+opt_unique:
+    /* empty */
+    {
+      $$ = 0;
+    }
+    | UNIQUE
+    {
+      $$ = 1;
+    }
+    ;
+
+opt_index_type:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | USING ID
+    {
+      $$ = $2;
+    }
+    ;
+
+opt_index_option:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | WITH ID
+    {
+      $$ = $2;
     }
     ;
 
@@ -415,7 +507,7 @@ update_stmt:      /*  update 语句的语法解析树*/
     }
     ;
 select_stmt:        /*  select 语句的语法解析树*/
-    SELECT select_attr FROM ID rel_list where
+    SELECT select_attr FROM ID rel_list where group_by order_by limit
     {
       $$ = new ParsedSqlNode(SCF_SELECT);
       if ($2 != nullptr) {
@@ -433,6 +525,24 @@ select_stmt:        /*  select 语句的语法解析树*/
         $$->selection.conditions.swap(*$6);
         delete $6;
       }
+
+      if ($7 != nullptr) {
+        $$->selection.group_by.swap(*$7);
+        std::reverse($$->selection.group_by.begin(), $$->selection.group_by.end());
+        delete $7;
+      }
+
+      if ($8 != nullptr) {
+        $$->selection.order_by.swap(*$8);
+        std::reverse($$->selection.order_by.begin(), $$->selection.order_by.end());
+        delete $8;
+      }
+
+      if ($9 != nullptr) {
+        $$->selection.limit = $9->first;
+        $$->selection.offset = $9->second;
+        delete $9;
+      }
       free($4);
     }
     ;
@@ -521,6 +631,30 @@ rel_attr:
       free($1);
       free($3);
     }
+    | ID LBRACE aggr_arg RBRACE {
+      $$ = $3;
+      $$->aggregation = $1;
+      free($1);
+    }
+    ;
+
+aggr_arg:
+    '*' {
+      $$ = new RelAttrSqlNode;
+      $$->attribute_name = "*";
+    }
+    | ID {
+      $$ = new RelAttrSqlNode;
+      $$->attribute_name = $1;
+      free($1);
+    }
+    | ID DOT ID {
+      $$ = new RelAttrSqlNode;
+      $$->relation_name  = $1;
+      $$->attribute_name = $3;
+      free($1);
+      free($3);
+    }
     ;
 
 attr_list:
@@ -556,15 +690,117 @@ rel_list:
       free($2);
     }
     ;
+group_by:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | GROUP BY rel_attr attr_list {
+      if ($4 != nullptr) {
+        $$ = $4;
+      } else {
+        $$ = new std::vector<RelAttrSqlNode>;
+      }
+      $$->emplace_back(*$3);
+      delete $3;
+    }
+    ;
+order_by:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | ORDER BY order_by_item order_by_list {
+      if ($4 != nullptr) {
+        $$ = $4;
+      } else {
+        $$ = new std::vector<OrderBySqlNode>;
+      }
+      $$->emplace_back(*$3);
+      delete $3;
+    }
+    ;
+order_by_list:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | COMMA order_by_item order_by_list {
+      if ($3 != nullptr) {
+        $$ = $3;
+      } else {
+        $$ = new std::vector<OrderBySqlNode>;
+      }
+      $$->emplace_back(*$2);
+      delete $2;
+    }
+    ;
+order_by_item:
+    rel_attr opt_asc {
+      $$ = new OrderBySqlNode;
+      $$->attr = *$1;
+      $$->asc = ($2 != 0);
+      delete $1;
+    }
+    ;
+opt_asc:
+    /* empty */ { $$ = 1; }
+    | ASC       { $$ = 1; }
+    | DESC      { $$ = 0; }
+    ;
+limit:
+    /* empty */
+    {
+      $$ = nullptr;
+    }
+    | LIMIT NUMBER {
+      $$ = new std::pair<int, int>($2, 0);
+    }
+    | LIMIT NUMBER OFFSET NUMBER {
+      $$ = new std::pair<int, int>($2, $4);
+    }
+    | LIMIT NUMBER COMMA NUMBER {
+      // MySQL的写法，前面是跳过的行数
+      $$ = new std::pair<int, int>($4, $2);
+    }
+    ;
 where:
     /* empty */
     {
       $$ = nullptr;
     }
-    | WHERE condition_list {
+    | WHERE or_condition_list {
       $$ = $2;  
     }
     ;
+or_condition_list:
+    condition_list {
+      $$ = $1;
+    }
+    | condition_list OR or_condition_list {
+      // AND的优先级比OR高，这里得到的是多个AND条件列表的OR
+      ConditionSqlNode condition;
+      condition.disjuncts.emplace_back();
+      if ($1 != nullptr) {
+        condition.disjuncts.back().swap(*$1);
+        delete $1;
+      }
+      if ($3 != nullptr && $3->size() == 1 && !$3->front().disjuncts.empty()) {
+        for (std::vector<ConditionSqlNode> &disjunct : $3->front().disjuncts) {
+          condition.disjuncts.emplace_back(std::move(disjunct));
+        }
+      } else {
+        condition.disjuncts.emplace_back();
+        if ($3 != nullptr) {
+          condition.disjuncts.back().swap(*$3);
+        }
+      }
+      delete $3;
+
+      $$ = new std::vector<ConditionSqlNode>;
+      $$->emplace_back(std::move(condition));
+    }
+    ;
 condition_list:
     /* empty */
     {
@@ -630,6 +866,20 @@ condition:
       delete $1;
       delete $3;
     }
+    | LBRACE or_condition_list RBRACE
+    {
+      if ($2 != nullptr && $2->size() == 1) {
+        $$ = new ConditionSqlNode(std::move($2->front()));
+      } else {
+        // 括号中是多个AND条件，作为只有一项的OR
+        $$ = new ConditionSqlNode;
+        $$->disjuncts.emplace_back();
+        if ($2 != nullptr) {
+          $$->disjuncts.back().swap(*$2);
+        }
+      }
+      delete $2;
+    }
     ;
 
 comp_op:
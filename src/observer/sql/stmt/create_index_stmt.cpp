@@ -14,6 +14,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "sql/stmt/create_index_stmt.h"
 #include "storage/table/table.h"
+#include "storage/index/index_bloom_filter.h"
 #include "storage/db/db.h"
 #include "common/lang/string.h"
 #include "common/log/log.h"
@@ -21,6 +22,72 @@ See the Mulan PSL v2 for more details. */
 using namespace std;
 using namespace common;
 
+/**
+ * @brief 把部分索引的条件转换成 字段 op 常量 的形式
+ * @details 只支持AND连接的简单比较，括号中只有AND条件时也可以展开
+ */
+static RC create_index_predicates(
+    Table *table, const vector<ConditionSqlNode> &conditions, vector<IndexPredicate> &predicates)
+{
+  for (const ConditionSqlNode &condition : conditions) {
+    if (!condition.disjuncts.empty()) {
+      if (condition.disjuncts.size() != 1) {
+        LOG_WARN("OR is not supported in index predicate. table=%s", table->name());
+        return RC::INVALID_ARGUMENT;
+      }
+      RC rc = create_index_predicates(table, condition.disjuncts.front(), predicates);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+      continue;
+    }
+
+    if (condition.left_is_attr == condition.right_is_attr) {
+      LOG_WARN("index predicate should compare a field with a value. table=%s", table->name());
+      return RC::INVALID_ARGUMENT;
+    }
+
+    // value op field 转换成 field op' value
+    const bool left_is_attr = condition.left_is_attr;
+    const RelAttrSqlNode &attr = left_is_attr ? condition.left_attr : condition.right_attr;
+    Value value = left_is_attr ? condition.right_value : condition.left_value;
+    CompOp comp = condition.comp;
+    if (!left_is_attr) {
+      switch (comp) {
+        case LESS_THAN: comp = GREAT_THAN; break;
+        case LESS_EQUAL: comp = GREAT_EQUAL; break;
+        case GREAT_THAN: comp = LESS_THAN; break;
+        case GREAT_EQUAL: comp = LESS_EQUAL; break;
+        default: break;
+      }
+    }
+
+    if (!is_blank(attr.relation_name.c_str()) && 0 != strcmp(attr.relation_name.c_str(), table->name())) {
+      LOG_WARN("index predicate references another table. table=%s, relation=%s",
+               table->name(), attr.relation_name.c_str());
+      return RC::SCHEMA_FIELD_NOT_EXIST;
+    }
+
+    const FieldMeta *field_meta = table->table_meta().field(attr.attribute_name.c_str());
+    if (nullptr == field_meta) {
+      LOG_WARN("no such field in table. table=%s, field name=%s", table->name(), attr.attribute_name.c_str());
+      return RC::SCHEMA_FIELD_NOT_EXIST;
+    }
+
+    if (field_meta->type() == FLOATS && value.attr_type() == INTS) {
+      value.set_float(static_cast<float>(value.get_int()));
+    }
+
+    IndexPredicate predicate;
+    RC rc = predicate.init(*field_meta, comp, value);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    predicates.push_back(std::move(predicate));
+  }
+  return RC::SUCCESS;
+}
+
 RC CreateIndexStmt::create(Db *db, const CreateIndexSqlNode &create_index, Stmt *&stmt)
 {
   stmt = nullptr;
@@ -52,6 +119,52 @@ RC CreateIndexStmt::create(Db *db, const CreateIndexSqlNode &create_index, Stmt
     return RC::SCHEMA_INDEX_NAME_REPEAT;
   }
 
-  stmt = new CreateIndexStmt(table, field_meta, create_index.index_name);
+  IndexType index_type = IndexType::BPLUS_TREE;
+  if (!create_index.index_type.empty()) {
+    index_type = index_type_from_string(create_index.index_type.c_str());
+    if (index_type == IndexType::UNDEFINED) {
+      LOG_WARN("unknown index type. index type=%s", create_index.index_type.c_str());
+      return RC::INVALID_ARGUMENT;
+    }
+  }
+
+  // 浮点数比较时允许一定的误差，“相等”的两个值二进制可能不同，不能使用哈希和位图
+  if ((index_type == IndexType::HASH || index_type == IndexType::BITMAP) && field_meta->type() == FLOATS) {
+    LOG_WARN("%s index does not support float field. table=%s, field=%s",
+             index_type_to_string(index_type), table_name, field_meta->name());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  if (index_type == IndexType::BITMAP && create_index.unique) {
+    LOG_WARN("bitmap index cannot be unique. table=%s, index=%s", table_name, create_index.index_name.c_str());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  bool bloom_filter = false;
+  if (!create_index.index_option.empty()) {
+    if (0 != strcasecmp(create_index.index_option.c_str(), "bloom_filter")) {
+      LOG_WARN("unknown index option. index option=%s", create_index.index_option.c_str());
+      return RC::INVALID_ARGUMENT;
+    }
+
+    // 与哈希索引一样，布隆过滤器使用键值的二进制计算哈希值，不能用于浮点数
+    if (index_type != IndexType::BPLUS_TREE || !IndexBloomFilter::support(field_meta->type())) {
+      LOG_WARN("bloom filter is not supported. index type=%s, field type=%s",
+               index_type_to_string(index_type), attr_type_to_string(field_meta->type()));
+      return RC::INVALID_ARGUMENT;
+    }
+    bloom_filter = true;
+  }
+
+  vector<IndexPredicate> predicates;
+  RC rc = create_index_predicates(table, create_index.conditions, predicates);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("invalid index predicate. table=%s, index=%s, rc=%s",
+             table_name, create_index.index_name.c_str(), strrc(rc));
+    return rc;
+  }
+
+  stmt = new CreateIndexStmt(table, field_meta, create_index.index_name, create_index.unique, index_type,
+                             bloom_filter, std::move(predicates));
   return RC::SUCCESS;
 }
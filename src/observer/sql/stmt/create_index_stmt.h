@@ -17,6 +17,7 @@ See the Mulan PSL v2 for more details. */
 #include <string>
 
 #include "sql/stmt/stmt.h"
+#include "storage/index/index_meta.h"
 
 struct CreateIndexSqlNode;
 class Table;
@@ -29,10 +30,15 @@ class FieldMeta;
 class CreateIndexStmt : public Stmt
 {
 public:
-  CreateIndexStmt(Table *table, const FieldMeta *field_meta, const std::string &index_name)
+  CreateIndexStmt(Table *table, const FieldMeta *field_meta, const std::string &index_name, bool unique,
+                  IndexType index_type, bool bloom_filter, std::vector<IndexPredicate> predicates)
         : table_(table),
           field_meta_(field_meta),
-          index_name_(index_name)
+          index_name_(index_name),
+          unique_(unique),
+          index_type_(index_type),
+          bloom_filter_(bloom_filter),
+          predicates_(std::move(predicates))
   {}
 
   virtual ~CreateIndexStmt() = default;
@@ -42,6 +48,10 @@ public:
   Table *table() const { return table_; }
   const FieldMeta *field_meta() const { return field_meta_; }
   const std::string &index_name() const { return index_name_; }
+  bool unique() const { return unique_; }
+  IndexType index_type() const { return index_type_; }
+  bool bloom_filter() const { return bloom_filter_; }
+  const std::vector<IndexPredicate> &predicates() const { return predicates_; }
 
 public:
   static RC create(Db *db, const CreateIndexSqlNode &create_index, Stmt *&stmt);
@@ -50,4 +60,8 @@ private:
   Table *table_ = nullptr;
   const FieldMeta *field_meta_ = nullptr;
   std::string index_name_;
+  bool unique_ = false;
+  IndexType index_type_ = IndexType::BPLUS_TREE;
+  bool bloom_filter_ = false;
+  std::vector<IndexPredicate> predicates_;  ///< 部分索引的条件
 };
@@ -19,6 +19,14 @@ See the Mulan PSL v2 for more details. */
 #include "storage/db/db.h"
 #include "storage/table/table.h"
 
+FilterUnit::~FilterUnit()
+{
+  for (FilterStmt *filter_stmt : disjuncts_) {
+    delete filter_stmt;
+  }
+  disjuncts_.clear();
+}
+
 FilterStmt::~FilterStmt()
 {
   for (FilterUnit *unit : filter_units_) {
@@ -49,6 +57,24 @@ RC FilterStmt::create(Db *db, Table *default_table, std::unordered_map<std::stri
   return rc;
 }
 
+void FilterStmt::visit_fields(const std::function<void(const Field &)> &visitor) const
+{
+  for (const FilterUnit *filter_unit : filter_units_) {
+    if (filter_unit->is_disjunction()) {
+      for (const FilterStmt *disjunct : filter_unit->disjuncts()) {
+        disjunct->visit_fields(visitor);
+      }
+      continue;
+    }
+
+    for (const FilterObj *filter_obj : {&filter_unit->left(), &filter_unit->right()}) {
+      if (filter_obj->is_attr) {
+        visitor(filter_obj->field);
+      }
+    }
+  }
+}
+
 RC get_table_and_field(Db *db, Table *default_table, std::unordered_map<std::string, Table *> *tables,
     const RelAttrSqlNode &attr, Table *&table, const FieldMeta *&field)
 {
@@ -82,6 +108,22 @@ RC FilterStmt::create_filter_unit(Db *db, Table *default_table, std::unordered_m
 {
   RC rc = RC::SUCCESS;
 
+  if (!condition.disjuncts.empty()) {
+    filter_unit = new FilterUnit;
+    for (const std::vector<ConditionSqlNode> &conditions : condition.disjuncts) {
+      FilterStmt *disjunct = nullptr;
+      rc = create(db, default_table, tables, conditions.data(), static_cast<int>(conditions.size()), disjunct);
+      if (rc != RC::SUCCESS) {
+        LOG_WARN("failed to create filter stmt of disjunct. rc=%s", strrc(rc));
+        delete filter_unit;
+        filter_unit = nullptr;
+        return rc;
+      }
+      filter_unit->add_disjunct(disjunct);
+    }
+    return rc;
+  }
+
   CompOp comp = condition.comp;
   if (comp < EQUAL_TO || comp >= NO_OP) {
     LOG_WARN("invalid compare operator : %d", comp);
@@ -14,6 +14,7 @@ See the Mulan PSL v2 for more details. */
 
 #pragma once
 
+#include <functional>
 #include <vector>
 #include <unordered_map>
 #include "sql/parser/parse_defs.h"
@@ -23,6 +24,7 @@ See the Mulan PSL v2 for more details. */
 class Db;
 class Table;
 class FieldMeta;
+class FilterStmt;
 
 struct FilterObj 
 {
@@ -43,12 +45,15 @@ struct FilterObj
   }
 };
 
+/**
+ * @brief 一个过滤条件
+ * @details 可以是一个比较，也可以是多个条件列表的OR(disjuncts不为空)，每个列表中的条件之间是AND的关系
+ */
 class FilterUnit 
 {
 public:
   FilterUnit() = default;
-  ~FilterUnit()
-  {}
+  ~FilterUnit();
 
   void set_comp(CompOp comp)
   {
@@ -78,10 +83,24 @@ public:
     return right_;
   }
 
+  bool is_disjunction() const
+  {
+    return !disjuncts_.empty();
+  }
+  const std::vector<FilterStmt *> &disjuncts() const
+  {
+    return disjuncts_;
+  }
+  void add_disjunct(FilterStmt *filter_stmt)
+  {
+    disjuncts_.push_back(filter_stmt);
+  }
+
 private:
   CompOp comp_ = NO_OP;
   FilterObj left_;
   FilterObj right_;
+  std::vector<FilterStmt *> disjuncts_;  ///< OR 的各个分支
 };
 
 /**
@@ -100,6 +119,11 @@ public:
     return filter_units_;
   }
 
+  /**
+   * @brief 遍历所有比较条件中引用的字段，包括OR中的
+   */
+  void visit_fields(const std::function<void(const Field &)> &visitor) const;
+
 public:
   static RC create(Db *db, Table *default_table, std::unordered_map<std::string, Table *> *tables,
       const ConditionSqlNode *conditions, int condition_num, FilterStmt *&stmt);
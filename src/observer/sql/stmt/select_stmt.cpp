@@ -12,6 +12,8 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai on 2022/6/6.
 //
 
+#include <algorithm>
+
 #include "sql/stmt/select_stmt.h"
 #include "sql/stmt/filter_stmt.h"
 #include "common/log/log.h"
@@ -36,6 +38,92 @@ static void wildcard_fields(Table *table, std::vector<Field> &field_metas)
   }
 }
 
+/**
+ * @brief 查找查询列表、聚合函数参数或者分组中的一个字段，不能是'*'
+ */
+static RC find_field(Db *db, const std::vector<Table *> &tables,
+    const std::unordered_map<std::string, Table *> &table_map, const RelAttrSqlNode &relation_attr, Field &field)
+{
+  const char *field_name = relation_attr.attribute_name.c_str();
+  if (0 == strcmp(field_name, "*")) {
+    LOG_WARN("* is not allowed here");
+    return RC::INVALID_ARGUMENT;
+  }
+
+  Table *table = nullptr;
+  if (!common::is_blank(relation_attr.relation_name.c_str())) {
+    auto iter = table_map.find(relation_attr.relation_name);
+    if (iter == table_map.end()) {
+      LOG_WARN("no such table in from list: %s", relation_attr.relation_name.c_str());
+      return RC::SCHEMA_FIELD_MISSING;
+    }
+    table = iter->second;
+  } else {
+    if (tables.size() != 1) {
+      LOG_WARN("invalid. I do not know the attr's table. attr=%s", field_name);
+      return RC::SCHEMA_FIELD_MISSING;
+    }
+    table = tables[0];
+  }
+
+  const FieldMeta *field_meta = table->table_meta().field(field_name);
+  if (nullptr == field_meta) {
+    LOG_WARN("no such field. field=%s.%s.%s", db->name(), table->name(), field_name);
+    return RC::SCHEMA_FIELD_MISSING;
+  }
+  field = Field(table, field_meta);
+  return RC::SUCCESS;
+}
+
+static std::string field_expr_name(const Field &field, bool with_table_name)
+{
+  return with_table_name ? std::string(field.table_name()) + "." + field.field_name() : field.field_name();
+}
+
+/**
+ * @brief 创建查询列表中的聚合函数
+ * @details 只有COUNT可以使用'*'，SUM和AVG只能计算数字
+ */
+static RC create_aggregate_expr(Db *db, const std::vector<Table *> &tables,
+    const std::unordered_map<std::string, Table *> &table_map, const RelAttrSqlNode &relation_attr,
+    bool with_table_name, std::vector<Field> &query_fields, std::unique_ptr<Expression> &expr)
+{
+  AggregateExpr::Type aggregate_type;
+  RC rc = AggregateExpr::type_from_string(relation_attr.aggregation.c_str(), aggregate_type);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("no such aggregate function: %s", relation_attr.aggregation.c_str());
+    return rc;
+  }
+
+  const char *type_name = AggregateExpr::type_name(aggregate_type);
+  if (0 == strcmp(relation_attr.attribute_name.c_str(), "*")) {
+    if (aggregate_type != AggregateExpr::Type::CNT || !common::is_blank(relation_attr.relation_name.c_str())) {
+      LOG_WARN("invalid argument of aggregate function. function=%s", type_name);
+      return RC::INVALID_ARGUMENT;
+    }
+    expr = std::make_unique<AggregateExpr>(aggregate_type, nullptr);
+    expr->set_name(std::string(type_name) + "(*)");
+    return RC::SUCCESS;
+  }
+
+  Field field;
+  rc = find_field(db, tables, table_map, relation_attr, field);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  if ((aggregate_type == AggregateExpr::Type::SUM || aggregate_type == AggregateExpr::Type::AVG) &&
+      field.attr_type() != INTS && field.attr_type() != FLOATS) {
+    LOG_WARN("aggregate function %s on non-numeric field %s", type_name, field.field_name());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  query_fields.push_back(field);
+  expr = std::make_unique<AggregateExpr>(aggregate_type, std::make_unique<FieldExpr>(field));
+  expr->set_name(std::string(type_name) + "(" + field_expr_name(field, with_table_name) + ")");
+  return RC::SUCCESS;
+}
+
 RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
 {
   if (nullptr == db) {
@@ -63,12 +151,31 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
     table_map.insert(std::pair<std::string, Table *>(table_name, table));
   }
 
+  bool has_aggregation = !select_sql.group_by.empty();
+  for (const RelAttrSqlNode &relation_attr : select_sql.attributes) {
+    if (!relation_attr.aggregation.empty()) {
+      has_aggregation = true;
+    }
+  }
+  const bool with_table_name = tables.size() > 1;
+
   // collect query fields in `select` statement
   std::vector<Field> query_fields;
+  std::vector<std::unique_ptr<Expression>> query_exprs;
   for (int i = static_cast<int>(select_sql.attributes.size()) - 1; i >= 0; i--) {
     const RelAttrSqlNode &relation_attr = select_sql.attributes[i];
+    const size_t field_begin = query_fields.size();
+
+    if (!relation_attr.aggregation.empty()) {
+      std::unique_ptr<Expression> aggregate_expr;
+      RC rc = create_aggregate_expr(db, tables, table_map, relation_attr, with_table_name, query_fields, aggregate_expr);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+      query_exprs.emplace_back(std::move(aggregate_expr));
+      continue;
 
-    if (common::is_blank(relation_attr.relation_name.c_str()) &&
+    } else if (common::is_blank(relation_attr.relation_name.c_str()) &&
         0 == strcmp(relation_attr.attribute_name.c_str(), "*")) {
       for (Table *table : tables) {
         wildcard_fields(table, query_fields);
@@ -121,6 +228,84 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
 
       query_fields.push_back(Field(table, field_meta));
     }
+
+    if (has_aggregation) {
+      for (size_t j = field_begin; j < query_fields.size(); j++) {
+        query_exprs.emplace_back(new FieldExpr(query_fields[j]));
+        query_exprs.back()->set_name(field_expr_name(query_fields[j], with_table_name));
+      }
+    }
+  }
+
+  // 有聚合时，查询列表中不是聚合函数的字段必须出现在分组中
+  std::vector<Field> group_by_fields;
+  for (const RelAttrSqlNode &relation_attr : select_sql.group_by) {
+    Field field;
+    RC rc = RC::INVALID_ARGUMENT;
+    if (relation_attr.aggregation.empty()) {
+      rc = find_field(db, tables, table_map, relation_attr, field);
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("invalid group by field. field=%s", relation_attr.attribute_name.c_str());
+      return rc;
+    }
+    group_by_fields.push_back(field);
+  }
+  query_fields.insert(query_fields.end(), group_by_fields.begin(), group_by_fields.end());
+
+  for (const std::unique_ptr<Expression> &expr : query_exprs) {
+    if (expr->type() != ExprType::FIELD) {
+      continue;
+    }
+    const Field &field = static_cast<FieldExpr &>(*expr).field();
+    auto iter = std::find_if(group_by_fields.begin(), group_by_fields.end(), [&field](const Field &other) {
+      return other.table() == field.table() && other.meta() == field.meta();
+    });
+    if (iter == group_by_fields.end()) {
+      LOG_WARN("field %s is neither aggregated nor in group by", expr->name().c_str());
+      return RC::INVALID_ARGUMENT;
+    }
+  }
+
+  // 有聚合时排序在聚合之后，只能使用查询列表中的项
+  std::vector<std::unique_ptr<Expression>> order_by_exprs;
+  std::vector<bool> order_by_asc;
+  for (const OrderBySqlNode &order_by : select_sql.order_by) {
+    std::unique_ptr<Expression> expr;
+    RC rc = RC::INVALID_ARGUMENT;
+    if (!order_by.attr.aggregation.empty()) {
+      std::vector<Field> aggregate_fields;
+      if (has_aggregation) {
+        rc = create_aggregate_expr(db, tables, table_map, order_by.attr, with_table_name, aggregate_fields, expr);
+      }
+    } else {
+      Field field;
+      rc = find_field(db, tables, table_map, order_by.attr, field);
+      if (rc == RC::SUCCESS) {
+        expr = std::make_unique<FieldExpr>(field);
+        expr->set_name(field_expr_name(field, with_table_name));
+      }
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("invalid order by item. attr=%s", order_by.attr.attribute_name.c_str());
+      return rc;
+    }
+
+    if (has_aggregation) {
+      auto iter = std::find_if(query_exprs.begin(), query_exprs.end(),
+          [&expr](const std::unique_ptr<Expression> &query_expr) { return query_expr->name() == expr->name(); });
+      if (iter == query_exprs.end()) {
+        LOG_WARN("order by item %s is not in select list of aggregate query", expr->name().c_str());
+        return RC::INVALID_ARGUMENT;
+      }
+    }
+    order_by_exprs.emplace_back(std::move(expr));
+    order_by_asc.push_back(order_by.asc);
+  }
+
+  if (select_sql.limit < -1 || select_sql.offset < 0) {
+    LOG_WARN("invalid limit or offset. limit=%d, offset=%d", select_sql.limit, select_sql.offset);
+    return RC::INVALID_ARGUMENT;
   }
 
   LOG_INFO("got %d tables in from stmt and %d fields in query stmt", tables.size(), query_fields.size());
@@ -148,6 +333,13 @@ RC SelectStmt::create(Db *db, const SelectSqlNode &select_sql, Stmt *&stmt)
   // TODO add expression copy
   select_stmt->tables_.swap(tables);
   select_stmt->query_fields_.swap(query_fields);
+  select_stmt->has_aggregation_ = has_aggregation;
+  select_stmt->query_exprs_.swap(query_exprs);
+  select_stmt->group_by_fields_.swap(group_by_fields);
+  select_stmt->order_by_exprs_.swap(order_by_exprs);
+  select_stmt->order_by_asc_.swap(order_by_asc);
+  select_stmt->limit_ = select_sql.limit;
+  select_stmt->offset_ = select_sql.offset;
   select_stmt->filter_stmt_ = filter_stmt;
   stmt = select_stmt;
   return RC::SUCCESS;
@@ -19,6 +19,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "common/rc.h"
 #include "sql/stmt/stmt.h"
+#include "sql/expr/expression.h"
 #include "storage/field/field.h"
 
 class FieldMeta;
@@ -49,10 +50,61 @@ public:
   {
     return tables_;
   }
+  /**
+   * @brief 查询的字段
+   * @details 有聚合时是查询列表、聚合函数参数和分组中用到的所有字段，不是输出的列
+   */
   const std::vector<Field> &query_fields() const
   {
     return query_fields_;
   }
+
+  /**
+   * @brief 是否有聚合函数或者GROUP BY
+   */
+  bool has_aggregation() const
+  {
+    return has_aggregation_;
+  }
+
+  /**
+   * @brief 有聚合时查询列表中的每一项，是字段或者聚合函数，生成逻辑计划时会取走
+   */
+  std::vector<std::unique_ptr<Expression>> &query_exprs()
+  {
+    return query_exprs_;
+  }
+
+  const std::vector<Field> &group_by_fields() const
+  {
+    return group_by_fields_;
+  }
+
+  /**
+   * @brief 排序的字段或者聚合函数，与 order_by_asc 一一对应，生成逻辑计划时会取走
+   * @details 有聚合时按照聚合的输出排序，只能是查询列表中出现的项
+   */
+  std::vector<std::unique_ptr<Expression>> &order_by_exprs()
+  {
+    return order_by_exprs_;
+  }
+  const std::vector<bool> &order_by_asc() const
+  {
+    return order_by_asc_;
+  }
+
+  /**
+   * @brief 最多输出的行数，小于0时没有限制
+   */
+  int limit() const
+  {
+    return limit_;
+  }
+  int offset() const
+  {
+    return offset_;
+  }
+
   FilterStmt *filter_stmt() const
   {
     return filter_stmt_;
@@ -60,6 +112,13 @@ public:
 
 private:
   std::vector<Field> query_fields_;
+  bool has_aggregation_ = false;
+  std::vector<std::unique_ptr<Expression>> query_exprs_;
+  std::vector<Field> group_by_fields_;
+  std::vector<std::unique_ptr<Expression>> order_by_exprs_;
+  std::vector<bool> order_by_asc_;
+  int limit_ = -1;
+  int offset_ = 0;
   std::vector<Table *> tables_;
   FilterStmt *filter_stmt_ = nullptr;
 };
@@ -0,0 +1,41 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+
+#pragma once
+
+#include "sql/stmt/stmt.h"
+
+class Db;
+class Table;
+
+/**
+ * @brief 查看表的统计信息的语句
+ * @ingroup Statement
+ */
+class ShowStatsStmt : public Stmt
+{
+public:
+  ShowStatsStmt(Table *table) : table_(table) {}
+  virtual ~ShowStatsStmt() = default;
+
+  StmtType type() const override { return StmtType::SHOW_STATS; }
+
+  Table *table() const { return table_; }
+
+  static RC create(Db *db, const ShowStatsSqlNode &show_stats, Stmt *&stmt);
+
+private:
+  Table *table_ = nullptr;
+};
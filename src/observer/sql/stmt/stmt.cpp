@@ -21,6 +21,8 @@ See the Mulan PSL v2 for more details. */
 #include "sql/stmt/create_index_stmt.h"
 #include "sql/stmt/create_table_stmt.h"
 #include "sql/stmt/desc_table_stmt.h"
+#include "sql/stmt/analyze_table_stmt.h"
+#include "sql/stmt/show_stats_stmt.h"
 #include "sql/stmt/help_stmt.h"
 #include "sql/stmt/show_tables_stmt.h"
 #include "sql/stmt/trx_begin_stmt.h"
@@ -61,6 +63,14 @@ RC Stmt::create_stmt(Db *db, ParsedSqlNode &sql_node, Stmt *&stmt)
       return DescTableStmt::create(db, sql_node.desc_table, stmt);
     }
 
+    case SCF_ANALYZE_TABLE: {
+      return AnalyzeTableStmt::create(db, sql_node.analyze_table, stmt);
+    }
+
+    case SCF_SHOW_STATS: {
+      return ShowStatsStmt::create(db, sql_node.show_stats, stmt);
+    }
+
     case SCF_HELP: {
       return HelpStmt::create(stmt);
     }
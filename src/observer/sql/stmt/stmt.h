@@ -42,6 +42,8 @@ class Db;
   DEFINE_ENUM_ITEM(SYNC)            \
   DEFINE_ENUM_ITEM(SHOW_TABLES)     \
   DEFINE_ENUM_ITEM(DESC_TABLE)      \
+  DEFINE_ENUM_ITEM(ANALYZE_TABLE)   \
+  DEFINE_ENUM_ITEM(SHOW_STATS)      \
   DEFINE_ENUM_ITEM(BEGIN)           \
   DEFINE_ENUM_ITEM(COMMIT)          \
   DEFINE_ENUM_ITEM(ROLLBACK)        \
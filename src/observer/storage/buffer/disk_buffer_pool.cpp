@@ -13,12 +13,14 @@ See the Mulan PSL v2 for more details. */
 //
 #include <errno.h>
 #include <string.h>
+#include <algorithm>
 
 #include "storage/buffer/disk_buffer_pool.h"
 #include "common/lang/mutex.h"
 #include "common/log/log.h"
 #include "common/os/os.h"
 #include "common/io/io.h"
+#include "storage/index/index_log.h"
 
 using namespace common;
 using namespace std;
@@ -182,9 +184,13 @@ BufferPoolIterator::BufferPoolIterator()
 {}
 BufferPoolIterator::~BufferPoolIterator()
 {}
-RC BufferPoolIterator::init(DiskBufferPool &bp, PageNum start_page /* = 0 */)
+RC BufferPoolIterator::init(DiskBufferPool &bp, PageNum start_page /* = 0 */, PageNum end_page /* = -1 */)
 {
-  bitmap_.init(bp.file_header_->bitmap, bp.file_header_->page_count);
+  PageNum page_count = bp.file_header_->page_count;
+  if (end_page >= 0 && end_page < page_count) {
+    page_count = end_page;
+  }
+  bitmap_.init(bp.file_header_->bitmap, page_count);
   if (start_page <= 0) {
     current_page_num_ = 0;
   } else {
@@ -297,6 +303,8 @@ RC DiskBufferPool::get_this_page(PageNum page_num, Frame **frame)
   RC rc = RC::SUCCESS;
   *frame = nullptr;
 
+  std::scoped_lock lock_guard(lock_); // 直接加了一把大锁，其实可以根据访问的页面来细化提高并行度
+
   Frame *used_match_frame = frame_manager_.get(file_desc_, page_num);
   if (used_match_frame != nullptr) {
     used_match_frame->access();
@@ -304,8 +312,6 @@ RC DiskBufferPool::get_this_page(PageNum page_num, Frame **frame)
     return RC::SUCCESS;
   }
 
-  std::scoped_lock lock_guard(lock_); // 直接加了一把大锁，其实可以根据访问的页面来细化提高并行度
-
   // Allocate one page and load the data into this page
   Frame *allocated_frame = nullptr;
   rc = allocate_frame(page_num, &allocated_frame);
@@ -497,6 +503,14 @@ RC DiskBufferPool::flush_page_internal(Frame &frame)
   // so it is easier to flush data to file.
 
   Page &page = frame.page();
+  if (log_handler_ != nullptr) {
+    RC rc = log_handler_->sync(page.lsn);
+    if (rc != RC::SUCCESS) {
+      LOG_ERROR("Failed to sync log before flushing page %d of %s. rc=%s", page.page_num, file_name_.c_str(), strrc(rc));
+      return rc;
+    }
+  }
+
   int64_t offset = ((int64_t)page.page_num) * sizeof(Page);
   if (lseek(file_desc_, offset, SEEK_SET) == offset - 1) {
     LOG_ERROR("Failed to flush page %lld of %d due to failed to seek %s.", offset, file_desc_, strerror(errno));
@@ -536,7 +550,8 @@ RC DiskBufferPool::recover_page(PageNum page_num)
   if (!(file_header_->bitmap[byte] & (1 << bit))) {
     file_header_->bitmap[byte] |= (1 << bit);
     file_header_->allocated_pages++;
-    file_header_->page_count++;
+    // 页面可能是释放以后又重新分配的，这时候文件的页面数不会变化
+    file_header_->page_count = std::max(file_header_->page_count, page_num + 1);
     hdr_frame_->mark_dirty();
   }
   return RC::SUCCESS;
@@ -611,6 +626,11 @@ int DiskBufferPool::file_desc() const
 {
   return file_desc_;
 }
+
+PageNum DiskBufferPool::page_count() const
+{
+  return file_header_->page_count;
+}
 ////////////////////////////////////////////////////////////////////////////////
 BufferPoolManager::BufferPoolManager(int memory_size /* = 0 */)
 {
@@ -36,6 +36,7 @@ See the Mulan PSL v2 for more details. */
 
 class BufferPoolManager;
 class DiskBufferPool;
+class IndexLogHandler;
 
 /**
  * @brief BufferPool 的实现
@@ -170,7 +171,11 @@ public:
   BufferPoolIterator();
   ~BufferPoolIterator();
 
-  RC init(DiskBufferPool &bp, PageNum start_page = 0);
+  /**
+   * @brief 从start_page之后的页面开始遍历
+   * @param end_page 遍历到这个页面之前为止，小于0时遍历到文件结尾
+   */
+  RC init(DiskBufferPool &bp, PageNum start_page = 0, PageNum end_page = -1);
   bool has_next();
   PageNum next();
   RC reset();
@@ -248,6 +253,11 @@ public:
 
   int file_desc() const;
 
+  /**
+   * @brief 文件中的页面个数，包括已经释放的页面，所有的页号都小于这个值
+   */
+  PageNum page_count() const;
+
   /**
    * 如果页面是脏的，就将数据刷新到磁盘
    */
@@ -263,6 +273,14 @@ public:
    */
   RC recover_page(PageNum page_num);
 
+  /**
+   * @brief 设置页面的日志处理器
+   * @details 设置以后，页面写入磁盘之前，会先保证页面上最后一次修改的日志已经写入磁盘(WAL)。
+   * 当前只有索引文件会设置。
+   */
+  void set_log_handler(IndexLogHandler *log_handler) { log_handler_ = log_handler; }
+  IndexLogHandler *log_handler() const { return log_handler_; }
+
 protected:
   RC allocate_frame(PageNum page_num, Frame **buf);
 
@@ -291,6 +309,7 @@ private:
   Frame *              hdr_frame_ = nullptr;
   BPFileHeader *       file_header_ = nullptr;
   std::set<PageNum>    disposed_pages_;
+  IndexLogHandler *    log_handler_ = nullptr;
 
   common::Mutex        lock_;
 private:
@@ -12,6 +12,7 @@ See the Mulan PSL v2 for more details. */
 // Created by huhaosheng.hhs on 2022
 //
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -19,6 +20,8 @@ See the Mulan PSL v2 for more details. */
 #include "storage/clog/clog.h"
 #include "common/global_context.h"
 #include "storage/trx/trx.h"
+#include "storage/db/db.h"
+#include "storage/table/table.h"
 #include "common/io/io.h"
 
 using namespace std;
@@ -75,8 +78,9 @@ const int32_t CLogRecordData::HEADER_SIZE = sizeof(CLogRecordData) - sizeof(CLog
 
 CLogRecordData::~CLogRecordData()
 {
-  if (data_ == nullptr) {
+  if (data_ != nullptr) {
     delete[] data_;
+    data_ = nullptr;
   }
 }
 string CLogRecordData::to_string() const
@@ -204,7 +208,7 @@ CLogBuffer::CLogBuffer()
 CLogBuffer::~CLogBuffer()
 {}
 
-RC CLogBuffer::append_log_record(CLogRecord *log_record)
+RC CLogBuffer::append_log_record(CLogRecord *log_record, LSN *lsn /* = nullptr */)
 {
   if (nullptr == log_record) {
     return RC::INVALID_ARGUMENT;
@@ -216,16 +220,29 @@ RC CLogBuffer::append_log_record(CLogRecord *log_record)
   }
 
   lock_guard<Mutex> lock_guard(lock_);
+  // 在锁内分配LSN，保证日志在文件中的顺序与LSN的顺序一致
+  log_record->set_lsn(++current_lsn_);
+  if (lsn != nullptr) {
+    *lsn = current_lsn_;
+  }
   log_records_.emplace_back(log_record);
   total_size_ += log_record->logrec_len();
   LOG_DEBUG("append log. log_record={%s}", log_record->to_string().c_str());
   return RC::SUCCESS;
 }
 
+void CLogBuffer::reset_lsn(LSN lsn)
+{
+  lock_guard<Mutex> lock_guard(lock_);
+  current_lsn_ = lsn;
+  flushed_lsn_ = lsn;
+}
+
 RC CLogBuffer::flush_buffer(CLogFile &log_file)
 {
   RC rc = RC::SUCCESS;
   int count = 0;
+  LSN last_lsn = flushed_lsn_;
   while (!log_records_.empty()) {
     lock_.lock();
     if (log_records_.empty()) {
@@ -245,11 +262,16 @@ RC CLogBuffer::flush_buffer(CLogFile &log_file)
 
     lock_.unlock();
     total_size_ -= log_record->logrec_len();
+    last_lsn = std::max(last_lsn, log_record->lsn());
     count++;
   }
 
-  LOG_WARN("flush log buffer done. write log record number=%d", count);
-  return log_file.sync();
+  LOG_TRACE("flush log buffer done. write log record number=%d", count);
+  rc = log_file.sync();
+  if (OB_SUCC(rc) && last_lsn > flushed_lsn_) {
+    flushed_lsn_ = last_lsn;
+  }
+  return rc;
 }
 
 RC CLogBuffer::write_log_record(CLogFile &log_file, CLogRecord *log_record)
@@ -482,12 +504,23 @@ RC CLogManager::rollback_trx(int32_t trx_id)
   return append_log(CLogRecord::build_mtr_record(CLogType::MTR_ROLLBACK, trx_id));
 }
 
-RC CLogManager::append_log(CLogRecord *log_record)
+RC CLogManager::append_log(CLogRecord *log_record, LSN *lsn /* = nullptr */)
 {
   if (nullptr == log_record) {
     return RC::INVALID_ARGUMENT;
   }
-  return log_buffer_->append_log_record(log_record);
+
+  RC rc = log_buffer_->append_log_record(log_record, lsn);
+  if (rc == RC::LOGBUF_FULL) {
+    rc = sync();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to flush log buffer. rc=%s", strrc(rc));
+      delete log_record;
+      return rc;
+    }
+    rc = log_buffer_->append_log_record(log_record, lsn);
+  }
+  return rc;
 }
 
 RC CLogManager::sync()
@@ -495,6 +528,14 @@ RC CLogManager::sync()
   return log_buffer_->flush_buffer(*log_file_);
 }
 
+RC CLogManager::sync_to(LSN lsn)
+{
+  if (lsn <= log_buffer_->flushed_lsn()) {
+    return RC::SUCCESS;
+  }
+  return sync();
+}
+
 RC CLogManager::recover(Db *db)
 {
   CLogRecordIterator log_record_iterator;
@@ -509,10 +550,31 @@ RC CLogManager::recover(Db *db)
 
   /// 遍历所有的日志，然后做redo
   // 在做redo时，需要记录处理的事务。在所有的日志都重做完成时，如果有事务没有结束，那这些事务就需要回滚
+  LSN max_lsn = 0;
   for (rc = log_record_iterator.next(); OB_SUCC(rc) && log_record_iterator.valid(); rc = log_record_iterator.next()) {
     const CLogRecord &log_record = log_record_iterator.log_record();
     LOG_TRACE("begin to redo log={%s}", log_record.to_string().c_str());
+    max_lsn = std::max(max_lsn, log_record.lsn());
     switch (log_record.log_type()) {
+      case CLogType::INDEX_PAGE:
+      case CLogType::INDEX_WRITE:
+      case CLogType::INDEX_INSERT:
+      case CLogType::INDEX_DELETE: {
+        // 索引页面的日志不属于任何事务。表可能已经删除了，这时候直接忽略
+        const CLogRecordData &data_record = log_record.data_record();
+        Table *table = db->find_table(data_record.table_id_);
+        if (nullptr == table) {
+          LOG_TRACE("skip index log of a dropped table. log_record={%s}", log_record.to_string().c_str());
+          break;
+        }
+
+        rc = table->redo_index(log_record);
+        if (OB_FAIL(rc)) {
+          LOG_WARN("failed to redo index log. log_record={%s}, rc=%s", log_record.to_string().c_str(), strrc(rc));
+          return rc;
+        }
+      } break;
+
       case CLogType::MTR_BEGIN: {
         Trx *trx = trx_manager->create_trx(log_record.trx_id());
         if (trx == nullptr) {
@@ -564,13 +626,38 @@ RC CLogManager::recover(Db *db)
 
   LOG_TRACE("recover redo log done");
 
+  // 新的日志从最大的LSN继续编号，已经读到的日志都在磁盘上了
+  log_buffer_->reset_lsn(max_lsn);
+
+  // 索引在内存中缓存了一些元数据(比如根节点)，重做以后需要重新加载
+  vector<string> table_names;
+  db->all_tables(table_names);
+  for (const string &table_name : table_names) {
+    rc = db->find_table(table_name.c_str())->finish_redo();
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to finish redo. table=%s, rc=%s", table_name.c_str(), strrc(rc));
+      return rc;
+    }
+  }
+
   vector<Trx *> uncommitted_trxes;
   trx_manager->all_trxes(uncommitted_trxes);
   LOG_INFO("find %d uncommitted trx", uncommitted_trxes.size());
   for (Trx *trx : uncommitted_trxes) {
+    const int32_t trx_id = trx->id();
     trx->rollback();
     trx_manager->destroy_trx(trx);
+
+    // 回滚以后记录的位置可能会被其它事务重用，如果下次恢复时又回滚一次，就会删掉别人的数据
+    rc = rollback_trx(trx_id);
+    if (OB_FAIL(rc)) {
+      LOG_WARN("failed to append rollback log. trx id=%d, rc=%s", trx_id, strrc(rc));
+      return rc;
+    }
   }
 
-  return RC::SUCCESS;
+  if (!uncommitted_trxes.empty()) {
+    rc = sync();
+  }
+  return rc;
 }
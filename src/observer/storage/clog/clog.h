@@ -48,6 +48,8 @@ class Db;
  * @details 除了事务操作相关的类型，比如MTR_BEGIN/MTR_COMMIT等，都是需要事务自己去处理的。
  * 也就是说，像INSERT、DELETE等是事务自己处理的，其实这种类型的日志不需要在这里定义，而是在各个
  * 事务模型中定义，由各个事务模型自行处理。
+ * INDEX_XXX 是索引页面的重做日志，不属于任何事务，恢复时由日志管理器直接交给对应的索引处理，
+ * 参考 IndexLogHandler。
  */
 #define DEFINE_CLOG_TYPE_ENUM         \
   DEFINE_CLOG_TYPE(ERROR)             \
@@ -55,7 +57,11 @@ class Db;
   DEFINE_CLOG_TYPE(MTR_COMMIT)        \
   DEFINE_CLOG_TYPE(MTR_ROLLBACK)      \
   DEFINE_CLOG_TYPE(INSERT)            \
-  DEFINE_CLOG_TYPE(DELETE)
+  DEFINE_CLOG_TYPE(DELETE)            \
+  DEFINE_CLOG_TYPE(INDEX_PAGE)        \
+  DEFINE_CLOG_TYPE(INDEX_WRITE)       \
+  DEFINE_CLOG_TYPE(INDEX_INSERT)      \
+  DEFINE_CLOG_TYPE(INDEX_DELETE)
 
 enum class CLogType 
 { 
@@ -87,7 +93,7 @@ CLogType clog_type_from_integer(int32_t value);
  */
 struct CLogRecordHeader 
 {
-  int32_t lsn_ = -1;     ///< log sequence number。当前没有使用
+  int32_t lsn_ = -1;     ///< log sequence number。追加到日志缓存时分配，单调递增
   int32_t trx_id_ = -1;  ///< 日志所属事务的编号
   int32_t type_ = clog_type_to_integer(CLogType::ERROR); ///< 日志类型
   int32_t logrec_len_ = 0;  ///< record的长度，不包含header长度
@@ -208,6 +214,8 @@ public:
 
   CLogType log_type() const  { return clog_type_from_integer(header_.type_); }
   int32_t  trx_id() const { return header_.trx_id_; }
+  LSN      lsn() const { return header_.lsn_; }
+  void     set_lsn(LSN lsn) { header_.lsn_ = lsn; }
   int32_t  logrec_len() const { return header_.logrec_len_; }
 
   CLogRecordHeader &header() { return header_; }
@@ -242,9 +250,10 @@ public:
 
   /**
    * @brief 增加一条日志
-   * @details 如果当前的日志达到一定量，就会刷新数据
+   * @details 同时给日志分配LSN。缓存满了返回LOGBUF_FULL，需要调用者先刷新数据
+   * @param[out] lsn 分配给这条日志的LSN，可以为空
    */
-  RC append_log_record(CLogRecord *log_record);
+  RC append_log_record(CLogRecord *log_record, LSN *lsn = nullptr);
 
   /**
    * @brief 将当前的日志都刷新到日志文件中
@@ -253,6 +262,16 @@ public:
    */
   RC flush_buffer(CLogFile &log_file);
 
+  /**
+   * @brief 已经写入并同步到日志文件中的最大LSN
+   */
+  LSN flushed_lsn() const { return flushed_lsn_.load(); }
+
+  /**
+   * @brief 恢复完成以后，从日志中最大的LSN继续分配
+   */
+  void reset_lsn(LSN lsn);
+
 private:
   /**
    * @brief 将日志记录写入到日志文件中
@@ -266,6 +285,8 @@ private:
   common::Mutex lock_;  ///< 加锁支持多线程并发写入
   std::deque<std::unique_ptr<CLogRecord>> log_records_;  ///< 当前等待刷数据的日志记录
   std::atomic_int32_t total_size_;  ///< 当前缓存中的日志记录的总大小
+  LSN current_lsn_ = 0;             ///< 最近分配的LSN，使用lock_保护
+  std::atomic<LSN> flushed_lsn_{0}; ///< 已经持久化的最大LSN
 };
 
 /**
@@ -401,18 +422,27 @@ public:
 
   /**
    * @brief 也可以调用这个函数直接增加一条日志
+   * @details 日志缓存满了会先刷新到磁盘再重试
+   * @param[out] lsn 分配给这条日志的LSN，可以为空
    */
-  RC append_log(CLogRecord *log_record);
+  RC append_log(CLogRecord *log_record, LSN *lsn = nullptr);
 
   /**
    * @brief 刷新日志到磁盘
    */
   RC sync();
 
+  /**
+   * @brief 保证LSN不大于lsn的日志都已经写入磁盘
+   * @details 写索引页面之前调用(WAL)，页面上最后一次修改的日志必须先落盘
+   */
+  RC sync_to(LSN lsn);
+
   /**
    * @brief 重做
-   * @details 当前会重做所有日志。也就是说，所有buffer pool页面都不会写入到磁盘中，
-   * 否则可能无法恢复成功。
+   * @details 当前会重做所有日志。数据记录的重做是幂等的；索引页面的日志会与页面上的LSN比较，
+   * 已经写入到磁盘的修改直接跳过，所以索引不需要在恢复时重建。
+   * 最后回滚所有没有结束的事务，并记录回滚日志，避免下次恢复时再次回滚。
    */
   RC recover(Db *db);
 
@@ -13,6 +13,7 @@ See the Mulan PSL v2 for more details. */
 
 #include "common/defs.h"
 #include "storage/common/meta_util.h"
+#include "json/json.h"
 
 std::string table_meta_file(const char *base_dir, const char *table_name)
 {
@@ -27,3 +28,40 @@ std::string table_index_file(const char *base_dir, const char *table_name, const
 {
   return std::string(base_dir) + common::FILE_PATH_SPLIT_STR + table_name + "-" + index_name + TABLE_INDEX_SUFFIX;
 }
+
+void value_to_json(const Value &value, Json::Value &json_value)
+{
+  switch (value.attr_type()) {
+    case INTS: json_value = value.get_int(); break;
+    case FLOATS: json_value = value.get_float(); break;
+    default: json_value = value.get_string(); break;
+  }
+}
+
+bool value_from_json(const Json::Value &json_value, AttrType attr_type, Value &value)
+{
+  switch (attr_type) {
+    case INTS: {
+      if (!json_value.isInt()) {
+        return false;
+      }
+      value.set_int(json_value.asInt());
+    } break;
+    case FLOATS: {
+      if (!json_value.isNumeric()) {
+        return false;
+      }
+      value.set_float(json_value.asFloat());
+    } break;
+    case CHARS: {
+      if (!json_value.isString()) {
+        return false;
+      }
+      value.set_string(json_value.asCString());
+    } break;
+    default: {
+      return false;
+    }
+  }
+  return true;
+}
@@ -15,6 +15,12 @@ See the Mulan PSL v2 for more details. */
 
 #include <string>
 
+#include "sql/parser/value.h"
+
+namespace Json {
+class Value;
+}  // namespace Json
+
 static constexpr const char *TABLE_META_SUFFIX = ".table";
 static constexpr const char *TABLE_META_FILE_PATTERN = ".*\\.table$";
 static constexpr const char *TABLE_DATA_SUFFIX = ".data";
@@ -23,3 +29,9 @@ static constexpr const char *TABLE_INDEX_SUFFIX = ".index";
 std::string table_meta_file(const char *base_dir, const char *table_name);
 std::string table_data_file(const char *base_dir, const char *table_name);
 std::string table_index_file(const char *base_dir, const char *table_name, const char *index_name);
+
+/**
+ * @brief 元数据中保存的常量值。值的类型由元数据中的其它信息决定，这里不保存
+ */
+void value_to_json(const Value &value, Json::Value &json_value);
+bool value_from_json(const Json::Value &json_value, AttrType attr_type, Value &value);
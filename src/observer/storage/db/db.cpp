@@ -68,6 +68,17 @@ RC Db::init(const char *name, const char *dbpath)
     return rc;
   }
 
+  // 只有MVCC会记录数据日志，索引日志也只在这种情况下才有意义
+  if (log_enabled()) {
+    for (auto &iter : opened_tables_) {
+      rc = iter.second->enable_log(clog_manager_.get());
+      if (OB_FAIL(rc)) {
+        LOG_WARN("failed to enable log. table=%s, rc=%s", iter.first.c_str(), strrc(rc));
+        return rc;
+      }
+    }
+  }
+
   rc = recover();
   if (OB_FAIL(rc)) {
     LOG_WARN("failed to recover db. dbpath=%s, rc=%s", dbpath, strrc(rc));
@@ -96,6 +107,15 @@ RC Db::create_table(const char *table_name, int attribute_count, const AttrInfoS
     return rc;
   }
 
+  if (log_enabled()) {
+    rc = table->enable_log(clog_manager_.get());
+    if (rc != RC::SUCCESS) {
+      LOG_ERROR("Failed to enable log of table %s.", table_name);
+      delete table;
+      return rc;
+    }
+  }
+
   opened_tables_[table_name] = table;
   LOG_INFO("Create table success. table name=%s, table_id:%d", table_name, table_id);
   return RC::SUCCESS;
@@ -185,6 +205,12 @@ RC Db::sync()
   return rc;
 }
 
+bool Db::log_enabled() const
+{
+  TrxKit *trx_kit = TrxKit::instance();
+  return trx_kit != nullptr && trx_kit->type() == TrxKit::MVCC;
+}
+
 RC Db::recover()
 {
   return clog_manager_->recover(this);
@@ -63,6 +63,11 @@ public:
 private:
   RC open_all_tables();
 
+  /**
+   * @brief 是否需要记录索引日志
+   */
+  bool log_enabled() const;
+
 private:
   std::string name_;
   std::string path_;
@@ -0,0 +1,588 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+
+#include "storage/index/bitmap_index.h"
+#include "common/log/log.h"
+
+using namespace std;
+using namespace common;
+
+static constexpr PageNum BITMAP_HEADER_PAGE = 1;
+
+static_assert(sizeof(BitmapContainerPageHeader) + RoaringContainer::CONTAINER_BYTES <= BP_PAGE_DATA_SIZE,
+              "bitmap container should fit in one page");
+
+static BitmapListPageHeader *list_page_header(Frame *frame)
+{
+  return reinterpret_cast<BitmapListPageHeader *>(frame->data());
+}
+
+static char *list_page_items(Frame *frame)
+{
+  return frame->data() + sizeof(BitmapListPageHeader);
+}
+
+static int list_page_capacity(int item_size)
+{
+  return static_cast<int>((BP_PAGE_DATA_SIZE - sizeof(BitmapListPageHeader)) / item_size);
+}
+
+/**
+ * @brief 容器目录中的数据项
+ */
+struct BitmapContainerItem
+{
+  uint32_t key;
+  PageNum  page_num;
+};
+
+BitmapIndex::~BitmapIndex() noexcept
+{
+  close();
+}
+
+RC BitmapIndex::create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta)
+{
+  if (disk_buffer_pool_ != nullptr) {
+    LOG_WARN("Failed to create index due to the index has been created before. file_name:%s, index:%s, field:%s",
+        file_name, index_meta.name(), index_meta.field());
+    return RC::RECORD_OPENNED;
+  }
+
+  Index::init(index_meta, field_meta);
+
+  BufferPoolManager &bpm = BufferPoolManager::instance();
+  RC rc = bpm.create_file(file_name);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to create file. file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+
+  DiskBufferPool *bp = nullptr;
+  rc = bpm.open_file(file_name, bp);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to open file. file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+  disk_buffer_pool_ = bp;
+
+  memset(&file_header_, 0, sizeof(file_header_));
+  file_header_.attr_length = field_meta.len();
+  file_header_.attr_type = field_meta.type();
+  file_header_.value_count = 0;
+
+  // 新文件别人还访问不到，不需要加锁
+  LatchMemo latch_memo(bp);
+  Frame *header_frame = nullptr;
+  rc = latch_memo.allocate_page(header_frame);
+  if (rc != RC::SUCCESS || header_frame->page_num() != BITMAP_HEADER_PAGE) {
+    LOG_WARN("failed to allocate header page for bitmap index. file=%s, rc=%s", file_name, strrc(rc));
+    latch_memo.release();
+    close();
+    return rc != RC::SUCCESS ? rc : RC::INTERNAL;
+  }
+
+  Frame *value_frame = nullptr;
+  rc = allocate_list_page(latch_memo, value_frame);
+  if (rc != RC::SUCCESS) {
+    latch_memo.release();
+    close();
+    return rc;
+  }
+  file_header_.first_value_page = value_frame->page_num();
+  file_header_.last_value_page = value_frame->page_num();
+
+  rc = write_header(latch_memo);
+  if (rc != RC::SUCCESS) {
+    latch_memo.release();
+    close();
+    return rc;
+  }
+
+  LOG_INFO("Successfully create bitmap index, file_name:%s, index:%s, field:%s",
+      file_name, index_meta.name(), index_meta.field());
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta)
+{
+  if (disk_buffer_pool_ != nullptr) {
+    LOG_WARN("Failed to open index due to the index has been inited before. file_name:%s, index:%s, field:%s",
+        file_name, index_meta.name(), index_meta.field());
+    return RC::RECORD_OPENNED;
+  }
+
+  Index::init(index_meta, field_meta);
+
+  BufferPoolManager &bpm = BufferPoolManager::instance();
+  DiskBufferPool *bp = nullptr;
+  RC rc = bpm.open_file(file_name, bp);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to open file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+  disk_buffer_pool_ = bp;
+
+  LatchMemo latch_memo(bp);
+  Frame *frame = nullptr;
+  rc = latch_memo.get_page(BITMAP_HEADER_PAGE, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to get header page. file name=%s, rc=%s", file_name, strrc(rc));
+    latch_memo.release();
+    close();
+    return rc;
+  }
+  memcpy(&file_header_, frame->data(), sizeof(file_header_));
+  latch_memo.release_frame(frame);
+
+  rc = load_values(latch_memo);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to load values of bitmap index. file name=%s, rc=%s", file_name, strrc(rc));
+    latch_memo.release();
+    close();
+    return rc;
+  }
+
+  LOG_INFO("Successfully open bitmap index, file_name:%s, index:%s, field:%s, values:%d",
+      file_name, index_meta.name(), index_meta.field(), file_header_.value_count);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::close()
+{
+  if (disk_buffer_pool_ != nullptr) {
+    LOG_INFO("Begin to close bitmap index, index:%s, field:%s", index_meta_.name(), index_meta_.field());
+    disk_buffer_pool_->close_file();
+    disk_buffer_pool_ = nullptr;
+  }
+  values_.clear();
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::sync()
+{
+  return disk_buffer_pool_->flush_all_pages();
+}
+
+RC BitmapIndex::finish_redo()
+{
+  lock_guard<SharedMutex> guard(lock_);
+  LatchMemo latch_memo(disk_buffer_pool_);
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(BITMAP_HEADER_PAGE, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to get header page. index=%s, rc=%s", index_meta_.name(), strrc(rc));
+    return rc;
+  }
+  memcpy(&file_header_, frame->data(), sizeof(file_header_));
+  latch_memo.release_frame(frame);
+
+  values_.clear();
+  return load_values(latch_memo);
+}
+
+RC BitmapIndex::load_values(LatchMemo &latch_memo)
+{
+  const int item_size = value_item_size();
+  PageNum page_num = file_header_.first_value_page;
+  while (page_num != BP_INVALID_PAGE_NUM) {
+    Frame *frame = nullptr;
+    RC rc = latch_memo.get_page(page_num, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch value page. page num=%d, rc=%s", page_num, strrc(rc));
+      return rc;
+    }
+
+    const BitmapListPageHeader *header = list_page_header(frame);
+    for (int i = 0; i < header->count; i++) {
+      const char *item = list_page_items(frame) + i * item_size;
+      string key(item, file_header_.attr_length);
+      PageNum dir_page = BP_INVALID_PAGE_NUM;
+      memcpy(&dir_page, item + file_header_.attr_length, sizeof(dir_page));
+
+      rc = load_containers(latch_memo, dir_page, values_[key]);
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+
+    page_num = header->next_page;
+    latch_memo.release_frame(frame);
+  }
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::load_containers(LatchMemo &latch_memo, PageNum dir_page, ValueInfo &value_info)
+{
+  PageNum page_num = dir_page;
+  while (page_num != BP_INVALID_PAGE_NUM) {
+    Frame *frame = nullptr;
+    RC rc = latch_memo.get_page(page_num, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch container directory page. page num=%d, rc=%s", page_num, strrc(rc));
+      return rc;
+    }
+
+    const BitmapListPageHeader *header = list_page_header(frame);
+    const BitmapContainerItem *items = reinterpret_cast<const BitmapContainerItem *>(list_page_items(frame));
+    for (int i = 0; i < header->count; i++) {
+      value_info.containers[items[i].key] = items[i].page_num;
+    }
+
+    value_info.last_dir_page = page_num;
+    page_num = header->next_page;
+    latch_memo.release_frame(frame);
+  }
+  return RC::SUCCESS;
+}
+
+bool BitmapIndex::normalize_key(const char *key, int key_len, string &normalized) const
+{
+  const int attr_length = file_header_.attr_length;
+  if (file_header_.attr_type != CHARS) {
+    if (key_len != attr_length) {
+      return false;
+    }
+    normalized.assign(key, attr_length);
+    return true;
+  }
+
+  // 字符串只比较'\0'之前的部分，后面补0
+  const int length = static_cast<int>(strnlen(key, key_len));
+  if (length > attr_length) {
+    return false;
+  }
+  normalized.assign(attr_length, '\0');
+  memcpy(normalized.data(), key, length);
+  return true;
+}
+
+string BitmapIndex::record_key(const char *record) const
+{
+  string key;
+  normalize_key(record + field_meta_.offset(), field_meta_.len(), key);
+  return key;
+}
+
+RC BitmapIndex::allocate_list_page(LatchMemo &latch_memo, Frame *&frame)
+{
+  RC rc = latch_memo.allocate_page(frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to allocate page for bitmap index. rc=%s", strrc(rc));
+    return rc;
+  }
+  BitmapListPageHeader *header = list_page_header(frame);
+  header->next_page = BP_INVALID_PAGE_NUM;
+  header->count = 0;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(BitmapListPageHeader));
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::append_list_item(LatchMemo &latch_memo, PageNum &last_page, const char *item, int item_size)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(last_page, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch list page. page num=%d, rc=%s", last_page, strrc(rc));
+    return rc;
+  }
+
+  BitmapListPageHeader *header = list_page_header(frame);
+  if (header->count >= list_page_capacity(item_size)) {
+    Frame *new_frame = nullptr;
+    rc = allocate_list_page(latch_memo, new_frame);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    header->next_page = new_frame->page_num();
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(BitmapListPageHeader));
+    latch_memo.release_frame(frame);
+
+    frame = new_frame;
+    header = list_page_header(frame);
+    last_page = frame->page_num();
+  }
+
+  char *list_item = list_page_items(frame) + header->count * item_size;
+  memcpy(list_item, item, item_size);
+  header->count++;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, list_item, item_size);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(BitmapListPageHeader));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::create_value(LatchMemo &latch_memo, const string &key, ValueInfo *&value_info)
+{
+  Frame *dir_frame = nullptr;
+  RC rc = allocate_list_page(latch_memo, dir_frame);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  const PageNum dir_page = dir_frame->page_num();
+  latch_memo.release_frame(dir_frame);
+
+  vector<char> item(value_item_size());
+  memcpy(item.data(), key.data(), file_header_.attr_length);
+  memcpy(item.data() + file_header_.attr_length, &dir_page, sizeof(dir_page));
+  rc = append_list_item(latch_memo, file_header_.last_value_page, item.data(), static_cast<int>(item.size()));
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to append value into bitmap index. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  file_header_.value_count++;
+  rc = write_header(latch_memo);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  value_info = &values_[key];
+  value_info->last_dir_page = dir_page;
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::create_container(LatchMemo &latch_memo, ValueInfo &value_info, uint32_t container_key, PageNum &page_num)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.allocate_page(frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to allocate container page. rc=%s", strrc(rc));
+    return rc;
+  }
+  BitmapContainerPageHeader *header = reinterpret_cast<BitmapContainerPageHeader *>(frame->data());
+  header->key = container_key;
+  header->type = static_cast<uint16_t>(RoaringContainer::Type::ARRAY);
+  header->cardinality = 0;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(BitmapContainerPageHeader));
+  page_num = frame->page_num();
+  latch_memo.release_frame(frame);
+
+  BitmapContainerItem item{container_key, page_num};
+  rc = append_list_item(latch_memo, value_info.last_dir_page, reinterpret_cast<const char *>(&item), sizeof(item));
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to append container into directory. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  value_info.containers[container_key] = page_num;
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::read_container(LatchMemo &latch_memo, PageNum page_num, RoaringContainer &container)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(page_num, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch container page. page num=%d, rc=%s", page_num, strrc(rc));
+    return rc;
+  }
+  const BitmapContainerPageHeader *header = reinterpret_cast<const BitmapContainerPageHeader *>(frame->data());
+  container.deserialize(static_cast<RoaringContainer::Type>(header->type), header->cardinality,
+      frame->data() + sizeof(BitmapContainerPageHeader));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::write_container(LatchMemo &latch_memo, PageNum page_num, uint32_t key, const RoaringContainer &container)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(page_num, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch container page. page num=%d, rc=%s", page_num, strrc(rc));
+    return rc;
+  }
+  BitmapContainerPageHeader *header = reinterpret_cast<BitmapContainerPageHeader *>(frame->data());
+  header->key = key;
+  header->type = static_cast<uint16_t>(container.type());
+  header->cardinality = static_cast<uint16_t>(container.cardinality());
+  container.serialize(frame->data() + sizeof(BitmapContainerPageHeader));
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header,
+      static_cast<int>(sizeof(BitmapContainerPageHeader)) + container.serialized_size());
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::write_header(LatchMemo &latch_memo)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(BITMAP_HEADER_PAGE, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch header page of bitmap index. rc=%s", strrc(rc));
+    return rc;
+  }
+  memcpy(frame->data(), &file_header_, sizeof(file_header_));
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, frame->data(), sizeof(file_header_));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndex::insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker)
+{
+  if (rid->slot_num >= (1 << SLOT_BITS) || rid->page_num >= (1 << (32 - SLOT_BITS))) {
+    LOG_WARN("rid is out of range of bitmap index. index=%s, rid=%s", index_meta_.name(), rid->to_string().c_str());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  const string key = record_key(record);
+  const uint32_t row_id = rid_to_row_id(*rid);
+  const uint32_t container_key = RoaringBitmap::container_key(row_id);
+
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.xlatch(&lock_);
+
+  ValueInfo *value_info = nullptr;
+  auto value_iter = values_.find(key);
+  if (value_iter != values_.end()) {
+    value_info = &value_iter->second;
+  } else {
+    RC rc = create_value(latch_memo, key, value_info);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  PageNum container_page = BP_INVALID_PAGE_NUM;
+  auto container_iter = value_info->containers.find(container_key);
+  if (container_iter != value_info->containers.end()) {
+    container_page = container_iter->second;
+  } else {
+    RC rc = create_container(latch_memo, *value_info, container_key, container_page);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  RoaringContainer container;
+  RC rc = read_container(latch_memo, container_page, container);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  if (!container.add(RoaringBitmap::container_value(row_id))) {
+    return RC::RECORD_DUPLICATE_KEY;
+  }
+  return write_container(latch_memo, container_page, container_key, container);
+}
+
+RC BitmapIndex::delete_entry(const char *record, const RID *rid)
+{
+  const string key = record_key(record);
+  const uint32_t row_id = rid_to_row_id(*rid);
+  const uint32_t container_key = RoaringBitmap::container_key(row_id);
+
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.xlatch(&lock_);
+
+  auto value_iter = values_.find(key);
+  if (value_iter == values_.end()) {
+    return RC::RECORD_NOT_EXIST;
+  }
+  auto container_iter = value_iter->second.containers.find(container_key);
+  if (container_iter == value_iter->second.containers.end()) {
+    return RC::RECORD_NOT_EXIST;
+  }
+
+  // 空的容器页面保留下来，后面插入数据时还可以使用
+  RoaringContainer container;
+  RC rc = read_container(latch_memo, container_iter->second, container);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+  if (!container.remove(RoaringBitmap::container_value(row_id))) {
+    return RC::RECORD_NOT_EXIST;
+  }
+  return write_container(latch_memo, container_iter->second, container_key, container);
+}
+
+RC BitmapIndex::get_bitmap(const char *key, int key_len, RoaringBitmap &bitmap)
+{
+  bitmap.clear();
+
+  string normalized;
+  if (!normalize_key(key, key_len, normalized)) {
+    return RC::SUCCESS;
+  }
+
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.slatch(&lock_);
+
+  auto value_iter = values_.find(normalized);
+  if (value_iter == values_.end()) {
+    return RC::SUCCESS;
+  }
+
+  for (const auto &[container_key, page_num] : value_iter->second.containers) {
+    RoaringContainer container;
+    RC rc = read_container(latch_memo, page_num, container);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+    bitmap.append_container(container_key, std::move(container));
+  }
+  return RC::SUCCESS;
+}
+
+IndexScanner *BitmapIndex::create_scanner(const char *left_key, int left_len, bool left_inclusive,
+    const char *right_key, int right_len, bool right_inclusive, bool reverse)
+{
+  (void)reverse;
+  if (left_key == nullptr || right_key == nullptr || !left_inclusive || !right_inclusive || left_len != right_len ||
+      0 != memcmp(left_key, right_key, left_len)) {
+    LOG_WARN("bitmap index only supports equality lookup. index=%s", index_meta_.name());
+    return nullptr;
+  }
+
+  BitmapIndexScanner *index_scanner = new BitmapIndexScanner();
+  RC rc = index_scanner->open(*this, left_key, left_len);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open bitmap index scanner. rc=%s", strrc(rc));
+    delete index_scanner;
+    return nullptr;
+  }
+  return index_scanner;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+RC BitmapIndexScanner::open(BitmapIndex &index, const char *key, int key_len)
+{
+  index.normalize_key(key, key_len, key_);
+  return index.get_bitmap(key, key_len, bitmap_);
+}
+
+RC BitmapIndexScanner::next_entry(RID *rid)
+{
+  uint32_t row_id = 0;
+  if (!iterator_.next(row_id)) {
+    return RC::RECORD_EOF;
+  }
+  *rid = BitmapIndex::row_id_to_rid(row_id);
+  return RC::SUCCESS;
+}
+
+RC BitmapIndexScanner::next_entry(RID *rid, char *key)
+{
+  RC rc = next_entry(rid);
+  if (rc == RC::SUCCESS) {
+    memcpy(key, key_.data(), key_.size());
+  }
+  return rc;
+}
+
+RC BitmapIndexScanner::destroy()
+{
+  delete this;
+  return RC::SUCCESS;
+}
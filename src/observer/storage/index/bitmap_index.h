@@ -0,0 +1,185 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "storage/index/index.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/trx/latch_memo.h"
+#include "common/lang/mutex.h"
+#include "common/lang/roaring_bitmap.h"
+
+/**
+ * @brief 位图索引文件的头部信息，存放在文件的第一个页面中
+ * @ingroup Index
+ */
+struct BitmapIndexFileHeader
+{
+  int32_t  attr_length;       ///< 键值的长度
+  AttrType attr_type;         ///< 键值的类型
+  int32_t  value_count;       ///< 不同键值的个数
+  PageNum  first_value_page;  ///< 键值页面链表的第一个页面
+  PageNum  last_value_page;   ///< 键值页面链表的最后一个页面，新的键值追加在这里
+};
+
+/**
+ * @brief 链表页面的头部
+ * @ingroup Index
+ * @details 键值页面和容器目录页面都使用这个格式，页面中依次存放count个定长的数据项。
+ * 键值页面的数据项是 | key | 容器目录的第一个页面 |，容器目录的数据项是 | 容器的key | 容器页面 |
+ */
+struct BitmapListPageHeader
+{
+  PageNum next_page;  ///< 下一个页面，没有就是BP_INVALID_PAGE_NUM
+  int32_t count;      ///< 当前页面中的数据项数
+};
+
+/**
+ * @brief 容器页面的头部，后面紧跟着容器序列化后的数据
+ * @ingroup Index
+ */
+struct BitmapContainerPageHeader
+{
+  uint32_t key;          ///< 容器的key
+  uint16_t type;         ///< 容器的格式，参考 common::RoaringContainer::Type
+  uint16_t cardinality;  ///< 容器中值的个数，为0时表示容器是空的
+};
+
+/**
+ * @brief 位图索引
+ * @ingroup Index
+ * @details 适合不同值很少的字段，比如状态、类型。每个键值对应一个压缩位图(参考 common::RoaringBitmap)，
+ * 位图中的每一位对应一条记录，多个条件可以直接做位图的交集、并集运算，得到的结果按照记录的物理位置排序。
+ * 每个容器保存在一个页面中，键值和容器的目录在打开索引时加载到内存。
+ * 索引的修改使用一个读写锁保护，写入的并发度比较低，不适合频繁修改的字段。
+ */
+class BitmapIndex : public Index
+{
+public:
+  /// 记录的页内编号占用的位数。记录最少8字节，一个页面中的记录不会超过1024个
+  static constexpr int SLOT_BITS = 10;
+
+public:
+  BitmapIndex() = default;
+  virtual ~BitmapIndex() noexcept;
+
+  RC create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
+  RC open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
+  RC close();
+
+  RC insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker) override;
+  RC delete_entry(const char *record, const RID *rid) override;
+
+  /**
+   * @brief 创建扫描器
+   * @details 只支持等值查询，其它情况返回空。扫描结果按照RID排序
+   */
+  IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+      int right_len, bool right_inclusive, bool reverse) override;
+
+  RC sync() override;
+
+  RC finish_redo() override;
+
+  /**
+   * @brief 获取键值等于key的所有记录的位图
+   * @param key_len key的长度。字符串可能与字段的长度不同，会按照字段长度调整
+   */
+  RC get_bitmap(const char *key, int key_len, common::RoaringBitmap &bitmap);
+
+  /**
+   * @brief 不同键值的个数
+   */
+  int value_count() const { return file_header_.value_count; }
+
+  static uint32_t rid_to_row_id(const RID &rid)
+  {
+    return (static_cast<uint32_t>(rid.page_num) << SLOT_BITS) | static_cast<uint32_t>(rid.slot_num);
+  }
+  static RID row_id_to_rid(uint32_t row_id)
+  {
+    return RID(static_cast<PageNum>(row_id >> SLOT_BITS), static_cast<SlotNum>(row_id & ((1u << SLOT_BITS) - 1)));
+  }
+
+  /**
+   * @brief 把查询使用的键值调整成与索引中相同的格式
+   * @return 键值不可能与任何数据相等时返回false，比如字符串比字段长
+   */
+  bool normalize_key(const char *key, int key_len, std::string &normalized) const;
+
+protected:
+  DiskBufferPool *buffer_pool() const override { return disk_buffer_pool_; }
+
+private:
+  /**
+   * @brief 一个键值在内存中的信息
+   */
+  struct ValueInfo
+  {
+    PageNum                     last_dir_page = BP_INVALID_PAGE_NUM;  ///< 容器目录的最后一个页面
+    std::map<uint32_t, PageNum> containers;                           ///< 容器的key -> 容器页面
+  };
+
+  RC load_values(LatchMemo &latch_memo);
+  RC load_containers(LatchMemo &latch_memo, PageNum dir_page, ValueInfo &value_info);
+
+  RC create_value(LatchMemo &latch_memo, const std::string &key, ValueInfo *&value_info);
+  RC create_container(LatchMemo &latch_memo, ValueInfo &value_info, uint32_t container_key, PageNum &page_num);
+
+  /**
+   * @brief 在链表的最后一个页面中追加数据项，页面满了就分配新的页面
+   * @param[in,out] last_page 链表的最后一个页面
+   */
+  RC append_list_item(LatchMemo &latch_memo, PageNum &last_page, const char *item, int item_size);
+  RC allocate_list_page(LatchMemo &latch_memo, Frame *&frame);
+
+  RC read_container(LatchMemo &latch_memo, PageNum page_num, common::RoaringContainer &container);
+  RC write_container(LatchMemo &latch_memo, PageNum page_num, uint32_t key, const common::RoaringContainer &container);
+  RC write_header(LatchMemo &latch_memo);
+
+  std::string record_key(const char *record) const;
+  int         value_item_size() const { return file_header_.attr_length + static_cast<int>(sizeof(PageNum)); }
+
+private:
+  DiskBufferPool                  *disk_buffer_pool_ = nullptr;
+  BitmapIndexFileHeader            file_header_;
+  std::map<std::string, ValueInfo> values_;  ///< 所有的键值，key是按照字段长度补齐以后的键值
+  common::SharedMutex              lock_;    ///< 修改时加写锁，查询时加读锁
+};
+
+/**
+ * @brief 位图索引的扫描器
+ * @ingroup Index
+ * @details 打开时就把整个位图取出来，按照RID从小到大返回
+ */
+class BitmapIndexScanner : public IndexScanner
+{
+public:
+  BitmapIndexScanner() : iterator_(bitmap_) {}
+  ~BitmapIndexScanner() noexcept override = default;
+
+  RC open(BitmapIndex &index, const char *key, int key_len);
+
+  RC next_entry(RID *rid) override;
+  RC next_entry(RID *rid, char *key) override;
+  RC destroy() override;
+
+private:
+  common::RoaringBitmap           bitmap_;
+  common::RoaringBitmap::Iterator iterator_;
+  std::string                     key_;
+};
@@ -26,15 +26,17 @@ using namespace common;
 int calc_internal_page_capacity(int attr_length)
 {
   int item_size = attr_length + sizeof(RID) + sizeof(PageNum);
+  int high_key_size = attr_length + sizeof(RID);
 
-  int capacity = ((int)BP_PAGE_DATA_SIZE - InternalIndexNode::HEADER_SIZE) / item_size;
+  int capacity = ((int)BP_PAGE_DATA_SIZE - InternalIndexNode::HEADER_SIZE - high_key_size) / item_size;
   return capacity;
 }
 
 int calc_leaf_page_capacity(int attr_length)
 {
   int item_size = attr_length + sizeof(RID) + sizeof(RID);
-  int capacity = ((int)BP_PAGE_DATA_SIZE - LeafIndexNode::HEADER_SIZE) / item_size;
+  int high_key_size = attr_length + sizeof(RID);
+  int capacity = ((int)BP_PAGE_DATA_SIZE - LeafIndexNode::HEADER_SIZE - high_key_size) / item_size;
   return capacity;
 }
 
@@ -52,6 +54,10 @@ void IndexNodeHandler::init_empty(bool leaf)
   node_->is_leaf = leaf;
   node_->key_num = 0;
   node_->parent = BP_INVALID_PAGE_NUM;
+  node_->prev_brother = BP_INVALID_PAGE_NUM;
+  node_->next_brother = BP_INVALID_PAGE_NUM;
+  node_->level = 0;
+  memset(reinterpret_cast<char *>(node_) + IndexNode::HEADER_SIZE, 0, key_size());
 }
 PageNum IndexNodeHandler::page_num() const
 {
@@ -105,6 +111,56 @@ void IndexNodeHandler::set_parent_page_num(PageNum page_num)
   this->node_->parent = page_num;
 }
 
+void IndexNodeHandler::set_prev_page(PageNum page_num)
+{
+  node_->prev_brother = page_num;
+}
+
+PageNum IndexNodeHandler::prev_page() const
+{
+  return node_->prev_brother;
+}
+
+void IndexNodeHandler::set_next_page(PageNum page_num)
+{
+  node_->next_brother = page_num;
+}
+
+PageNum IndexNodeHandler::next_page() const
+{
+  return node_->next_brother;
+}
+
+void IndexNodeHandler::set_level(int level)
+{
+  node_->level = level;
+}
+
+int IndexNodeHandler::level() const
+{
+  return node_->level;
+}
+
+bool IndexNodeHandler::has_high_key() const
+{
+  return node_->next_brother != BP_INVALID_PAGE_NUM;
+}
+
+const char *IndexNodeHandler::high_key() const
+{
+  return reinterpret_cast<const char *>(node_) + IndexNode::HEADER_SIZE;
+}
+
+void IndexNodeHandler::set_high_key(const char *key)
+{
+  memcpy(reinterpret_cast<char *>(node_) + IndexNode::HEADER_SIZE, key, key_size());
+}
+
+bool IndexNodeHandler::need_move_right(const KeyComparator &comparator, const char *key) const
+{
+  return key != nullptr && has_high_key() && comparator(key, high_key()) >= 0;
+}
+
 /**
  * 检查一个节点经过插入或删除操作后是否需要分裂或合并操作
  * @return true 需要分裂或合并；
@@ -144,7 +200,10 @@ std::string to_string(const IndexNodeHandler &handler)
 
   ss << "PageNum:" << handler.page_num() << ",is_leaf:" << handler.is_leaf() << ","
      << "key_num:" << handler.size() << ","
-     << "parent:" << handler.parent_page_num() << ",";
+     << "parent:" << handler.parent_page_num() << ","
+     << "level:" << handler.level() << ","
+     << "prev page:" << handler.prev_page() << ","
+     << "next page:" << handler.next_page() << ",";
 
   return ss.str();
 }
@@ -162,6 +221,36 @@ bool IndexNodeHandler::validate() const
       LOG_WARN("root page internal node has less than 2 child. size=%d", size());
       return false;
     }
+
+    if (has_high_key() || prev_page() != BP_INVALID_PAGE_NUM) {
+      LOG_WARN("root page should not have brothers. prev page=%d, next page=%d", prev_page(), next_page());
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IndexNodeHandler::validate_high_key(
+    const KeyComparator &comparator, InternalIndexNodeHandler &parent_node, int index_in_parent) const
+{
+  // 节点的high key就是父节点中下一个子节点的分隔键，最后一个子节点与父节点的high key相同
+  const bool is_last_child = (index_in_parent == parent_node.size() - 1);
+  const bool expect_high_key = is_last_child ? parent_node.has_high_key() : true;
+  if (has_high_key() != expect_high_key) {
+    LOG_WARN("invalid right link. this page num=%d, next page=%d, parent page num=%d, index in parent=%d",
+             page_num(), next_page(), parent_node.page_num(), index_in_parent);
+    return false;
+  }
+
+  if (!has_high_key()) {
+    return true;
+  }
+
+  const char *expect_key = is_last_child ? parent_node.high_key() : parent_node.key_at(index_in_parent + 1);
+  if (comparator(high_key(), expect_key) != 0) {
+    LOG_WARN("invalid high key. this page num=%d, parent page num=%d, index in parent=%d",
+             page_num(), parent_node.page_num(), index_in_parent);
+    return false;
   }
   return true;
 }
@@ -174,17 +263,6 @@ LeafIndexNodeHandler::LeafIndexNodeHandler(const IndexFileHeader &header, Frame
 void LeafIndexNodeHandler::init_empty()
 {
   IndexNodeHandler::init_empty(true);
-  leaf_node_->next_brother = BP_INVALID_PAGE_NUM;
-}
-
-void LeafIndexNodeHandler::set_next_page(PageNum page_num)
-{
-  leaf_node_->next_brother = page_num;
-}
-
-PageNum LeafIndexNodeHandler::next_page() const
-{
-  return leaf_node_->next_brother;
 }
 
 char *LeafIndexNodeHandler::key_at(int index)
@@ -295,7 +373,8 @@ void LeafIndexNodeHandler::preappend(const char *item)
 
 char *LeafIndexNodeHandler::__item_at(int index) const
 {
-  return leaf_node_->array + (index * item_size());
+  // 数据项存放在high key的后面
+  return leaf_node_->array + key_size() + (index * item_size());
 }
 char *LeafIndexNodeHandler::__key_at(int index) const
 {
@@ -309,9 +388,11 @@ char *LeafIndexNodeHandler::__value_at(int index) const
 std::string to_string(const LeafIndexNodeHandler &handler, const KeyPrinter &printer)
 {
   std::stringstream ss;
-  ss << to_string((const IndexNodeHandler &)handler)
-     << ",next page:" << handler.next_page();
-  ss << ",values=[" << printer(handler.__key_at(0));
+  ss << to_string((const IndexNodeHandler &)handler);
+  if (handler.has_high_key()) {
+    ss << "high key:" << printer(handler.high_key()) << ",";
+  }
+  ss << "values=[" << printer(handler.__key_at(0));
   for (int i = 1; i < handler.size(); i++) {
     ss << "," << printer(handler.__key_at(i));
   }
@@ -335,6 +416,11 @@ bool LeafIndexNodeHandler::validate(const KeyComparator &comparator, DiskBufferP
     }
   }
 
+  if (node_size > 0 && has_high_key() && comparator(__key_at(node_size - 1), high_key()) >= 0) {
+    LOG_WARN("page number = %d, last key is not less than high key. this=%s", page_num(), to_string(*this).c_str());
+    return false;
+  }
+
   PageNum parent_page_num = this->parent_page_num();
   if (parent_page_num == BP_INVALID_PAGE_NUM) {
     return true;
@@ -377,6 +463,11 @@ bool LeafIndexNodeHandler::validate(const KeyComparator &comparator, DiskBufferP
       return false;
     }
   }
+
+  if (!validate_high_key(comparator, parent_node, index_in_parent)) {
+    bp->unpin_page(parent_frame);
+    return false;
+  }
   bp->unpin_page(parent_frame);
   return true;
 }
@@ -390,7 +481,10 @@ std::string to_string(const InternalIndexNodeHandler &node, const KeyPrinter &pr
 {
   std::stringstream ss;
   ss << to_string((const IndexNodeHandler &)node);
-  ss << ",children:["
+  if (node.has_high_key()) {
+    ss << "high key:" << printer(node.high_key()) << ",";
+  }
+  ss << "children:["
      << "{key:" << printer(node.__key_at(0)) << ","
      << "value:" << *(PageNum *)node.__value_at(0) << "}";
 
@@ -573,7 +667,8 @@ RC InternalIndexNodeHandler::copy_from(const char *items, int num, DiskBufferPoo
     }
     IndexNodeHandler child_node(header_, frame);
     child_node.set_parent_page_num(this_page_num);
-    frame->mark_dirty();
+    IndexLogHandler::mark_dirty(
+        *disk_buffer_pool, *frame, frame->data() + offsetof(IndexNode, parent), sizeof(PageNum));
     disk_buffer_pool->unpin_page(frame);
   }
   increase_size(num);
@@ -598,7 +693,7 @@ RC InternalIndexNodeHandler::preappend(const char *item, DiskBufferPool *bp)
   IndexNodeHandler child_node(header_, frame);
   child_node.set_parent_page_num(this->page_num());
 
-  frame->mark_dirty();
+  IndexLogHandler::mark_dirty(*bp, *frame, frame->data() + offsetof(IndexNode, parent), sizeof(PageNum));
   bp->unpin_page(frame);
 
   if (this->size() > 0) {
@@ -612,7 +707,8 @@ RC InternalIndexNodeHandler::preappend(const char *item, DiskBufferPool *bp)
 
 char *InternalIndexNodeHandler::__item_at(int index) const
 {
-  return internal_node_->array + (index * item_size());
+  // 数据项存放在high key的后面
+  return internal_node_->array + key_size() + (index * item_size());
 }
 
 char *InternalIndexNodeHandler::__key_at(int index) const
@@ -651,6 +747,11 @@ bool InternalIndexNodeHandler::validate(const KeyComparator &comparator, DiskBuf
     }
   }
 
+  if (node_size > 1 && has_high_key() && comparator(__key_at(node_size - 1), high_key()) >= 0) {
+    LOG_WARN("page number = %d, last key is not less than high key. this=%s", page_num(), to_string(*this).c_str());
+    return false;
+  }
+
   for (int i = 0; result && i < node_size; i++) {
     PageNum page_num = *(PageNum *)__value_at(i);
     if (page_num < 0) {
@@ -719,6 +820,11 @@ bool InternalIndexNodeHandler::validate(const KeyComparator &comparator, DiskBuf
       return false;
     }
   }
+
+  if (!validate_high_key(comparator, parent_node, index_in_parent)) {
+    bp->unpin_page(parent_frame);
+    return false;
+  }
   bp->unpin_page(parent_frame);
 
   return result;
@@ -745,6 +851,53 @@ RC BplusTreeHandler::sync()
   return disk_buffer_pool_->flush_all_pages();
 }
 
+RC BplusTreeHandler::redo(const IndexLogEntry &entry)
+{
+  auto node_redoer = [this](Frame &frame, const IndexLogEntry &entry) {
+    LeafIndexNodeHandler leaf_node(file_header_, &frame);
+    switch (entry.type) {
+      case CLogType::INDEX_INSERT: {
+        if (!leaf_node.is_leaf() || entry.len != leaf_node.item_size() || entry.slot < 0 ||
+            entry.slot > leaf_node.size() || leaf_node.size() >= leaf_node.max_size()) {
+          LOG_WARN("invalid leaf insert log. page=%d, index=%d, size=%d", frame.page_num(), entry.slot, leaf_node.size());
+          return RC::INTERNAL;
+        }
+        leaf_node.insert(entry.slot, entry.data, entry.data + leaf_node.key_size());
+      } break;
+
+      case CLogType::INDEX_DELETE: {
+        if (!leaf_node.is_leaf() || entry.slot < 0 || entry.slot >= leaf_node.size()) {
+          LOG_WARN("invalid leaf delete log. page=%d, index=%d, size=%d", frame.page_num(), entry.slot, leaf_node.size());
+          return RC::INTERNAL;
+        }
+        leaf_node.remove(entry.slot);
+      } break;
+
+      default: {
+        return RC::UNIMPLENMENT;
+      }
+    }
+    return RC::SUCCESS;
+  };
+  return IndexLogHandler::redo(*disk_buffer_pool_, entry, node_redoer);
+}
+
+RC BplusTreeHandler::finish_redo()
+{
+  Frame *frame = nullptr;
+  RC rc = disk_buffer_pool_->get_this_page(FIRST_INDEX_PAGE, &frame);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to fetch index header page. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  std::lock_guard<common::Mutex> guard(root_page_lock_);
+  memcpy(&file_header_, frame->data(), sizeof(file_header_));
+  header_dirty_ = false;
+  disk_buffer_pool_->unpin_page(frame);
+  return RC::SUCCESS;
+}
+
 RC BplusTreeHandler::create(const char *file_name, AttrType attr_type, int attr_length, int internal_max_size /* = -1*/,
     int leaf_max_size /* = -1 */)
 {
@@ -865,6 +1018,11 @@ RC BplusTreeHandler::open(const char *file_name)
 
 RC BplusTreeHandler::close()
 {
+  if (bloom_filter_ != nullptr) {
+    bloom_filter_->close();
+    bloom_filter_.reset();
+  }
+
   if (disk_buffer_pool_ != nullptr) {
     disk_buffer_pool_->close_file();
   }
@@ -1022,6 +1180,12 @@ bool BplusTreeHandler::validate_leaf_link(LatchMemo &latch_memo)
 
   LeafIndexNodeHandler leaf_node(file_header_, frame);
   PageNum next_page_num = leaf_node.next_page();
+  PageNum prev_page_num = frame->page_num();
+  if (leaf_node.prev_page() != BP_INVALID_PAGE_NUM) {
+    LOG_WARN("left most page should not have left brother. page num=%d, prev page=%d",
+             prev_page_num, leaf_node.prev_page());
+    return false;
+  }
 
   MemPoolItem::unique_ptr prev_key = mem_pool_item_->alloc_unique_ptr();
   memcpy(prev_key.get(), leaf_node.key_at(leaf_node.size() - 1), file_header_.key_length);
@@ -1040,6 +1204,13 @@ bool BplusTreeHandler::validate_leaf_link(LatchMemo &latch_memo)
       result = false;
     }
 
+    if (leaf_node.prev_page() != prev_page_num) {
+      LOG_WARN("invalid left link. page num=%d, prev page=%d, expect=%d",
+               frame->page_num(), leaf_node.prev_page(), prev_page_num);
+      result = false;
+    }
+
+    prev_page_num = frame->page_num();
     next_page_num = leaf_node.next_page();
     memcpy(prev_key.get(), leaf_node.key_at(leaf_node.size() - 1), file_header_.key_length);
   }
@@ -1074,85 +1245,182 @@ bool BplusTreeHandler::validate_tree()
 
 bool BplusTreeHandler::is_empty() const
 {
-  return file_header_.root_page == BP_INVALID_PAGE_NUM;
+  return root_page_num() == BP_INVALID_PAGE_NUM;
 }
 
-RC BplusTreeHandler::find_leaf(LatchMemo &latch_memo, BplusTreeOperationType op, const char *key, Frame *&frame)
+PageNum BplusTreeHandler::root_page_num() const
+{
+  std::lock_guard<common::Mutex> guard(root_page_lock_);
+  return file_header_.root_page;
+}
+
+RC BplusTreeHandler::find_leaf(LatchMemo &latch_memo, BplusTreeOperationType op, const char *key, Frame *&frame,
+                               std::vector<PageNum> *parent_pages /* = nullptr */)
 {
   auto child_page_getter = [this, key](InternalIndexNodeHandler &internal_node) {
         return internal_node.value_at(internal_node.lookup(key_comparator_, key));
       };
-  return find_leaf_internal(latch_memo, op, child_page_getter, frame);
+  LatchMemoType latch_type = (op == BplusTreeOperationType::READ) ? LatchMemoType::SHARED : LatchMemoType::EXCLUSIVE;
+  return find_node(latch_memo, key, 0 /*level*/, latch_type, child_page_getter, parent_pages, frame);
 }
 
 RC BplusTreeHandler::left_most_page(LatchMemo &latch_memo, Frame *&frame)
 {
   auto child_page_getter = [](InternalIndexNodeHandler &internal_node) { return internal_node.value_at(0); };
-  return find_leaf_internal(latch_memo, BplusTreeOperationType::READ, child_page_getter, frame);
+  return find_node(latch_memo, nullptr /*key*/, 0 /*level*/, LatchMemoType::SHARED, child_page_getter,
+                   nullptr /*parent_pages*/, frame);
 }
 
-RC BplusTreeHandler::find_leaf_internal(
-    LatchMemo &latch_memo, BplusTreeOperationType op, 
-    const std::function<PageNum(InternalIndexNodeHandler &)> &child_page_getter, 
-    Frame *&frame)
+RC BplusTreeHandler::right_most_page(LatchMemo &latch_memo, Frame *&frame)
 {
-  // root locked
-  if (op != BplusTreeOperationType::READ) {
-    latch_memo.xlatch(&root_lock_);
-  } else {
-    latch_memo.slatch(&root_lock_);
+  auto child_page_getter = [](InternalIndexNodeHandler &internal_node) {
+    return internal_node.value_at(internal_node.size() - 1);
+  };
+  RC rc = find_node(latch_memo, nullptr /*key*/, 0 /*level*/, LatchMemoType::SHARED, child_page_getter,
+                    nullptr /*parent_pages*/, frame);
+  if (rc != RC::SUCCESS) {
+    return rc;
   }
 
-  if (is_empty()) {
+  // 查找的过程中节点可能分裂了，沿着右兄弟指针一直移动到最右边
+  while (true) {
+    IndexNodeHandler node(file_header_, frame);
+    const PageNum next_page_num = node.next_page();
+    if (BP_INVALID_PAGE_NUM == next_page_num) {
+      return RC::SUCCESS;
+    }
+
+    Frame *next_frame = nullptr;
+    rc = latch_memo.get_page(next_page_num, next_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch right brother page. page num=%d, rc=%s", next_page_num, strrc(rc));
+      return rc;
+    }
+
+    latch_memo.slatch(next_frame);
+    latch_memo.release_frame(frame);
+    frame = next_frame;
+  }
+  return rc;
+}
+
+RC BplusTreeHandler::find_node(LatchMemo &latch_memo, const char *key, int level, LatchMemoType latch_type,
+                               const std::function<PageNum(InternalIndexNodeHandler &)> &child_page_getter,
+                               std::vector<PageNum> *parent_pages, Frame *&frame)
+{
+  const PageNum root_page = root_page_num();
+  if (root_page == BP_INVALID_PAGE_NUM) {
     return RC::EMPTY;
   }
 
-  RC rc = crabing_protocal_fetch_page(latch_memo, op, file_header_.root_page, true/* is_root_node */, frame);
+  // 在加锁之前不知道根节点的层次，先加读锁，如果根节点就是目标节点再换成需要的锁。
+  // 换锁的间隙根节点可能已经分裂了，不过节点的层次不会变化，后面向右移动就可以找到正确的节点
+  RC rc = latch_memo.get_page(root_page, frame);
   if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to fetch root page. page id=%d, rc=%d:%s", file_header_.root_page, rc, strrc(rc));
+    LOG_WARN("failed to fetch root page. page id=%d, rc=%d:%s", root_page, rc, strrc(rc));
     return rc;
   }
+  latch_memo.slatch(frame);
+
+  LatchMemoType current_latch_type = LatchMemoType::SHARED;
+  if (IndexNodeHandler(file_header_, frame).level() == level && latch_type != LatchMemoType::SHARED) {
+    latch_memo.release_frame(frame);
+    rc = latch_memo.get_page(root_page, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch root page. page id=%d, rc=%d:%s", root_page, rc, strrc(rc));
+      return rc;
+    }
+    latch_memo.latch(frame, latch_type);
+    current_latch_type = latch_type;
+  }
+
+  while (true) {
+    rc = move_right(latch_memo, current_latch_type, key, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to move right. rc=%s", strrc(rc));
+      return rc;
+    }
 
-  IndexNode *node = (IndexNode *)frame->data();
-  PageNum next_page_id;
-  for (; !node->is_leaf; ) {
     InternalIndexNodeHandler internal_node(file_header_, frame);
-    next_page_id = child_page_getter(internal_node);
-    rc = crabing_protocal_fetch_page(latch_memo, op, next_page_id, false /* is_root_node */, frame);
+    if (internal_node.level() <= level) {
+      ASSERT(internal_node.level() == level, "got a node with invalid level. expect=%d, got=%d",
+             level, internal_node.level());
+      return RC::SUCCESS;
+    }
+
+    const PageNum child_page_num = child_page_getter(internal_node);
+    const int child_level = internal_node.level() - 1;
+    if (parent_pages != nullptr) {
+      parent_pages->push_back(frame->page_num());
+    }
+
+    // 先释放当前节点再去对子节点加锁，如果子节点在这期间分裂了，通过向右移动来找到正确的节点
+    latch_memo.release_frame(frame);
+
+    rc = latch_memo.get_page(child_page_num, frame);
     if (rc != RC::SUCCESS) {
-      LOG_WARN("Failed to load page page_num:%d. rc=%s", next_page_id, strrc(rc));
+      LOG_WARN("Failed to load page page_num:%d. rc=%s", child_page_num, strrc(rc));
       return rc;
     }
 
-    node = (IndexNode *)frame->data();
+    current_latch_type = (child_level == level) ? latch_type : LatchMemoType::SHARED;
+    latch_memo.latch(frame, current_latch_type);
   }
   return RC::SUCCESS;
 }
 
-RC BplusTreeHandler::crabing_protocal_fetch_page(LatchMemo &latch_memo, 
-                                                 BplusTreeOperationType op, 
-                                                 PageNum page_num, 
-                                                 bool is_root_node, 
-                                                 Frame *&frame)
+RC BplusTreeHandler::move_right(LatchMemo &latch_memo, LatchMemoType latch_type, const char *key, Frame *&frame)
 {
-  bool readonly = (op == BplusTreeOperationType::READ);
-  const int memo_point = latch_memo.memo_point();
-  RC rc = latch_memo.get_page(page_num, frame);
-  if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to get frame. pageNum=%d, rc=%s", page_num, strrc(rc));
-    return rc;
+  while (true) {
+    IndexNodeHandler node(file_header_, frame);
+    if (!node.need_move_right(key_comparator_, key)) {
+      return RC::SUCCESS;
+    }
+
+    const PageNum next_page_num = node.next_page();
+    Frame *next_frame = nullptr;
+    RC rc = latch_memo.get_page(next_page_num, next_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch right brother page. page num=%d, rc=%s", next_page_num, strrc(rc));
+      return rc;
+    }
+
+    latch_memo.latch(next_frame, latch_type);
+    latch_memo.release_frame(frame);
+    frame = next_frame;
+  }
+  return RC::SUCCESS;
+}
+
+RC BplusTreeHandler::find_leaf_for_restructure(LatchMemo &latch_memo, const char *key, Frame *&frame)
+{
+  // 调用者已经对整棵树加了写锁，不会有其它的修改操作，路径上的节点都需要保留，合并节点时会使用
+  PageNum page_num = file_header_.root_page;
+  if (page_num == BP_INVALID_PAGE_NUM) {
+    return RC::EMPTY;
   }
 
-  LatchMemoType latch_type = readonly ? LatchMemoType::SHARED : LatchMemoType::EXCLUSIVE;
-  latch_memo.latch(frame, latch_type);
-  IndexNodeHandler index_node(file_header_, frame);
-  if (index_node.is_safe(op, is_root_node)) {
-    latch_memo.release_to(memo_point); // 当前节点不会分裂或合并，可以将前面的锁都释放掉
+  while (true) {
+    RC rc = latch_memo.get_page(page_num, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("Failed to load page page_num:%d. rc=%s", page_num, strrc(rc));
+      return rc;
+    }
+    latch_memo.xlatch(frame);
+
+    IndexNodeHandler node(file_header_, frame);
+    if (node.is_leaf()) {
+      break;
+    }
+
+    InternalIndexNodeHandler internal_node(file_header_, frame);
+    page_num = internal_node.value_at(internal_node.lookup(key_comparator_, key));
   }
-  return rc;
+  return RC::SUCCESS;
 }
 
-RC BplusTreeHandler::insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *frame, const char *key, const RID *rid)
+RC BplusTreeHandler::insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *frame, const char *key, const RID *rid,
+                                                 std::vector<PageNum> &parent_pages)
 {
   LeafIndexNodeHandler leaf_node(file_header_, frame);
   bool exists = false; // 该数据是否已经存在指定的叶子节点中了
@@ -1165,6 +1433,10 @@ RC BplusTreeHandler::insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *f
   if (leaf_node.size() < leaf_node.max_size()) {
     leaf_node.insert(insert_position, key, (const char *)rid);
     frame->mark_dirty();
+    IndexLogHandler *log_handler = disk_buffer_pool_->log_handler();
+    if (log_handler != nullptr) {
+      log_handler->log_leaf_insert(*frame, insert_position, leaf_node.key_at(insert_position), leaf_node.item_size());
+    }
     // disk_buffer_pool_->unpin_page(frame); // unpin pages 由latch memo 来操作
     return RC::SUCCESS;
   }
@@ -1177,117 +1449,146 @@ RC BplusTreeHandler::insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *f
   }
 
   LeafIndexNodeHandler new_index_node(file_header_, new_frame);
-  new_index_node.set_next_page(leaf_node.next_page());
-  new_index_node.set_parent_page_num(leaf_node.parent_page_num());
-  leaf_node.set_next_page(new_frame->page_num());
-
   if (insert_position < leaf_node.size()) {
     leaf_node.insert(insert_position, key, (const char *)rid);
   } else {
     new_index_node.insert(insert_position - leaf_node.size(), key, (const char *)rid);
+    // 新数据可能插入到了右边节点的第一个位置，分隔键也随之变化
+    leaf_node.set_high_key(new_index_node.key_at(0));
   }
 
-  return insert_entry_into_parent(latch_memo, frame, new_frame, new_index_node.key_at(0));
+  return insert_entry_into_parent(latch_memo, frame, new_frame, new_index_node.key_at(0), parent_pages);
 }
 
-RC BplusTreeHandler::insert_entry_into_parent(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key)
+RC BplusTreeHandler::find_parent_for_insert(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key,
+                                            std::vector<PageNum> &parent_pages, Frame *&parent_frame)
 {
-  RC rc = RC::SUCCESS;
+  parent_frame = nullptr;
 
   IndexNodeHandler node_handler(file_header_, frame);
-  IndexNodeHandler new_node_handler(file_header_, new_frame);
-  PageNum parent_page_num = node_handler.parent_page_num();
-
-  if (parent_page_num == BP_INVALID_PAGE_NUM) {
+  RC rc = RC::SUCCESS;
+  if (!parent_pages.empty()) {
+    // 查找时记录的父节点，它可能已经分裂了，需要的话向右移动
+    const PageNum parent_page_num = parent_pages.back();
+    parent_pages.pop_back();
 
-    // create new root page
-    Frame *root_frame;
-    rc = disk_buffer_pool_->allocate_page(&root_frame);
+    rc = latch_memo.get_page(parent_page_num, parent_frame);
     if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to allocate new root page. rc=%d:%s", rc, strrc(rc));
+      LOG_WARN("failed to fetch parent page. page num=%d, rc=%d:%s", parent_page_num, rc, strrc(rc));
       return rc;
     }
+    latch_memo.xlatch(parent_frame);
+    return move_right(latch_memo, LatchMemoType::EXCLUSIVE, key, parent_frame);
+  }
 
-    InternalIndexNodeHandler root_node(file_header_, root_frame);
-    root_node.init_empty();
-    root_node.create_new_root(frame->page_num(), key, new_frame->page_num());
-    node_handler.set_parent_page_num(root_frame->page_num());
-    new_node_handler.set_parent_page_num(root_frame->page_num());
+  // 当前节点是根节点，只有持有根节点写锁的线程才能修改根节点，所以这里的判断是可靠的
+  if (root_page_num() == frame->page_num()) {
+    return create_new_root(frame, new_frame, key);
+  }
 
-    frame->mark_dirty();
-    new_frame->mark_dirty();
-    // disk_buffer_pool_->unpin_page(frame);
-    // disk_buffer_pool_->unpin_page(new_frame);
+  // 查找的时候从根节点开始，之后根节点分裂了，需要从新的根节点开始找到上一层的节点
+  auto child_page_getter = [this, key](InternalIndexNodeHandler &internal_node) {
+        return internal_node.value_at(internal_node.lookup(key_comparator_, key));
+      };
+  rc = find_node(latch_memo, key, node_handler.level() + 1, LatchMemoType::EXCLUSIVE, child_page_getter,
+                 nullptr /*parent_pages*/, parent_frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to find parent node. rc=%s", strrc(rc));
+    parent_frame = nullptr;
+  }
+  return rc;
+}
 
-    root_frame->write_latch(); // 在root页面更新之后，别人就可以访问到了，这时候就要加上锁
-    update_root_page_num_locked(root_frame->page_num());
-    root_frame->mark_dirty();
-    root_frame->write_unlatch();
-    disk_buffer_pool_->unpin_page(root_frame);
+RC BplusTreeHandler::create_new_root(Frame *frame, Frame *new_frame, const char *key)
+{
+  IndexNodeHandler node_handler(file_header_, frame);
+  IndexNodeHandler new_node_handler(file_header_, new_frame);
 
-    return RC::SUCCESS;
+  Frame *root_frame = nullptr;
+  RC rc = disk_buffer_pool_->allocate_page(&root_frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to allocate new root page. rc=%d:%s", rc, strrc(rc));
+    return rc;
+  }
 
-  } else {
+  // 新的根节点在更新到文件头之前，别人都访问不到，不需要加锁
+  InternalIndexNodeHandler root_node(file_header_, root_frame);
+  root_node.init_empty();
+  root_node.set_level(node_handler.level() + 1);
+  root_node.create_new_root(frame->page_num(), key, new_frame->page_num());
+  node_handler.set_parent_page_num(root_frame->page_num());
+  new_node_handler.set_parent_page_num(root_frame->page_num());
 
-    Frame *parent_frame = nullptr;
-    rc = latch_memo.get_page(parent_page_num, parent_frame);
-    if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to insert entry into leaf. rc=%d:%s", rc, strrc(rc));
-      // we should do some things to recover
-      return rc;
-    }
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *new_frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *root_frame);
 
-    // 在第一次遍历这个页面时，我们已经拿到parent frame的write latch，所以这里不再去加锁
-    InternalIndexNodeHandler parent_node(file_header_, parent_frame);
+  update_root_page_num(root_frame->page_num());
+  disk_buffer_pool_->unpin_page(root_frame);
+  return RC::SUCCESS;
+}
 
-    /// 当前这个父节点还没有满，直接将新节点数据插进入就行了
-    if (parent_node.size() < parent_node.max_size()) {
-      parent_node.insert(key, new_frame->page_num(), key_comparator_);
-      new_node_handler.set_parent_page_num(parent_page_num);
+RC BplusTreeHandler::insert_entry_into_parent(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key,
+                                              std::vector<PageNum> &parent_pages)
+{
+  Frame *parent_frame = nullptr;
+  RC rc = find_parent_for_insert(latch_memo, frame, new_frame, key, parent_pages, parent_frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to find parent node. rc=%s", strrc(rc));
+    return rc;
+  }
 
-      frame->mark_dirty();
-      new_frame->mark_dirty();
-      parent_frame->mark_dirty();
-      // disk_buffer_pool_->unpin_page(frame);
-      // disk_buffer_pool_->unpin_page(new_frame);
-      // disk_buffer_pool_->unpin_page(parent_frame);
+  if (parent_frame == nullptr) {
+    // 创建了新的根节点
+    return RC::SUCCESS;
+  }
 
-    } else {
+  IndexNodeHandler new_node_handler(file_header_, new_frame);
+  InternalIndexNodeHandler parent_node(file_header_, parent_frame);
 
-      // 当前父节点即将装满了，那只能再将父节点执行分裂操作
-      Frame *new_parent_frame = nullptr;
-      rc = split<InternalIndexNodeHandler>(latch_memo, parent_frame, new_parent_frame);
-      if (rc != RC::SUCCESS) {
-        LOG_WARN("failed to split internal node. rc=%d:%s", rc, strrc(rc));
-        // disk_buffer_pool_->unpin_page(frame);
-        // disk_buffer_pool_->unpin_page(new_frame);
-        // disk_buffer_pool_->unpin_page(parent_frame);
-      } else {
-        // insert into left or right ? decide by key compare result
-        InternalIndexNodeHandler new_node(file_header_, new_parent_frame);
-        if (key_comparator_(key, new_node.key_at(0)) > 0) {
-          new_node.insert(key, new_frame->page_num(), key_comparator_);
-          new_node_handler.set_parent_page_num(new_node.page_num());
-        } else {
-          parent_node.insert(key, new_frame->page_num(), key_comparator_);
-          new_node_handler.set_parent_page_num(parent_node.page_num());
-        }
+  /// 当前这个父节点还没有满，直接将新节点数据插进入就行了
+  if (parent_node.size() < parent_node.max_size()) {
+    parent_node.insert(key, new_frame->page_num(), key_comparator_);
+    new_node_handler.set_parent_page_num(parent_frame->page_num());
 
-        // disk_buffer_pool_->unpin_page(frame);
-        // disk_buffer_pool_->unpin_page(new_frame);
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *new_frame);
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *parent_frame);
+    return RC::SUCCESS;
+  }
 
-        // 虽然这里是递归调用，但是通常B+ Tree 的层高比较低（3层已经可以容纳很多数据），所以没有栈溢出风险。
-        // Q: 在查找叶子节点时，我们都会尝试将没必要的锁提前释放掉，在这里插入数据时，是在向上遍历节点，
-        //    理论上来说，我们可以释放更低层级节点的锁，但是并没有这么做，为什么？
-        rc = insert_entry_into_parent(latch_memo, parent_frame, new_parent_frame, new_node.key_at(0));
-      }
-    }
+  // 当前父节点即将装满了，那只能再将父节点执行分裂操作
+  Frame *new_parent_frame = nullptr;
+  rc = split<InternalIndexNodeHandler>(latch_memo, parent_frame, new_parent_frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to split internal node. rc=%d:%s", rc, strrc(rc));
+    return rc;
   }
-  return rc;
+
+  // insert into left or right ? decide by key compare result
+  InternalIndexNodeHandler new_node(file_header_, new_parent_frame);
+  if (key_comparator_(key, new_node.key_at(0)) > 0) {
+    new_node.insert(key, new_frame->page_num(), key_comparator_);
+    new_node_handler.set_parent_page_num(new_node.page_num());
+  } else {
+    parent_node.insert(key, new_frame->page_num(), key_comparator_);
+    new_node_handler.set_parent_page_num(parent_node.page_num());
+  }
+
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *new_frame);
+
+  // 下一层的分裂已经完成了，在向上插入分隔键之前就可以释放它们的锁
+  latch_memo.release_frame(frame);
+  latch_memo.release_frame(new_frame);
+
+  // 虽然这里是递归调用，但是通常B+ Tree 的层高比较低（3层已经可以容纳很多数据），所以没有栈溢出风险。
+  return insert_entry_into_parent(latch_memo, parent_frame, new_parent_frame, new_node.key_at(0), parent_pages);
 }
 
 /**
  * split one full node into two
+ * 新节点链接到原节点的右边，并继承原节点的high key和右兄弟(B-link)
  */
 template <typename IndexNodeHandlerType>
 RC BplusTreeHandler::split(LatchMemo &latch_memo, Frame *frame, Frame *&new_frame)
@@ -1306,19 +1607,74 @@ RC BplusTreeHandler::split(LatchMemo &latch_memo, Frame *frame, Frame *&new_fram
   IndexNodeHandlerType new_node(file_header_, new_frame);
   new_node.init_empty();
   new_node.set_parent_page_num(old_node.parent_page_num());
+  new_node.set_level(old_node.level());
 
   old_node.move_half_to(new_node, disk_buffer_pool_); // TODO remove disk buffer pool
 
-  frame->mark_dirty();
-  new_frame->mark_dirty();
+  if (old_node.next_page() != BP_INVALID_PAGE_NUM) {
+    rc = update_prev_page(latch_memo, old_node.next_page(), new_frame->page_num());
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  new_node.set_prev_page(frame->page_num());
+  new_node.set_next_page(old_node.next_page());
+  if (old_node.has_high_key()) {
+    new_node.set_high_key(old_node.high_key());
+  }
+  old_node.set_next_page(new_frame->page_num());
+  old_node.set_high_key(new_node.key_at(0));
+
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *new_frame);
   return RC::SUCCESS;
 }
 
+RC BplusTreeHandler::update_prev_page(LatchMemo &latch_memo, PageNum page_num, PageNum prev_page_num)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(page_num, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch right brother page. page num=%d, rc=%s", page_num, strrc(rc));
+    return rc;
+  }
+
+  // 加锁顺序是从左到右，这里不会死锁
+  latch_memo.xlatch(frame);
+  IndexNodeHandler node(file_header_, frame);
+  node.set_prev_page(prev_page_num);
+  IndexLogHandler::mark_dirty(
+      *disk_buffer_pool_, *frame, frame->data() + offsetof(IndexNode, prev_brother), sizeof(PageNum));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+void BplusTreeHandler::update_root_page_num(PageNum root_page_num)
+{
+  std::lock_guard<common::Mutex> guard(root_page_lock_);
+  update_root_page_num_locked(root_page_num);
+}
+
 void BplusTreeHandler::update_root_page_num_locked(PageNum root_page_num)
 {
   file_header_.root_page = root_page_num;
   header_dirty_ = true;
   LOG_DEBUG("set root page to %d", root_page_num);
+
+  // 开启日志时直接修改文件头页面，恢复时根节点的变化与节点页面的修改按照相同的顺序重做
+  if (disk_buffer_pool_->log_handler() != nullptr) {
+    Frame *frame = nullptr;
+    RC rc = disk_buffer_pool_->get_this_page(FIRST_INDEX_PAGE, &frame);
+    if (OB_FAIL(rc)) {
+      LOG_ERROR("failed to fetch index header page. rc=%s", strrc(rc));
+      return;
+    }
+    IndexFileHeader *header = reinterpret_cast<IndexFileHeader *>(frame->data());
+    header->root_page = root_page_num;
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, &header->root_page, sizeof(header->root_page));
+    disk_buffer_pool_->unpin_page(frame);
+  }
 }
 
 RC BplusTreeHandler::create_new_tree(const char *key, const RID *rid)
@@ -1340,8 +1696,8 @@ RC BplusTreeHandler::create_new_tree(const char *key, const RID *rid)
   LeafIndexNodeHandler leaf_node(file_header_, frame);
   leaf_node.init_empty();
   leaf_node.insert(0, key, (const char *)rid);
-  update_root_page_num_locked(frame->page_num());
-  frame->mark_dirty();
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+  update_root_page_num(frame->page_num());
   disk_buffer_pool_->unpin_page(frame);
 
   // disk_buffer_pool_->check_all_pages_unpinned(file_id_);
@@ -1380,30 +1736,217 @@ RC BplusTreeHandler::insert_entry(const char *user_key, const RID *rid)
     if (is_empty()) {
       RC rc = create_new_tree(key, rid);
       root_lock_.unlock();
+      if (rc == RC::SUCCESS && bloom_filter_ != nullptr) {
+        bloom_filter_->add(user_key);
+      }
       return rc;
     }
     root_lock_.unlock();
   }
 
   LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.slatch(&root_lock_);  // 只是为了避免与修改树结构的删除操作并发
 
   Frame *frame = nullptr;
-  RC rc = find_leaf(latch_memo, BplusTreeOperationType::INSERT, key, frame);
+  std::vector<PageNum> parent_pages;
+  RC rc = find_leaf(latch_memo, BplusTreeOperationType::INSERT, key, frame, &parent_pages);
+  if (rc == RC::EMPTY) {
+    // 在检查之后，树被别人删空了
+    latch_memo.release();
+    return insert_entry(user_key, rid);
+  }
   if (rc != RC::SUCCESS) {
     LOG_WARN("Failed to find leaf %s. rc=%d:%s", rid->to_string().c_str(), rc, strrc(rc));
     return rc;
   }
 
-  rc = insert_entry_into_leaf_node(latch_memo, frame, key, rid);
+  rc = insert_entry_into_leaf_node(latch_memo, frame, key, rid, parent_pages);
   if (rc != RC::SUCCESS) {
     LOG_TRACE("Failed to insert into leaf of index, rid:%s. rc=%s", rid->to_string().c_str(), strrc(rc));
     return rc;
   }
 
+  // 重新构建布隆过滤器时会扫描叶子节点，先释放页面的锁再修改过滤器
+  latch_memo.release();
+  if (bloom_filter_ != nullptr) {
+    bloom_filter_->add(user_key);
+  }
+
   LOG_TRACE("insert entry success");
   return RC::SUCCESS;
 }
 
+RC BplusTreeHandler::insert_unique_entry(const char *user_key, const RID *rid,
+                                         const std::function<bool(const RID &)> &conflict_checker)
+{
+  if (user_key == nullptr || rid == nullptr) {
+    LOG_WARN("Invalid arguments, key is empty or rid is empty");
+    return RC::INVALID_ARGUMENT;
+  }
+
+  MemPoolItem::unique_ptr pkey = make_key(user_key, *rid);
+  // 相同user_key的索引项中最小的键值，从它所在的叶子节点开始检查
+  MemPoolItem::unique_ptr pmin_key = make_key(user_key, *RID::min());
+  if (pkey == nullptr || pmin_key == nullptr) {
+    LOG_WARN("Failed to alloc memory for key.");
+    return RC::NOMEM;
+  }
+
+  char *key = static_cast<char *>(pkey.get());
+  char *min_key = static_cast<char *>(pmin_key.get());
+
+  if (is_empty()) {
+    root_lock_.lock();
+    if (is_empty()) {
+      RC rc = create_new_tree(key, rid);
+      root_lock_.unlock();
+      if (rc == RC::SUCCESS && bloom_filter_ != nullptr) {
+        bloom_filter_->add(user_key);
+      }
+      return rc;
+    }
+    root_lock_.unlock();
+  }
+
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.slatch(&root_lock_);  // 只是为了避免与修改树结构的删除操作并发
+
+  Frame *frame = nullptr;
+  std::vector<PageNum> parent_pages;
+  RC rc = find_leaf(latch_memo, BplusTreeOperationType::INSERT, min_key, frame, &parent_pages);
+  if (rc == RC::EMPTY) {
+    // 在检查之后，树被别人删空了
+    latch_memo.release();
+    return insert_unique_entry(user_key, rid, conflict_checker);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to find leaf %s. rc=%d:%s", rid->to_string().c_str(), rc, strrc(rc));
+    return rc;
+  }
+
+  rc = check_unique_and_find_leaf(latch_memo, min_key, key, conflict_checker, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_TRACE("Failed to insert unique entry, rid:%s. rc=%s", rid->to_string().c_str(), strrc(rc));
+    return rc;
+  }
+
+  // 插入的叶子节点可能在查找时记录的父节点的右边，分裂时会从记录的父节点向右移动找到正确的父节点
+  rc = insert_entry_into_leaf_node(latch_memo, frame, key, rid, parent_pages);
+  if (rc != RC::SUCCESS) {
+    LOG_TRACE("Failed to insert into leaf of index, rid:%s. rc=%s", rid->to_string().c_str(), strrc(rc));
+    return rc;
+  }
+
+  latch_memo.release();
+  if (bloom_filter_ != nullptr) {
+    bloom_filter_->add(user_key);
+  }
+
+  LOG_TRACE("insert unique entry success");
+  return RC::SUCCESS;
+}
+
+RC BplusTreeHandler::check_unique_and_find_leaf(LatchMemo &latch_memo, const char *min_key, const char *key,
+                                                const std::function<bool(const RID &)> &conflict_checker,
+                                                Frame *&frame)
+{
+  // 只比较user_key部分
+  const AttrComparator &attr_comparator = key_comparator_.attr_comparator();
+
+  // 相同user_key的索引项可能跨越多个叶子节点，沿着右兄弟指针逐个检查。
+  // 检查期间持有经过的所有节点的写锁，并发插入相同键值的操作只能跟在后面，不会漏掉彼此插入的数据
+  std::vector<Frame *> frames;
+  Frame *insert_frame = nullptr;
+  Frame *current_frame = frame;
+  RC rc = RC::SUCCESS;
+  while (true) {
+    frames.push_back(current_frame);
+
+    LeafIndexNodeHandler leaf_node(file_header_, current_frame);
+    if (insert_frame == nullptr && !leaf_node.need_move_right(key_comparator_, key)) {
+      insert_frame = current_frame;
+    }
+
+    bool finished = false;
+    const int size = leaf_node.size();
+    for (int i = leaf_node.lookup(key_comparator_, min_key); i < size; i++) {
+      if (attr_comparator(leaf_node.key_at(i), min_key) != 0) {
+        finished = true;
+        break;
+      }
+
+      const RID *exist_rid = reinterpret_cast<const RID *>(leaf_node.value_at(i));
+      if (!conflict_checker || conflict_checker(*exist_rid)) {
+        LOG_TRACE("duplicate key in unique index. exist rid=%s", exist_rid->to_string().c_str());
+        rc = RC::RECORD_DUPLICATE_KEY;
+        finished = true;
+        break;
+      }
+    }
+
+    // 右边节点中不可能再有相同的键值了
+    if (finished || !leaf_node.has_high_key() || attr_comparator(leaf_node.high_key(), min_key) != 0) {
+      break;
+    }
+
+    const PageNum next_page_num = leaf_node.next_page();
+    Frame *next_frame = nullptr;
+    rc = latch_memo.get_page(next_page_num, next_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch right brother page. page num=%d, rc=%s", next_page_num, strrc(rc));
+      break;
+    }
+    latch_memo.xlatch(next_frame);
+    current_frame = next_frame;
+  }
+
+  if (rc == RC::SUCCESS) {
+    ASSERT(insert_frame != nullptr, "cannot find the leaf to insert in unique index");
+  }
+
+  // 插入的节点分裂时会修改右兄弟节点，先释放其它节点，只保留插入节点的锁
+  for (Frame *walked_frame : frames) {
+    if (walked_frame != insert_frame) {
+      latch_memo.release_frame(walked_frame);
+    }
+  }
+  frame = insert_frame;
+  return rc;
+}
+
+RC BplusTreeHandler::enable_bloom_filter(const char *file_name)
+{
+  if (disk_buffer_pool_ == nullptr) {
+    LOG_WARN("index is not opened. file=%s", file_name);
+    return RC::FILE_NOT_OPENED;
+  }
+
+  auto bloom_filter = std::make_unique<IndexBloomFilter>();
+  auto key_source = [this](const IndexBloomFilter::KeyVisitor &visitor) {
+    BplusTreeScanner scanner(*this);
+    RC rc = scanner.open(nullptr, 0, false, nullptr, 0, false);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    std::vector<char> user_key(file_header_.attr_length);
+    RID rid;
+    while ((rc = scanner.next_entry(rid, user_key.data())) == RC::SUCCESS) {
+      visitor(user_key.data());
+    }
+    scanner.close();
+    return rc == RC::RECORD_EOF ? RC::SUCCESS : rc;
+  };
+
+  RC rc = bloom_filter->init(file_name, file_header_.attr_type, file_header_.attr_length, key_source);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to init bloom filter. file=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+  bloom_filter_ = std::move(bloom_filter);
+  return RC::SUCCESS;
+}
+
 RC BplusTreeHandler::get_entry(const char *user_key, int key_len, std::list<RID> &rids)
 {
   BplusTreeScanner scanner(*this);
@@ -1454,12 +1997,14 @@ RC BplusTreeHandler::adjust_root(LatchMemo &latch_memo, Frame *root_frame)
 
     IndexNodeHandler child_node(file_header_, child_frame);
     child_node.set_parent_page_num(BP_INVALID_PAGE_NUM);
+    IndexLogHandler::mark_dirty(
+        *disk_buffer_pool_, *child_frame, child_frame->data() + offsetof(IndexNode, parent), sizeof(PageNum));
 
     // file_header_.root_page = child_page_num;
     new_root_page_num = child_page_num;
   }
 
-  update_root_page_num_locked(new_root_page_num);
+  update_root_page_num(new_root_page_num);
 
   PageNum old_root_page_num = root_frame->page_num();
   latch_memo.dispose_page(old_root_page_num);
@@ -1555,11 +2100,19 @@ RC BplusTreeHandler::coalesce(LatchMemo &latch_memo, Frame *neighbor_frame, Fram
   }
   // left_node.validate(key_comparator_);
 
-  if (left_node.is_leaf()) {
-    LeafIndexNodeHandler left_leaf_node(file_header_, left_frame);
-    LeafIndexNodeHandler right_leaf_node(file_header_, right_frame);
-    left_leaf_node.set_next_page(right_leaf_node.next_page());
+  // 右边节点的数据都合并到了左边，左边节点接管右边节点的high key和右兄弟
+  if (right_node.has_high_key()) {
+    left_node.set_high_key(right_node.high_key());
+  }
+  left_node.set_next_page(right_node.next_page());
+  if (right_node.next_page() != BP_INVALID_PAGE_NUM) {
+    rc = update_prev_page(latch_memo, right_node.next_page(), left_frame->page_num());
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
   }
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *left_frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *parent_frame);
 
   latch_memo.dispose_page(right_frame->page_num());
   return coalesce_or_redistribute<InternalIndexNodeHandler>(latch_memo, parent_frame);
@@ -1580,6 +2133,7 @@ RC BplusTreeHandler::redistribute(Frame *neighbor_frame, Frame *frame, Frame *pa
     // neighbor_node.validate(key_comparator_, disk_buffer_pool_, file_id_);
     // node.validate(key_comparator_, disk_buffer_pool_, file_id_);
     parent_node.set_key_at(index + 1, neighbor_node.key_at(0));
+    node.set_high_key(neighbor_node.key_at(0));
     // parent_node.validate(key_comparator_, disk_buffer_pool_, file_id_);
   } else {
     // the neighbor is at left
@@ -1587,12 +2141,13 @@ RC BplusTreeHandler::redistribute(Frame *neighbor_frame, Frame *frame, Frame *pa
     // neighbor_node.validate(key_comparator_, disk_buffer_pool_, file_id_);
     // node.validate(key_comparator_, disk_buffer_pool_, file_id_);
     parent_node.set_key_at(index, node.key_at(0));
+    neighbor_node.set_high_key(node.key_at(0));
     // parent_node.validate(key_comparator_, disk_buffer_pool_, file_id_);
   }
 
-  neighbor_frame->mark_dirty();
-  frame->mark_dirty();
-  parent_frame->mark_dirty();
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *neighbor_frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *parent_frame);
 
   return RC::SUCCESS;
 }
@@ -1601,15 +2156,21 @@ RC BplusTreeHandler::delete_entry_internal(LatchMemo &latch_memo, Frame *leaf_fr
 {
   LeafIndexNodeHandler leaf_index_node(file_header_, leaf_frame);
 
-  const int remove_count = leaf_index_node.remove(key, key_comparator_);
-  if (remove_count == 0) {
+  bool found = false;
+  const int index = leaf_index_node.lookup(key_comparator_, key, &found);
+  if (!found) {
     LOG_TRACE("no data need to remove");
     // disk_buffer_pool_->unpin_page(leaf_frame);
     return RC::RECORD_NOT_EXIST;
   }
+  leaf_index_node.remove(index);
   // leaf_index_node.validate(key_comparator_, disk_buffer_pool_, file_id_);
 
   leaf_frame->mark_dirty();
+  IndexLogHandler *log_handler = disk_buffer_pool_->log_handler();
+  if (log_handler != nullptr) {
+    log_handler->log_leaf_remove(*leaf_frame, index);
+  }
 
   if (leaf_index_node.size() >= leaf_index_node.min_size()) {
     return RC::SUCCESS;
@@ -1631,21 +2192,67 @@ RC BplusTreeHandler::delete_entry(const char *user_key, const RID *rid)
   memcpy(key + file_header_.attr_length, rid, sizeof(*rid));
 
   BplusTreeOperationType op = BplusTreeOperationType::DELETE;
+  {
+    LatchMemo latch_memo(disk_buffer_pool_);
+    latch_memo.slatch(&root_lock_);
+
+    Frame *leaf_frame = nullptr;
+    RC rc = find_leaf(latch_memo, op, key, leaf_frame);
+    if (rc == RC::EMPTY) {
+      rc = RC::RECORD_NOT_EXIST;
+      return rc;
+    }
+
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to find leaf page. rc =%s", strrc(rc));
+      return rc;
+    }
+
+    LeafIndexNodeHandler leaf_node(file_header_, leaf_frame);
+    bool found = false;
+    const int index = leaf_node.lookup(key_comparator_, key, &found);
+    if (!found) {
+      LOG_TRACE("no data need to remove");
+      return RC::RECORD_NOT_EXIST;
+    }
+
+    // 如果叶子节点是根节点，我们持有它的写锁，别人无法修改根节点，所以这里的判断是可靠的
+    const bool is_root_node = (leaf_frame->page_num() == root_page_num());
+    if (leaf_node.is_safe(op, is_root_node)) {
+      leaf_node.remove(index);
+      leaf_frame->mark_dirty();
+      IndexLogHandler *log_handler = disk_buffer_pool_->log_handler();
+      if (log_handler != nullptr) {
+        log_handler->log_leaf_remove(*leaf_frame, index);
+      }
+      if (bloom_filter_ != nullptr) {
+        bloom_filter_->remove();
+      }
+      return RC::SUCCESS;
+    }
+  }
+
+  // 删除后需要合并或者重新分配节点，对整棵树加写锁后重新执行删除
   LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.xlatch(&root_lock_);
 
   Frame *leaf_frame = nullptr;
-  RC rc = find_leaf(latch_memo, op, key, leaf_frame);
+  RC rc = find_leaf_for_restructure(latch_memo, key, leaf_frame);
   if (rc == RC::EMPTY) {
     rc = RC::RECORD_NOT_EXIST;
     return rc;
   }
-  
+
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to find leaf page. rc =%s", strrc(rc));
     return rc;
   }
 
-  return delete_entry_internal(latch_memo, leaf_frame, key);
+  rc = delete_entry_internal(latch_memo, leaf_frame, key);
+  if (rc == RC::SUCCESS && bloom_filter_ != nullptr) {
+    bloom_filter_->remove();
+  }
+  return rc;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1661,7 +2268,7 @@ BplusTreeScanner::~BplusTreeScanner()
 }
 
 RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inclusive, 
-                          const char *right_user_key, int right_len, bool right_inclusive)
+                          const char *right_user_key, int right_len, bool right_inclusive, bool reverse /* = false */)
 {
   RC rc = RC::SUCCESS;
   if (inited_) {
@@ -1670,6 +2277,7 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
   }
 
   inited_ = true;
+  reverse_ = reverse;
   first_emitted_ = false;
 
   // 校验输入的键值是否是合法范围
@@ -1681,16 +2289,19 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
         (result == 0 && (left_inclusive == false || right_inclusive == false))) {
       return RC::INVALID_ARGUMENT;
     }
-  }
 
-  if (nullptr == left_user_key) {
-    rc = tree_handler_.left_most_page(latch_memo_, current_frame_);
-    if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to find left most page. rc=%s", strrc(rc));
-      return rc;
+    // 等值查询，布隆过滤器可以确定不存在时，不需要访问索引页面
+    IndexBloomFilter *bloom_filter = tree_handler_.bloom_filter_.get();
+    if (result == 0 && bloom_filter != nullptr && !bloom_filter->may_contain(left_user_key, left_len)) {
+      LOG_TRACE("bloom filter says the key does not exist");
+      current_frame_ = nullptr;
+      return RC::SUCCESS;
     }
+  }
 
-    iter_index_ = 0;
+  // 没有指定左边界范围，就从最左边开始
+  if (nullptr == left_user_key) {
+    left_key_ = nullptr;
   } else {
 
     char *fixed_left_key = const_cast<char *>(left_user_key);
@@ -1707,52 +2318,16 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
       }
     }
 
-    MemPoolItem::unique_ptr left_pkey;
     if (left_inclusive) {
-      left_pkey = tree_handler_.make_key(fixed_left_key, *RID::min());
+      left_key_ = tree_handler_.make_key(fixed_left_key, *RID::min());
     } else {
-      left_pkey = tree_handler_.make_key(fixed_left_key, *RID::max());
+      left_key_ = tree_handler_.make_key(fixed_left_key, *RID::max());
     }
 
-    const char *left_key = (const char *)left_pkey.get();
-
     if (fixed_left_key != left_user_key) {
       delete[] fixed_left_key;
       fixed_left_key = nullptr;
     }
-
-    rc = tree_handler_.find_leaf(latch_memo_, BplusTreeOperationType::READ, left_key, current_frame_);
-    if (rc == RC::EMPTY) {
-      rc = RC::SUCCESS;
-      current_frame_ = nullptr;
-      return rc;
-    } else if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to find left page. rc=%s", strrc(rc));
-      return rc;
-    }
-    
-
-    LeafIndexNodeHandler left_node(tree_handler_.file_header_, current_frame_);
-    int left_index = left_node.lookup(tree_handler_.key_comparator_, left_key);
-    // lookup 返回的是适合插入的位置，还需要判断一下是否在合适的边界范围内
-    if (left_index >= left_node.size()) {  // 超出了当前页，就需要向后移动一个位置
-      const PageNum next_page_num = left_node.next_page();
-      if (next_page_num == BP_INVALID_PAGE_NUM) {  // 这里已经是最后一页，说明当前扫描，没有数据
-        latch_memo_.release();
-        current_frame_ = nullptr;
-        return RC::SUCCESS;
-      }
-
-      rc = latch_memo_.get_page(next_page_num, current_frame_);
-      if (rc != RC::SUCCESS) {
-        LOG_WARN("failed to fetch next page. page num=%d, rc=%s", next_page_num, strrc(rc));
-        return rc;
-      }
-      latch_memo_.slatch(current_frame_);
-
-      left_index = 0;
-    }
-    iter_index_ = left_index;
   }
 
   // 没有指定右边界范围，那么就返回右边界最大值
@@ -1785,81 +2360,292 @@ RC BplusTreeScanner::open(const char *left_user_key, int left_len, bool left_inc
     }
   }
 
+  rc = reverse_ ? open_reverse() : open_forward();
+  if (rc == RC::RECORD_EOF) {  // 范围内没有数据
+    latch_memo_.release();
+    current_frame_ = nullptr;
+    return RC::SUCCESS;
+  } else if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to find first leaf page with data. reverse=%d, rc=%s", reverse_, strrc(rc));
+    return rc;
+  }
+
   if (touch_end()) {
+    latch_memo_.release();
     current_frame_ = nullptr;
   }
 
   return RC::SUCCESS;
 }
 
-void BplusTreeScanner::fetch_item(RID &rid)
+RC BplusTreeScanner::open_forward()
+{
+  const char *left_key = static_cast<const char *>(left_key_.get());
+
+  // 只在查找叶子节点时持有树的读锁，之后持有叶子节点的锁就可以了
+  tree_handler_.root_lock_.lock_shared();
+  RC rc = RC::SUCCESS;
+  if (nullptr == left_key) {
+    rc = tree_handler_.left_most_page(latch_memo_, current_frame_);
+  } else {
+    rc = tree_handler_.find_leaf(latch_memo_, BplusTreeOperationType::READ, left_key, current_frame_);
+  }
+  tree_handler_.root_lock_.unlock_shared();
+  if (rc == RC::EMPTY) {
+    return RC::RECORD_EOF;
+  } else if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to find left page. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  iter_index_ = 0;
+  if (nullptr != left_key) {
+    LeafIndexNodeHandler left_node(tree_handler_.file_header_, current_frame_);
+    iter_index_ = left_node.lookup(tree_handler_.key_comparator_, left_key);
+  }
+  // lookup 返回的是适合插入的位置，如果超出了当前页，就需要向后移动
+  return move_to_next_leaf(left_key);
+}
+
+RC BplusTreeScanner::open_reverse()
+{
+  const char *right_key = static_cast<const char *>(right_key_.get());
+
+  tree_handler_.root_lock_.lock_shared();
+  RC rc = RC::SUCCESS;
+  if (nullptr == right_key) {
+    rc = tree_handler_.right_most_page(latch_memo_, current_frame_);
+  } else {
+    rc = tree_handler_.find_leaf(latch_memo_, BplusTreeOperationType::READ, right_key, current_frame_);
+  }
+  tree_handler_.root_lock_.unlock_shared();
+  if (rc == RC::EMPTY) {
+    return RC::RECORD_EOF;
+  } else if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to find right page. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  LeafIndexNodeHandler right_node(tree_handler_.file_header_, current_frame_);
+  if (nullptr == right_key) {
+    iter_index_ = right_node.size() - 1;
+  } else {
+    // 右边界的键值带有RID的最大值或最小值，不会与索引中的数据相等，插入位置的前一个就是范围内最大的数据
+    iter_index_ = right_node.lookup(tree_handler_.key_comparator_, right_key) - 1;
+  }
+  // 如果当前页面中没有比右边界小的数据，就需要向前移动
+  return move_to_prev_leaf(right_key);
+}
+
+void BplusTreeScanner::fetch_item(RID &rid, char *user_key)
 {
   LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
   memcpy(&rid, node.value_at(iter_index_), sizeof(rid));
+  if (user_key != nullptr) {
+    memcpy(user_key, node.key_at(iter_index_), tree_handler_.file_header_.attr_length);
+  }
 }
 
 bool BplusTreeScanner::touch_end()
 {
+  LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
+  const char *this_key = node.key_at(iter_index_);
+  if (reverse_) {
+    if (left_key_ == nullptr) {
+      return false;
+    }
+    return tree_handler_.key_comparator_(this_key, static_cast<char *>(left_key_.get())) < 0;
+  }
+
   if (right_key_ == nullptr) {
     return false;
   }
   
-  LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
-  const char *this_key = node.key_at(iter_index_);
   int compare_result = tree_handler_.key_comparator_(this_key, static_cast<char *>(right_key_.get()));
   return compare_result > 0;
 }
 
-RC BplusTreeScanner::next_entry(RID &rid)
+RC BplusTreeScanner::next_entry(RID &rid, char *user_key)
 {
   if (nullptr == current_frame_) {
     return RC::RECORD_EOF;
   }
 
   if (!first_emitted_) {
-    fetch_item(rid);
+    fetch_item(rid, user_key);
     first_emitted_ = true;
     return RC::SUCCESS;
   }
 
-  iter_index_++;
+  iter_index_ += reverse_ ? -1 : 1;
 
   LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
-  if (iter_index_ < node.size()) {
+  if (iter_index_ >= 0 && iter_index_ < node.size()) {
     if (touch_end()) {
       return RC::RECORD_EOF;
     }
 
-    fetch_item(rid);
+    fetch_item(rid, user_key);
     return RC::SUCCESS;
   }
 
-  RC rc = RC::SUCCESS;
-  PageNum next_page_num = node.next_page();
-  if (BP_INVALID_PAGE_NUM == next_page_num) {
-    return RC::RECORD_EOF;
+  // 当前页面已经遍历完了，记下最后遍历的键值，移动到后面(反向扫描时是前面)的页面
+  MemPoolItem::unique_ptr last_key = tree_handler_.mem_pool_item_->alloc_unique_ptr();
+  if (last_key == nullptr) {
+    LOG_WARN("failed to alloc memory for key");
+    return RC::NOMEM;
   }
+  const int last_index = reverse_ ? 0 : node.size() - 1;
+  memcpy(last_key.get(), node.key_at(last_index), tree_handler_.file_header_.key_length);
 
-  const int memo_point = latch_memo_.memo_point();
-  rc = latch_memo_.get_page(next_page_num, current_frame_);
+  const char *resume_key = static_cast<const char *>(last_key.get());
+  RC rc = reverse_ ? move_to_prev_leaf(resume_key) : move_to_next_leaf(resume_key);
   if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to get next page. page num=%d, rc=%s", next_page_num, strrc(rc));
+    if (rc != RC::RECORD_EOF) {
+      LOG_WARN("failed to move to next leaf page. reverse=%d, rc=%s", reverse_, strrc(rc));
+    }
     return rc;
   }
 
-  /**
-   * 如果这里直接去加锁，那可能会造成死锁
-   * 因为这里访问页面的方式顺序与插入、删除的顺序不一样
-   * 如果加锁失败，就由上层做重试
-   */
-  bool locked = latch_memo_.try_slatch(current_frame_);
-  if (!locked) {
-    return RC::LOCKED_NEED_WAIT;
+  if (touch_end()) {
+    return RC::RECORD_EOF;
   }
 
-  latch_memo_.release_to(memo_point);
-  iter_index_ = -1; // `next` will add 1
-  return next_entry(rid);
+  fetch_item(rid, user_key);
+  return RC::SUCCESS;
+}
+
+RC BplusTreeScanner::move_to_next_leaf(const char *resume_key)
+{
+  RC rc = RC::SUCCESS;
+  while (true) {
+    LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
+    if (iter_index_ < node.size()) {
+      return RC::SUCCESS;
+    }
+
+    const PageNum next_page_num = node.next_page();
+    if (BP_INVALID_PAGE_NUM == next_page_num) {
+      return RC::RECORD_EOF;
+    }
+
+    const int memo_point = latch_memo_.memo_point();
+    Frame *next_frame = nullptr;
+    rc = latch_memo_.get_page(next_page_num, next_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get next page. page num=%d, rc=%s", next_page_num, strrc(rc));
+      return rc;
+    }
+
+    /**
+     * 如果这里直接去加锁，那可能会造成死锁
+     * 因为合并节点时，可能先锁住右边的节点，再来锁左边的节点
+     * 加锁失败时，释放所有的锁，从根节点开始重新查找。插入数据导致的分裂不会阻塞这里，
+     * 所以只有在删除数据合并节点时才会走到这个流程
+     */
+    if (latch_memo_.try_slatch(next_frame)) {
+      latch_memo_.release_to(memo_point);
+      current_frame_ = next_frame;
+      iter_index_ = 0;
+      continue;
+    }
+
+    latch_memo_.release();
+    current_frame_ = nullptr;
+
+    tree_handler_.root_lock_.lock_shared();
+    if (resume_key == nullptr) {
+      rc = tree_handler_.left_most_page(latch_memo_, current_frame_);
+    } else {
+      rc = tree_handler_.find_leaf(latch_memo_, BplusTreeOperationType::READ, resume_key, current_frame_);
+    }
+    tree_handler_.root_lock_.unlock_shared();
+
+    if (rc == RC::EMPTY) {
+      return RC::RECORD_EOF;
+    } else if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to find leaf page again. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    iter_index_ = 0;
+    if (resume_key != nullptr) {
+      // 只返回比resume_key大的数据
+      bool found = false;
+      LeafIndexNodeHandler leaf_node(tree_handler_.file_header_, current_frame_);
+      iter_index_ = leaf_node.lookup(tree_handler_.key_comparator_, resume_key, &found);
+      if (found) {
+        iter_index_++;
+      }
+    }
+  }
+  return rc;
+}
+
+RC BplusTreeScanner::move_to_prev_leaf(const char *resume_key)
+{
+  RC rc = RC::SUCCESS;
+  while (true) {
+    if (iter_index_ >= 0) {
+      return RC::SUCCESS;
+    }
+
+    LeafIndexNodeHandler node(tree_handler_.file_header_, current_frame_);
+    const PageNum prev_page_num = node.prev_page();
+    if (BP_INVALID_PAGE_NUM == prev_page_num) {
+      return RC::RECORD_EOF;
+    }
+
+    const int memo_point = latch_memo_.memo_point();
+    Frame *prev_frame = nullptr;
+    rc = latch_memo_.get_page(prev_page_num, prev_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to get prev page. page num=%d, rc=%s", prev_page_num, strrc(rc));
+      return rc;
+    }
+
+    /**
+     * 分裂节点时会先锁住左边的节点，再去修改右边节点的prev_brother，所以这里只能尝试加锁。
+     * 加锁成功后，如果左边节点的右兄弟已经不是当前节点，说明左边的节点分裂了，新节点中的数据
+     * 还没有遍历，这时也需要从根节点重新查找
+     */
+    if (latch_memo_.try_slatch(prev_frame)) {
+      LeafIndexNodeHandler prev_node(tree_handler_.file_header_, prev_frame);
+      if (prev_node.next_page() == current_frame_->page_num()) {
+        latch_memo_.release_to(memo_point);
+        current_frame_ = prev_frame;
+        iter_index_ = prev_node.size() - 1;
+        continue;
+      }
+    }
+
+    latch_memo_.release();
+    current_frame_ = nullptr;
+
+    tree_handler_.root_lock_.lock_shared();
+    if (resume_key == nullptr) {
+      rc = tree_handler_.right_most_page(latch_memo_, current_frame_);
+    } else {
+      rc = tree_handler_.find_leaf(latch_memo_, BplusTreeOperationType::READ, resume_key, current_frame_);
+    }
+    tree_handler_.root_lock_.unlock_shared();
+
+    if (rc == RC::EMPTY) {
+      return RC::RECORD_EOF;
+    } else if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to find leaf page again. rc=%s", strrc(rc));
+      return rc;
+    }
+
+    // 只返回比resume_key小的数据
+    LeafIndexNodeHandler leaf_node(tree_handler_.file_header_, current_frame_);
+    if (resume_key == nullptr) {
+      iter_index_ = leaf_node.size() - 1;
+    } else {
+      iter_index_ = leaf_node.lookup(tree_handler_.key_comparator_, resume_key) - 1;
+    }
+  }
+  return rc;
 }
 
 RC BplusTreeScanner::close()
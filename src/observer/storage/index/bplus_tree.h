@@ -21,10 +21,13 @@ See the Mulan PSL v2 for more details. */
 #include <sstream>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "storage/record/record_manager.h"
 #include "storage/buffer/disk_buffer_pool.h"
 #include "storage/trx/latch_memo.h"
+#include "storage/index/index_bloom_filter.h"
+#include "storage/index/index_log.h"
 #include "sql/parser/parse_defs.h"
 #include "common/lang/comparator.h"
 #include "common/log/log.h"
@@ -241,16 +244,28 @@ struct IndexFileHeader
  * @ingroup BPlusTree
  * @code
  * storage format:
- * | page type | item number | parent page id |
+ * | page type | item number | parent page id | prev page id | next page id | level |
+ * | high key |
  * @endcode 
+ * @details 这里实现的是B-link树：同一层的节点(包括内部节点)通过next_brother串成一个链表，
+ * 每个节点还保存一个high key，表示当前节点中所有键值的上界(不包含)。
+ * 最右边的节点没有右兄弟，它的high key是无穷大，不会使用。
+ * 节点分裂后，原节点的一部分数据移动到了右兄弟中，并发的查找如果发现要找的键值不小于high key，
+ * 就沿着next_brother向右移动，因此查找不需要持有父节点的锁，也不会因为分裂而找不到数据。
+ * high key紧跟在头部之后，长度与键值相同(key_length)。
+ * prev_brother指向左边的兄弟节点，只用于反向扫描。加锁的顺序总是从左向右，所以沿着prev_brother
+ * 向左移动时只能尝试加锁。
  */
 struct IndexNode 
 {
-  static constexpr int HEADER_SIZE = 12;
+  static constexpr int HEADER_SIZE = 24;
 
   bool    is_leaf;
   int     key_num;
   PageNum parent;
+  PageNum prev_brother;  ///< 同一层中左边的兄弟节点
+  PageNum next_brother;  ///< 同一层中右边的兄弟节点
+  int     level;         ///< 节点所在的层次，叶子节点是0
 };
 
 /**
@@ -258,7 +273,7 @@ struct IndexNode
  * @ingroup BPlusTree
  * @code
  * storage format:
- * | common header | prev page id | next page id |
+ * | common header | high key |
  * | key0, rid0 | key1, rid1 | ... | keyn, ridn |
  * @endcode 
  * the key is in format: the key value of record and rid.
@@ -268,9 +283,8 @@ struct IndexNode
  */
 struct LeafIndexNode : public IndexNode 
 {
-  static constexpr int HEADER_SIZE = IndexNode::HEADER_SIZE + 4;
+  static constexpr int HEADER_SIZE = IndexNode::HEADER_SIZE;
 
-  PageNum next_brother;
   /**
    * leaf can store order keys and rids at most
    */
@@ -282,7 +296,7 @@ struct LeafIndexNode : public IndexNode
  * @ingroup BPlusTree
  * @code
  * storage format:
- * | common header |
+ * | common header | high key |
  * | key(0),page_id(0) | key(1), page_id(1) | ... | key(n), page_id(n) |
  * @endcode
  * the first key is ignored(key0).
@@ -298,6 +312,8 @@ struct InternalIndexNode : public IndexNode
   char array[0];
 };
 
+class InternalIndexNodeHandler;
+
 /**
  * @brief IndexNode 仅作为数据在内存或磁盘中的表示
  * @ingroup BPlusTree
@@ -325,12 +341,39 @@ public:
   PageNum parent_page_num() const;
   PageNum page_num() const;
 
+  void set_prev_page(PageNum page_num);
+  PageNum prev_page() const;
+  void set_next_page(PageNum page_num);
+  PageNum next_page() const;
+  void set_level(int level);
+  int  level() const;
+
+  /**
+   * @brief 当前节点是否有high key
+   * @details 只有最右边的节点没有右兄弟，它的high key是无穷大
+   */
+  bool has_high_key() const;
+  const char *high_key() const;
+  void set_high_key(const char *key);
+
+  /**
+   * @brief 要查找的键值是否已经不在当前节点的范围内，需要沿着右兄弟指针向右查找
+   */
+  bool need_move_right(const KeyComparator &comparator, const char *key) const;
+
   bool is_safe(BplusTreeOperationType op, bool is_root_node);
 
   bool validate() const;
 
   friend std::string to_string(const IndexNodeHandler &handler);
 
+protected:
+  /**
+   * @brief 校验节点的high key与父节点中记录的范围是否一致
+   * @param index_in_parent 当前节点在父节点中的位置
+   */
+  bool validate_high_key(const KeyComparator &comparator, InternalIndexNodeHandler &parent_node, int index_in_parent) const;
+
 protected:
   const IndexFileHeader &header_;
   PageNum page_num_;
@@ -348,8 +391,6 @@ public:
   virtual ~LeafIndexNodeHandler() = default;
 
   void init_empty();
-  void set_next_page(PageNum page_num);
-  PageNum next_page() const;
 
   char *key_at(int index);
   char *value_at(int index);
@@ -454,6 +495,14 @@ private:
 /**
  * @brief B+树的实现
  * @ingroup BPlusTree
+ * @details 并发控制使用B-link树的方法(Lehman & Yao)，而不是从根节点开始逐层加锁的latch crabbing：
+ * - 查找时每次只持有一个节点的锁，先释放父节点的锁再去加子节点的锁，如果因为并发分裂导致键值已经
+ *   不在当前节点中，就沿着右兄弟指针向右移动。查找不会被其它节点的分裂阻塞；
+ * - 插入时只对叶子节点加写锁，大部分情况下不需要分裂，也就只锁一个节点。叶子节点分裂时，先在同一层
+ *   把新节点链接到右边，然后再自底向上对父节点加锁插入分隔键。父节点通过查找时记录的路径找到；
+ * - 删除时如果叶子节点不会因此发生合并或重新分配，与插入一样只锁叶子节点。否则需要修改树的结构，
+ *   B-link树的查找不持有父节点的锁，无法安全地回收页面，这时对整棵树加写锁(root_lock_)再执行删除。
+ *   其它所有的操作都会对root_lock_加读锁，所以它们之间不会相互阻塞。
  */
 class BplusTreeHandler 
 {
@@ -488,6 +537,17 @@ public:
    */
   RC insert_entry(const char *user_key, const RID *rid);
 
+  /**
+   * @brief 向唯一索引中插入一个索引项
+   * @details 查找插入位置时会经过user_key相同的所有索引项，在同一次下降中完成重复键值的检查，
+   * 不需要额外的查找。已经存在的相同键值是否冲突由conflict_checker决定，比如对应的记录已经被删除了，
+   * 就不算冲突。检查和插入期间一直持有相关叶子节点的写锁，并发插入相同键值时只有一个能成功
+   * @param conflict_checker 参数是已经存在的相同键值的索引项对应的RID，返回true表示冲突。为空时任何相同键值都是冲突
+   * @return RECORD_DUPLICATE_KEY 存在冲突的键值
+   */
+  RC insert_unique_entry(const char *user_key, const RID *rid,
+                         const std::function<bool(const RID &)> &conflict_checker);
+
   /**
    * 从IndexHandle句柄对应的索引中删除一个值为（*pData，rid）的索引项
    * @return RECORD_INVALID_KEY 指定值不存在
@@ -506,6 +566,27 @@ public:
 
   RC sync();
 
+  /**
+   * @brief 为索引启用布隆过滤器，在 create 或 open 之后调用
+   * @details 等值查询(包括 get_entry 和左右边界相同的扫描)先检查过滤器，一定不存在的键值不会访问索引页面
+   * @param file_name 索引文件的名字，过滤器保存在它旁边
+   */
+  RC enable_bloom_filter(const char *file_name);
+  IndexBloomFilter *bloom_filter() { return bloom_filter_.get(); }
+
+  DiskBufferPool *buffer_pool() const { return disk_buffer_pool_; }
+
+  /**
+   * @brief 重做一条索引日志
+   * @details 叶子节点插入、删除索引项的日志按照节点的格式重做，其它日志直接修改页面数据
+   */
+  RC redo(const IndexLogEntry &entry);
+
+  /**
+   * @brief 日志重做完成以后，从文件头页面重新加载根节点等信息
+   */
+  RC finish_redo();
+
   /**
    * Check whether current B+ tree is invalid or not.
    * @return true means current tree is valid, return false means current tree is invalid.
@@ -531,21 +612,55 @@ private:
   bool validate_node_recursive(LatchMemo &latch_memo, Frame *frame);
 
 protected:
-  RC find_leaf(LatchMemo &latch_memo, BplusTreeOperationType op, const char *key, Frame *&frame);
+  /**
+   * @brief 查找指定键值所在的叶子节点
+   * @details 调用者需要对root_lock_加读锁。读操作对叶子节点加读锁，其它操作加写锁
+   * @param parent_pages 如果不为空，会记录查找过程中每一层经过的内部节点，用于分裂时查找父节点
+   */
+  RC find_leaf(LatchMemo &latch_memo, BplusTreeOperationType op, const char *key, Frame *&frame,
+               std::vector<PageNum> *parent_pages = nullptr);
   RC left_most_page(LatchMemo &latch_memo, Frame *&frame);
-  RC find_leaf_internal(LatchMemo &latch_memo, BplusTreeOperationType op, 
-                        const std::function<PageNum(InternalIndexNodeHandler &)> &child_page_getter, 
-                        Frame *&frame);
-  RC crabing_protocal_fetch_page(LatchMemo &latch_memo, BplusTreeOperationType op, PageNum page_num, bool is_root_page,
-                                 Frame *&frame);
+  RC right_most_page(LatchMemo &latch_memo, Frame *&frame);
 
-  RC insert_into_parent(LatchMemo &latch_memo, PageNum parent_page, Frame *left_frame, const char *pkey, 
-                        Frame &right_frame);
+  /**
+   * @brief 按照B-link树的方式，从根节点开始查找指定层次中包含key的节点
+   * @param key 查找的键值。如果是空，就不会向右移动，用于查找最左边的节点
+   * @param level 目标节点的层次
+   * @param latch_type 目标节点加锁的类型。中间经过的节点都加读锁，而且同时只持有一个节点的锁
+   */
+  RC find_node(LatchMemo &latch_memo, const char *key, int level, LatchMemoType latch_type,
+               const std::function<PageNum(InternalIndexNodeHandler &)> &child_page_getter,
+               std::vector<PageNum> *parent_pages, Frame *&frame);
+
+  /**
+   * @brief 如果key已经不在当前节点的范围内，就沿着右兄弟指针向右移动
+   * @details 先对右边的节点加锁，再释放当前节点，加锁顺序总是从左到右，不会死锁
+   */
+  RC move_right(LatchMemo &latch_memo, LatchMemoType latch_type, const char *key, Frame *&frame);
+
+  /**
+   * @brief 在对整棵树加写锁的情况下，查找叶子节点，并对路径上的所有节点加写锁
+   * @details 删除数据导致节点合并或重新分配时使用
+   */
+  RC find_leaf_for_restructure(LatchMemo &latch_memo, const char *key, Frame *&frame);
+
+  /**
+   * @brief 节点分裂后，找到并锁住分隔键应该插入的父节点
+   * @param parent_frame 如果当前节点是根节点，会创建一个新的根节点，这时返回空
+   */
+  RC find_parent_for_insert(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key,
+                            std::vector<PageNum> &parent_pages, Frame *&parent_frame);
 
   RC delete_entry_internal(LatchMemo &latch_memo, Frame *leaf_frame, const char *key);
 
   template <typename IndexNodeHandlerType>
   RC split(LatchMemo &latch_memo, Frame *frame, Frame *&new_frame);
+
+  /**
+   * @brief 修改节点的左兄弟指针
+   * @details 分裂和合并节点时使用，调用者已经持有左边节点的写锁，这里会对page_num加写锁
+   */
+  RC update_prev_page(LatchMemo &latch_memo, PageNum page_num, PageNum prev_page_num);
   template <typename IndexNodeHandlerType>
   RC coalesce_or_redistribute(LatchMemo &latch_memo, Frame *frame);
   template <typename IndexNodeHandlerType>
@@ -553,11 +668,31 @@ protected:
   template <typename IndexNodeHandlerType>
   RC redistribute(Frame *neighbor_frame, Frame *frame, Frame *parent_frame, int index);
 
-  RC insert_entry_into_parent(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key);
-  RC insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *frame, const char *pkey, const RID *rid);
+  RC insert_entry_into_parent(LatchMemo &latch_memo, Frame *frame, Frame *new_frame, const char *key,
+                              std::vector<PageNum> &parent_pages);
+  RC insert_entry_into_leaf_node(LatchMemo &latch_memo, Frame *frame, const char *pkey, const RID *rid,
+                                 std::vector<PageNum> &parent_pages);
+
+  /**
+   * @brief 检查唯一索引中是否有冲突的键值，同时找到插入的叶子节点
+   * @details frame是包含min_key的叶子节点，从这里开始向右检查所有user_key相同的索引项。
+   * 返回时frame是key应该插入的叶子节点，并且持有它的写锁，经过的其它节点都已经释放
+   * @param min_key 由user_key和最小的RID组成的键值
+   */
+  RC check_unique_and_find_leaf(LatchMemo &latch_memo, const char *min_key, const char *key,
+                                const std::function<bool(const RID &)> &conflict_checker, Frame *&frame);
   RC create_new_tree(const char *key, const RID *rid);
+  RC create_new_root(Frame *frame, Frame *new_frame, const char *key);
 
+  PageNum root_page_num() const;
+  /**
+   * @brief 修改根节点页面
+   * @details 分裂根节点时只对root_lock_加了读锁，查找可能同时在读取根节点页面，所以需要加root_page_lock_
+   */
   void update_root_page_num(PageNum root_page_num);
+  /**
+   * @brief 修改根节点页面，调用者已经持有root_page_lock_
+   */
   void update_root_page_num_locked(PageNum root_page_num);
 
   RC adjust_root(LatchMemo &latch_memo, Frame *root_frame);
@@ -571,15 +706,19 @@ protected:
   bool            header_dirty_ = false; // 
   IndexFileHeader file_header_;
 
-  // 在调整根节点时，需要加上这个锁。
+  // 整棵树的锁。删除数据导致树的结构收缩(合并节点、删除根节点)时加写锁，其它操作加读锁。
   // 这个锁可以使用递归读写锁，但是这里偷懒先不改
   common::SharedMutex   root_lock_;
+  // 保护file_header_中的根节点页面。分裂根节点时只持有root_lock_的读锁，查找可能同时在读根节点页面
+  mutable common::Mutex root_page_lock_;
 
   KeyComparator   key_comparator_;
   KeyPrinter      key_printer_;
 
   std::unique_ptr<common::MemPoolItem> mem_pool_item_;
 
+  std::unique_ptr<IndexBloomFilter> bloom_filter_;  ///< 没有启用时为空
+
 private:
   friend class BplusTreeScanner;
   friend class BplusTreeTester;
@@ -603,11 +742,18 @@ public:
    * @param right_user_key 扫描范围的右边界。如果是null，则没有右边界
    * @param right_len right_user_key 的内存大小(只有在变长字段中才会关注)
    * @param right_inclusive 右边界的值是否包含在内
+   * @param reverse 是否反向扫描，即从右边界开始按照键值从大到小返回数据
    */
   RC open(const char *left_user_key, int left_len, bool left_inclusive, 
-          const char *right_user_key, int right_len, bool right_inclusive);
+          const char *right_user_key, int right_len, bool right_inclusive, bool reverse = false);
 
-  RC next_entry(RID &rid);
+  /**
+   * @brief 获取下一条数据
+   * @param rid 数据的RID
+   * @param user_key 如果不为空，就把索引中的键值(不包含RID)复制到这里，用于索引覆盖扫描。
+   *                 调用者需要保证空间不小于索引字段的长度
+   */
+  RC next_entry(RID &rid, char *user_key = nullptr);
 
   RC close();
 
@@ -617,11 +763,31 @@ private:
    */
   RC fix_user_key(const char *user_key, int key_len, bool want_greater, char **fixed_key, bool *should_inclusive);
 
-  void fetch_item(RID &rid);
+  void fetch_item(RID &rid, char *user_key);
   bool touch_end();
 
+  /**
+   * @brief 当前叶子节点已经遍历完，移动到后面有数据的叶子节点
+   * @details 优先直接对右兄弟节点加锁，如果加锁失败，右边的节点可能正在被合并，为了避免死锁，
+   * 释放所有的锁，从根节点重新查找resume_key后面的数据
+   * @param resume_key 已经遍历过的键值，后面只会返回比它大的数据。如果是空，就从最左边的叶子节点开始
+   */
+  RC move_to_next_leaf(const char *resume_key);
+
+  /**
+   * @brief 反向扫描时，当前叶子节点已经遍历完，移动到前面有数据的叶子节点
+   * @details 加锁的顺序是从左到右，所以只尝试对左兄弟节点加锁。加锁失败或者左兄弟节点已经分裂，
+   * 就释放所有的锁，从根节点重新查找resume_key前面的数据
+   * @param resume_key 已经遍历过的键值，后面只会返回比它小的数据。如果是空，就从最右边的叶子节点开始
+   */
+  RC move_to_prev_leaf(const char *resume_key);
+
+  RC open_forward();
+  RC open_reverse();
+
 private:
   bool inited_ = false;
+  bool reverse_ = false;
   BplusTreeHandler &tree_handler_;
 
   LatchMemo latch_memo_;
@@ -630,6 +796,7 @@ private:
   /// 起始位置和终止位置都是有效的数据
   Frame *current_frame_ = nullptr;
 
+  common::MemPoolItem::unique_ptr left_key_;
   common::MemPoolItem::unique_ptr right_key_;
   int iter_index_ = -1;
   bool first_emitted_ = false;
@@ -42,6 +42,15 @@ RC BplusTreeIndex::create(const char *file_name, const IndexMeta &index_meta, co
     return rc;
   }
 
+  if (index_meta.bloom_filter()) {
+    rc = index_handler_.enable_bloom_filter(file_name);
+    if (RC::SUCCESS != rc) {
+      LOG_WARN("Failed to enable bloom filter, file_name:%s, index:%s, rc:%s", file_name, index_meta.name(), strrc(rc));
+      index_handler_.close();
+      return rc;
+    }
+  }
+
   inited_ = true;
   LOG_INFO(
       "Successfully create index, file_name:%s, index:%s, field:%s", file_name, index_meta.name(), index_meta.field());
@@ -70,6 +79,15 @@ RC BplusTreeIndex::open(const char *file_name, const IndexMeta &index_meta, cons
     return rc;
   }
 
+  if (index_meta.bloom_filter()) {
+    rc = index_handler_.enable_bloom_filter(file_name);
+    if (RC::SUCCESS != rc) {
+      LOG_WARN("Failed to enable bloom filter, file_name:%s, index:%s, rc:%s", file_name, index_meta.name(), strrc(rc));
+      index_handler_.close();
+      return rc;
+    }
+  }
+
   inited_ = true;
   LOG_INFO(
       "Successfully open index, file_name:%s, index:%s, field:%s", file_name, index_meta.name(), index_meta.field());
@@ -87,8 +105,11 @@ RC BplusTreeIndex::close()
   return RC::SUCCESS;
 }
 
-RC BplusTreeIndex::insert_entry(const char *record, const RID *rid)
+RC BplusTreeIndex::insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker)
 {
+  if (index_meta_.unique()) {
+    return index_handler_.insert_unique_entry(record + field_meta_.offset(), rid, conflict_checker);
+  }
   return index_handler_.insert_entry(record + field_meta_.offset(), rid);
 }
 
@@ -97,11 +118,11 @@ RC BplusTreeIndex::delete_entry(const char *record, const RID *rid)
   return index_handler_.delete_entry(record + field_meta_.offset(), rid);
 }
 
-IndexScanner *BplusTreeIndex::create_scanner(
-    const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len, bool right_inclusive)
+IndexScanner *BplusTreeIndex::create_scanner(const char *left_key, int left_len, bool left_inclusive,
+    const char *right_key, int right_len, bool right_inclusive, bool reverse)
 {
   BplusTreeIndexScanner *index_scanner = new BplusTreeIndexScanner(index_handler_);
-  RC rc = index_scanner->open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive);
+  RC rc = index_scanner->open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive, reverse);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to open index scanner. rc=%d:%s", rc, strrc(rc));
     delete index_scanner;
@@ -115,6 +136,16 @@ RC BplusTreeIndex::sync()
   return index_handler_.sync();
 }
 
+RC BplusTreeIndex::redo(const IndexLogEntry &entry)
+{
+  return index_handler_.redo(entry);
+}
+
+RC BplusTreeIndex::finish_redo()
+{
+  return index_handler_.finish_redo();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 BplusTreeIndexScanner::BplusTreeIndexScanner(BplusTreeHandler &tree_handler) : tree_scanner_(tree_handler)
 {}
@@ -124,10 +155,10 @@ BplusTreeIndexScanner::~BplusTreeIndexScanner() noexcept
   tree_scanner_.close();
 }
 
-RC BplusTreeIndexScanner::open(
-    const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len, bool right_inclusive)
+RC BplusTreeIndexScanner::open(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+    int right_len, bool right_inclusive, bool reverse)
 {
-  return tree_scanner_.open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive);
+  return tree_scanner_.open(left_key, left_len, left_inclusive, right_key, right_len, right_inclusive, reverse);
 }
 
 RC BplusTreeIndexScanner::next_entry(RID *rid)
@@ -135,6 +166,11 @@ RC BplusTreeIndexScanner::next_entry(RID *rid)
   return tree_scanner_.next_entry(*rid);
 }
 
+RC BplusTreeIndexScanner::next_entry(RID *rid, char *key)
+{
+  return tree_scanner_.next_entry(*rid, key);
+}
+
 RC BplusTreeIndexScanner::destroy()
 {
   delete this;
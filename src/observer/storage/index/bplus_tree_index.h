@@ -27,21 +27,27 @@ public:
   BplusTreeIndex() = default;
   virtual ~BplusTreeIndex() noexcept;
 
-  RC create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta);
-  RC open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta);
+  RC create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
+  RC open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
   RC close();
 
-  RC insert_entry(const char *record, const RID *rid) override;
+  RC insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker) override;
   RC delete_entry(const char *record, const RID *rid) override;
 
   /**
    * 扫描指定范围的数据
    */
   IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
-      int right_len, bool right_inclusive) override;
+      int right_len, bool right_inclusive, bool reverse) override;
 
   RC sync() override;
 
+  RC redo(const IndexLogEntry &entry) override;
+  RC finish_redo() override;
+
+protected:
+  DiskBufferPool *buffer_pool() const override { return index_handler_.buffer_pool(); }
+
 private:
   bool inited_ = false;
   BplusTreeHandler index_handler_;
@@ -58,10 +64,11 @@ public:
   ~BplusTreeIndexScanner() noexcept override;
 
   RC next_entry(RID *rid) override;
+  RC next_entry(RID *rid, char *key) override;
   RC destroy() override;
 
   RC open(const char *left_key, int left_len, bool left_inclusive, const char *right_key, int right_len,
-      bool right_inclusive);
+      bool right_inclusive, bool reverse);
 
 private:
   BplusTreeScanner tree_scanner_;
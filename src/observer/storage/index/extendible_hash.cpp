@@ -0,0 +1,707 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <algorithm>
+#include <sstream>
+
+#include "storage/index/extendible_hash.h"
+#include "common/log/log.h"
+
+using namespace std;
+using namespace common;
+
+static constexpr PageNum HASH_HEADER_PAGE = 1;
+
+static HashBucketHeader *bucket_header(Frame *frame)
+{
+  return reinterpret_cast<HashBucketHeader *>(frame->data());
+}
+
+string HashIndexFileHeader::to_string() const
+{
+  stringstream ss;
+  ss << "attr_length:" << attr_length << ","
+     << "key_length:" << key_length << ","
+     << "attr_type:" << attr_type << ","
+     << "global_depth:" << global_depth << ","
+     << "bucket_capacity:" << bucket_capacity << ","
+     << "dir_page_count:" << dir_page_count << ";";
+  return ss.str();
+}
+
+RC ExtendibleHashHandler::create(const char *file_name, AttrType attr_type, int attr_length,
+                                 int bucket_capacity /* = -1 */)
+{
+  BufferPoolManager &bpm = BufferPoolManager::instance();
+  RC rc = bpm.create_file(file_name);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to create file. file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+
+  DiskBufferPool *bp = nullptr;
+  rc = bpm.open_file(file_name, bp);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to open file. file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+
+  const int key_length = attr_length + static_cast<int>(sizeof(RID));
+  const int max_capacity = static_cast<int>((BP_PAGE_DATA_SIZE - sizeof(HashBucketHeader)) / key_length);
+  if (bucket_capacity <= 0 || bucket_capacity > max_capacity) {
+    bucket_capacity = max_capacity;
+  }
+
+  memset(&file_header_, 0, sizeof(file_header_));
+  file_header_.attr_length = attr_length;
+  file_header_.key_length = key_length;
+  file_header_.attr_type = attr_type;
+  file_header_.global_depth = 0;
+  file_header_.bucket_capacity = bucket_capacity;
+  disk_buffer_pool_ = bp;
+  attr_comparator_.init(attr_type, attr_length);
+
+  // 新文件别人还访问不到，不需要加锁
+  LatchMemo latch_memo(bp);
+  Frame *header_frame = nullptr;
+  rc = latch_memo.allocate_page(header_frame);
+  if (rc != RC::SUCCESS || header_frame->page_num() != HASH_HEADER_PAGE) {
+    LOG_WARN("failed to allocate header page for hash index. file=%s, rc=%s", file_name, strrc(rc));
+    latch_memo.release();
+    close();
+    return rc != RC::SUCCESS ? rc : RC::INTERNAL;
+  }
+
+  Frame *dir_frame = nullptr;
+  Frame *bucket_frame = nullptr;
+  rc = latch_memo.allocate_page(dir_frame);
+  if (rc == RC::SUCCESS) {
+    rc = latch_memo.allocate_page(bucket_frame);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to allocate pages for hash index. file=%s, rc=%s", file_name, strrc(rc));
+    latch_memo.release();
+    close();
+    return rc;
+  }
+
+  init_bucket(bucket_frame, 0 /*local_depth*/);
+  PageNum *dir_entries = reinterpret_cast<PageNum *>(dir_frame->data());
+  dir_entries[0] = bucket_frame->page_num();
+  dir_frame->mark_dirty();
+
+  file_header_.dir_page_count = 1;
+  file_header_.dir_pages[0] = dir_frame->page_num();
+  rc = write_header(latch_memo);
+  if (rc != RC::SUCCESS) {
+    latch_memo.release();
+    close();
+    return rc;
+  }
+
+  LOG_INFO("Successfully create hash index %s. header=%s", file_name, file_header_.to_string().c_str());
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::open(const char *file_name)
+{
+  if (disk_buffer_pool_ != nullptr) {
+    LOG_WARN("%s has been opened before index.open.", file_name);
+    return RC::RECORD_OPENNED;
+  }
+
+  BufferPoolManager &bpm = BufferPoolManager::instance();
+  DiskBufferPool *bp = nullptr;
+  RC rc = bpm.open_file(file_name, bp);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to open file name=%s, rc=%s", file_name, strrc(rc));
+    return rc;
+  }
+
+  Frame *frame = nullptr;
+  rc = bp->get_this_page(HASH_HEADER_PAGE, &frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("Failed to get header page. file name=%s, rc=%s", file_name, strrc(rc));
+    bpm.close_file(file_name);
+    return rc;
+  }
+
+  memcpy(&file_header_, frame->data(), sizeof(file_header_));
+  bp->unpin_page(frame);
+
+  disk_buffer_pool_ = bp;
+  attr_comparator_.init(file_header_.attr_type, file_header_.attr_length);
+  LOG_INFO("Successfully open hash index %s. header=%s", file_name, file_header_.to_string().c_str());
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::close()
+{
+  if (disk_buffer_pool_ != nullptr) {
+    disk_buffer_pool_->close_file();
+  }
+  disk_buffer_pool_ = nullptr;
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::sync()
+{
+  return disk_buffer_pool_->flush_all_pages();
+}
+
+RC ExtendibleHashHandler::finish_redo()
+{
+  Frame *frame = nullptr;
+  RC rc = disk_buffer_pool_->get_this_page(HASH_HEADER_PAGE, &frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch header page of hash index. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  memcpy(&file_header_, frame->data(), sizeof(file_header_));
+  disk_buffer_pool_->unpin_page(frame);
+  return RC::SUCCESS;
+}
+
+uint32_t ExtendibleHashHandler::hash_key(const char *user_key) const
+{
+  // 字符串比较时只比较'\0'之前的部分，后面的内容不能参与计算
+  size_t length = file_header_.attr_length;
+  if (file_header_.attr_type == CHARS) {
+    length = strnlen(user_key, length);
+  }
+
+  // FNV-1a，再用murmur3的finalizer把高位的变化扩散到低位，目录使用的是哈希值的低位
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(user_key[i]);
+    hash *= 16777619u;
+  }
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+void ExtendibleHashHandler::init_bucket(Frame *frame, int local_depth)
+{
+  HashBucketHeader *header = bucket_header(frame);
+  header->local_depth = local_depth;
+  header->size = 0;
+  header->overflow_page = BP_INVALID_PAGE_NUM;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(HashBucketHeader));
+}
+
+char *ExtendibleHashHandler::item_at(Frame *frame, int index) const
+{
+  return frame->data() + sizeof(HashBucketHeader) + index * file_header_.key_length;
+}
+
+RC ExtendibleHashHandler::write_header(LatchMemo &latch_memo)
+{
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(HASH_HEADER_PAGE, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch header page of hash index. rc=%s", strrc(rc));
+    return rc;
+  }
+  memcpy(frame->data(), &file_header_, sizeof(file_header_));
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, frame->data(), sizeof(file_header_));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::get_dir_entry(LatchMemo &latch_memo, uint32_t index, PageNum &page_num)
+{
+  const int dir_page_index = index / HashIndexFileHeader::DIR_ENTRIES_PER_PAGE;
+  ASSERT(dir_page_index < file_header_.dir_page_count, "invalid directory index. index=%u, header=%s",
+         index, file_header_.to_string().c_str());
+
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(file_header_.dir_pages[dir_page_index], frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch directory page. page num=%d, rc=%s", file_header_.dir_pages[dir_page_index], strrc(rc));
+    return rc;
+  }
+  const PageNum *dir_entries = reinterpret_cast<const PageNum *>(frame->data());
+  page_num = dir_entries[index % HashIndexFileHeader::DIR_ENTRIES_PER_PAGE];
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::set_dir_entry(LatchMemo &latch_memo, uint32_t index, PageNum page_num)
+{
+  const int dir_page_index = index / HashIndexFileHeader::DIR_ENTRIES_PER_PAGE;
+  Frame *frame = nullptr;
+  RC rc = latch_memo.get_page(file_header_.dir_pages[dir_page_index], frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch directory page. page num=%d, rc=%s", file_header_.dir_pages[dir_page_index], strrc(rc));
+    return rc;
+  }
+  PageNum *dir_entries = reinterpret_cast<PageNum *>(frame->data());
+  PageNum *dir_entry = &dir_entries[index % HashIndexFileHeader::DIR_ENTRIES_PER_PAGE];
+  *dir_entry = page_num;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, dir_entry, sizeof(PageNum));
+  latch_memo.release_frame(frame);
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::fetch_bucket(LatchMemo &latch_memo, uint32_t hash, LatchMemoType latch_type, Frame *&frame)
+{
+  PageNum page_num = BP_INVALID_PAGE_NUM;
+  RC rc = get_dir_entry(latch_memo, dir_index(hash), page_num);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  rc = latch_memo.get_page(page_num, frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to fetch bucket page. page num=%d, rc=%s", page_num, strrc(rc));
+    return rc;
+  }
+  if (latch_type != LatchMemoType::PIN) {
+    latch_memo.latch(frame, latch_type);
+  }
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::fetch_chain(LatchMemo &latch_memo, Frame *bucket_frame, vector<Frame *> &frames)
+{
+  frames.push_back(bucket_frame);
+  PageNum next_page_num = bucket_header(bucket_frame)->overflow_page;
+  while (next_page_num != BP_INVALID_PAGE_NUM) {
+    Frame *frame = nullptr;
+    RC rc = latch_memo.get_page(next_page_num, frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to fetch overflow page. page num=%d, rc=%s", next_page_num, strrc(rc));
+      return rc;
+    }
+    frames.push_back(frame);
+    next_page_num = bucket_header(frame)->overflow_page;
+  }
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::append_item(LatchMemo &latch_memo, Frame *&tail_frame, const char *key)
+{
+  HashBucketHeader *header = bucket_header(tail_frame);
+  if (header->size >= file_header_.bucket_capacity) {
+    Frame *new_frame = nullptr;
+    RC rc = latch_memo.allocate_page(new_frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to allocate overflow page. rc=%s", strrc(rc));
+      return rc;
+    }
+    init_bucket(new_frame, header->local_depth);
+    header->overflow_page = new_frame->page_num();
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *tail_frame, header, sizeof(HashBucketHeader));
+
+    tail_frame = new_frame;
+    header = bucket_header(tail_frame);
+  }
+
+  char *item = item_at(tail_frame, header->size);
+  memcpy(item, key, file_header_.key_length);
+  header->size++;
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *tail_frame, item, file_header_.key_length);
+  IndexLogHandler::mark_dirty(*disk_buffer_pool_, *tail_frame, header, sizeof(HashBucketHeader));
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::insert_into_bucket(LatchMemo &latch_memo, Frame *bucket_frame, const char *key, bool unique,
+                                             const function<bool(const RID &)> &conflict_checker, bool &need_split)
+{
+  need_split = false;
+
+  vector<Frame *> frames;
+  RC rc = fetch_chain(latch_memo, bucket_frame, frames);
+  if (rc == RC::SUCCESS) {
+    rc = insert_into_chain(latch_memo, frames, key, unique, conflict_checker, need_split);
+  }
+
+  // 溢出页都由桶页面的锁保护，用完就可以释放
+  for (size_t i = 1; i < frames.size(); i++) {
+    latch_memo.release_frame(frames[i]);
+  }
+  return rc;
+}
+
+RC ExtendibleHashHandler::insert_into_chain(LatchMemo &latch_memo, const vector<Frame *> &frames, const char *key,
+                                            bool unique, const function<bool(const RID &)> &conflict_checker,
+                                            bool &need_split)
+{
+  const RID *rid = reinterpret_cast<const RID *>(key + file_header_.attr_length);
+  const uint32_t hash = hash_key(key);
+  bool all_same_hash = true;  // 桶中所有数据的哈希值是否都与新数据相同，相同时分裂也分不开
+  Frame *free_frame = nullptr;
+  for (Frame *frame : frames) {
+    const int size = bucket_header(frame)->size;
+    for (int i = 0; i < size; i++) {
+      const char *item = item_at(frame, i);
+      if (attr_comparator_(item, key) != 0) {
+        all_same_hash = all_same_hash && hash_key(item) == hash;
+        continue;
+      }
+
+      const RID *exist_rid = reinterpret_cast<const RID *>(item + file_header_.attr_length);
+      if (*exist_rid == *rid) {
+        LOG_TRACE("entry exists. rid=%s", rid->to_string().c_str());
+        return RC::RECORD_DUPLICATE_KEY;
+      }
+      if (unique && (!conflict_checker || conflict_checker(*exist_rid))) {
+        LOG_TRACE("duplicate key in unique index. exist rid=%s", exist_rid->to_string().c_str());
+        return RC::RECORD_DUPLICATE_KEY;
+      }
+    }
+
+    if (free_frame == nullptr && size < file_header_.bucket_capacity) {
+      free_frame = frame;
+    }
+  }
+
+  if (free_frame == nullptr) {
+    const int local_depth = bucket_header(frames.front())->local_depth;
+    if (!all_same_hash && local_depth < HashIndexFileHeader::MAX_GLOBAL_DEPTH) {
+      need_split = true;
+      return RC::SUCCESS;
+    }
+    // 在最后一个页面后面增加溢出页，新分配的页面在latch_memo释放时unpin
+    free_frame = frames.back();
+  }
+
+  return append_item(latch_memo, free_frame, key);
+}
+
+RC ExtendibleHashHandler::double_directory(LatchMemo &latch_memo)
+{
+  if (file_header_.global_depth >= HashIndexFileHeader::MAX_GLOBAL_DEPTH) {
+    LOG_WARN("hash index directory is too large. header=%s", file_header_.to_string().c_str());
+    return RC::INTERNAL;
+  }
+
+  const uint32_t old_size = 1u << file_header_.global_depth;
+  const uint32_t new_size = old_size * 2;
+  const int need_pages =
+      (new_size + HashIndexFileHeader::DIR_ENTRIES_PER_PAGE - 1) / HashIndexFileHeader::DIR_ENTRIES_PER_PAGE;
+  while (file_header_.dir_page_count < need_pages) {
+    Frame *frame = nullptr;
+    RC rc = latch_memo.allocate_page(frame);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to allocate directory page. rc=%s", strrc(rc));
+      return rc;
+    }
+    IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame);
+    file_header_.dir_pages[file_header_.dir_page_count++] = frame->page_num();
+    latch_memo.release_frame(frame);
+  }
+
+  // 新的一半目录项与原来的一半相同，指向同一个桶
+  for (uint32_t i = 0; i < old_size; i++) {
+    PageNum page_num = BP_INVALID_PAGE_NUM;
+    RC rc = get_dir_entry(latch_memo, i, page_num);
+    if (rc == RC::SUCCESS) {
+      rc = set_dir_entry(latch_memo, i + old_size, page_num);
+    }
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  file_header_.global_depth++;
+  return write_header(latch_memo);
+}
+
+RC ExtendibleHashHandler::split_bucket(LatchMemo &latch_memo, uint32_t hash)
+{
+  Frame *bucket_frame = nullptr;
+  RC rc = fetch_bucket(latch_memo, hash, LatchMemoType::PIN, bucket_frame);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int local_depth = bucket_header(bucket_frame)->local_depth;
+  if (local_depth == file_header_.global_depth) {
+    rc = double_directory(latch_memo);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  // 先把桶中所有的数据复制出来，再按照哈希值的第local_depth位重新分配到两个桶中
+  vector<Frame *> frames;
+  rc = fetch_chain(latch_memo, bucket_frame, frames);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  const int key_length = file_header_.key_length;
+  vector<char> items;
+  for (Frame *frame : frames) {
+    const int size = bucket_header(frame)->size;
+    items.insert(items.end(), item_at(frame, 0), item_at(frame, size));
+  }
+  for (size_t i = 1; i < frames.size(); i++) {
+    latch_memo.release_frame(frames[i]);
+    latch_memo.dispose_page(frames[i]->page_num());
+  }
+
+  Frame *new_frame = nullptr;
+  rc = latch_memo.allocate_page(new_frame);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to allocate bucket page. rc=%s", strrc(rc));
+    return rc;
+  }
+  init_bucket(bucket_frame, local_depth + 1);
+  init_bucket(new_frame, local_depth + 1);
+
+  Frame *tail_frame = bucket_frame;
+  Frame *new_tail_frame = new_frame;
+  for (size_t offset = 0; offset < items.size(); offset += key_length) {
+    const char *item = items.data() + offset;
+    if ((hash_key(item) >> local_depth) & 1) {
+      rc = append_item(latch_memo, new_tail_frame, item);
+    } else {
+      rc = append_item(latch_memo, tail_frame, item);
+    }
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  // 原来指向这个桶的目录项中，第local_depth位是1的改为指向新的桶
+  const uint32_t step = 1u << local_depth;
+  const uint32_t dir_size = 1u << file_header_.global_depth;
+  for (uint32_t i = hash & (step - 1); i < dir_size; i += step) {
+    if ((i >> local_depth) & 1) {
+      rc = set_dir_entry(latch_memo, i, new_frame->page_num());
+      if (rc != RC::SUCCESS) {
+        return rc;
+      }
+    }
+  }
+
+  LOG_TRACE("split hash bucket. page=%d, new page=%d, local depth=%d, global depth=%d",
+            bucket_frame->page_num(), new_frame->page_num(), local_depth + 1, file_header_.global_depth);
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::insert_entry_internal(const char *user_key, const RID *rid, bool unique,
+                                                const function<bool(const RID &)> &conflict_checker)
+{
+  if (user_key == nullptr || rid == nullptr) {
+    LOG_WARN("Invalid arguments, key is empty or rid is empty");
+    return RC::INVALID_ARGUMENT;
+  }
+
+  vector<char> key(file_header_.key_length);
+  memcpy(key.data(), user_key, file_header_.attr_length);
+  memcpy(key.data() + file_header_.attr_length, rid, sizeof(*rid));
+  const uint32_t hash = hash_key(user_key);
+
+  bool need_split = false;
+  {
+    LatchMemo latch_memo(disk_buffer_pool_);
+    latch_memo.slatch(&dir_lock_);
+
+    Frame *frame = nullptr;
+    RC rc = fetch_bucket(latch_memo, hash, LatchMemoType::EXCLUSIVE, frame);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    rc = insert_into_bucket(latch_memo, frame, key.data(), unique, conflict_checker, need_split);
+    if (rc != RC::SUCCESS || !need_split) {
+      return rc;
+    }
+  }
+
+  // 桶需要分裂。对目录加写锁后重新检查，期间可能别人已经分裂过了
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.xlatch(&dir_lock_);
+  while (true) {
+    Frame *frame = nullptr;
+    RC rc = fetch_bucket(latch_memo, hash, LatchMemoType::PIN, frame);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+
+    rc = insert_into_bucket(latch_memo, frame, key.data(), unique, conflict_checker, need_split);
+    latch_memo.release_frame(frame);
+    if (rc != RC::SUCCESS || !need_split) {
+      return rc;
+    }
+
+    rc = split_bucket(latch_memo, hash);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to split hash bucket. rc=%s", strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC ExtendibleHashHandler::insert_entry(const char *user_key, const RID *rid)
+{
+  return insert_entry_internal(user_key, rid, false /*unique*/, nullptr);
+}
+
+RC ExtendibleHashHandler::insert_unique_entry(const char *user_key, const RID *rid,
+                                              const function<bool(const RID &)> &conflict_checker)
+{
+  return insert_entry_internal(user_key, rid, true /*unique*/, conflict_checker);
+}
+
+RC ExtendibleHashHandler::delete_entry(const char *user_key, const RID *rid)
+{
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.slatch(&dir_lock_);
+
+  Frame *bucket_frame = nullptr;
+  RC rc = fetch_bucket(latch_memo, hash_key(user_key), LatchMemoType::EXCLUSIVE, bucket_frame);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  vector<Frame *> frames;
+  rc = fetch_chain(latch_memo, bucket_frame, frames);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  // 用页面中最后一项覆盖删除的数据。溢出页空了也不回收，后面插入时还会使用
+  for (Frame *frame : frames) {
+    HashBucketHeader *header = bucket_header(frame);
+    for (int i = 0; i < header->size; i++) {
+      char *item = item_at(frame, i);
+      if (attr_comparator_(item, user_key) != 0 ||
+          *reinterpret_cast<const RID *>(item + file_header_.attr_length) != *rid) {
+        continue;
+      }
+
+      if (i != header->size - 1) {
+        memcpy(item, item_at(frame, header->size - 1), file_header_.key_length);
+        IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, item, file_header_.key_length);
+      }
+      header->size--;
+      IndexLogHandler::mark_dirty(*disk_buffer_pool_, *frame, header, sizeof(HashBucketHeader));
+      return RC::SUCCESS;
+    }
+  }
+  return RC::RECORD_INVALID_KEY;
+}
+
+RC ExtendibleHashHandler::get_entry(const char *user_key, vector<RID> &rids)
+{
+  LatchMemo latch_memo(disk_buffer_pool_);
+  latch_memo.slatch(&dir_lock_);
+
+  Frame *bucket_frame = nullptr;
+  RC rc = fetch_bucket(latch_memo, hash_key(user_key), LatchMemoType::SHARED, bucket_frame);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  vector<Frame *> frames;
+  rc = fetch_chain(latch_memo, bucket_frame, frames);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  for (Frame *frame : frames) {
+    const int size = bucket_header(frame)->size;
+    for (int i = 0; i < size; i++) {
+      const char *item = item_at(frame, i);
+      if (attr_comparator_(item, user_key) == 0) {
+        rids.push_back(*reinterpret_cast<const RID *>(item + file_header_.attr_length));
+      }
+    }
+  }
+  return RC::SUCCESS;
+}
+
+bool ExtendibleHashHandler::validate()
+{
+  LatchMemo latch_memo(disk_buffer_pool_);
+  const uint32_t dir_size = 1u << file_header_.global_depth;
+  for (uint32_t index = 0; index < dir_size; index++) {
+    Frame *bucket_frame = nullptr;
+    RC rc = fetch_bucket(latch_memo, index, LatchMemoType::PIN, bucket_frame);
+    if (rc != RC::SUCCESS) {
+      return false;
+    }
+
+    const int local_depth = bucket_header(bucket_frame)->local_depth;
+    if (local_depth > file_header_.global_depth) {
+      LOG_WARN("invalid local depth. index=%u, local depth=%d, global depth=%d",
+               index, local_depth, file_header_.global_depth);
+      return false;
+    }
+
+    vector<Frame *> frames;
+    rc = fetch_chain(latch_memo, bucket_frame, frames);
+    if (rc != RC::SUCCESS) {
+      return false;
+    }
+
+    // 桶中所有数据哈希值的低local_depth位都与目录项的下标相同
+    const uint32_t mask = (1u << local_depth) - 1;
+    for (Frame *frame : frames) {
+      const int size = bucket_header(frame)->size;
+      if (size < 0 || size > file_header_.bucket_capacity) {
+        LOG_WARN("invalid bucket size. page=%d, size=%d", frame->page_num(), size);
+        return false;
+      }
+      for (int i = 0; i < size; i++) {
+        if ((hash_key(item_at(frame, i)) & mask) != (index & mask)) {
+          LOG_WARN("item in wrong bucket. index=%u, page=%d, item=%d", index, frame->page_num(), i);
+          return false;
+        }
+      }
+    }
+    latch_memo.release();
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ExtendibleHashScanner::ExtendibleHashScanner(ExtendibleHashHandler &handler) : handler_(handler)
+{}
+
+RC ExtendibleHashScanner::open(const char *user_key, int key_len)
+{
+  const int attr_length = handler_.attr_length();
+  key_.assign(attr_length, 0);
+  rids_.clear();
+  position_ = 0;
+
+  // 字符串可能比字段长，超出字段长度的部分不是空的话，就不可能有相等的数据
+  if (key_len > attr_length && user_key[attr_length] != 0) {
+    return RC::SUCCESS;
+  }
+  memcpy(key_.data(), user_key, std::min(key_len, attr_length));
+  return handler_.get_entry(key_.data(), rids_);
+}
+
+RC ExtendibleHashScanner::next_entry(RID &rid)
+{
+  if (position_ >= rids_.size()) {
+    return RC::RECORD_EOF;
+  }
+  rid = rids_[position_++];
+  return RC::SUCCESS;
+}
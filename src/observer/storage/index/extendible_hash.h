@@ -0,0 +1,217 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storage/index/bplus_tree.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/trx/latch_memo.h"
+#include "common/lang/mutex.h"
+
+/**
+ * @brief 可扩展哈希(Extendible Hashing)的实现
+ * @defgroup ExtendibleHash
+ * @details 目录(directory)是一个长度为2^global_depth的数组，保存桶页面的页号，使用键值哈希值的低global_depth位定位。
+ * 每个桶有自己的local_depth，有2^(global_depth-local_depth)个目录项指向同一个桶。
+ * 桶满了就分裂成两个，只有local_depth等于global_depth时目录才需要翻倍。
+ * 相同键值(或者哈希值完全相同)的数据分裂也分不开，这时在桶后面串上溢出页。
+ * 桶不会合并，目录也不会缩小。
+ */
+
+/**
+ * @brief 哈希索引文件的头部信息
+ * @ingroup ExtendibleHash
+ * @details 存放在索引文件的第一个页面中。目录分散在多个目录页中，每个目录页存放DIR_ENTRIES_PER_PAGE个页号
+ */
+struct HashIndexFileHeader
+{
+  static constexpr int MAX_DIR_PAGES = 256;
+  static constexpr int DIR_ENTRIES_PER_PAGE = 1024;
+  static constexpr int MAX_GLOBAL_DEPTH = 18;  ///< 2^18 = MAX_DIR_PAGES * DIR_ENTRIES_PER_PAGE
+
+  int32_t  attr_length;                ///< 键值的长度
+  int32_t  key_length;                 ///< attr_length + sizeof(RID)
+  AttrType attr_type;                  ///< 键值的类型
+  int32_t  global_depth;               ///< 目录的全局深度
+  int32_t  bucket_capacity;            ///< 每个桶页面最多存放的数据项数
+  int32_t  dir_page_count;             ///< 目录页的个数
+  PageNum  dir_pages[MAX_DIR_PAGES];   ///< 目录页的页号
+
+  std::string to_string() const;
+};
+
+/**
+ * @brief 桶页面的头部
+ * @ingroup ExtendibleHash
+ * @code
+ * | local depth | item number | overflow page | item0(key + rid) | item1 | ... |
+ * @endcode
+ * @details 溢出页的格式与桶页面相同，local_depth没有意义
+ */
+struct HashBucketHeader
+{
+  int32_t local_depth;    ///< 桶的局部深度
+  int32_t size;           ///< 当前页面中的数据项数
+  PageNum overflow_page;  ///< 下一个溢出页，没有就是BP_INVALID_PAGE_NUM
+};
+
+/**
+ * @brief 可扩展哈希索引的操作类
+ * @ingroup ExtendibleHash
+ * @details 并发控制：目录由dir_lock_保护，插入、删除和查找对它加读锁，再对桶页面加锁，溢出页由桶页面的锁保护。
+ * 分裂桶时对dir_lock_加写锁，这时没有其它的操作，不再对页面加锁。
+ */
+class ExtendibleHashHandler
+{
+public:
+  /**
+   * @brief 创建索引文件
+   * @param bucket_capacity 每个桶存放的数据项数，小于0时按照页面大小计算。测试时使用较小的值
+   */
+  RC create(const char *file_name, AttrType attr_type, int attr_length, int bucket_capacity = -1);
+  RC open(const char *file_name);
+  RC close();
+
+  /**
+   * @brief 插入一个值为(user_key, rid)的数据项
+   * @return RECORD_DUPLICATE_KEY 相同的数据项已经存在
+   */
+  RC insert_entry(const char *user_key, const RID *rid);
+
+  /**
+   * @brief 向唯一索引中插入数据项
+   * @details 相同键值的数据一定在同一个桶中，检查和插入都在持有桶页面写锁的情况下完成
+   * @param conflict_checker 与 BplusTreeHandler::insert_unique_entry 中的含义相同
+   */
+  RC insert_unique_entry(const char *user_key, const RID *rid,
+                         const std::function<bool(const RID &)> &conflict_checker);
+
+  /**
+   * @brief 删除值为(user_key, rid)的数据项
+   * @return RECORD_INVALID_KEY 指定的数据项不存在
+   */
+  RC delete_entry(const char *user_key, const RID *rid);
+
+  /**
+   * @brief 查找键值等于user_key的所有数据
+   * @note 这里假设user_key的内存大小与attr_length一致
+   */
+  RC get_entry(const char *user_key, std::vector<RID> &rids);
+
+  RC sync();
+
+  DiskBufferPool *buffer_pool() const { return disk_buffer_pool_; }
+
+  /**
+   * @brief 日志重做完成以后，重新加载文件头
+   */
+  RC finish_redo();
+
+  int attr_length() const { return file_header_.attr_length; }
+  int global_depth() const { return file_header_.global_depth; }
+
+  /**
+   * @brief 检查目录和桶中的数据是否一致
+   * @note thread unsafe
+   */
+  bool validate();
+
+private:
+  RC insert_entry_internal(const char *user_key, const RID *rid, bool unique,
+                           const std::function<bool(const RID &)> &conflict_checker);
+
+  /**
+   * @brief 在桶中插入数据项
+   * @details 调用者持有桶页面的写锁，或者持有目录的写锁。
+   * 桶和溢出页都满了的时候，如果分裂可以把数据分开，就不插入，设置need_split；否则增加一个溢出页
+   */
+  RC insert_into_bucket(LatchMemo &latch_memo, Frame *bucket_frame, const char *key, bool unique,
+                        const std::function<bool(const RID &)> &conflict_checker, bool &need_split);
+
+  RC insert_into_chain(LatchMemo &latch_memo, const std::vector<Frame *> &frames, const char *key, bool unique,
+                       const std::function<bool(const RID &)> &conflict_checker, bool &need_split);
+
+  /**
+   * @brief 分裂哈希值hash所在的桶，需要的话先把目录翻倍
+   * @details 调用者持有目录的写锁
+   */
+  RC split_bucket(LatchMemo &latch_memo, uint32_t hash);
+  RC double_directory(LatchMemo &latch_memo);
+
+  /**
+   * @brief 在桶的最后一个页面追加数据项，最后一个页面满了就增加一个溢出页
+   * @param[in,out] tail_frame 桶的最后一个页面，增加溢出页后指向新的页面
+   */
+  RC append_item(LatchMemo &latch_memo, Frame *&tail_frame, const char *key);
+
+  /**
+   * @brief 获取桶页面及它所有的溢出页
+   * @details 溢出页只固定(pin)在内存中，不加锁
+   */
+  RC fetch_chain(LatchMemo &latch_memo, Frame *bucket_frame, std::vector<Frame *> &frames);
+
+  /**
+   * @brief 根据哈希值获取桶页面，并按照latch_type加锁。latch_type是PIN时只固定页面，不加锁
+   */
+  RC fetch_bucket(LatchMemo &latch_memo, uint32_t hash, LatchMemoType latch_type, Frame *&frame);
+  RC get_dir_entry(LatchMemo &latch_memo, uint32_t index, PageNum &page_num);
+  RC set_dir_entry(LatchMemo &latch_memo, uint32_t index, PageNum page_num);
+  RC write_header(LatchMemo &latch_memo);
+
+  uint32_t hash_key(const char *user_key) const;
+  uint32_t dir_index(uint32_t hash) const { return hash & ((1u << file_header_.global_depth) - 1); }
+
+  void init_bucket(Frame *frame, int local_depth);
+  char *item_at(Frame *frame, int index) const;
+
+private:
+  DiskBufferPool     *disk_buffer_pool_ = nullptr;
+  HashIndexFileHeader file_header_;
+  AttrComparator      attr_comparator_;
+
+  common::SharedMutex dir_lock_;  ///< 保护目录，分裂时加写锁
+};
+
+/**
+ * @brief 哈希索引的扫描器
+ * @ingroup ExtendibleHash
+ * @details 只支持等值查询，打开时就把所有匹配的RID取出来，后面遍历时不需要再持有页面的锁
+ */
+class ExtendibleHashScanner
+{
+public:
+  ExtendibleHashScanner(ExtendibleHashHandler &handler);
+
+  /**
+   * @brief 查找等于user_key的数据
+   * @param key_len user_key的长度。字符串可能与字段的长度不同，会按照字段长度做调整
+   */
+  RC open(const char *user_key, int key_len);
+  RC next_entry(RID &rid);
+
+  /**
+   * @brief 调整后的键值，所有匹配的数据的键值都与它相同
+   */
+  const char *key() const { return key_.data(); }
+
+private:
+  ExtendibleHashHandler &handler_;
+  std::vector<char>      key_;
+  std::vector<RID>       rids_;
+  size_t                 position_ = 0;
+};
@@ -0,0 +1,153 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+
+#include "storage/index/hash_index.h"
+#include "common/log/log.h"
+
+HashIndex::~HashIndex() noexcept
+{
+  close();
+}
+
+RC HashIndex::create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta)
+{
+  if (inited_) {
+    LOG_WARN("Failed to create index due to the index has been created before. file_name:%s, index:%s, field:%s",
+        file_name, index_meta.name(), index_meta.field());
+    return RC::RECORD_OPENNED;
+  }
+
+  Index::init(index_meta, field_meta);
+
+  RC rc = index_handler_.create(file_name, field_meta.type(), field_meta.len());
+  if (RC::SUCCESS != rc) {
+    LOG_WARN("Failed to create hash index handler, file_name:%s, index:%s, field:%s, rc:%s",
+        file_name, index_meta.name(), index_meta.field(), strrc(rc));
+    return rc;
+  }
+
+  inited_ = true;
+  LOG_INFO("Successfully create hash index, file_name:%s, index:%s, field:%s",
+      file_name, index_meta.name(), index_meta.field());
+  return RC::SUCCESS;
+}
+
+RC HashIndex::open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta)
+{
+  if (inited_) {
+    LOG_WARN("Failed to open index due to the index has been inited before. file_name:%s, index:%s, field:%s",
+        file_name, index_meta.name(), index_meta.field());
+    return RC::RECORD_OPENNED;
+  }
+
+  Index::init(index_meta, field_meta);
+
+  RC rc = index_handler_.open(file_name);
+  if (RC::SUCCESS != rc) {
+    LOG_WARN("Failed to open hash index handler, file_name:%s, index:%s, field:%s, rc:%s",
+        file_name, index_meta.name(), index_meta.field(), strrc(rc));
+    return rc;
+  }
+
+  inited_ = true;
+  LOG_INFO("Successfully open hash index, file_name:%s, index:%s, field:%s",
+      file_name, index_meta.name(), index_meta.field());
+  return RC::SUCCESS;
+}
+
+RC HashIndex::close()
+{
+  if (inited_) {
+    LOG_INFO("Begin to close hash index, index:%s, field:%s", index_meta_.name(), index_meta_.field());
+    index_handler_.close();
+    inited_ = false;
+  }
+  return RC::SUCCESS;
+}
+
+RC HashIndex::insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker)
+{
+  if (index_meta_.unique()) {
+    return index_handler_.insert_unique_entry(record + field_meta_.offset(), rid, conflict_checker);
+  }
+  return index_handler_.insert_entry(record + field_meta_.offset(), rid);
+}
+
+RC HashIndex::delete_entry(const char *record, const RID *rid)
+{
+  return index_handler_.delete_entry(record + field_meta_.offset(), rid);
+}
+
+IndexScanner *HashIndex::create_scanner(const char *left_key, int left_len, bool left_inclusive,
+    const char *right_key, int right_len, bool right_inclusive, bool reverse)
+{
+  // 相等的数据没有顺序，反向扫描与正向扫描相同
+  (void)reverse;
+  if (left_key == nullptr || right_key == nullptr || !left_inclusive || !right_inclusive || left_len != right_len ||
+      0 != memcmp(left_key, right_key, left_len)) {
+    LOG_WARN("hash index only supports equality lookup. index=%s", index_meta_.name());
+    return nullptr;
+  }
+
+  HashIndexScanner *index_scanner = new HashIndexScanner(index_handler_);
+  RC rc = index_scanner->open(left_key, left_len);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to open hash index scanner. rc=%s", strrc(rc));
+    delete index_scanner;
+    return nullptr;
+  }
+  return index_scanner;
+}
+
+RC HashIndex::sync()
+{
+  return index_handler_.sync();
+}
+
+RC HashIndex::finish_redo()
+{
+  return index_handler_.finish_redo();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+HashIndexScanner::HashIndexScanner(ExtendibleHashHandler &handler)
+    : hash_scanner_(handler), attr_length_(handler.attr_length())
+{}
+
+RC HashIndexScanner::open(const char *key, int key_len)
+{
+  return hash_scanner_.open(key, key_len);
+}
+
+RC HashIndexScanner::next_entry(RID *rid)
+{
+  return hash_scanner_.next_entry(*rid);
+}
+
+RC HashIndexScanner::next_entry(RID *rid, char *key)
+{
+  RC rc = hash_scanner_.next_entry(*rid);
+  if (rc == RC::SUCCESS) {
+    memcpy(key, hash_scanner_.key(), attr_length_);
+  }
+  return rc;
+}
+
+RC HashIndexScanner::destroy()
+{
+  delete this;
+  return RC::SUCCESS;
+}
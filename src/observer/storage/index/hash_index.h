@@ -0,0 +1,76 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include "storage/index/index.h"
+#include "storage/index/extendible_hash.h"
+
+/**
+ * @brief 哈希索引
+ * @ingroup Index
+ * @details 使用可扩展哈希实现，只支持等值查询，不能用于范围查询和排序
+ */
+class HashIndex : public Index 
+{
+public:
+  HashIndex() = default;
+  virtual ~HashIndex() noexcept;
+
+  RC create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
+  RC open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) override;
+  RC close();
+
+  RC insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker) override;
+  RC delete_entry(const char *record, const RID *rid) override;
+
+  /**
+   * @brief 创建扫描器
+   * @details 只支持左右边界相同并且都包含边界的等值查询，其它情况返回空
+   */
+  IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+      int right_len, bool right_inclusive, bool reverse) override;
+
+  RC sync() override;
+
+  RC finish_redo() override;
+
+protected:
+  DiskBufferPool *buffer_pool() const override { return index_handler_.buffer_pool(); }
+
+private:
+  bool inited_ = false;
+  ExtendibleHashHandler index_handler_;
+};
+
+/**
+ * @brief 哈希索引扫描器
+ * @ingroup Index
+ */
+class HashIndexScanner : public IndexScanner 
+{
+public:
+  HashIndexScanner(ExtendibleHashHandler &handler);
+  ~HashIndexScanner() noexcept override = default;
+
+  RC next_entry(RID *rid) override;
+  RC next_entry(RID *rid, char *key) override;
+  RC destroy() override;
+
+  RC open(const char *key, int key_len);
+
+private:
+  ExtendibleHashScanner hash_scanner_;
+  int                   attr_length_ = 0;
+};
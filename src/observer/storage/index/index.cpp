@@ -13,6 +13,8 @@ See the Mulan PSL v2 for more details. */
 //
 
 #include "storage/index/index.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "common/log/log.h"
 
 RC Index::init(const IndexMeta &index_meta, const FieldMeta &field_meta)
 {
@@ -20,3 +22,46 @@ RC Index::init(const IndexMeta &index_meta, const FieldMeta &field_meta)
   field_meta_ = field_meta;
   return RC::SUCCESS;
 }
+
+RC Index::enable_log(CLogManager &log_manager, int32_t table_id)
+{
+  DiskBufferPool *disk_buffer_pool = buffer_pool();
+  if (nullptr == disk_buffer_pool) {
+    LOG_WARN("index is not opened. index=%s", index_meta_.name());
+    return RC::INTERNAL;
+  }
+
+  log_handler_.reset(new IndexLogHandler(log_manager, table_id, index_meta_.name()));
+  disk_buffer_pool->set_log_handler(log_handler_.get());
+  LOG_INFO("redo log of index enabled. index=%s, table id=%d", index_meta_.name(), table_id);
+  return RC::SUCCESS;
+}
+
+RC Index::redo(const IndexLogEntry &entry)
+{
+  return IndexLogHandler::redo(*buffer_pool(), entry, nullptr /*node_redoer*/);
+}
+
+RC Index::estimate_count(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+    int right_len, bool right_inclusive, int limit, int &count)
+{
+  count = 0;
+  IndexScanner *scanner = create_scanner(
+      left_key, left_len, left_inclusive, right_key, right_len, right_inclusive, false /*reverse*/);
+  if (nullptr == scanner) {
+    LOG_WARN("failed to create index scanner. index=%s", index_meta_.name());
+    return RC::INTERNAL;
+  }
+
+  RC rc = RC::SUCCESS;
+  RID rid;
+  while (count < limit && RC::SUCCESS == (rc = scanner->next_entry(&rid))) {
+    count++;
+  }
+  scanner->destroy();
+
+  if (rc == RC::RECORD_EOF) {
+    rc = RC::SUCCESS;
+  }
+  return rc;
+}
@@ -15,15 +15,26 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <stddef.h>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include "common/rc.h"
 #include "storage/index/index_meta.h"
 #include "storage/field/field_meta.h"
 #include "storage/record/record_manager.h"
+#include "storage/index/index_log.h"
 
 class IndexScanner;
 
+/**
+ * @brief 唯一索引插入时，判断已经存在的相同键值是否冲突
+ * @ingroup Index
+ * @details 参数是已经存在的索引项对应的记录位置，返回true表示冲突。
+ * 索引中只有键值和记录位置，记录是否还有效需要由事务模块来判断，比如MVCC中已经删除并提交的记录就不算冲突
+ */
+using IndexEntryConflictChecker = std::function<bool(const RID &)>;
+
 /**
  * @brief 索引
  * @defgroup Index
@@ -45,13 +56,34 @@ public:
     return index_meta_;
   }
 
+  const FieldMeta &field_meta() const
+  {
+    return field_meta_;
+  }
+
+  /**
+   * @brief 创建索引文件并打开索引
+   * 
+   * @param file_name 索引文件的名字
+   * @param index_meta 索引的元数据
+   * @param field_meta 索引关联的字段
+   */
+  virtual RC create(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) = 0;
+
+  /**
+   * @brief 打开已经存在的索引文件
+   */
+  virtual RC open(const char *file_name, const IndexMeta &index_meta, const FieldMeta &field_meta) = 0;
+
   /**
    * @brief 插入一条数据
    * 
    * @param record 插入的记录，当前假设记录是定长的
    * @param[out] rid    插入的记录的位置
+   * @param conflict_checker 唯一索引检查重复键值时使用，为空时任何相同的键值都算冲突。非唯一索引忽略这个参数
+   * @return RECORD_DUPLICATE_KEY 唯一索引中存在冲突的键值
    */
-  virtual RC insert_entry(const char *record, const RID *rid) = 0;
+  virtual RC insert_entry(const char *record, const RID *rid, const IndexEntryConflictChecker &conflict_checker) = 0;
 
   /**
    * @brief 删除一条数据
@@ -70,9 +102,19 @@ public:
    * @param right_key 要扫描的右边界
    * @param right_len 右边界的长度
    * @param right_inclusive 是否包含右边界
+   * @param reverse 是否反向扫描，即按照键值从大到小返回数据
    */
   virtual IndexScanner *create_scanner(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
-      int right_len, bool right_inclusive) = 0;
+      int right_len, bool right_inclusive, bool reverse) = 0;
+
+  /**
+   * @brief 估算指定范围内索引项的个数
+   * @details 供优化器选择扫描方式时使用。最多统计到limit个，超过limit时直接返回limit。
+   * 参数的含义与 create_scanner 相同
+   * @param[out] count 估算出来的个数
+   */
+  virtual RC estimate_count(const char *left_key, int left_len, bool left_inclusive, const char *right_key,
+      int right_len, bool right_inclusive, int limit, int &count);
 
   /**
    * @brief 同步索引数据到磁盘
@@ -80,12 +122,38 @@ public:
    */
   virtual RC sync() = 0;
 
+  /**
+   * @brief 开启重做日志
+   * @details 之后对索引页面的所有修改都会记录日志，恢复时使用日志重做，不需要重建索引。
+   * 开启之前索引中的数据需要已经写入磁盘(参考 sync)
+   * @param table_id 索引所属的表，恢复时根据表和索引的名字找到索引
+   */
+  RC enable_log(CLogManager &log_manager, int32_t table_id);
+
+  /**
+   * @brief 重做一条索引页面的日志
+   */
+  virtual RC redo(const IndexLogEntry &entry);
+
+  /**
+   * @brief 所有的日志都重做完成
+   * @details 索引在内存中缓存的元数据(比如根节点)需要重新从页面中加载
+   */
+  virtual RC finish_redo() { return RC::SUCCESS; }
+
 protected:
   RC init(const IndexMeta &index_meta, const FieldMeta &field_meta);
 
+  /**
+   * @brief 索引文件使用的buffer pool
+   */
+  virtual DiskBufferPool *buffer_pool() const = 0;
+
 protected:
   IndexMeta index_meta_;  ///< 索引的元数据
   FieldMeta field_meta_;  ///< 当前实现仅考虑一个字段的索引
+
+  std::unique_ptr<IndexLogHandler> log_handler_;  ///< 没有开启日志时为空
 };
 
 /**
@@ -103,5 +171,13 @@ public:
    * 如果没有更多的元素，返回RECORD_EOF
    */
   virtual RC next_entry(RID *rid) = 0;
+
+  /**
+   * @brief 遍历元素数据，同时返回索引的键值
+   * @details 索引覆盖扫描时使用，不需要回表就可以拿到索引字段的值
+   * @param[out] key 索引键值，空间大小不能小于索引字段的长度
+   */
+  virtual RC next_entry(RID *rid, char *key) { return RC::UNIMPLENMENT; }
+
   virtual RC destroy() = 0;
 };
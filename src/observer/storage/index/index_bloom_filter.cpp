@@ -0,0 +1,187 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+#include "storage/index/index_bloom_filter.h"
+#include "common/io/io.h"
+#include "common/log/log.h"
+
+RC IndexBloomFilter::init(const char *index_file, AttrType attr_type, int attr_length, KeySource key_source)
+{
+  if (!support(attr_type)) {
+    LOG_WARN("bloom filter does not support attr type %s", attr_type_to_string(attr_type));
+    return RC::INVALID_ARGUMENT;
+  }
+
+  file_name_   = std::string(index_file) + FILE_SUFFIX;
+  attr_type_   = attr_type;
+  attr_length_ = attr_length;
+  key_source_  = std::move(key_source);
+
+  RC rc = load();
+  if (rc != RC::SUCCESS) {
+    LOG_INFO("bloom filter will be rebuilt on the first lookup. file=%s, rc=%s", file_name_.c_str(), strrc(rc));
+    stale_ = true;
+  }
+  return RC::SUCCESS;
+}
+
+RC IndexBloomFilter::load()
+{
+  if (::access(file_name_.c_str(), F_OK) != 0) {
+    return RC::FILE_NOT_EXIST;
+  }
+
+  char  *data = nullptr;
+  size_t size = 0;
+  if (common::readFromFile(file_name_, data, size) != 0) {
+    LOG_WARN("failed to read bloom filter file %s", file_name_.c_str());
+    return RC::IOERR_READ;
+  }
+
+  // 文件只在正常关闭时写入，读取以后就删掉，崩溃后重新打开不会用到旧的数据
+  ::unlink(file_name_.c_str());
+
+  RC rc = RC::SUCCESS;
+  FileHeader header;
+  if (size < sizeof(header)) {
+    rc = RC::IOERR_READ;
+  } else {
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != MAGIC || header.attr_type != attr_type_ || header.attr_length != attr_length_ ||
+        !filter_.deserialize(data + sizeof(header), size - sizeof(header))) {
+      LOG_WARN("invalid bloom filter file %s", file_name_.c_str());
+      rc = RC::IOERR_READ;
+    } else {
+      key_count_    = header.key_count;
+      delete_count_ = header.delete_count;
+      stale_        = false;
+    }
+  }
+  free(data);
+  return rc;
+}
+
+RC IndexBloomFilter::close()
+{
+  if (file_name_.empty() || stale_) {
+    return RC::SUCCESS;
+  }
+
+  FileHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic        = MAGIC;
+  header.attr_type    = attr_type_;
+  header.attr_length  = attr_length_;
+  header.key_count    = key_count_;
+  header.delete_count = delete_count_;
+
+  std::string buf(reinterpret_cast<const char *>(&header), sizeof(header));
+  std::string filter_data;
+  filter_.serialize(filter_data);
+  buf.append(filter_data);
+
+  if (common::writeToFile(file_name_, buf.data(), static_cast<uint32_t>(buf.size()), "wb") != 0) {
+    LOG_WARN("failed to write bloom filter file %s", file_name_.c_str());
+    return RC::IOERR_WRITE;
+  }
+  LOG_INFO("bloom filter saved. file=%s, keys=%ld", file_name_.c_str(), key_count_.load());
+  return RC::SUCCESS;
+}
+
+uint64_t IndexBloomFilter::hash_key(const char *user_key, int key_len) const
+{
+  // 字符串比较时只比较'\0'之前的部分，后面的内容不能参与计算
+  size_t length = attr_length_;
+  if (attr_type_ == CHARS) {
+    length = strnlen(user_key, std::min(key_len, attr_length_));
+  }
+  return common::BlockedBloomFilter::hash_bytes(user_key, length);
+}
+
+void IndexBloomFilter::add(const char *user_key)
+{
+  const uint64_t hash = hash_key(user_key, attr_length_);
+
+  lock_.lock_shared();
+  // 过期的过滤器会在重新构建时扫描到这个值
+  if (!stale_) {
+    filter_.add(hash);
+    if (++key_count_ > static_cast<int64_t>(filter_.capacity())) {
+      stale_ = true;
+    }
+  }
+  lock_.unlock_shared();
+}
+
+void IndexBloomFilter::remove()
+{
+  const int64_t delete_count = ++delete_count_;
+  if (delete_count > std::max(key_count_.load() / 2, MIN_CAPACITY / 2)) {
+    stale_ = true;
+  }
+}
+
+bool IndexBloomFilter::may_contain(const char *user_key, int key_len)
+{
+  if (stale_) {
+    RC rc = rebuild();
+    if (rc != RC::SUCCESS) {
+      return true;
+    }
+  }
+
+  const uint64_t hash = hash_key(user_key, key_len);
+
+  lock_.lock_shared();
+  const bool result = stale_ || filter_.may_contain(hash);
+  lock_.unlock_shared();
+  return result;
+}
+
+RC IndexBloomFilter::rebuild()
+{
+  lock_.lock();
+  if (!stale_) {
+    lock_.unlock();
+    return RC::SUCCESS;
+  }
+
+  std::vector<uint64_t> hashes;
+  RC rc = key_source_([this, &hashes](const char *user_key) { hashes.push_back(hash_key(user_key, attr_length_)); });
+  if (rc != RC::SUCCESS) {
+    lock_.unlock();
+    LOG_WARN("failed to scan index to rebuild bloom filter. rc=%s", strrc(rc));
+    return rc;
+  }
+
+  // 留出一倍的空间给后面插入的数据
+  const int64_t key_count = static_cast<int64_t>(hashes.size());
+  filter_.init(static_cast<size_t>(std::max(key_count * 2, MIN_CAPACITY)));
+  for (uint64_t hash : hashes) {
+    filter_.add(hash);
+  }
+
+  key_count_    = key_count;
+  delete_count_ = 0;
+  stale_        = false;
+  lock_.unlock();
+
+  LOG_INFO("bloom filter rebuilt. file=%s, keys=%ld, blocks=%ld", file_name_.c_str(), key_count, filter_.block_count());
+  return RC::SUCCESS;
+}
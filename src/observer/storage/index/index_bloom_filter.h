@@ -0,0 +1,126 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+
+#include "common/rc.h"
+#include "common/lang/mutex.h"
+#include "common/lang/bloom_filter.h"
+#include "sql/parser/value.h"
+
+/**
+ * @brief 索引的布隆过滤器
+ * @ingroup Index
+ * @details 等值查询之前先检查过滤器，一定不存在的键值直接返回空，不需要访问索引页面。
+ * 插入数据时同步修改过滤器。布隆过滤器不支持删除，删除的数据多了以后误判率会上升，
+ * 插入的数据超过容量时也是一样，这时把过滤器标记为过期，下次查询时扫描整个索引重新构建。
+ *
+ * 过滤器保存在索引文件旁边的 .bloom 文件中，只在正常关闭索引时写入。打开时读取以后就删除这个文件，
+ * 如果没有正常关闭(比如进程崩溃)，下次打开时找不到文件，也会重新构建，避免使用与索引数据不一致的过滤器。
+ *
+ * 浮点数的比较有误差范围，相等的值哈希值可能不同，所以不支持浮点数。
+ */
+class IndexBloomFilter
+{
+public:
+  /// 访问一个索引项的键值
+  using KeyVisitor = std::function<void(const char *user_key)>;
+  /// 遍历索引中的所有键值，重新构建过滤器时使用
+  using KeySource = std::function<RC(const KeyVisitor &)>;
+
+  static constexpr const char *FILE_SUFFIX = ".bloom";
+
+public:
+  IndexBloomFilter() = default;
+
+  static bool support(AttrType attr_type) { return attr_type == CHARS || attr_type == INTS; }
+
+  /**
+   * @brief 初始化过滤器，尝试从index_file对应的 .bloom 文件中加载数据
+   * @param key_source 遍历索引的所有键值。调用时过滤器持有自己的写锁，不能再访问过滤器
+   */
+  RC init(const char *index_file, AttrType attr_type, int attr_length, KeySource key_source);
+
+  /**
+   * @brief 把过滤器写到文件中。过期的过滤器不需要保存
+   */
+  RC close();
+
+  /**
+   * @brief 索引中插入了一个键值
+   * @details 需要在数据插入到索引以后调用，而且调用者不能持有索引页面的锁，否则可能与重新构建过滤器死锁
+   */
+  void add(const char *user_key);
+
+  /**
+   * @brief 索引中删除了一个键值
+   * @details 只是计数，删除的数据足够多以后标记为过期
+   */
+  void remove();
+
+  /**
+   * @brief 检查键值是否可能存在，过滤器过期时会先重新构建
+   * @param key_len user_key的长度。字符串可能与字段的长度不同
+   * @return false 表示一定不存在
+   */
+  bool may_contain(const char *user_key, int key_len);
+
+  /**
+   * @brief 扫描索引重新构建过滤器
+   */
+  RC rebuild();
+
+  bool   stale() const { return stale_.load(); }
+  size_t capacity() const { return filter_.capacity(); }
+
+private:
+  uint64_t hash_key(const char *user_key, int key_len) const;
+
+  RC load();
+
+private:
+  /**
+   * @brief .bloom 文件的头部，后面是过滤器的数据
+   */
+  struct FileHeader
+  {
+    uint32_t magic;
+    int32_t  attr_type;
+    int32_t  attr_length;
+    int32_t  reserved;
+    int64_t  key_count;
+    int64_t  delete_count;
+  };
+
+  static constexpr uint32_t MAGIC = 0x424c4f4d;  // "BLOM"
+  /// 重新构建时至少按照这么多个值分配空间，避免小表插入数据时频繁重新构建
+  static constexpr int64_t MIN_CAPACITY = 1024;
+
+private:
+  std::string file_name_;
+  AttrType    attr_type_   = UNDEFINED;
+  int         attr_length_ = 0;
+  KeySource   key_source_;
+
+  common::BlockedBloomFilter filter_;
+  common::SharedMutex        lock_;  ///< 重新构建时加写锁，其它操作加读锁
+
+  std::atomic<bool>    stale_{true};
+  std::atomic<int64_t> key_count_{0};     ///< 过滤器中的值的个数，包括已经删除的
+  std::atomic<int64_t> delete_count_{0};  ///< 构建以后删除的值的个数
+};
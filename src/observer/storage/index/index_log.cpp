@@ -0,0 +1,199 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "storage/index/index_log.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/buffer/frame.h"
+#include "common/log/log.h"
+
+using namespace std;
+using namespace common;
+
+RC IndexLogEntry::parse(const CLogRecord &log_record, IndexLogEntry &entry)
+{
+  const CLogRecordData &data_record = log_record.data_record();
+  if (!is_index_log(log_record.log_type()) || data_record.data_offset_ <= 0 ||
+      data_record.data_offset_ > data_record.data_len_) {
+    LOG_WARN("invalid index log record. log_record={%s}", log_record.to_string().c_str());
+    return RC::INVALID_ARGUMENT;
+  }
+
+  entry.type       = log_record.log_type();
+  entry.lsn        = log_record.lsn();
+  entry.index_name = string(data_record.data_, data_record.data_offset_);
+  entry.page_num   = data_record.rid_.page_num;
+  entry.slot       = data_record.rid_.slot_num;
+  entry.data       = data_record.data_ + data_record.data_offset_;
+  entry.len        = data_record.data_len_ - data_record.data_offset_;
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+IndexLogHandler::IndexLogHandler(CLogManager &log_manager, int32_t table_id, const char *index_name)
+    : log_manager_(log_manager), table_id_(table_id), index_name_(index_name)
+{}
+
+RC IndexLogHandler::append(CLogType type, Frame &frame, int slot, const char *data, int len)
+{
+  vector<char> buffer(index_name_.size() + len);
+  memcpy(buffer.data(), index_name_.data(), index_name_.size());
+  if (len > 0) {
+    memcpy(buffer.data() + index_name_.size(), data, len);
+  }
+
+  const RID rid(frame.page_num(), slot);
+  CLogRecord *log_record = CLogRecord::build_data_record(type,
+      0 /*trx_id*/,
+      table_id_,
+      rid,
+      static_cast<int32_t>(buffer.size()),
+      static_cast<int32_t>(index_name_.size()),
+      buffer.data());
+  if (nullptr == log_record) {
+    return RC::NOMEM;
+  }
+
+  // 页面上的LSN只能变大。父节点指针这类修改可能在没有页面锁的情况下进行，所以这里要加锁
+  lock_guard<Mutex> guard(lock_);
+  LSN lsn = 0;
+  RC rc = log_manager_.append_log(log_record, &lsn);
+  if (OB_FAIL(rc)) {
+    LOG_ERROR("failed to append index log. index=%s, page=%d, type=%s, rc=%s",
+              index_name_.c_str(), frame.page_num(), clog_type_name(type), strrc(rc));
+    return rc;
+  }
+
+  frame.set_lsn(std::max(frame.lsn(), lsn));
+  return rc;
+}
+
+RC IndexLogHandler::log_page(Frame &frame)
+{
+  // 新分配的页面后面大部分是0，不需要记录
+  const char *data = frame.data();
+  int len = BP_PAGE_DATA_SIZE;
+  while (len > 0 && data[len - 1] == 0) {
+    len--;
+  }
+  return append(CLogType::INDEX_PAGE, frame, 0, data, len);
+}
+
+RC IndexLogHandler::log_write(Frame &frame, int offset, int len)
+{
+  ASSERT(offset >= 0 && len >= 0 && offset + len <= BP_PAGE_DATA_SIZE,
+         "invalid write range. offset=%d, len=%d", offset, len);
+  return append(CLogType::INDEX_WRITE, frame, offset, frame.data() + offset, len);
+}
+
+RC IndexLogHandler::log_leaf_insert(Frame &frame, int index, const char *item, int item_len)
+{
+  return append(CLogType::INDEX_INSERT, frame, index, item, item_len);
+}
+
+RC IndexLogHandler::log_leaf_remove(Frame &frame, int index)
+{
+  return append(CLogType::INDEX_DELETE, frame, index, nullptr, 0);
+}
+
+RC IndexLogHandler::sync(LSN lsn)
+{
+  return log_manager_.sync_to(lsn);
+}
+
+void IndexLogHandler::mark_dirty(DiskBufferPool &buffer_pool, Frame &frame)
+{
+  frame.mark_dirty();
+  IndexLogHandler *log_handler = buffer_pool.log_handler();
+  if (log_handler != nullptr) {
+    RC rc = log_handler->log_page(frame);
+    if (OB_FAIL(rc)) {
+      LOG_ERROR("failed to log index page. page=%d, rc=%s", frame.page_num(), strrc(rc));
+    }
+  }
+}
+
+void IndexLogHandler::mark_dirty(DiskBufferPool &buffer_pool, Frame &frame, const void *start, int len)
+{
+  frame.mark_dirty();
+  IndexLogHandler *log_handler = buffer_pool.log_handler();
+  if (log_handler != nullptr) {
+    const int offset = static_cast<int>(static_cast<const char *>(start) - frame.data());
+    RC rc = log_handler->log_write(frame, offset, len);
+    if (OB_FAIL(rc)) {
+      LOG_ERROR("failed to log index page write. page=%d, offset=%d, len=%d, rc=%s",
+                frame.page_num(), offset, len, strrc(rc));
+    }
+  }
+}
+
+RC IndexLogHandler::redo(DiskBufferPool &buffer_pool, const IndexLogEntry &entry, const NodeRedoer &node_redoer)
+{
+  // 页面分配的信息(文件头)没有记录日志，日志中出现的页面一定是已经分配的
+  RC rc = buffer_pool.recover_page(entry.page_num);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to recover page. page=%d, rc=%s", entry.page_num, strrc(rc));
+    return rc;
+  }
+
+  Frame *frame = nullptr;
+  rc = buffer_pool.get_this_page(entry.page_num, &frame);
+  if (OB_FAIL(rc)) {
+    LOG_WARN("failed to get page while redo index log. page=%d, rc=%s", entry.page_num, strrc(rc));
+    return rc;
+  }
+
+  if (frame->lsn() >= entry.lsn) {
+    // 修改已经写入磁盘了
+    buffer_pool.unpin_page(frame);
+    return RC::SUCCESS;
+  }
+
+  switch (entry.type) {
+    case CLogType::INDEX_PAGE: {
+      if (entry.len > BP_PAGE_DATA_SIZE) {
+        rc = RC::INVALID_ARGUMENT;
+        break;
+      }
+      memcpy(frame->data(), entry.data, entry.len);
+      memset(frame->data() + entry.len, 0, BP_PAGE_DATA_SIZE - entry.len);
+    } break;
+
+    case CLogType::INDEX_WRITE: {
+      if (entry.slot < 0 || entry.slot + entry.len > BP_PAGE_DATA_SIZE) {
+        rc = RC::INVALID_ARGUMENT;
+        break;
+      }
+      memcpy(frame->data() + entry.slot, entry.data, entry.len);
+    } break;
+
+    default: {
+      rc = node_redoer ? node_redoer(*frame, entry) : RC::UNIMPLENMENT;
+    } break;
+  }
+
+  if (OB_SUCC(rc)) {
+    frame->set_lsn(entry.lsn);
+    frame->mark_dirty();
+  } else {
+    LOG_WARN("failed to redo index log. index=%s, page=%d, type=%s, rc=%s",
+             entry.index_name.c_str(), entry.page_num, clog_type_name(entry.type), strrc(rc));
+  }
+  buffer_pool.unpin_page(frame);
+  return rc;
+}
@@ -0,0 +1,116 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "common/rc.h"
+#include "common/types.h"
+#include "common/lang/mutex.h"
+#include "storage/buffer/page.h"
+#include "storage/clog/clog.h"
+
+class Frame;
+class DiskBufferPool;
+
+/**
+ * @brief 一条索引页面的重做日志
+ * @ingroup Index
+ * @details 索引日志复用 CLogRecordData 的格式：rid_.page_num 是修改的页面，rid_.slot_num 根据日志类型
+ * 有不同的含义，data_ 中先存放索引的名字(长度是data_offset_)，后面是具体的修改数据。
+ */
+struct IndexLogEntry
+{
+  CLogType    type = CLogType::ERROR;
+  LSN         lsn = 0;
+  std::string index_name;
+  PageNum     page_num = BP_INVALID_PAGE_NUM;
+  int         slot = 0;           ///< INDEX_PAGE: 无用；INDEX_WRITE: 页面内的偏移；INDEX_INSERT/DELETE: 索引项的位置
+  const char *data = nullptr;     ///< 修改的数据，指向日志记录中的内存
+  int         len = 0;
+
+  static bool is_index_log(CLogType type)
+  {
+    return type == CLogType::INDEX_PAGE || type == CLogType::INDEX_WRITE || type == CLogType::INDEX_INSERT ||
+           type == CLogType::INDEX_DELETE;
+  }
+
+  /**
+   * @brief 从日志记录中解析。返回的对象引用了日志记录中的数据
+   */
+  static RC parse(const CLogRecord &log_record, IndexLogEntry &entry);
+};
+
+/**
+ * @brief 索引页面的重做日志
+ * @ingroup Index
+ * @details 索引文件的 buffer pool 开启日志以后，每次修改页面都要记录日志，并把日志的LSN写到页面上。
+ * 页面写入磁盘前会先刷新日志(WAL)，恢复时页面上的LSN不小于日志的LSN，说明修改已经在磁盘上了，直接跳过。
+ * 这样就不需要在恢复时扫描表重建索引，也不会把已经在磁盘上的索引项再插入一次。
+ *
+ * 日志有几种粒度：
+ * - INDEX_INSERT/INDEX_DELETE 是B+树叶子节点插入、删除一个索引项，是最常见的修改，日志很小；
+ * - INDEX_WRITE 记录页面中一段连续数据的修改，比如文件头中的根节点、子节点中的父节点指针；
+ * - INDEX_PAGE 记录整个页面，用于分裂、合并、新建根节点这类修改很多数据的操作。
+ *
+ * 日志不属于任何事务，事务回滚时删除索引项也会再记录一条日志，所以恢复时只需要按照顺序重做。
+ * 所有的修改都需要在持有页面写锁(或者其它能够保证独占修改的锁)时记录日志。
+ */
+class IndexLogHandler
+{
+public:
+  using NodeRedoer = std::function<RC(Frame &frame, const IndexLogEntry &entry)>;
+
+public:
+  IndexLogHandler(CLogManager &log_manager, int32_t table_id, const char *index_name);
+
+  RC log_page(Frame &frame);
+  RC log_write(Frame &frame, int offset, int len);
+  RC log_leaf_insert(Frame &frame, int index, const char *item, int item_len);
+  RC log_leaf_remove(Frame &frame, int index);
+
+  /**
+   * @brief 保证LSN不大于lsn的日志已经写入磁盘。buffer pool写页面之前调用
+   */
+  RC sync(LSN lsn);
+
+  /**
+   * @brief 标记页面被修改了，如果buffer pool开启了日志，同时记录整个页面
+   * @details 给没有细粒度日志的修改使用
+   */
+  static void mark_dirty(DiskBufferPool &buffer_pool, Frame &frame);
+
+  /**
+   * @brief 标记页面中的一段数据被修改了，如果buffer pool开启了日志，同时记录这段数据
+   */
+  static void mark_dirty(DiskBufferPool &buffer_pool, Frame &frame, const void *start, int len);
+
+  /**
+   * @brief 重做一条日志
+   * @details 页面上的LSN不小于日志的LSN时跳过。INDEX_INSERT/INDEX_DELETE 与具体的页面格式相关，
+   * 交给node_redoer处理，其它类型直接修改页面数据。
+   */
+  static RC redo(DiskBufferPool &buffer_pool, const IndexLogEntry &entry, const NodeRedoer &node_redoer);
+
+private:
+  RC append(CLogType type, Frame &frame, int slot, const char *data, int len);
+
+private:
+  CLogManager  &log_manager_;
+  int32_t       table_id_;
+  std::string   index_name_;
+  common::Mutex lock_;  ///< 保证同一个页面上LSN的写入顺序与分配顺序一致
+};
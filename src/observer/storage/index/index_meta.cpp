@@ -12,25 +12,222 @@ See the Mulan PSL v2 for more details. */
 // Created by Wangyunlai.wyl on 2021/5/18.
 //
 
+#include <string.h>
+#include <strings.h>
+
 #include "storage/index/index_meta.h"
 #include "storage/field/field_meta.h"
 #include "storage/table/table_meta.h"
+#include "storage/common/meta_util.h"
 #include "common/lang/string.h"
 #include "common/log/log.h"
 #include "json/json.h"
 
 const static Json::StaticString FIELD_NAME("name");
 const static Json::StaticString FIELD_FIELD_NAME("field_name");
+const static Json::StaticString FIELD_UNIQUE("unique");
+const static Json::StaticString FIELD_TYPE("type");
+const static Json::StaticString FIELD_BLOOM_FILTER("bloom_filter");
+const static Json::StaticString FIELD_PREDICATES("predicates");
+const static Json::StaticString FIELD_COMP("comp");
+const static Json::StaticString FIELD_VALUE("value");
+
+static const char *COMP_OP_NAMES[] = {"=", "<=", "<>", "<", ">=", ">"};
+
+static const char *INDEX_TYPE_NAMES[] = {"undefined", "btree", "hash", "bitmap"};
+
+const char *index_type_to_string(IndexType type)
+{
+  if (type >= IndexType::UNDEFINED && type <= IndexType::BITMAP) {
+    return INDEX_TYPE_NAMES[static_cast<int>(type)];
+  }
+  return "unknown";
+}
+
+IndexType index_type_from_string(const char *s)
+{
+  for (int i = static_cast<int>(IndexType::BPLUS_TREE); i <= static_cast<int>(IndexType::BITMAP); i++) {
+    if (0 == strcasecmp(s, INDEX_TYPE_NAMES[i])) {
+      return static_cast<IndexType>(i);
+    }
+  }
+  return IndexType::UNDEFINED;
+}
+
+RC IndexPredicate::init(const FieldMeta &field, CompOp comp, const Value &value)
+{
+  if (comp < EQUAL_TO || comp >= NO_OP) {
+    LOG_WARN("invalid comparison of index predicate. field=%s, comp=%d", field.name(), comp);
+    return RC::INVALID_ARGUMENT;
+  }
+  if (value.attr_type() != field.type()) {
+    LOG_WARN("value type of index predicate mismatch. field=%s, field type=%s, value type=%s",
+        field.name(), attr_type_to_string(field.type()), attr_type_to_string(value.attr_type()));
+    return RC::SCHEMA_FIELD_TYPE_MISMATCH;
+  }
+
+  field_ = field.name();
+  offset_ = field.offset();
+  len_ = field.len();
+  comp_ = comp;
+  value_ = value;
+  return RC::SUCCESS;
+}
+
+bool IndexPredicate::evaluate(const Value &field_value) const
+{
+  const int cmp = field_value.compare(value_);
+  switch (comp_) {
+    case EQUAL_TO: return cmp == 0;
+    case LESS_EQUAL: return cmp <= 0;
+    case NOT_EQUAL: return cmp != 0;
+    case LESS_THAN: return cmp < 0;
+    case GREAT_EQUAL: return cmp >= 0;
+    case GREAT_THAN: return cmp > 0;
+    default: return false;
+  }
+}
+
+bool IndexPredicate::evaluate(const char *record) const
+{
+  Value field_value;
+  field_value.set_type(value_.attr_type());
+  field_value.set_data(record + offset_, len_);
+  return evaluate(field_value);
+}
+
+bool IndexPredicate::implied_by(const IndexPredicate &other) const
+{
+  if (field_ != other.field_) {
+    return false;
+  }
+
+  if (other.comp_ == NOT_EQUAL) {
+    return comp_ == NOT_EQUAL && 0 == value_.compare(other.value_);
+  }
+
+  // 把other看作一个区间，当前条件需要对区间中所有的值都成立
+  const Value *low = nullptr;
+  const Value *high = nullptr;
+  bool low_inclusive = false;
+  bool high_inclusive = false;
+  switch (other.comp_) {
+    case EQUAL_TO: {
+      return evaluate(other.value_);
+    }
+    case LESS_EQUAL:
+    case LESS_THAN: {
+      high = &other.value_;
+      high_inclusive = (other.comp_ == LESS_EQUAL);
+    } break;
+    case GREAT_EQUAL:
+    case GREAT_THAN: {
+      low = &other.value_;
+      low_inclusive = (other.comp_ == GREAT_EQUAL);
+    } break;
+    default: {
+      return false;
+    }
+  }
+
+  // 区间的下界大于value(或者等于value但是不包含)
+  auto above = [this, low, low_inclusive]() {
+    if (nullptr == low) {
+      return false;
+    }
+    const int cmp = low->compare(value_);
+    return cmp > 0 || (cmp == 0 && !low_inclusive);
+  };
+  auto below = [this, high, high_inclusive]() {
+    if (nullptr == high) {
+      return false;
+    }
+    const int cmp = high->compare(value_);
+    return cmp < 0 || (cmp == 0 && !high_inclusive);
+  };
+
+  switch (comp_) {
+    case GREAT_THAN: return above();
+    case GREAT_EQUAL: return nullptr != low && low->compare(value_) >= 0;
+    case LESS_THAN: return below();
+    case LESS_EQUAL: return nullptr != high && high->compare(value_) <= 0;
+    case NOT_EQUAL: return above() || below();
+    default: return false;
+  }
+}
 
-RC IndexMeta::init(const char *name, const FieldMeta &field)
+std::string IndexPredicate::to_string() const
+{
+  std::string s = field_;
+  s += COMP_OP_NAMES[comp_];
+  if (value_.attr_type() == CHARS) {
+    s += "'" + value_.to_string() + "'";
+  } else {
+    s += value_.to_string();
+  }
+  return s;
+}
+
+void IndexPredicate::to_json(Json::Value &json_value) const
+{
+  json_value[FIELD_FIELD_NAME] = field_;
+  json_value[FIELD_COMP] = COMP_OP_NAMES[comp_];
+  value_to_json(value_, json_value[FIELD_VALUE]);
+}
+
+RC IndexPredicate::from_json(const TableMeta &table, const Json::Value &json_value, IndexPredicate &predicate)
+{
+  const Json::Value &field_value = json_value[FIELD_FIELD_NAME];
+  const Json::Value &comp_value = json_value[FIELD_COMP];
+  if (!field_value.isString() || !comp_value.isString()) {
+    LOG_ERROR("Invalid index predicate. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+
+  const FieldMeta *field = table.field(field_value.asCString());
+  if (nullptr == field) {
+    LOG_ERROR("Deserialize index predicate: no such field: %s", field_value.asCString());
+    return RC::SCHEMA_FIELD_MISSING;
+  }
+
+  int comp = EQUAL_TO;
+  while (comp < NO_OP && 0 != strcmp(COMP_OP_NAMES[comp], comp_value.asCString())) {
+    comp++;
+  }
+
+  Value value;
+  if (!value_from_json(json_value[FIELD_VALUE], field->type(), value)) {
+    LOG_ERROR("Deserialize index predicate: invalid value. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+  return predicate.init(*field, static_cast<CompOp>(comp), value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+RC IndexMeta::init(const char *name, const FieldMeta &field, bool unique, IndexType type, bool bloom_filter)
 {
   if (common::is_blank(name)) {
     LOG_ERROR("Failed to init index, name is empty.");
     return RC::INVALID_ARGUMENT;
   }
 
+  if (type == IndexType::UNDEFINED) {
+    LOG_ERROR("Failed to init index, index type is undefined. name=%s", name);
+    return RC::INVALID_ARGUMENT;
+  }
+
+  if (bloom_filter && type != IndexType::BPLUS_TREE) {
+    LOG_ERROR("Failed to init index, only btree index supports bloom filter. name=%s, type=%s",
+        name, index_type_to_string(type));
+    return RC::INVALID_ARGUMENT;
+  }
+
   name_ = name;
   field_ = field.name();
+  unique_ = unique;
+  type_ = type;
+  bloom_filter_ = bloom_filter;
   return RC::SUCCESS;
 }
 
@@ -38,6 +235,18 @@ void IndexMeta::to_json(Json::Value &json_value) const
 {
   json_value[FIELD_NAME] = name_;
   json_value[FIELD_FIELD_NAME] = field_;
+  json_value[FIELD_UNIQUE] = unique_;
+  json_value[FIELD_TYPE] = index_type_to_string(type_);
+  json_value[FIELD_BLOOM_FILTER] = bloom_filter_;
+  if (!predicates_.empty()) {
+    Json::Value predicates_value(Json::arrayValue);
+    for (const IndexPredicate &predicate : predicates_) {
+      Json::Value predicate_value;
+      predicate.to_json(predicate_value);
+      predicates_value.append(std::move(predicate_value));
+    }
+    json_value[FIELD_PREDICATES] = std::move(predicates_value);
+  }
 }
 
 RC IndexMeta::from_json(const TableMeta &table, const Json::Value &json_value, IndexMeta &index)
@@ -62,7 +271,40 @@ RC IndexMeta::from_json(const TableMeta &table, const Json::Value &json_value, I
     return RC::SCHEMA_FIELD_MISSING;
   }
 
-  return index.init(name_value.asCString(), *field);
+  // 早期版本的元数据中没有unique字段，按照普通索引处理
+  const Json::Value &unique_value = json_value[FIELD_UNIQUE];
+  const bool unique = unique_value.isBool() && unique_value.asBool();
+
+  // 没有type字段的都是B+树索引
+  IndexType type = IndexType::BPLUS_TREE;
+  const Json::Value &type_value = json_value[FIELD_TYPE];
+  if (type_value.isString()) {
+    type = index_type_from_string(type_value.asCString());
+    if (type == IndexType::UNDEFINED) {
+      LOG_ERROR("Deserialize index [%s]: unknown index type: %s", name_value.asCString(), type_value.asCString());
+      return RC::INTERNAL;
+    }
+  }
+
+  const Json::Value &bloom_filter_value = json_value[FIELD_BLOOM_FILTER];
+  const bool bloom_filter = bloom_filter_value.isBool() && bloom_filter_value.asBool();
+  RC rc = index.init(name_value.asCString(), *field, unique, type, bloom_filter);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  std::vector<IndexPredicate> predicates;
+  for (const Json::Value &predicate_value : json_value[FIELD_PREDICATES]) {
+    IndexPredicate predicate;
+    rc = IndexPredicate::from_json(table, predicate_value, predicate);
+    if (rc != RC::SUCCESS) {
+      LOG_ERROR("Deserialize index [%s]: invalid predicate. rc=%s", name_value.asCString(), strrc(rc));
+      return rc;
+    }
+    predicates.push_back(std::move(predicate));
+  }
+  index.set_predicates(std::move(predicates));
+  return rc;
 }
 
 const char *IndexMeta::name() const
@@ -77,5 +319,41 @@ const char *IndexMeta::field() const
 
 void IndexMeta::desc(std::ostream &os) const
 {
-  os << "index name=" << name_ << ", field=" << field_;
+  os << "index name=" << name_ << ", field=" << field_ << ", type=" << index_type_to_string(type_);
+  if (unique_) {
+    os << ", unique";
+  }
+  if (bloom_filter_) {
+    os << ", bloom_filter";
+  }
+  for (size_t i = 0; i < predicates_.size(); i++) {
+    os << (i == 0 ? ", where " : " and ") << predicates_[i].to_string();
+  }
+}
+
+bool IndexMeta::covers(const char *record) const
+{
+  for (const IndexPredicate &predicate : predicates_) {
+    if (!predicate.evaluate(record)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IndexMeta::implied_by(const std::vector<IndexPredicate> &conditions) const
+{
+  for (const IndexPredicate &predicate : predicates_) {
+    bool implied = false;
+    for (const IndexPredicate &condition : conditions) {
+      if (predicate.implied_by(condition)) {
+        implied = true;
+        break;
+      }
+    }
+    if (!implied) {
+      return false;
+    }
+  }
+  return true;
 }
\ No newline at end of file
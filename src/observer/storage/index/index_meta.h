@@ -15,7 +15,9 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <string>
+#include <vector>
 #include "common/rc.h"
+#include "sql/parser/parse_defs.h"
 
 class TableMeta;
 class FieldMeta;
@@ -24,22 +26,115 @@ namespace Json {
 class Value;
 }  // namespace Json
 
+/**
+ * @brief 索引的类型
+ * @ingroup Index
+ */
+enum class IndexType
+{
+  UNDEFINED,
+  BPLUS_TREE,  ///< B+树索引，支持等值和范围查询
+  HASH,        ///< 哈希索引，只支持等值查询
+  BITMAP,      ///< 位图索引，只支持等值查询，适合不同值很少的字段
+};
+
+const char *index_type_to_string(IndexType type);
+
+/**
+ * @brief 根据名字获取索引类型，不区分大小写
+ * @return 不认识的名字返回 IndexType::UNDEFINED
+ */
+IndexType index_type_from_string(const char *s);
+
+/**
+ * @brief 部分索引的一个条件，形式是 字段 op 常量
+ * @ingroup Index
+ * @details 部分索引(CREATE INDEX ... WHERE ...)只包含满足所有条件的记录。常量的类型与字段相同。
+ */
+class IndexPredicate
+{
+public:
+  IndexPredicate() = default;
+
+  RC init(const FieldMeta &field, CompOp comp, const Value &value);
+
+  const char  *field() const { return field_.c_str(); }
+  CompOp       comp() const { return comp_; }
+  const Value &value() const { return value_; }
+
+  /**
+   * @brief 字段的值是否满足条件
+   */
+  bool evaluate(const Value &field_value) const;
+
+  /**
+   * @brief 记录是否满足条件
+   * @param record 记录的原始数据
+   */
+  bool evaluate(const char *record) const;
+
+  /**
+   * @brief 满足other的记录是否一定满足当前条件。两个条件必须是同一个字段
+   */
+  bool implied_by(const IndexPredicate &other) const;
+
+  std::string to_string() const;
+
+  void to_json(Json::Value &json_value) const;
+  static RC from_json(const TableMeta &table, const Json::Value &json_value, IndexPredicate &predicate);
+
+private:
+  std::string field_;
+  int         offset_ = 0;
+  int         len_ = 0;
+  CompOp      comp_ = NO_OP;
+  Value       value_;
+};
+
 /**
  * @brief 描述一个索引
  * @ingroup Index
- * @details 一个索引包含了表的哪些字段，索引的名称等。
- * 如果以后实现了多种类型的索引，还需要记录索引的类型，对应类型的一些元数据等
+ * @details 一个索引包含了表的哪些字段，索引的名称、类型等。
  */
 class IndexMeta 
 {
 public:
   IndexMeta() = default;
 
-  RC init(const char *name, const FieldMeta &field);
+  /**
+   * @param bloom_filter 是否使用布隆过滤器加速等值查询，只有B+树索引支持
+   */
+  RC init(const char *name, const FieldMeta &field, bool unique = false, IndexType type = IndexType::BPLUS_TREE,
+      bool bloom_filter = false);
+
+  /**
+   * @brief 设置部分索引的条件，多个条件之间是AND的关系
+   */
+  void set_predicates(std::vector<IndexPredicate> predicates) { predicates_ = std::move(predicates); }
 
 public:
   const char *name() const;
   const char *field() const;
+  bool        unique() const { return unique_; }
+  IndexType   type() const { return type_; }
+  bool        bloom_filter() const { return bloom_filter_; }
+
+  /**
+   * @brief 是否是部分索引
+   */
+  bool partial() const { return !predicates_.empty(); }
+  const std::vector<IndexPredicate> &predicates() const { return predicates_; }
+
+  /**
+   * @brief 记录是否应该出现在索引中。不是部分索引时总是返回true
+   */
+  bool covers(const char *record) const;
+
+  /**
+   * @brief 满足所有conditions的记录是否一定在索引中
+   * @details 索引的每个条件都能由某一个查询条件推导出来时返回true。部分索引只能在这种情况下用于查询
+   */
+  bool implied_by(const std::vector<IndexPredicate> &conditions) const;
 
   void desc(std::ostream &os) const;
 
@@ -50,4 +145,8 @@ public:
 protected:
   std::string name_;   // index's name
   std::string field_;  // field's name
+  bool        unique_ = false;  // 唯一索引，不允许插入重复的键值
+  IndexType   type_   = IndexType::BPLUS_TREE;
+  bool        bloom_filter_ = false;  // 是否使用布隆过滤器
+  std::vector<IndexPredicate> predicates_;  // 部分索引的条件
 };
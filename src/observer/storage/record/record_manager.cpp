@@ -310,6 +310,10 @@ void RecordFileHandler::close()
     free_pages_.clear();
     disk_buffer_pool_ = nullptr;
   }
+
+  visibility_lock_.lock();
+  all_visible_pages_.clear();
+  visibility_lock_.unlock();
 }
 
 RC RecordFileHandler::init_free_pages()
@@ -404,6 +408,8 @@ RC RecordFileHandler::insert_record(const char *data, int record_size, RID *rid)
     lock_.unlock();
   }
 
+  clear_page_all_visible(current_page_num);
+
   // 找到空闲位置
   return record_page_handler.insert_record(data, rid);
 }
@@ -420,6 +426,7 @@ RC RecordFileHandler::recover_insert_record(const char *data, int record_size, c
     return ret;
   }
 
+  clear_page_all_visible(rid.page_num);
   return record_page_handler.recover_insert_record(data, rid);
 }
 
@@ -433,6 +440,7 @@ RC RecordFileHandler::delete_record(const RID *rid)
     return rc;
   }
 
+  clear_page_all_visible(rid->page_num);
   rc = page_handler.delete_record(rid);
   // 📢 这里注意要清理掉资源，否则会与insert_record中的加锁顺序冲突而可能出现死锁
   // delete record的加锁逻辑是拿到页面锁，删除指定记录，然后加上和释放record manager锁
@@ -462,6 +470,9 @@ RC RecordFileHandler::get_record(RecordPageHandler &page_handler, const RID *rid
     return ret;
   }
 
+  if (!readonly) {
+    clear_page_all_visible(rid->page_num);
+  }
   return page_handler.get_record(rid, rec);
 }
 
@@ -475,6 +486,10 @@ RC RecordFileHandler::visit_record(const RID &rid, bool readonly, std::function<
     return rc;
   }
 
+  if (!readonly) {
+    clear_page_all_visible(rid.page_num);
+  }
+
   Record record;
   rc = page_handler.get_record(&rid, &record);
   if (OB_FAIL(rc)) {
@@ -486,12 +501,30 @@ RC RecordFileHandler::visit_record(const RID &rid, bool readonly, std::function<
   return rc;
 }
 
+bool RecordFileHandler::is_page_all_visible(PageNum page_num)
+{
+  std::lock_guard<Mutex> guard(visibility_lock_);
+  return all_visible_pages_.count(page_num) > 0;
+}
+
+void RecordFileHandler::set_page_all_visible(PageNum page_num)
+{
+  std::lock_guard<Mutex> guard(visibility_lock_);
+  all_visible_pages_.insert(page_num);
+}
+
+void RecordFileHandler::clear_page_all_visible(PageNum page_num)
+{
+  std::lock_guard<Mutex> guard(visibility_lock_);
+  all_visible_pages_.erase(page_num);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 RecordFileScanner::~RecordFileScanner() { close_scan(); }
 
-RC RecordFileScanner::open_scan(
-    Table *table, DiskBufferPool &buffer_pool, Trx *trx, bool readonly, ConditionFilter *condition_filter)
+RC RecordFileScanner::open_scan(Table *table, DiskBufferPool &buffer_pool, Trx *trx, bool readonly,
+    ConditionFilter *condition_filter, PageNum begin_page /* = 0 */, PageNum end_page /* = -1 */)
 {
   close_scan();
 
@@ -499,8 +532,11 @@ RC RecordFileScanner::open_scan(
   disk_buffer_pool_ = &buffer_pool;
   trx_              = trx;
   readonly_         = readonly;
+  record_handler_   = (table != nullptr) ? table->record_handler() : nullptr;
+  page_all_visible_ = false;
 
-  RC rc = bp_iterator_.init(buffer_pool);
+  // 迭代器从指定页面的下一个页面开始遍历
+  RC rc = bp_iterator_.init(buffer_pool, begin_page - 1, end_page);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to init bp iterator. rc=%d:%s", rc, strrc(rc));
     return rc;
@@ -544,6 +580,16 @@ RC RecordFileScanner::fetch_next_record()
       return rc;
     }
 
+    // 只读遍历时顺便检查页面上的记录是否全部可见，写模式下访问者可能会修改记录，需要清除标记
+    if (record_handler_ != nullptr) {
+      if (readonly_) {
+        page_all_visible_ = trx_ != nullptr && !record_handler_->is_page_all_visible(page_num);
+      } else {
+        record_handler_->clear_page_all_visible(page_num);
+        page_all_visible_ = false;
+      }
+    }
+
     record_page_iterator_.init(record_page_handler_);
     rc = fetch_next_record_in_page();
     if (rc == RC::SUCCESS || rc != RC::RECORD_EOF) {
@@ -574,6 +620,10 @@ RC RecordFileScanner::fetch_next_record_in_page()
       return rc;
     }
 
+    if (page_all_visible_ && !trx_->visible_to_all(table_, next_record_)) {
+      page_all_visible_ = false;
+    }
+
     // 如果有过滤条件，就用过滤条件过滤一下
     if (condition_filter_ != nullptr && !condition_filter_->filter(next_record_)) {
       continue;
@@ -594,6 +644,12 @@ RC RecordFileScanner::fetch_next_record_in_page()
     return rc;
   }
 
+  // 整个页面都遍历完了，此时还拿着页面锁，可以安全地设置标记
+  if (page_all_visible_) {
+    record_handler_->set_page_all_visible(record_page_handler_.get_page_num());
+    page_all_visible_ = false;
+  }
+
   next_record_.rid().slot_num = -1;
   return RC::RECORD_EOF;
 }
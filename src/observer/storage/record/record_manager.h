@@ -305,6 +305,26 @@ public:
    */
   RC visit_record(const RID &rid, bool readonly, std::function<void(Record &)> visitor);
 
+  /**
+   * @brief 页面上的所有记录是否对所有事务（包括之后开启的事务）都可见
+   * @details 类似PostgreSQL的visibility map。索引覆盖扫描(index only scan)在页面全部可见时，
+   * 可以直接使用索引中的数据，不需要再回表判断可见性。
+   * 这个标记仅在内存中维护，重启后所有页面都认为不是全部可见的，需要重新扫描后才能建立。
+   */
+  bool is_page_all_visible(PageNum page_num);
+
+  /**
+   * @brief 标记页面上的记录全部可见
+   * @note 调用者必须持有该页面的锁(读锁即可)，并且已经检查过页面上的每条记录
+   */
+  void set_page_all_visible(PageNum page_num);
+
+  /**
+   * @brief 清除页面全部可见的标记
+   * @details 以写模式访问页面时都会清除，比如插入、删除或者修改事务字段
+   */
+  void clear_page_all_visible(PageNum page_num);
+
 private:
   /**
    * @brief 初始化当前没有填满记录的页面，初始化free_pages_成员
@@ -315,6 +335,9 @@ private:
   DiskBufferPool             *disk_buffer_pool_ = nullptr;
   std::unordered_set<PageNum> free_pages_;  ///< 没有填充满的页面集合
   common::Mutex               lock_;        ///< 当编译时增加-DCONCURRENCY=ON 选项时，才会真正的支持并发
+
+  std::unordered_set<PageNum> all_visible_pages_;  ///< 记录全部可见的页面，参考 is_page_all_visible
+  common::Mutex               visibility_lock_;    ///< 保护 all_visible_pages_
 };
 
 /**
@@ -336,8 +359,10 @@ public:
    * @param readonly         当前是否只读操作。访问数据时，需要对页面加锁。比如
    *                         删除时也需要遍历找到数据，然后删除，这时就需要加写锁
    * @param condition_filter 做一些初步过滤操作
+   * @param begin_page       只遍历[begin_page, end_page)范围内的页面，end_page小于0时遍历到文件结尾
    */
-  RC open_scan(Table *table, DiskBufferPool &buffer_pool, Trx *trx, bool readonly, ConditionFilter *condition_filter);
+  RC open_scan(Table *table, DiskBufferPool &buffer_pool, Trx *trx, bool readonly, ConditionFilter *condition_filter,
+      PageNum begin_page = 0, PageNum end_page = -1);
 
   /**
    * @brief 关闭一个文件扫描，释放相应的资源
@@ -382,4 +407,7 @@ private:
   RecordPageHandler  record_page_handler_;         ///< 处理文件某页面的记录
   RecordPageIterator record_page_iterator_;        ///< 遍历某个页面上的所有record
   Record             next_record_;                 ///< 获取的记录放在这里缓存起来
+
+  RecordFileHandler *record_handler_ = nullptr;    ///< 用来维护页面的 all-visible 标记，可能为空
+  bool               page_all_visible_ = false;    ///< 当前页面遍历过的记录是否都对所有事务可见
 };
\ No newline at end of file
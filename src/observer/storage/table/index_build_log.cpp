@@ -0,0 +1,31 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "storage/table/index_build_log.h"
+
+using namespace std;
+using namespace common;
+
+void IndexBuildLog::append(Type type, const char *record, int record_size, const RID &rid)
+{
+  lock_guard<Mutex> guard(lock_);
+  entries_.push_back(Entry{type, rid, vector<char>(record, record + record_size)});
+}
+
+void IndexBuildLog::fetch(vector<Entry> &entries)
+{
+  entries.clear();
+  lock_guard<Mutex> guard(lock_);
+  entries_.swap(entries);
+}
@@ -0,0 +1,57 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <vector>
+
+#include "common/lang/mutex.h"
+#include "storage/record/record.h"
+
+/**
+ * @brief 在线创建索引时，记录表中索引相关的修改
+ * @ingroup Table
+ * @details 创建索引时不阻塞其它事务的修改。扫描表中数据的同时，插入、删除记录时会把修改记录在这里，
+ * 扫描完成以后再把这些修改应用到新的索引上。扫描可能已经看到了其中的某些修改，所以应用的过程需要是幂等的。
+ */
+class IndexBuildLog
+{
+public:
+  enum class Type
+  {
+    INSERT,
+    DELETE,
+  };
+
+  struct Entry
+  {
+    Type              type;
+    RID               rid;
+    std::vector<char> record;  ///< 记录数据的拷贝
+  };
+
+public:
+  IndexBuildLog() = default;
+
+  void append(Type type, const char *record, int record_size, const RID &rid);
+
+  /**
+   * @brief 取出目前记录的所有修改，按照发生的顺序
+   */
+  void fetch(std::vector<Entry> &entries);
+
+private:
+  common::Mutex      lock_;
+  std::vector<Entry> entries_;
+};
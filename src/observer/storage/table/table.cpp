@@ -27,8 +27,23 @@ See the Mulan PSL v2 for more details. */
 #include "storage/common/meta_util.h"
 #include "storage/index/index.h"
 #include "storage/index/bplus_tree_index.h"
+#include "storage/index/hash_index.h"
+#include "storage/index/bitmap_index.h"
 #include "storage/trx/trx.h"
 
+/**
+ * @brief 按照索引类型创建对应的索引对象
+ */
+static Index *new_index(IndexType type)
+{
+  switch (type) {
+    case IndexType::BPLUS_TREE: return new BplusTreeIndex();
+    case IndexType::HASH: return new HashIndex();
+    case IndexType::BITMAP: return new BitmapIndex();
+    default: return nullptr;
+  }
+}
+
 Table::~Table()
 {
   if (record_handler_ != nullptr) {
@@ -165,7 +180,12 @@ RC Table::open(const char *meta_file, const char *base_dir)
       return RC::INTERNAL;
     }
 
-    BplusTreeIndex *index = new BplusTreeIndex();
+    Index *index = new_index(index_meta->type());
+    if (index == nullptr) {
+      LOG_ERROR("Found invalid index type. table=%s, index=%s, type=%s",
+                name(), index_meta->name(), index_type_to_string(index_meta->type()));
+      return RC::INTERNAL;
+    }
     std::string index_file = table_index_file(base_dir, name(), index_meta->name());
     rc = index->open(index_file.c_str(), *index_meta, *field_meta);
     if (rc != RC::SUCCESS) {
@@ -182,7 +202,7 @@ RC Table::open(const char *meta_file, const char *base_dir)
   return rc;
 }
 
-RC Table::insert_record(Record &record)
+RC Table::insert_record(Record &record, const IndexEntryConflictChecker &conflict_checker)
 {
   RC rc = RC::SUCCESS;
   rc = record_handler_->insert_record(record.data(), table_meta_.record_size(), &record.rid());
@@ -191,14 +211,9 @@ RC Table::insert_record(Record &record)
     return rc;
   }
 
-  rc = insert_entry_of_indexes(record.data(), record.rid());
-  if (rc != RC::SUCCESS) { // 可能出现了键值重复
-    RC rc2 = delete_entry_of_indexes(record.data(), record.rid(), false/*error_on_not_exists*/);
-    if (rc2 != RC::SUCCESS) {
-      LOG_ERROR("Failed to rollback index data when insert index entries failed. table name=%s, rc=%d:%s",
-                name(), rc2, strrc(rc2));
-    }
-    rc2 = record_handler_->delete_record(&record.rid());
+  rc = insert_entry_of_indexes(record.data(), record.rid(), conflict_checker);
+  if (rc != RC::SUCCESS) { // 可能出现了键值重复，已经插入的索引项在insert_entry_of_indexes中删除了
+    RC rc2 = record_handler_->delete_record(&record.rid());
     if (rc2 != RC::SUCCESS) {
       LOG_PANIC("Failed to rollback record data when insert index entries failed. table name=%s, rc=%d:%s",
                 name(), rc2, strrc(rc2));
@@ -235,29 +250,83 @@ RC Table::get_record(const RID &rid, Record &record)
 
 RC Table::recover_insert_record(Record &record)
 {
-  RC rc = RC::SUCCESS;
-  rc = record_handler_->recover_insert_record(record.data(), table_meta_.record_size(), record.rid());
+  // 索引项不在这里插入。索引页面的修改由索引日志重做，已经写到磁盘上的索引项不能再插入一次
+  RC rc = record_handler_->recover_insert_record(record.data(), table_meta_.record_size(), record.rid());
   if (rc != RC::SUCCESS) {
     LOG_ERROR("Insert record failed. table name=%s, rc=%s", table_meta_.name(), strrc(rc));
     return rc;
   }
+  return rc;
+}
 
-  rc = insert_entry_of_indexes(record.data(), record.rid());
-  if (rc != RC::SUCCESS) { // 可能出现了键值重复
-    RC rc2 = delete_entry_of_indexes(record.data(), record.rid(), false/*error_on_not_exists*/);
-    if (rc2 != RC::SUCCESS) {
-      LOG_ERROR("Failed to rollback index data when insert index entries failed. table name=%s, rc=%d:%s",
-                name(), rc2, strrc(rc2));
-    }
-    rc2 = record_handler_->delete_record(&record.rid());
-    if (rc2 != RC::SUCCESS) {
-      LOG_PANIC("Failed to rollback record data when insert index entries failed. table name=%s, rc=%d:%s",
-                name(), rc2, strrc(rc2));
+RC Table::recover_delete_record(const Record &record, bool delete_index_entries)
+{
+  RC rc = RC::SUCCESS;
+  if (delete_index_entries) {
+    for (Index *index : indexes_) {
+      if (!index->index_meta().covers(record.data())) {
+        continue;
+      }
+      rc = index->delete_entry(record.data(), &record.rid());
+      // 索引项可能没有来得及插入
+      if (rc != RC::SUCCESS && rc != RC::RECORD_NOT_EXIST && rc != RC::RECORD_INVALID_KEY) {
+        LOG_WARN("failed to delete index entry while recovering. table=%s, index=%s, rid=%s, rc=%s",
+                 name(), index->index_meta().name(), record.rid().to_string().c_str(), strrc(rc));
+        return rc;
+      }
     }
   }
+
+  rc = record_handler_->delete_record(&record.rid());
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to delete record while recovering. table=%s, rid=%s, rc=%s",
+             name(), record.rid().to_string().c_str(), strrc(rc));
+  }
   return rc;
 }
 
+RC Table::enable_log(CLogManager *log_manager)
+{
+  log_manager_ = log_manager;
+  for (Index *index : indexes_) {
+    RC rc = index->enable_log(*log_manager, table_id());
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to enable index log. table=%s, index=%s, rc=%s", name(), index->index_meta().name(), strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
+RC Table::redo_index(const CLogRecord &log_record)
+{
+  IndexLogEntry entry;
+  RC rc = IndexLogEntry::parse(log_record, entry);
+  if (rc != RC::SUCCESS) {
+    return rc;
+  }
+
+  Index *index = find_index(entry.index_name.c_str());
+  if (nullptr == index) {
+    // 索引创建失败，或者创建索引的元数据没有写到磁盘上
+    LOG_WARN("no such index to redo. table=%s, index=%s", name(), entry.index_name.c_str());
+    return RC::SUCCESS;
+  }
+  return index->redo(entry);
+}
+
+RC Table::finish_redo()
+{
+  for (Index *index : indexes_) {
+    RC rc = index->finish_redo();
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to finish redo. table=%s, index=%s, rc=%s", name(), index->index_meta().name(), strrc(rc));
+      return rc;
+    }
+  }
+  return RC::SUCCESS;
+}
+
 const char *Table::name() const
 {
   return table_meta_.name();
@@ -341,7 +410,22 @@ RC Table::get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly
   return rc;
 }
 
-RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_name)
+RC Table::get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly, PageNum begin_page, PageNum end_page)
+{
+  RC rc = scanner.open_scan(this, *data_buffer_pool_, trx, readonly, nullptr, begin_page, end_page);
+  if (rc != RC::SUCCESS) {
+    LOG_ERROR("failed to open scanner. begin page=%d, end page=%d, rc=%s", begin_page, end_page, strrc(rc));
+  }
+  return rc;
+}
+
+PageNum Table::data_page_count() const
+{
+  return data_buffer_pool_->page_count();
+}
+
+RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_name, bool unique, IndexType type,
+                       bool bloom_filter, const std::vector<IndexPredicate> &predicates)
 {
   if (common::is_blank(index_name) || nullptr == field_meta) {
     LOG_INFO("Invalid input arguments, table name is %s, index_name is blank or attribute_name is blank", name());
@@ -349,60 +433,184 @@ RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_
   }
 
   IndexMeta new_index_meta;
-  RC rc = new_index_meta.init(index_name, *field_meta);
+  RC rc = new_index_meta.init(index_name, *field_meta, unique, type, bloom_filter);
   if (rc != RC::SUCCESS) {
     LOG_INFO("Failed to init IndexMeta in table:%s, index_name:%s, field_name:%s", 
              name(), index_name, field_meta->name());
     return rc;
   }
+  new_index_meta.set_predicates(predicates);
 
   // 创建索引相关数据
-  BplusTreeIndex *index = new BplusTreeIndex();
+  Index *index = new_index(type);
+  if (index == nullptr) {
+    LOG_WARN("Invalid index type. table=%s, index=%s, type=%s", name(), index_name, index_type_to_string(type));
+    return RC::INVALID_ARGUMENT;
+  }
   std::string index_file = table_index_file(base_dir_.c_str(), name(), index_name);
   rc = index->create(index_file.c_str(), new_index_meta, *field_meta);
   if (rc != RC::SUCCESS) {
     delete index;
-    LOG_ERROR("Failed to create bplus tree index. file name=%s, rc=%d:%s", index_file.c_str(), rc, strrc(rc));
+    LOG_ERROR("Failed to create %s index. file name=%s, rc=%d:%s",
+              index_type_to_string(type), index_file.c_str(), rc, strrc(rc));
     return rc;
   }
 
-  // 遍历当前的所有数据，插入这个索引
-  RecordFileScanner scanner;
-  rc = get_record_scanner(scanner, trx, true/*readonly*/);
+  // 索引数据没有全部插入时出错了，比如唯一索引遇到了重复的数据，需要删除索引文件，否则无法再创建同名的索引
+  auto drop_new_index = [index, &index_file]() {
+    delete index;
+    if (::remove(index_file.c_str()) != 0) {
+      LOG_WARN("failed to remove index file. file=%s, errmsg=%s", index_file.c_str(), strerror(errno));
+    }
+  };
+
+  // 从这里开始记录表上索引相关的修改。修改索引时都会持有共享锁，拿到排它锁以后，之后的修改一定会记录下来
+  IndexBuildLog build_log;
+  {
+    std::lock_guard<common::SharedMutex> guard(index_lock_);
+    if (build_log_ != nullptr) {
+      LOG_WARN("another index is being created on this table. table=%s, index=%s", name(), index_name);
+      drop_new_index();
+      return RC::LOCKED_CONCURRENCY_CONFLICT;
+    }
+    build_log_ = &build_log;
+  }
+
+  auto finish_build = [this]() {
+    std::lock_guard<common::SharedMutex> guard(index_lock_);
+    build_log_ = nullptr;
+  };
+
+  // 一个页面一个页面地扫描所有的数据。先把页面上的记录复制出来再插入索引，不会长时间持有页面的锁，
+  // 检查唯一索引冲突时也需要访问其它记录
+  BufferPoolIterator bp_iterator;
+  rc = bp_iterator.init(*data_buffer_pool_);
   if (rc != RC::SUCCESS) {
-    LOG_WARN("failed to create scanner while creating index. table=%s, index=%s, rc=%s", 
+    LOG_WARN("failed to init buffer pool iterator while creating index. table=%s, index=%s, rc=%s",
              name(), index_name, strrc(rc));
+    finish_build();
+    drop_new_index();
     return rc;
   }
 
-  Record record;
-  while (scanner.has_next()) {
-    rc = scanner.next(record);
+  const int record_size = table_meta_.record_size();
+  std::vector<IndexBuildLog::Entry> entries;
+  while (rc == RC::SUCCESS && bp_iterator.has_next()) {
+    const PageNum page_num = bp_iterator.next();
+    RecordPageHandler page_handler;
+    rc = page_handler.init(*data_buffer_pool_, page_num, true /*readonly*/);
     if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to scan records while creating index. table=%s, index=%s, rc=%s",
-               name(), index_name, strrc(rc));
-      return rc;
+      LOG_WARN("failed to init record page handler. table=%s, page_num=%d, rc=%s", name(), page_num, strrc(rc));
+      break;
     }
-    rc = index->insert_entry(record.data(), &record.rid());
-    if (rc != RC::SUCCESS) {
-      LOG_WARN("failed to insert record into index while creating index. table=%s, index=%s, rc=%s",
-               name(), index_name, strrc(rc));
-      return rc;         
+
+    entries.clear();
+    RecordPageIterator record_iterator;
+    record_iterator.init(page_handler);
+    Record record;
+    while (record_iterator.has_next()) {
+      rc = record_iterator.next(record);
+      if (rc != RC::SUCCESS) {
+        break;
+      }
+      if (new_index_meta.covers(record.data())) {
+        entries.push_back(IndexBuildLog::Entry{
+            IndexBuildLog::Type::INSERT, record.rid(), std::vector<char>(record.data(), record.data() + record_size)});
+      }
+    }
+    page_handler.cleanup();
+
+    for (size_t i = 0; rc == RC::SUCCESS && i < entries.size(); i++) {
+      rc = apply_index_build_entry(index, trx, entries[i], false /*idempotent*/);
     }
   }
-  scanner.close_scan();
+
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to insert records into index while creating index. table=%s, index=%s, rc=%s",
+             name(), index_name, strrc(rc));
+    finish_build();
+    drop_new_index();
+    return rc;
+  }
   LOG_INFO("inserted all records into new index. table=%s, index=%s", name(), index_name);
-  
-  indexes_.push_back(index);
+
+  // 应用扫描期间的修改，这时候仍然不阻塞其它事务。修改很多的话多追几轮，最后剩下的修改在加入索引的时候处理
+  const int max_catch_up_rounds = 3;
+  size_t caught_up_num = 0;
+  for (int round = 0; rc == RC::SUCCESS && round < max_catch_up_rounds; round++) {
+    build_log.fetch(entries);
+    if (entries.empty()) {
+      break;
+    }
+    caught_up_num += entries.size();
+    for (size_t i = 0; rc == RC::SUCCESS && i < entries.size(); i++) {
+      rc = apply_index_build_entry(index, trx, entries[i], true /*idempotent*/);
+    }
+  }
+
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to apply changes to index while creating index. table=%s, index=%s, rc=%s",
+             name(), index_name, strrc(rc));
+    finish_build();
+    drop_new_index();
+    return rc;
+  }
+
+  // 最后阻塞索引的修改，处理剩下的修改，把索引加入到表中
+  std::lock_guard<common::SharedMutex> guard(index_lock_);
+  build_log_ = nullptr;
+  build_log.fetch(entries);
+  for (size_t i = 0; rc == RC::SUCCESS && i < entries.size(); i++) {
+    rc = apply_index_build_entry(index, trx, entries[i], true /*idempotent*/);
+  }
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to apply changes to index while creating index. table=%s, index=%s, rc=%s",
+             name(), index_name, strrc(rc));
+    drop_new_index();
+    return rc;
+  }
+  LOG_INFO("applied concurrent changes to new index. table=%s, index=%s, changes=%lu, changes while blocking=%lu",
+           name(), index_name, caught_up_num + entries.size(), entries.size());
+
+  // 构建索引的过程不记录日志，直接把索引数据写到磁盘上，之后的修改再记录日志
+  if (log_manager_ != nullptr) {
+    rc = index->sync();
+    if (rc == RC::SUCCESS) {
+      rc = index->enable_log(*log_manager_, table_id());
+    }
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to sync new index. table=%s, index=%s, rc=%s", name(), index_name, strrc(rc));
+      drop_new_index();
+      return rc;
+    }
+  }
 
   /// 接下来将这个索引放到表的元数据中
   TableMeta new_table_meta(table_meta_);
   rc = new_table_meta.add_index(new_index_meta);
   if (rc != RC::SUCCESS) {
     LOG_ERROR("Failed to add index (%s) on table (%s). error=%d:%s", index_name, name(), rc, strrc(rc));
+    drop_new_index();
+    return rc;
+  }
+
+  rc = dump_meta(new_table_meta);
+  if (rc != RC::SUCCESS) {
+    LOG_ERROR("Failed to dump table meta while creating index (%s) on table (%s). rc=%s", index_name, name(), strrc(rc));
+    drop_new_index();
     return rc;
   }
 
+  // 其它事务正在执行的语句引用着字段的元数据，不能替换整个表的元数据，只把索引加进去
+  indexes_.push_back(index);
+  table_meta_.add_index(new_index_meta);
+
+  LOG_INFO("Successfully added a new index (%s) on the table (%s)", index_name, name());
+  return rc;
+}
+
+RC Table::dump_meta(const TableMeta &new_table_meta)
+{
   /// 内存中有一份元数据，磁盘文件也有一份元数据。修改磁盘文件时，先创建一个临时文件，写入完成后再rename为正式文件
   /// 这样可以防止文件内容不完整
   // 创建元数据临时文件
@@ -411,7 +619,7 @@ RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_
   fs.open(tmp_file, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
   if (!fs.is_open()) {
     LOG_ERROR("Failed to open file for write. file name=%s, errmsg=%s", tmp_file.c_str(), strerror(errno));
-    return RC::IOERR_OPEN;  // 创建索引中途出错，要做还原操作
+    return RC::IOERR_OPEN;
   }
   if (new_table_meta.serialize(fs) < 0) {
     LOG_ERROR("Failed to dump new table meta to file: %s. sys err=%d:%s", tmp_file.c_str(), errno, strerror(errno));
@@ -423,22 +631,102 @@ RC Table::create_index(Trx *trx, const FieldMeta *field_meta, const char *index_
   std::string meta_file = table_meta_file(base_dir_.c_str(), name());
   int ret = rename(tmp_file.c_str(), meta_file.c_str());
   if (ret != 0) {
-    LOG_ERROR("Failed to rename tmp meta file (%s) to normal meta file (%s) while creating index (%s) on table (%s). "
-              "system error=%d:%s",
-              tmp_file.c_str(), meta_file.c_str(), index_name, name(), errno, strerror(errno));
+    LOG_ERROR("Failed to rename tmp meta file (%s) to normal meta file (%s) on table (%s). system error=%d:%s",
+              tmp_file.c_str(), meta_file.c_str(), name(), errno, strerror(errno));
     return RC::IOERR_WRITE;
   }
+  return RC::SUCCESS;
+}
 
-  table_meta_.swap(new_table_meta);
+RC Table::analyze(Trx *trx)
+{
+  // 记录文件的第一个页面是文件头，迭代器会跳过它
+  std::vector<PageNum> pages;
+  BufferPoolIterator bp_iterator;
+  RC rc = bp_iterator.init(*data_buffer_pool_);
+  if (rc != RC::SUCCESS) {
+    LOG_WARN("failed to init buffer pool iterator. table=%s, rc=%s", name(), strrc(rc));
+    return rc;
+  }
+  while (bp_iterator.has_next()) {
+    pages.push_back(bp_iterator.next());
+  }
 
-  LOG_INFO("Successfully added a new index (%s) on the table (%s)", index_name, name());
+  // 页面比较多时均匀地采样一部分页面
+  std::vector<PageNum> sample_pages;
+  const size_t max_sample_pages = TableStatsCollector::MAX_SAMPLE_PAGES;
+  if (pages.size() <= max_sample_pages) {
+    sample_pages = pages;
+  } else {
+    for (size_t i = 0; i < max_sample_pages; i++) {
+      sample_pages.push_back(pages[i * pages.size() / max_sample_pages]);
+    }
+  }
+
+  TableStatsCollector collector(table_meta_);
+  for (PageNum page_num : sample_pages) {
+    RecordPageHandler page_handler;
+    rc = page_handler.init(*data_buffer_pool_, page_num, true /*readonly*/);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to init record page handler. table=%s, page_num=%d, rc=%s", name(), page_num, strrc(rc));
+      return rc;
+    }
+
+    RecordPageIterator record_iterator;
+    record_iterator.init(page_handler);
+    Record record;
+    while (record_iterator.has_next()) {
+      rc = record_iterator.next(record);
+      if (rc != RC::SUCCESS) {
+        break;
+      }
+
+      // 只统计当前事务可见的数据
+      if (trx != nullptr) {
+        rc = trx->visit_record(this, record, true /*readonly*/);
+        if (rc == RC::RECORD_INVISIBLE) {
+          rc = RC::SUCCESS;
+          continue;
+        }
+        if (rc != RC::SUCCESS) {
+          break;
+        }
+      }
+      collector.add_record(record.data());
+    }
+    page_handler.cleanup();
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to scan records while analyzing table. table=%s, page_num=%d, rc=%s",
+               name(), page_num, strrc(rc));
+      return rc;
+    }
+  }
+
+  TableStats stats;
+  collector.finish(static_cast<int32_t>(pages.size()), static_cast<int32_t>(sample_pages.size()), stats);
+
+  TableMeta new_table_meta(table_meta_);
+  new_table_meta.set_stats(stats);
+  rc = dump_meta(new_table_meta);
+  if (rc != RC::SUCCESS) {
+    LOG_ERROR("Failed to dump table meta while analyzing table (%s). rc=%s", name(), strrc(rc));
+    return rc;
+  }
+
+  table_meta_.swap(new_table_meta);
+  LOG_INFO("Successfully analyzed table (%s). rows=%ld, pages=%d", name(), stats.row_count(), stats.page_count());
   return rc;
 }
 
 RC Table::delete_record(const Record &record)
 {
   RC rc = RC::SUCCESS;
+  std::shared_lock<common::SharedMutex> guard(index_lock_);
+  append_build_log(IndexBuildLog::Type::DELETE, record.data(), record.rid());
   for (Index *index : indexes_) {
+    if (!index->index_meta().covers(record.data())) {
+      continue;
+    }
     rc = index->delete_entry(record.data(), &record.rid());
     ASSERT(RC::SUCCESS == rc, 
            "failed to delete entry from index. table name=%s, index name=%s, rid=%s, rc=%s",
@@ -448,22 +736,50 @@ RC Table::delete_record(const Record &record)
   return rc;
 }
 
-RC Table::insert_entry_of_indexes(const char *record, const RID &rid)
+RC Table::insert_entry_of_indexes(const char *record, const RID &rid, const IndexEntryConflictChecker &conflict_checker)
 {
   RC rc = RC::SUCCESS;
-  for (Index *index : indexes_) {
-    rc = index->insert_entry(record, &rid);
+  size_t inserted_num = 0;
+  std::shared_lock<common::SharedMutex> guard(index_lock_);
+  for (size_t i = 0; i < indexes_.size(); i++) {
+    Index *index = indexes_[i];
+    // 部分索引只包含满足条件的记录
+    if (!index->index_meta().covers(record)) {
+      continue;
+    }
+    rc = index->insert_entry(record, &rid, conflict_checker);
     if (rc != RC::SUCCESS) {
+      inserted_num = i;
       break;
     }
   }
+
+  // 只回滚已经插入成功的索引，插入失败的索引中没有这条数据
+  for (size_t i = 0; i < inserted_num; i++) {
+    if (!indexes_[i]->index_meta().covers(record)) {
+      continue;
+    }
+    RC rc2 = indexes_[i]->delete_entry(record, &rid);
+    if (rc2 != RC::SUCCESS) {
+      LOG_ERROR("Failed to rollback index data when insert index entries failed. table name=%s, index=%s, rc=%s",
+                name(), indexes_[i]->index_meta().name(), strrc(rc2));
+    }
+  }
+
+  // 插入失败时调用者会删除这条记录，正在创建的索引可能已经扫描到了它
+  append_build_log(rc == RC::SUCCESS ? IndexBuildLog::Type::INSERT : IndexBuildLog::Type::DELETE, record, rid);
   return rc;
 }
 
 RC Table::delete_entry_of_indexes(const char *record, const RID &rid, bool error_on_not_exists)
 {
   RC rc = RC::SUCCESS;
+  std::shared_lock<common::SharedMutex> guard(index_lock_);
+  append_build_log(IndexBuildLog::Type::DELETE, record, rid);
   for (Index *index : indexes_) {
+    if (!index->index_meta().covers(record)) {
+      continue;
+    }
     rc = index->delete_entry(record, &rid);
     if (rc != RC::SUCCESS) {
       if (rc != RC::RECORD_INVALID_KEY || !error_on_not_exists) {
@@ -474,6 +790,58 @@ RC Table::delete_entry_of_indexes(const char *record, const RID &rid, bool error
   return rc;
 }
 
+void Table::append_build_log(IndexBuildLog::Type type, const char *record, const RID &rid)
+{
+  if (build_log_ != nullptr) {
+    build_log_->append(type, record, table_meta_.record_size(), rid);
+  }
+}
+
+RC Table::apply_index_build_entry(Index *index, Trx *trx, const IndexBuildLog::Entry &entry, bool idempotent)
+{
+  const char *data = entry.record.data();
+  if (!index->index_meta().covers(data)) {
+    return RC::SUCCESS;
+  }
+
+  RC rc = RC::SUCCESS;
+  if (entry.type == IndexBuildLog::Type::DELETE || idempotent) {
+    rc = index->delete_entry(data, &entry.rid);
+    // 扫描的时候可能没有看到这条记录
+    if (rc == RC::RECORD_NOT_EXIST || rc == RC::RECORD_INVALID_KEY) {
+      rc = RC::SUCCESS;
+    }
+    if (rc != RC::SUCCESS || entry.type == IndexBuildLog::Type::DELETE) {
+      return rc;
+    }
+  }
+
+  // 已经删除的记录不会与其它记录冲突。已经不存在的记录，后面一定还有一条删除它的修改
+  Record record;
+  record.set_data(const_cast<char *>(data), static_cast<int>(entry.record.size()));
+  record.set_rid(entry.rid);
+  const bool deleted = trx != nullptr && trx->is_deleted(this, record);
+  auto conflict_checker = [this, trx, deleted](const RID &rid) {
+    if (deleted) {
+      return false;
+    }
+    if (nullptr == trx) {
+      return true;
+    }
+    bool conflict = true;
+    RC rc = visit_record(rid, true /*readonly*/, [&](Record &exist_record) {
+      conflict = !trx->is_deleted(this, exist_record);
+    });
+    if (rc == RC::RECORD_NOT_EXIST) {
+      conflict = false;
+    } else if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to visit record while checking unique index. rid=%s, rc=%s", rid.to_string().c_str(), strrc(rc));
+    }
+    return conflict;
+  };
+  return index->insert_entry(data, &entry.rid, conflict_checker);
+}
+
 Index *Table::find_index(const char *index_name) const
 {
   for (Index *index : indexes_) {
@@ -483,10 +851,21 @@ Index *Table::find_index(const char *index_name) const
   }
   return nullptr;
 }
-Index *Table::find_index_by_field(const char *field_name) const
+Index *Table::find_index_by_field(
+    const char *field_name, bool for_equality, const std::vector<IndexPredicate> *conditions) const
 {
   const TableMeta &table_meta = this->table_meta();
-  const IndexMeta *index_meta = table_meta.find_index_by_field(field_name);
+  const IndexMeta *index_meta = table_meta.find_index_by_field(field_name, for_equality, conditions);
+  if (index_meta != nullptr) {
+    return this->find_index(index_meta->name());
+  }
+  return nullptr;
+}
+
+Index *Table::find_index_by_field(
+    const char *field_name, IndexType type, const std::vector<IndexPredicate> *conditions) const
+{
+  const IndexMeta *index_meta = table_meta_.find_index_by_field(field_name, type, conditions);
   if (index_meta != nullptr) {
     return this->find_index(index_meta->name());
   }
@@ -15,7 +15,10 @@ See the Mulan PSL v2 for more details. */
 #pragma once
 
 #include <functional>
+#include "common/lang/mutex.h"
 #include "storage/table/table_meta.h"
+#include "storage/table/index_build_log.h"
+#include "storage/index/index.h"
 
 struct RID;
 class Record;
@@ -74,19 +77,71 @@ public:
    * @brief 在当前的表中插入一条记录
    * @details 在表文件和索引中插入关联数据。这里只管在表中插入数据，不关心事务相关操作。
    * @param record[in/out] 传入的数据包含具体的数据，插入成功会通过此字段返回RID
+   * @param conflict_checker 插入唯一索引时，判断已经存在的相同键值是否冲突。为空时任何相同的键值都算冲突
    */
-  RC insert_record(Record &record);
+  RC insert_record(Record &record, const IndexEntryConflictChecker &conflict_checker = nullptr);
   RC delete_record(const Record &record);
   RC visit_record(const RID &rid, bool readonly, std::function<void(Record &)> visitor);
   RC get_record(const RID &rid, Record &record);
 
+  /**
+   * @brief 恢复时重做插入记录
+   * @details 只处理记录数据。索引的修改有自己的日志，由redo_index重做
+   */
   RC recover_insert_record(Record &record);
 
-  // TODO refactor
-  RC create_index(Trx *trx, const FieldMeta *field_meta, const char *index_name);
+  /**
+   * @brief 恢复时删除记录
+   * @param delete_index_entries 是否同时删除索引项。重做已经记录过的回滚时，索引的修改已经在索引日志中了
+   */
+  RC recover_delete_record(const Record &record, bool delete_index_entries);
+
+  /**
+   * @brief 开启索引日志
+   * @details 之后所有索引页面的修改都会记录到日志中，恢复时不需要重建索引
+   */
+  RC enable_log(CLogManager *log_manager);
+
+  /**
+   * @brief 重做一条索引日志
+   */
+  RC redo_index(const CLogRecord &log_record);
+
+  /**
+   * @brief 所有日志都重做完成以后调用，让索引重新加载内存中的数据
+   */
+  RC finish_redo();
+
+  /**
+   * @brief 创建索引
+   * @details 创建索引时不阻塞其它事务对这张表的修改。先记录下表上索引相关的修改，然后按页面扫描表中所有的数据
+   * 插入新的索引，再把扫描期间记录下来的修改应用到新的索引上，最后只在很短的时间内阻塞修改，把索引加入到表中。
+   * 索引中包含所有物理上存在的记录，包括已经删除但是没有清理的记录，与插入记录时维护索引的方式一致。
+   * @param trx 用来判断记录是否已经删除，唯一索引检查冲突时忽略已经删除的记录
+   */
+  RC create_index(Trx *trx, const FieldMeta *field_meta, const char *index_name, bool unique = false,
+                  IndexType type = IndexType::BPLUS_TREE, bool bloom_filter = false,
+                  const std::vector<IndexPredicate> &predicates = {});
 
   RC get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly);
 
+  /**
+   * @brief 只遍历数据文件中[begin_page, end_page)范围内的页面
+   * @details 并行扫描时每个工作线程每次处理一段页面
+   */
+  RC get_record_scanner(RecordFileScanner &scanner, Trx *trx, bool readonly, PageNum begin_page, PageNum end_page);
+
+  /**
+   * @brief 数据文件的页面个数，页号都小于这个值
+   */
+  PageNum data_page_count() const;
+
+  /**
+   * @brief 收集统计信息并保存到元数据中
+   * @details 页面比较多时只采样一部分页面，只统计事务可见的数据
+   */
+  RC analyze(Trx *trx);
+
   RecordFileHandler *record_handler() const
   {
     return record_handler_;
@@ -95,21 +150,55 @@ public:
 public:
   int32_t table_id() const { return table_meta_.table_id(); }
   const char *name() const;
+  const char *base_dir() const { return base_dir_.c_str(); }
 
   const TableMeta &table_meta() const;
 
   RC sync();
 
 private:
-  RC insert_entry_of_indexes(const char *record, const RID &rid);
+  /**
+   * @brief 在所有索引中插入记录对应的索引项
+   * @details 某个索引插入失败时，会把已经插入到其它索引中的索引项删除
+   */
+  RC insert_entry_of_indexes(const char *record, const RID &rid, const IndexEntryConflictChecker &conflict_checker);
   RC delete_entry_of_indexes(const char *record, const RID &rid, bool error_on_not_exists);
 
+  /**
+   * @brief 正在创建索引时，记录一条修改
+   * @details 需要在持有 index_lock_ 共享锁时调用
+   */
+  void append_build_log(IndexBuildLog::Type type, const char *record, const RID &rid);
+
+  /**
+   * @brief 把一条记录的修改应用到正在创建的索引上
+   * @param idempotent 插入前先删除可能已经存在的索引项。扫描的时候可能已经看到了这条修改
+   */
+  RC apply_index_build_entry(Index *index, Trx *trx, const IndexBuildLog::Entry &entry, bool idempotent);
+
 private:
   RC init_record_handler(const char *base_dir);
 
+  /**
+   * @brief 把新的元数据写到元数据文件中
+   */
+  RC dump_meta(const TableMeta &new_table_meta);
+
 public:
   Index *find_index(const char *index_name) const;
-  Index *find_index_by_field(const char *field_name) const;
+  /**
+   * @brief 查找字段上的索引
+   * @param for_equality 是否只用于等值查询。等值查询优先使用哈希索引，否则只返回有序的索引
+   * @param conditions 查询的条件，用来判断部分索引是否可以使用。为空时不返回部分索引
+   */
+  Index *find_index_by_field(const char *field_name, bool for_equality = false,
+      const std::vector<IndexPredicate> *conditions = nullptr) const;
+
+  /**
+   * @brief 查找字段上指定类型的索引
+   */
+  Index *find_index_by_field(const char *field_name, IndexType type,
+      const std::vector<IndexPredicate> *conditions = nullptr) const;
 
 private:
   std::string base_dir_;
@@ -117,4 +206,9 @@ private:
   DiskBufferPool *data_buffer_pool_ = nullptr;   /// 数据文件关联的buffer pool
   RecordFileHandler *record_handler_ = nullptr;  /// 记录操作
   std::vector<Index *> indexes_;
+  CLogManager *log_manager_ = nullptr;           /// 不为空时，索引的修改需要记录日志
+
+  /// 修改索引时加共享锁，创建索引时只在开始和最后加入索引的时候加排它锁
+  common::SharedMutex index_lock_;
+  IndexBuildLog      *build_log_ = nullptr;      /// 正在创建索引时不为空
 };
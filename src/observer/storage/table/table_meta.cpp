@@ -26,12 +26,14 @@ static const Json::StaticString FIELD_TABLE_ID("table_id");
 static const Json::StaticString FIELD_TABLE_NAME("table_name");
 static const Json::StaticString FIELD_FIELDS("fields");
 static const Json::StaticString FIELD_INDEXES("indexes");
+static const Json::StaticString FIELD_STATS("stats");
 
 TableMeta::TableMeta(const TableMeta &other)
     : table_id_(other.table_id_),
     name_(other.name_),
     fields_(other.fields_),
     indexes_(other.indexes_),
+    stats_(other.stats_),
     record_size_(other.record_size_)
 {}
 
@@ -40,6 +42,7 @@ void TableMeta::swap(TableMeta &other) noexcept
   name_.swap(other.name_);
   fields_.swap(other.fields_);
   indexes_.swap(other.indexes_);
+  std::swap(stats_, other.stats_);
   std::swap(record_size_, other.record_size_);
 }
 
@@ -165,14 +168,53 @@ const IndexMeta *TableMeta::index(const char *name) const
   return nullptr;
 }
 
-const IndexMeta *TableMeta::find_index_by_field(const char *field) const
+/**
+ * @brief 从两个候选索引中选择一个，可以使用的部分索引优先
+ */
+static const IndexMeta *prefer_index(
+    const IndexMeta *current, const IndexMeta &index, const std::vector<IndexPredicate> *conditions)
 {
+  if (index.partial() && (nullptr == conditions || !index.implied_by(*conditions))) {
+    return current;
+  }
+  if (nullptr == current || (!current->partial() && index.partial())) {
+    return &index;
+  }
+  return current;
+}
+
+const IndexMeta *TableMeta::find_index_by_field(
+    const char *field, bool for_equality, const std::vector<IndexPredicate> *conditions) const
+{
+  // 哈希索引没有顺序，只能用于等值查询，并且等值查询时比B+树更快。
+  // 位图索引一般用在不同值很少的字段上，单独使用的效果不好，不在这里返回
+  const IndexMeta *hash_index = nullptr;
+  const IndexMeta *ordered_index = nullptr;
   for (const IndexMeta &index : indexes_) {
-    if (0 == strcmp(index.field(), field)) {
-      return &index;
+    if (0 != strcmp(index.field(), field)) {
+      continue;
+    }
+    if (index.type() == IndexType::HASH) {
+      if (for_equality) {
+        hash_index = prefer_index(hash_index, index, conditions);
+      }
+    } else if (index.type() == IndexType::BPLUS_TREE) {
+      ordered_index = prefer_index(ordered_index, index, conditions);
     }
   }
-  return nullptr;
+  return hash_index != nullptr ? hash_index : ordered_index;
+}
+
+const IndexMeta *TableMeta::find_index_by_field(
+    const char *field, IndexType type, const std::vector<IndexPredicate> *conditions) const
+{
+  const IndexMeta *result = nullptr;
+  for (const IndexMeta &index : indexes_) {
+    if (index.type() == type && 0 == strcmp(index.field(), field)) {
+      result = prefer_index(result, index, conditions);
+    }
+  }
+  return result;
 }
 
 const IndexMeta *TableMeta::index(int i) const
@@ -214,6 +256,12 @@ int TableMeta::serialize(std::ostream &ss) const
   }
   table_value[FIELD_INDEXES] = std::move(indexes_value);
 
+  if (stats_.analyzed()) {
+    Json::Value stats_value;
+    stats_.to_json(stats_value);
+    table_value[FIELD_STATS] = std::move(stats_value);
+  }
+
   Json::StreamWriterBuilder builder;
   Json::StreamWriter *writer = builder.newStreamWriter();
 
@@ -302,6 +350,18 @@ int TableMeta::deserialize(std::istream &is)
     indexes_.swap(indexes);
   }
 
+  // 统计信息不影响正确性，格式不对时忽略，重新执行 ANALYZE TABLE 就可以了
+  const Json::Value &stats_value = table_value[FIELD_STATS];
+  if (stats_value.isObject()) {
+    TableStats stats;
+    rc = TableStats::from_json(stats_value, stats);
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("Failed to deserialize table stats, ignore it. table name=%s", name_.c_str());
+    } else {
+      stats_ = std::move(stats);
+    }
+  }
+
   return (int)(is.tellg() - old_pos);
 }
 
@@ -20,6 +20,7 @@ See the Mulan PSL v2 for more details. */
 #include "common/rc.h"
 #include "storage/field/field_meta.h"
 #include "storage/index/index_meta.h"
+#include "storage/table/table_stats.h"
 #include "common/lang/serializable.h"
 
 /**
@@ -40,6 +41,11 @@ public:
 
   RC add_index(const IndexMeta &index);
 
+  /**
+   * @brief 替换统计信息，ANALYZE TABLE 时使用
+   */
+  void set_stats(const TableStats &stats) { stats_ = stats; }
+
 public:
   int32_t table_id() const { return table_id_; }
   const char *name() const;
@@ -57,12 +63,22 @@ public:
   int sys_field_num() const;
 
   const IndexMeta *index(const char *name) const;
-  const IndexMeta *find_index_by_field(const char *field) const;
+  /**
+   * @brief 查找字段上可以用于查询的索引
+   * @param conditions 查询中 字段 op 常量 形式的AND条件。部分索引只有在这些条件能推导出索引的条件时才返回，
+   *                   可以使用时部分索引优先，因为它更小
+   */
+  const IndexMeta *find_index_by_field(const char *field, bool for_equality = false,
+      const std::vector<IndexPredicate> *conditions = nullptr) const;
+  const IndexMeta *find_index_by_field(const char *field, IndexType type,
+      const std::vector<IndexPredicate> *conditions = nullptr) const;
   const IndexMeta *index(int i) const;
   int index_num() const;
 
   int record_size() const;
 
+  const TableStats &stats() const { return stats_; }
+
 public:
   int serialize(std::ostream &os) const override;
   int deserialize(std::istream &is) override;
@@ -75,6 +91,7 @@ protected:
   std::string name_;
   std::vector<FieldMeta> fields_;  // 包含sys_fields
   std::vector<IndexMeta> indexes_;
+  TableStats             stats_;  ///< 没有执行过 ANALYZE TABLE 时是空的
 
   int record_size_ = 0;
 };
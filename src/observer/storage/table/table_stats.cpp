@@ -0,0 +1,338 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <algorithm>
+
+#include "storage/table/table_stats.h"
+#include "storage/table/table_meta.h"
+#include "storage/common/meta_util.h"
+#include "common/lang/bloom_filter.h"
+#include "common/log/log.h"
+#include "json/json.h"
+
+using namespace std;
+
+static const Json::StaticString FIELD_FIELD_NAME("field_name");
+static const Json::StaticString FIELD_TYPE("type");
+static const Json::StaticString FIELD_DISTINCT_COUNT("distinct_count");
+static const Json::StaticString FIELD_NULL_FRACTION("null_fraction");
+static const Json::StaticString FIELD_BOUNDS("bounds");
+static const Json::StaticString FIELD_ROW_COUNT("row_count");
+static const Json::StaticString FIELD_PAGE_COUNT("page_count");
+static const Json::StaticString FIELD_SAMPLE_ROWS("sample_rows");
+static const Json::StaticString FIELD_SAMPLE_PAGES("sample_pages");
+static const Json::StaticString FIELD_COLUMNS("columns");
+
+////////////////////////////////////////////////////////////////////////////////
+double ColumnStats::equal_selectivity(const Value &value) const
+{
+  if (bounds_.empty()) {
+    return 0;
+  }
+  if (value.compare(bounds_.front()) < 0 || value.compare(bounds_.back()) > 0) {
+    return 0;
+  }
+
+  // 上下边界都是这个值的桶里面全是这个值，只有一个边界是这个值的桶算一半
+  const int bucket_num = static_cast<int>(bounds_.size()) - 1;
+  int       full_buckets = 0;
+  int       partial_buckets = 0;
+  for (int i = 0; i < bucket_num; i++) {
+    const bool low_equal  = bounds_[i].compare(value) == 0;
+    const bool high_equal = bounds_[i + 1].compare(value) == 0;
+    if (low_equal && high_equal) {
+      full_buckets++;
+    } else if (low_equal || high_equal) {
+      partial_buckets++;
+    }
+  }
+  if (full_buckets > 0) {
+    return (full_buckets + 0.5 * partial_buckets) / bucket_num;
+  }
+
+  // 不是常见的值，按照均匀分布估算，但是最多不超过一个桶
+  double selectivity = 1.0 / max(bucket_num, 1);
+  if (distinct_count_ > 0) {
+    selectivity = min(selectivity, 1.0 / distinct_count_);
+  }
+  return selectivity;
+}
+
+double ColumnStats::less_fraction(const Value &value) const
+{
+  const int bucket_num = static_cast<int>(bounds_.size()) - 1;
+  if (bucket_num <= 0) {
+    return value.compare(bounds_.front()) > 0 ? 1 : 0;
+  }
+
+  double fraction = 0;
+  for (int i = 0; i < bucket_num; i++) {
+    const Value &low  = bounds_[i];
+    const Value &high = bounds_[i + 1];
+    if (high.compare(value) < 0) {
+      fraction += 1;
+    } else if (low.compare(value) < 0) {
+      // value 在这个桶中间，数值类型按照线性插值，字符串就算一半
+      double part = 0.5;
+      if (attr_type_ == INTS || attr_type_ == FLOATS) {
+        const double low_value  = low.get_float();
+        const double high_value = high.get_float();
+        if (high_value > low_value) {
+          part = (value.get_float() - low_value) / (high_value - low_value);
+        }
+      }
+      fraction += part;
+    } else {
+      break;
+    }
+  }
+  return fraction / bucket_num;
+}
+
+double ColumnStats::range_selectivity(
+    const Value *left, bool left_inclusive, const Value *right, bool right_inclusive) const
+{
+  if (bounds_.empty()) {
+    return 0;
+  }
+
+  if (left != nullptr && right != nullptr && left_inclusive && right_inclusive && left->compare(*right) == 0) {
+    return equal_selectivity(*left);
+  }
+
+  // 满足条件的比例 = 右边界以下的比例 - 左边界以下的比例
+  double high_fraction = 1;
+  if (right != nullptr) {
+    high_fraction = less_fraction(*right);
+    if (right_inclusive) {
+      high_fraction += equal_selectivity(*right);
+    }
+  }
+
+  double low_fraction = 0;
+  if (left != nullptr) {
+    low_fraction = less_fraction(*left);
+    if (!left_inclusive) {
+      low_fraction += equal_selectivity(*left);
+    }
+  }
+
+  return clamp(high_fraction - low_fraction, 0.0, 1.0);
+}
+
+void ColumnStats::to_json(Json::Value &json_value) const
+{
+  json_value[FIELD_FIELD_NAME]     = field_name_;
+  json_value[FIELD_TYPE]           = attr_type_to_string(attr_type_);
+  json_value[FIELD_DISTINCT_COUNT] = static_cast<Json::Int64>(distinct_count_);
+  json_value[FIELD_NULL_FRACTION]  = null_fraction_;
+
+  Json::Value bounds_value(Json::arrayValue);
+  for (const Value &bound : bounds_) {
+    Json::Value bound_value;
+    value_to_json(bound, bound_value);
+    bounds_value.append(std::move(bound_value));
+  }
+  json_value[FIELD_BOUNDS] = std::move(bounds_value);
+}
+
+RC ColumnStats::from_json(const Json::Value &json_value, ColumnStats &column)
+{
+  const Json::Value &name_value     = json_value[FIELD_FIELD_NAME];
+  const Json::Value &type_value     = json_value[FIELD_TYPE];
+  const Json::Value &distinct_value = json_value[FIELD_DISTINCT_COUNT];
+  const Json::Value &null_value     = json_value[FIELD_NULL_FRACTION];
+  const Json::Value &bounds_value   = json_value[FIELD_BOUNDS];
+  if (!name_value.isString() || !type_value.isString() || !distinct_value.isIntegral() || !null_value.isNumeric() ||
+      !bounds_value.isArray()) {
+    LOG_ERROR("Invalid column stats. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+
+  column.field_name_     = name_value.asString();
+  column.attr_type_      = attr_type_from_string(type_value.asCString());
+  column.distinct_count_ = distinct_value.asInt64();
+  column.null_fraction_  = null_value.asDouble();
+  column.bounds_.clear();
+  for (const Json::Value &bound_value : bounds_value) {
+    Value bound;
+    if (!value_from_json(bound_value, column.attr_type_, bound)) {
+      LOG_ERROR("Invalid histogram bound of column %s. json value=%s",
+          column.field_name_.c_str(), bound_value.toStyledString().c_str());
+      return RC::INTERNAL;
+    }
+    column.bounds_.emplace_back(std::move(bound));
+  }
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+const ColumnStats *TableStats::column(const char *field_name) const
+{
+  for (const ColumnStats &column : columns_) {
+    if (0 == strcmp(column.field_name().c_str(), field_name)) {
+      return &column;
+    }
+  }
+  return nullptr;
+}
+
+bool TableStats::selectivity(const char *field_name, const Value *left, bool left_inclusive, const Value *right,
+    bool right_inclusive, double &result) const
+{
+  const ColumnStats *column_stats = analyzed_ ? column(field_name) : nullptr;
+  if (nullptr == column_stats) {
+    return false;
+  }
+
+  result = column_stats->range_selectivity(left, left_inclusive, right, right_inclusive);
+  return true;
+}
+
+void TableStats::to_json(Json::Value &json_value) const
+{
+  json_value[FIELD_ROW_COUNT]    = static_cast<Json::Int64>(row_count_);
+  json_value[FIELD_PAGE_COUNT]   = page_count_;
+  json_value[FIELD_SAMPLE_ROWS]  = static_cast<Json::Int64>(sample_rows_);
+  json_value[FIELD_SAMPLE_PAGES] = sample_pages_;
+
+  Json::Value columns_value(Json::arrayValue);
+  for (const ColumnStats &column : columns_) {
+    Json::Value column_value;
+    column.to_json(column_value);
+    columns_value.append(std::move(column_value));
+  }
+  json_value[FIELD_COLUMNS] = std::move(columns_value);
+}
+
+RC TableStats::from_json(const Json::Value &json_value, TableStats &stats)
+{
+  const Json::Value &row_count_value    = json_value[FIELD_ROW_COUNT];
+  const Json::Value &page_count_value   = json_value[FIELD_PAGE_COUNT];
+  const Json::Value &sample_rows_value  = json_value[FIELD_SAMPLE_ROWS];
+  const Json::Value &sample_pages_value = json_value[FIELD_SAMPLE_PAGES];
+  const Json::Value &columns_value      = json_value[FIELD_COLUMNS];
+  if (!row_count_value.isIntegral() || !page_count_value.isInt() || !sample_rows_value.isIntegral() ||
+      !sample_pages_value.isInt() || !columns_value.isArray()) {
+    LOG_ERROR("Invalid table stats. json value=%s", json_value.toStyledString().c_str());
+    return RC::INTERNAL;
+  }
+
+  vector<ColumnStats> columns(columns_value.size());
+  for (Json::ArrayIndex i = 0; i < columns_value.size(); i++) {
+    RC rc = ColumnStats::from_json(columns_value[i], columns[i]);
+    if (rc != RC::SUCCESS) {
+      return rc;
+    }
+  }
+
+  stats.analyzed_     = true;
+  stats.row_count_    = row_count_value.asInt64();
+  stats.page_count_   = page_count_value.asInt();
+  stats.sample_rows_  = sample_rows_value.asInt64();
+  stats.sample_pages_ = sample_pages_value.asInt();
+  stats.columns_.swap(columns);
+  return RC::SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+TableStatsCollector::TableStatsCollector(const TableMeta &table_meta) : table_meta_(table_meta)
+{
+  const int field_num = table_meta_.field_num() - table_meta_.sys_field_num();
+  sketches_.resize(field_num);
+  samples_.resize(field_num);
+}
+
+void TableStatsCollector::add_record(const char *record)
+{
+  // 蓄水池抽样，第n行数据以 MAX_SAMPLE_ROWS/n 的概率替换掉已经保留的某一行
+  int64_t sample_index = row_count_;
+  if (row_count_ >= MAX_SAMPLE_ROWS) {
+    sample_index = static_cast<int64_t>(random_() % static_cast<uint64_t>(row_count_ + 1));
+  }
+  row_count_++;
+
+  const int sys_field_num = table_meta_.sys_field_num();
+  for (size_t i = 0; i < samples_.size(); i++) {
+    const FieldMeta *field = table_meta_.field(static_cast<int>(i) + sys_field_num);
+    const char      *data  = record + field->offset();
+
+    // 字符串只有'\0'之前的内容有意义
+    size_t length = field->len();
+    if (field->type() == CHARS) {
+      length = strnlen(data, length);
+    }
+    sketches_[i].add(common::BlockedBloomFilter::hash_bytes(data, length));
+
+    if (sample_index < MAX_SAMPLE_ROWS) {
+      Value value;
+      value.set_type(field->type());
+      value.set_data(data, field->len());
+      if (sample_index < static_cast<int64_t>(samples_[i].size())) {
+        samples_[i][sample_index] = std::move(value);
+      } else {
+        samples_[i].emplace_back(std::move(value));
+      }
+    }
+  }
+}
+
+void TableStatsCollector::finish(int32_t total_pages, int32_t sampled_pages, TableStats &stats)
+{
+  stats.analyzed_     = true;
+  stats.page_count_   = total_pages;
+  stats.sample_pages_ = sampled_pages;
+  stats.sample_rows_  = row_count_;
+  stats.row_count_    = row_count_;
+  if (sampled_pages > 0 && sampled_pages < total_pages) {
+    stats.row_count_ = row_count_ * total_pages / sampled_pages;
+  }
+
+  const int sys_field_num = table_meta_.sys_field_num();
+  stats.columns_.clear();
+  stats.columns_.resize(samples_.size());
+  for (size_t i = 0; i < samples_.size(); i++) {
+    const FieldMeta *field  = table_meta_.field(static_cast<int>(i) + sys_field_num);
+    ColumnStats     &column = stats.columns_[i];
+    column.field_name_      = field->name();
+    column.attr_type_       = field->type();
+    // 当前没有NULL值，所有的字段都不为空
+    column.null_fraction_   = 0;
+
+    // 采样的数据中几乎都是不同的值时，认为整个表也是这样，按比例放大
+    double distinct = min(sketches_[i].estimate(), static_cast<double>(row_count_));
+    if (row_count_ > 0 && stats.row_count_ > row_count_ && distinct > 0.9 * row_count_) {
+      distinct = distinct * stats.row_count_ / row_count_;
+    }
+    column.distinct_count_ = static_cast<int64_t>(distinct + 0.5);
+
+    vector<Value> &values = samples_[i];
+    if (values.empty()) {
+      continue;
+    }
+
+    sort(values.begin(), values.end(), [](const Value &left, const Value &right) { return left.compare(right) < 0; });
+    const int bucket_num = min(HISTOGRAM_BUCKETS, static_cast<int>(values.size()));
+    column.bounds_.reserve(bucket_num + 1);
+    for (int b = 0; b <= bucket_num; b++) {
+      const size_t pos = static_cast<size_t>(b) * (values.size() - 1) / bucket_num;
+      column.bounds_.push_back(values[pos]);
+    }
+  }
+
+  samples_.clear();
+  LOG_INFO("table stats collected. table=%s, rows=%ld, sampled rows=%ld, pages=%d, sampled pages=%d",
+      table_meta_.name(), stats.row_count_, row_count_, total_pages, sampled_pages);
+}
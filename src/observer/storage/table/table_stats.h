@@ -0,0 +1,153 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/rc.h"
+#include "common/math/hyperloglog.h"
+#include "sql/parser/value.h"
+
+namespace Json {
+class Value;
+}  // namespace Json
+
+class TableMeta;
+
+/**
+ * @brief 一个字段的统计信息
+ * @ingroup Table
+ * @details 包括不同值的个数、空值的比例和等深直方图。
+ * 等深直方图有 bounds().size() - 1 个桶，每个桶中的记录数相同，第i个桶的范围是[bounds[i], bounds[i+1]]。
+ * 一个值占满了多个桶时，这些桶的上下边界都是这个值，可以据此识别出现次数很多的值。
+ */
+class ColumnStats
+{
+public:
+  ColumnStats() = default;
+
+  const std::string        &field_name() const { return field_name_; }
+  AttrType                  attr_type() const { return attr_type_; }
+  int64_t                   distinct_count() const { return distinct_count_; }
+  double                    null_fraction() const { return null_fraction_; }
+  const std::vector<Value> &bounds() const { return bounds_; }
+
+  /**
+   * @brief 估算等于value的记录所占的比例
+   */
+  double equal_selectivity(const Value &value) const;
+
+  /**
+   * @brief 估算在范围内的记录所占的比例
+   * @param left 左边界，为空表示没有限制
+   * @param right 右边界，为空表示没有限制
+   */
+  double range_selectivity(const Value *left, bool left_inclusive, const Value *right, bool right_inclusive) const;
+
+  void      to_json(Json::Value &json_value) const;
+  static RC from_json(const Json::Value &json_value, ColumnStats &column);
+
+private:
+  /**
+   * @brief 估算小于value的记录所占的比例，桶内按照均匀分布插值
+   */
+  double less_fraction(const Value &value) const;
+
+private:
+  friend class TableStatsCollector;
+
+  std::string        field_name_;
+  AttrType           attr_type_      = UNDEFINED;
+  int64_t            distinct_count_ = 0;
+  double             null_fraction_  = 0;
+  std::vector<Value> bounds_;
+};
+
+/**
+ * @brief 表的统计信息
+ * @ingroup Table
+ * @details 由 ANALYZE TABLE 收集，保存在表的元数据中，优化器根据它估算各种访问路径的代价。
+ * 统计信息不会随着数据的修改自动更新，数据变化比较大以后需要重新执行 ANALYZE TABLE。
+ */
+class TableStats
+{
+public:
+  TableStats() = default;
+
+  bool    analyzed() const { return analyzed_; }
+  int64_t row_count() const { return row_count_; }
+  int32_t page_count() const { return page_count_; }
+  int64_t sample_rows() const { return sample_rows_; }
+  int32_t sample_pages() const { return sample_pages_; }
+
+  const std::vector<ColumnStats> &columns() const { return columns_; }
+  const ColumnStats              *column(const char *field_name) const;
+
+  /**
+   * @brief 估算满足字段范围条件的记录所占的比例
+   * @details 左右边界都存在、都包含并且相等时就是等值条件
+   * @return 没有收集过这个字段的统计信息时返回false
+   */
+  bool selectivity(const char *field_name, const Value *left, bool left_inclusive, const Value *right,
+      bool right_inclusive, double &result) const;
+
+  void      to_json(Json::Value &json_value) const;
+  static RC from_json(const Json::Value &json_value, TableStats &stats);
+
+private:
+  friend class TableStatsCollector;
+
+  bool                     analyzed_     = false;
+  int64_t                  row_count_    = 0;
+  int32_t                  page_count_   = 0;  ///< 数据文件的页面个数
+  int64_t                  sample_rows_  = 0;  ///< 采样到的记录数
+  int32_t                  sample_pages_ = 0;  ///< 采样的页面个数
+  std::vector<ColumnStats> columns_;
+};
+
+/**
+ * @brief 收集表的统计信息
+ * @ingroup Table
+ * @details 调用者按页面采样，把采样页面上所有可见的记录交给收集器。
+ * 每个字段的所有采样值都会加到HyperLogLog中估算不同值的个数，同时用蓄水池抽样保留最多
+ * MAX_SAMPLE_ROWS 行数据，结束时排序生成等深直方图。
+ */
+class TableStatsCollector
+{
+public:
+  static constexpr int MAX_SAMPLE_PAGES  = 256;    ///< 最多采样的页面个数
+  static constexpr int MAX_SAMPLE_ROWS   = 30000;  ///< 生成直方图时最多使用的记录数
+  static constexpr int HISTOGRAM_BUCKETS = 32;     ///< 直方图的桶数
+
+public:
+  explicit TableStatsCollector(const TableMeta &table_meta);
+
+  void add_record(const char *record);
+
+  /**
+   * @param total_pages 数据文件的页面个数
+   * @param sampled_pages 实际采样的页面个数，用来把采样的记录数换算成整个表的记录数
+   */
+  void finish(int32_t total_pages, int32_t sampled_pages, TableStats &stats);
+
+private:
+  const TableMeta                &table_meta_;
+  std::vector<common::HyperLogLog> sketches_;
+  std::vector<std::vector<Value>>  samples_;  ///< 每个字段保留的采样值，所有字段使用相同的记录
+  int64_t                          row_count_ = 0;
+  std::mt19937_64                  random_{0};
+};
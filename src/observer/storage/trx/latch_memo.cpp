@@ -158,6 +158,18 @@ void LatchMemo::release()
   disposed_pages_.clear();
 }
 
+void LatchMemo::release_frame(Frame *frame)
+{
+  // 从后向前释放，先释放锁再unpin
+  for (int i = static_cast<int>(items_.size()) - 1; i >= 0; i--) {
+    LatchMemoItem &item = items_[i];
+    if (item.frame == frame) {
+      release_item(item);
+      items_.erase(items_.begin() + i);
+    }
+  }
+}
+
 void LatchMemo::release_to(int point)
 {
   ASSERT(point >= 0 && point <= static_cast<int>(items_.size()), 
@@ -70,6 +70,12 @@ public:
 
   void release_to(int point);
 
+  /**
+   * @brief 释放指定页面上的锁和pin，其它页面不受影响
+   * @details B-link树在查找时只持有当前节点的锁，换到下一个节点时需要单独释放前面的节点
+   */
+  void release_frame(Frame *frame);
+
   int  memo_point() const { return static_cast<int>(items_.size()); }
 
 private:
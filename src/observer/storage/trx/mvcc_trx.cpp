@@ -117,6 +117,20 @@ void MvccTrxKit::all_trxes(std::vector<Trx *> &trxes)
   lock_.unlock();
 }
 
+int32_t MvccTrxKit::min_active_trx_id()
+{
+  lock_.lock();
+  int32_t min_trx_id = current_trx_id_;
+  for (Trx *trx : trxes_) {
+    MvccTrx *mvcc_trx = static_cast<MvccTrx *>(trx);
+    if (mvcc_trx->started() && mvcc_trx->id() < min_trx_id) {
+      min_trx_id = mvcc_trx->id();
+    }
+  }
+  lock_.unlock();
+  return min_trx_id;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 MvccTrx::MvccTrx(MvccTrxKit &kit, CLogManager *log_manager) : trx_kit_(kit), log_manager_(log_manager)
@@ -141,7 +155,20 @@ RC MvccTrx::insert_record(Table *table, Record &record)
   begin_field.set_int(record, -trx_id_);
   end_field.set_int(record, trx_kit_.max_trx_id());
 
-  RC rc = table->insert_record(record);
+  // 删除记录时不会删除索引项，唯一索引中相同键值的记录，如果已经被删除并且提交了，或者就是当前事务删除的，
+  // 就不算冲突。其它事务正在删除的记录可能会回滚，仍然算冲突
+  auto conflict_checker = [this, table](const RID &rid) {
+    bool conflict = true;
+    RC rc = table->visit_record(rid, true /*readonly*/, [&](Record &exist_record) {
+      conflict = !is_deleted(table, exist_record);
+    });
+    if (rc != RC::SUCCESS) {
+      LOG_WARN("failed to visit record while checking unique index. rid=%s, rc=%s", rid.to_string().c_str(), strrc(rc));
+    }
+    return conflict;
+  };
+
+  RC rc = table->insert_record(record, conflict_checker);
   if (rc != RC::SUCCESS) {
     LOG_WARN("failed to insert record into table. rc=%s", strrc(rc));
     return rc;
@@ -219,6 +246,33 @@ RC MvccTrx::visit_record(Table *table, Record &record, bool readonly)
   return rc;
 }
 
+bool MvccTrx::visible_to_all(Table *table, const Record &record)
+{
+  Field begin_field;
+  Field end_field;
+  trx_fields(table, begin_field, end_field);
+
+  int32_t begin_xid = begin_field.get_int(record);
+  int32_t end_xid = end_field.get_int(record);
+  if (begin_xid <= 0 || end_xid != trx_kit_.max_trx_id()) {
+    // 没有提交的插入，或者已经(正在)被删除的数据
+    return false;
+  }
+
+  // 活跃事务的事务号比 begin_xid 小的话，是看不到这条数据的
+  return begin_xid <= trx_kit_.min_active_trx_id();
+}
+
+bool MvccTrx::is_deleted(Table *table, const Record &record)
+{
+  Field begin_field;
+  Field end_field;
+  trx_fields(table, begin_field, end_field);
+
+  const int32_t end_xid = end_field.get_int(record);
+  return (end_xid > 0 && end_xid != trx_kit_.max_trx_id()) || end_xid == -trx_id_;
+}
+
 /**
  * @brief 获取指定表上的事务使用的字段
  * 
@@ -323,6 +377,11 @@ RC MvccTrx::commit_with_trx_id(int32_t commit_xid)
 }
 
 RC MvccTrx::rollback()
+{
+  return rollback_internal(false /*redo*/);
+}
+
+RC MvccTrx::rollback_internal(bool redo)
 {
   RC rc = RC::SUCCESS;
   started_ = false;
@@ -340,7 +399,15 @@ RC MvccTrx::rollback()
         rc = table->get_record(rid, record); 
         ASSERT(rc == RC::SUCCESS, "failed to get record while rollback. rid=%s, rc=%s", 
                rid.to_string().c_str(), strrc(rc));
-        rc = table->delete_record(record);
+        if (redo) {
+          // 当时删除索引项的修改已经记录在索引日志中，并且已经重做过了
+          rc = table->recover_delete_record(record, false /*delete_index_entries*/);
+        } else if (recovering_) {
+          // 恢复完成以后回滚没有提交的事务，索引项可能没有来得及插入
+          rc = table->recover_delete_record(record, true /*delete_index_entries*/);
+        } else {
+          rc = table->delete_record(record);
+        }
         ASSERT(rc == RC::SUCCESS, "failed to delete record while rollback. rid=%s, rc=%s",
               rid.to_string().c_str(), strrc(rc));
       } break;
@@ -453,7 +520,7 @@ RC MvccTrx::redo(Db *db, const CLogRecord &log_record)
     } break;
 
     case CLogType::MTR_ROLLBACK: {
-      rollback();
+      rollback_internal(true /*redo*/);
     } break;
     
     default: {
@@ -27,6 +27,7 @@ public:
   virtual ~MvccTrxKit();
 
   RC init() override;
+  Type type() const override { return MVCC; }
   const std::vector<FieldMeta> *trx_fields() const override;
   Trx *create_trx(CLogManager *log_manager) override;
   Trx *create_trx(int32_t trx_id) override;
@@ -45,6 +46,12 @@ public:
 public:
   int32_t max_trx_id() const;
 
+  /**
+   * @brief 当前所有活跃事务中最小的事务号
+   * @details 如果没有活跃的事务，就返回当前已经分配的最大事务号。之后开启的事务，事务号都会比它大
+   */
+  int32_t min_active_trx_id();
+
 private:
   std::vector<FieldMeta> fields_; // 存储事务数据需要用到的字段元数据，所有表结构都需要带的
 
@@ -81,6 +88,17 @@ public:
    */
   RC visit_record(Table *table, Record &record, bool readonly) override;
 
+  /**
+   * @brief 记录已经提交、没有被删除，并且提交的事务号不大于所有活跃事务的事务号时，对所有事务可见
+   */
+  bool visible_to_all(Table *table, const Record &record) override;
+
+  /**
+   * @brief 删除已经提交，或者是被当前事务删除的记录
+   * @details 其它事务正在删除的记录不算，那个事务可能会回滚
+   */
+  bool is_deleted(Table *table, const Record &record) override;
+
   RC start_if_need() override;
   RC commit() override;
   RC rollback() override;
@@ -88,9 +106,15 @@ public:
   RC redo(Db *db, const CLogRecord &log_record) override;
 
   int32_t id() const override { return trx_id_; }
+  bool started() const { return started_; }
 
 private:
   RC commit_with_trx_id(int32_t commit_id);
+
+  /**
+   * @param redo 是否在重做回滚日志。重做时只删除记录数据，索引的修改有自己的日志
+   */
+  RC rollback_internal(bool redo);
   void trx_fields(Table *table, Field &begin_xid_field, Field &end_xid_field) const;
 
 private:
@@ -120,6 +120,7 @@ public:
   virtual ~TrxKit() = default;
 
   virtual RC init() = 0;
+  virtual Type type() const = 0;
   virtual const std::vector<FieldMeta> *trx_fields() const = 0;
   virtual Trx *create_trx(CLogManager *log_manager) = 0;
   virtual Trx *create_trx(int32_t trx_id) = 0;
@@ -148,6 +149,18 @@ public:
   virtual RC delete_record(Table *table, Record &record) = 0;
   virtual RC visit_record(Table *table, Record &record, bool readonly) = 0;
 
+  /**
+   * @brief 判断某条记录是否对所有事务都可见，包括当前活跃的和之后才开启的事务
+   * @details 用来维护数据页面的 all-visible 标记，参考 RecordFileHandler::is_page_all_visible
+   */
+  virtual bool visible_to_all(Table *table, const Record &record) = 0;
+
+  /**
+   * @brief 判断某条记录是否已经被删除了，包括已经提交的删除和当前事务自己的删除
+   * @details 索引中会保留已经删除的数据，唯一索引检查键值冲突时要忽略这些数据
+   */
+  virtual bool is_deleted(Table *table, const Record &record) = 0;
+
   virtual RC start_if_need() = 0;
   virtual RC commit() = 0;
   virtual RC rollback() = 0;
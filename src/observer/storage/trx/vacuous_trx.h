@@ -26,6 +26,7 @@ public:
   virtual ~VacuousTrxKit() = default;
 
   RC init() override;
+  Type type() const override { return VACUOUS; }
   const std::vector<FieldMeta> *trx_fields() const override;
   Trx *create_trx(CLogManager *log_manager) override;
   Trx *create_trx(int32_t trx_id) override;
@@ -44,6 +45,8 @@ public:
   RC insert_record(Table *table, Record &record) override;
   RC delete_record(Table *table, Record &record) override;
   RC visit_record(Table *table, Record &record, bool readonly) override;
+  bool visible_to_all(Table *table, const Record &record) override { return true; }
+  bool is_deleted(Table *table, const Record &record) override { return false; }
   RC start_if_need() override;
   RC commit() override;
   RC rollback() override;
@@ -0,0 +1,422 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sql/operator/hash_aggregate_physical_operator.h"
+#include "sql/operator/hash_join_physical_operator.h"
+#include "sql/operator/parallel_hash_aggregate_physical_operator.h"
+#include "sql/operator/stream_aggregate_physical_operator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/table/table.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+BufferPoolManager bpm;
+
+// 没有初始化的表，名字是空的
+static Table     table;
+static FieldMeta id_meta;
+static FieldMeta score_meta;
+static FieldMeta name_meta;
+
+/**
+ * @brief 按顺序输出给定数据的算子，模拟聚合算子的输入
+ */
+class ValuesPhysicalOperator : public PhysicalOperator
+{
+public:
+  ValuesPhysicalOperator(const vector<vector<Value>> &rows) : rows_(rows)
+  {
+    speces_.emplace_back(table.name(), id_meta.name());
+    speces_.emplace_back(table.name(), score_meta.name());
+    speces_.emplace_back(table.name(), name_meta.name());
+    tuple_.set_schema(&speces_);
+  }
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::STRING_LIST; }
+
+  RC open(Trx *) override
+  {
+    current_ = -1;
+    return RC::SUCCESS;
+  }
+  RC next() override
+  {
+    if (++current_ >= static_cast<int>(rows_.size())) {
+      return RC::RECORD_EOF;
+    }
+    tuple_.set_cells(rows_[current_].data());
+    return RC::SUCCESS;
+  }
+  RC close() override { return RC::SUCCESS; }
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+private:
+  vector<vector<Value>>  rows_;
+  int                    current_ = -1;
+  vector<TupleCellSpec>  speces_;
+  MaterializedTuple      tuple_;
+};
+
+static unique_ptr<Expression> field_expr(const FieldMeta &field_meta)
+{
+  unique_ptr<Expression> expr = make_unique<FieldExpr>(Field(&table, &field_meta));
+  expr->set_name(field_meta.name());
+  return expr;
+}
+
+static unique_ptr<Expression> aggregate_expr(AggregateExpr::Type type, const FieldMeta *field_meta)
+{
+  unique_ptr<Expression> child = (nullptr == field_meta) ? nullptr : field_expr(*field_meta);
+  const string arg = (nullptr == field_meta) ? "*" : field_meta->name();
+  unique_ptr<Expression> expr = make_unique<AggregateExpr>(type, std::move(child));
+  expr->set_name(string(AggregateExpr::type_name(type)) + "(" + arg + ")");
+  return expr;
+}
+
+/**
+ * @brief select id, count(*), sum(score), min(name), avg(score) from t group by id
+ */
+static void make_exprs(
+    bool group_by_id, vector<unique_ptr<Expression>> &group_by_exprs, vector<unique_ptr<Expression>> &exprs)
+{
+  if (group_by_id) {
+    group_by_exprs.emplace_back(field_expr(id_meta));
+    exprs.emplace_back(field_expr(id_meta));
+  }
+  exprs.emplace_back(aggregate_expr(AggregateExpr::Type::CNT, nullptr));
+  exprs.emplace_back(aggregate_expr(AggregateExpr::Type::SUM, &score_meta));
+  exprs.emplace_back(aggregate_expr(AggregateExpr::Type::MIN, &name_meta));
+  exprs.emplace_back(aggregate_expr(AggregateExpr::Type::AVG, &score_meta));
+}
+
+template <typename AggregateOperator, typename... Args>
+static unique_ptr<AggregatePhysicalOperator> create_aggregate(
+    const vector<vector<Value>> &rows, bool group_by_id, Args... args)
+{
+  vector<unique_ptr<Expression>> group_by_exprs;
+  vector<unique_ptr<Expression>> exprs;
+  make_exprs(group_by_id, group_by_exprs, exprs);
+
+  unique_ptr<AggregatePhysicalOperator> oper(
+      new AggregateOperator(std::move(group_by_exprs), std::move(exprs), args...));
+  oper->add_child(make_unique<ValuesPhysicalOperator>(rows));
+  return oper;
+}
+
+/**
+ * @brief 输入的行轮流分给每个工作线程的局部聚合
+ */
+static unique_ptr<AggregatePhysicalOperator> create_parallel_aggregate(
+    const vector<vector<Value>> &rows, bool group_by_id, int worker_num)
+{
+  vector<unique_ptr<Expression>> group_by_exprs;
+  vector<unique_ptr<Expression>> exprs;
+  make_exprs(group_by_id, group_by_exprs, exprs);
+  unique_ptr<AggregatePhysicalOperator> oper(new ParallelHashAggregatePhysicalOperator(
+      std::move(group_by_exprs), std::move(exprs), ".", nullptr /*scheduler*/, nullptr /*table*/));
+
+  for (int worker = 0; worker < worker_num; worker++) {
+    vector<vector<Value>> worker_rows;
+    for (size_t i = worker; i < rows.size(); i += worker_num) {
+      worker_rows.push_back(rows[i]);
+    }
+    unique_ptr<AggregatePhysicalOperator> partial =
+        create_aggregate<HashAggregatePhysicalOperator>(worker_rows, group_by_id, string("."));
+    static_cast<HashAggregatePhysicalOperator &>(*partial).set_partial(true);
+    oper->add_child(std::move(partial));
+  }
+  return oper;
+}
+
+using Result = tuple<int, int, float, string, float>;
+
+static map<int, Result> expected_result(const vector<vector<Value>> &rows)
+{
+  map<int, Result> result;
+  for (const vector<Value> &row : rows) {
+    const int id = row[0].get_int();
+    auto iter = result.find(id);
+    if (iter == result.end()) {
+      result.emplace(id, Result(id, 1, row[1].get_float(), row[2].get_string(), 0));
+      continue;
+    }
+    Result &group = iter->second;
+    get<1>(group)++;
+    get<2>(group) += row[1].get_float();
+    get<3>(group) = std::min(get<3>(group), row[2].get_string());
+  }
+  for (auto &item : result) {
+    get<4>(item.second) = get<2>(item.second) / get<1>(item.second);
+  }
+  return result;
+}
+
+static void check_result(PhysicalOperator &oper, const vector<vector<Value>> &rows)
+{
+  map<int, Result> expected = expected_result(rows);
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+
+  int count = 0;
+  RC  rc = RC::SUCCESS;
+  Value value;
+  while (RC::SUCCESS == (rc = oper.next())) {
+    Tuple *tuple = oper.current_tuple();
+    ASSERT_EQ(5, tuple->cell_num());
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(0, value));
+    auto iter = expected.find(value.get_int());
+    ASSERT_NE(iter, expected.end());
+    const Result &group = iter->second;
+
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(1, value));
+    ASSERT_EQ(get<1>(group), value.get_int());
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(2, value));
+    ASSERT_NEAR(get<2>(group), value.get_float(), 0.01);
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(3, value));
+    ASSERT_EQ(get<3>(group), value.get_string());
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(4, value));
+    ASSERT_NEAR(get<4>(group), value.get_float(), 0.01);
+
+    // 聚合函数的值也可以按照名字获取
+    ASSERT_EQ(RC::SUCCESS, tuple->find_cell(TupleCellSpec(nullptr, "count(*)"), value));
+    ASSERT_EQ(get<1>(group), value.get_int());
+    expected.erase(iter);
+    count++;
+  }
+  ASSERT_EQ(RC::RECORD_EOF, rc);
+  ASSERT_TRUE(expected.empty());
+  ASSERT_GT(count, 0);
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+}
+
+static vector<vector<Value>> make_rows(int row_num, int group_num, bool sorted)
+{
+  vector<vector<Value>> rows;
+  for (int i = 0; i < row_num; i++) {
+    const int id = sorted ? i * group_num / row_num : (i * 7919) % group_num;
+    const string name = "n" + to_string(i % 13);
+    rows.push_back({Value(id), Value(static_cast<float>(i % 10) / 2), Value(name.c_str())});
+  }
+  return rows;
+}
+
+TEST(test_aggregate, test_hash_table)
+{
+  AggregateHashTable hash_table;
+  hash_table.init(2);
+
+  const int group_num = 10000;
+  for (int i = 0; i < group_num; i++) {
+    const Value keys[2] = {Value(i), Value(to_string(i % 10).c_str())};
+    const uint32_t hash = JoinHashTable::hash(keys, 2);
+    ASSERT_EQ(-1, hash_table.find(keys, hash));
+    ASSERT_EQ(i, hash_table.insert(keys, hash));
+  }
+  ASSERT_EQ(group_num, hash_table.group_num());
+
+  for (int i = 0; i < group_num; i++) {
+    const Value keys[2] = {Value(i), Value(to_string(i % 10).c_str())};
+    ASSERT_EQ(i, hash_table.find(keys, JoinHashTable::hash(keys, 2)));
+    ASSERT_EQ(i, hash_table.keys(i)[0].get_int());
+
+    const Value other_keys[2] = {Value(i), Value("x")};
+    ASSERT_EQ(-1, hash_table.find(other_keys, JoinHashTable::hash(other_keys, 2)));
+  }
+}
+
+TEST(test_aggregate, test_aggregator)
+{
+  unique_ptr<Expression> count = aggregate_expr(AggregateExpr::Type::CNT, nullptr);
+  unique_ptr<Expression> max_id = aggregate_expr(AggregateExpr::Type::MAX, &id_meta);
+  unique_ptr<Expression> max_name = aggregate_expr(AggregateExpr::Type::MAX, &name_meta);
+  Aggregator aggregator;
+  aggregator.init({static_cast<AggregateExpr *>(count.get()),
+      static_cast<AggregateExpr *>(max_id.get()),
+      static_cast<AggregateExpr *>(max_name.get())});
+  aggregator.resize(3);
+
+  // 同一批数据中一个分组出现多次
+  const int   groups[] = {0, 1, 0, 0, 1};
+  const Value ids[] = {Value(-5), Value(3), Value(-7), Value(-1), Value(2)};
+  const Value names[] = {Value("b"), Value("a"), Value("c"), Value("a"), Value("z")};
+  aggregator.update(0, nullptr, groups, 5);
+  aggregator.update(1, ids, groups, 5);
+  aggregator.update(2, names, groups, 5);
+
+  Value value;
+  aggregator.get_result(0, 0, value);
+  ASSERT_EQ(3, value.get_int());
+  aggregator.get_result(1, 0, value);
+  ASSERT_EQ(-1, value.get_int());
+  aggregator.get_result(1, 1, value);
+  ASSERT_EQ(3, value.get_int());
+  aggregator.get_result(2, 1, value);
+  ASSERT_EQ(string("z"), value.get_string());
+
+  // 没有输入的分组
+  aggregator.get_result(0, 2, value);
+  ASSERT_EQ(0, value.get_int());
+  aggregator.get_result(1, 2, value);
+  ASSERT_EQ(UNDEFINED, value.attr_type());
+
+  // 复制以后缩小，再扩大的分组是初始状态
+  aggregator.copy_group(1, 0);
+  aggregator.resize(1);
+  aggregator.resize(2);
+  aggregator.get_result(1, 0, value);
+  ASSERT_EQ(3, value.get_int());
+  aggregator.get_result(0, 1, value);
+  ASSERT_EQ(0, value.get_int());
+}
+
+TEST(test_aggregate, test_hash_aggregate)
+{
+  const vector<vector<Value>> rows = make_rows(20000, 1000, false /*sorted*/);
+  unique_ptr<AggregatePhysicalOperator> oper = create_aggregate<HashAggregatePhysicalOperator>(rows, true, string("."));
+  check_result(*oper, rows);
+  ASSERT_EQ(0, static_cast<HashAggregatePhysicalOperator &>(*oper).spilled_rows());
+}
+
+TEST(test_aggregate, test_hash_aggregate_spill)
+{
+  // 内存只能放下一部分分组，其它分组的行溢出到外部排序中
+  const vector<vector<Value>> rows = make_rows(50000, 5000, false /*sorted*/);
+  unique_ptr<AggregatePhysicalOperator> oper = create_aggregate<HashAggregatePhysicalOperator>(rows, true, string("."));
+  auto &hash_oper = static_cast<HashAggregatePhysicalOperator &>(*oper);
+  hash_oper.set_memory_limit(64 * 1024);
+  check_result(*oper, rows);
+  ASSERT_GT(hash_oper.spilled_rows(), 0);
+}
+
+TEST(test_aggregate, test_merge_group)
+{
+  unique_ptr<Expression> count = aggregate_expr(AggregateExpr::Type::CNT, nullptr);
+  unique_ptr<Expression> min_id = aggregate_expr(AggregateExpr::Type::MIN, &id_meta);
+  unique_ptr<Expression> sum_score = aggregate_expr(AggregateExpr::Type::SUM, &score_meta);
+  unique_ptr<Expression> max_name = aggregate_expr(AggregateExpr::Type::MAX, &name_meta);
+  const vector<AggregateExpr *> aggregates = {static_cast<AggregateExpr *>(count.get()),
+      static_cast<AggregateExpr *>(min_id.get()),
+      static_cast<AggregateExpr *>(sum_score.get()),
+      static_cast<AggregateExpr *>(max_name.get())};
+
+  Aggregator left;
+  Aggregator right;
+  left.init(aggregates);
+  right.init(aggregates);
+  left.resize(2);
+  right.resize(2);
+
+  const int   groups[] = {0, 0};
+  const Value left_ids[] = {Value(3), Value(5)};
+  const Value right_ids[] = {Value(4), Value(-2)};
+  const Value scores[] = {Value(1.5f), Value(2.0f)};
+  const Value left_names[] = {Value("b"), Value("d")};
+  const Value right_names[] = {Value("c"), Value("a")};
+  left.update(0, nullptr, groups, 2);
+  left.update(1, left_ids, groups, 2);
+  left.update(2, scores, groups, 2);
+  left.update(3, left_names, groups, 2);
+  right.update(0, nullptr, groups, 2);
+  right.update(1, right_ids, groups, 2);
+  right.update(2, scores, groups, 2);
+  right.update(3, right_names, groups, 2);
+
+  // 合并有数据的分组，以及没有输入的分组
+  left.merge_group(right, 0, 0);
+  left.merge_group(right, 1, 0);
+  left.merge_group(right, 0, 1);
+
+  Value value;
+  left.get_result(0, 0, value);
+  ASSERT_EQ(4, value.get_int());
+  left.get_result(1, 0, value);
+  ASSERT_EQ(-2, value.get_int());
+  left.get_result(2, 0, value);
+  ASSERT_NEAR(7.0, value.get_float(), 0.001);
+  left.get_result(3, 0, value);
+  ASSERT_EQ(string("d"), value.get_string());
+
+  left.get_result(0, 1, value);
+  ASSERT_EQ(2, value.get_int());
+  left.get_result(1, 1, value);
+  ASSERT_EQ(-2, value.get_int());
+  left.get_result(3, 1, value);
+  ASSERT_EQ(string("c"), value.get_string());
+}
+
+TEST(test_aggregate, test_parallel_hash_aggregate)
+{
+  // 同一个分组的行分散在所有的工作线程中
+  const vector<vector<Value>> rows = make_rows(20000, 1000, false /*sorted*/);
+  unique_ptr<AggregatePhysicalOperator> oper = create_parallel_aggregate(rows, true, 4);
+  check_result(*oper, rows);
+  ASSERT_EQ(string("WORKERS 4 GROUP BY .id"), oper->param());
+
+  // 执行多次的结果相同
+  check_result(*oper, rows);
+}
+
+TEST(test_aggregate, test_stream_aggregate)
+{
+  // 一个分组跨越多批数据
+  const vector<vector<Value>> rows = make_rows(20000, 7, true /*sorted*/);
+  unique_ptr<AggregatePhysicalOperator> oper = create_aggregate<StreamAggregatePhysicalOperator>(rows, true);
+  check_result(*oper, rows);
+
+  // 每批数据中有很多分组
+  const vector<vector<Value>> many_groups = make_rows(20000, 15000, true /*sorted*/);
+  oper = create_aggregate<StreamAggregatePhysicalOperator>(many_groups, true);
+  check_result(*oper, many_groups);
+}
+
+TEST(test_aggregate, test_empty_input)
+{
+  // 没有分组时，没有输入也输出一行
+  vector<unique_ptr<AggregatePhysicalOperator>> opers;
+  opers.emplace_back(create_aggregate<HashAggregatePhysicalOperator>({}, false, string(".")));
+  opers.emplace_back(create_aggregate<StreamAggregatePhysicalOperator>({}, false));
+  opers.emplace_back(create_parallel_aggregate({}, false, 3));
+  for (unique_ptr<AggregatePhysicalOperator> &oper : opers) {
+    ASSERT_EQ(RC::SUCCESS, oper->open(nullptr));
+    ASSERT_EQ(RC::SUCCESS, oper->next());
+    Value value;
+    ASSERT_EQ(RC::SUCCESS, oper->current_tuple()->cell_at(0, value));
+    ASSERT_EQ(0, value.get_int());
+    ASSERT_EQ(RC::RECORD_EOF, oper->next());
+    ASSERT_EQ(RC::SUCCESS, oper->close());
+  }
+
+  // 有分组时没有输出
+  unique_ptr<AggregatePhysicalOperator> oper = create_aggregate<HashAggregatePhysicalOperator>({}, true, string("."));
+  ASSERT_EQ(RC::SUCCESS, oper->open(nullptr));
+  ASSERT_EQ(RC::RECORD_EOF, oper->next());
+  ASSERT_EQ(RC::SUCCESS, oper->close());
+}
+
+int main(int argc, char **argv)
+{
+  id_meta.init("id", INTS, 0, sizeof(int), true);
+  score_meta.init("score", FLOATS, 4, sizeof(float), true);
+  name_meta.init("name", CHARS, 8, 4, true);
+
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,107 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+
+#include "storage/index/bitmap_index.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "common/log/log.h"
+#include "gtest/gtest.h"
+
+using namespace common;
+
+#define VALUE_NUM 5
+#define ROW_NUM 20000
+
+BufferPoolManager bpm;
+
+TEST(test_bitmap_index, test_insert_delete_reopen)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_file = "test.bitmap";
+  ::remove(index_file);
+
+  // 记录中只有一个int字段，偏移是0
+  FieldMeta field_meta;
+  ASSERT_EQ(RC::SUCCESS, field_meta.init("status", INTS, 0, sizeof(int), true));
+  IndexMeta index_meta;
+  ASSERT_EQ(RC::SUCCESS, index_meta.init("status_index", field_meta, false, IndexType::BITMAP));
+
+  BitmapIndex *index = new BitmapIndex();
+  ASSERT_EQ(RC::SUCCESS, index->create(index_file, index_meta, field_meta));
+
+  for (int i = 0; i < ROW_NUM; i++) {
+    int value = i % VALUE_NUM;
+    RID rid(i / 500 + 1, i % 500);
+    ASSERT_EQ(RC::SUCCESS, index->insert_entry((const char *)&value, &rid, nullptr));
+  }
+  ASSERT_EQ(VALUE_NUM, index->value_count());
+
+  int value = 0;
+  RID rid(1, 0);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, index->insert_entry((const char *)&value, &rid, nullptr));
+
+  // 删除value=0的一半数据
+  for (int i = 0; i < ROW_NUM; i += VALUE_NUM * 2) {
+    RID rid(i / 500 + 1, i % 500);
+    ASSERT_EQ(RC::SUCCESS, index->delete_entry((const char *)&value, &rid));
+  }
+  ASSERT_EQ(RC::RECORD_NOT_EXIST, index->delete_entry((const char *)&value, &rid));
+
+  RoaringBitmap bitmap;
+  ASSERT_EQ(RC::SUCCESS, index->get_bitmap((const char *)&value, sizeof(value), bitmap));
+  ASSERT_EQ(ROW_NUM / VALUE_NUM / 2, (int)bitmap.cardinality());
+
+  // 关闭以后重新打开，数据还在
+  index->close();
+  delete index;
+  index = new BitmapIndex();
+  ASSERT_EQ(RC::SUCCESS, index->open(index_file, index_meta, field_meta));
+  ASSERT_EQ(VALUE_NUM, index->value_count());
+
+  for (int v = 0; v < VALUE_NUM; v++) {
+    ASSERT_EQ(RC::SUCCESS, index->get_bitmap((const char *)&v, sizeof(v), bitmap));
+    ASSERT_EQ(v == 0 ? ROW_NUM / VALUE_NUM / 2 : ROW_NUM / VALUE_NUM, (int)bitmap.cardinality());
+  }
+
+  // 扫描结果按照RID排序
+  value = 3;
+  IndexScanner *scanner = index->create_scanner(
+      (const char *)&value, sizeof(value), true, (const char *)&value, sizeof(value), true, false);
+  ASSERT_NE(nullptr, scanner);
+  RID last_rid(0, 0);
+  int count = 0;
+  while (RC::SUCCESS == scanner->next_entry(&rid)) {
+    ASSERT_LT(RID::compare(&last_rid, &rid), 0);
+    last_rid = rid;
+    count++;
+  }
+  ASSERT_EQ(ROW_NUM / VALUE_NUM, count);
+  scanner->destroy();
+
+  value = 100;
+  ASSERT_EQ(RC::SUCCESS, index->get_bitmap((const char *)&value, sizeof(value), bitmap));
+  ASSERT_TRUE(bitmap.empty());
+
+  index->close();
+  delete index;
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
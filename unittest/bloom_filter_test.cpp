@@ -0,0 +1,189 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <list>
+#include <string>
+#include <unistd.h>
+
+#include "common/lang/bloom_filter.h"
+#include "storage/index/bplus_tree.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "common/log/log.h"
+#include "gtest/gtest.h"
+
+using namespace common;
+
+#define KEY_NUM 10000
+
+BufferPoolManager bpm;
+
+TEST(test_bloom_filter, test_blocked_bloom_filter)
+{
+  BlockedBloomFilter filter;
+  filter.init(KEY_NUM);
+  ASSERT_GE(filter.capacity(), static_cast<size_t>(KEY_NUM));
+
+  for (int i = 0; i < KEY_NUM; i++) {
+    filter.add(BlockedBloomFilter::hash_bytes(&i, sizeof(i)));
+  }
+
+  // 不能有漏报
+  for (int i = 0; i < KEY_NUM; i++) {
+    ASSERT_TRUE(filter.may_contain(BlockedBloomFilter::hash_bytes(&i, sizeof(i))));
+  }
+
+  // 误判率应该在1%左右，这里放宽到3%
+  int false_positives = 0;
+  for (int i = KEY_NUM; i < KEY_NUM * 11; i++) {
+    if (filter.may_contain(BlockedBloomFilter::hash_bytes(&i, sizeof(i)))) {
+      false_positives++;
+    }
+  }
+  ASSERT_LT(false_positives, KEY_NUM * 10 * 3 / 100);
+
+  std::string buf;
+  filter.serialize(buf);
+  BlockedBloomFilter other;
+  ASSERT_FALSE(other.deserialize(buf.data(), buf.size() - 1));
+  ASSERT_TRUE(other.deserialize(buf.data(), buf.size()));
+  for (int i = 0; i < KEY_NUM * 11; i++) {
+    const uint64_t hash = BlockedBloomFilter::hash_bytes(&i, sizeof(i));
+    ASSERT_EQ(filter.may_contain(hash), other.may_contain(hash));
+  }
+}
+
+TEST(test_bloom_filter, test_bplus_tree_bloom_filter)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_file = "bloom_filter_test.btree";
+  const std::string bloom_file = std::string(index_file) + IndexBloomFilter::FILE_SUFFIX;
+  ::remove(index_file);
+  ::remove(bloom_file.c_str());
+
+  BplusTreeHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(index_file, INTS, sizeof(int)));
+  ASSERT_EQ(RC::SUCCESS, handler.enable_bloom_filter(index_file));
+  ASSERT_TRUE(handler.bloom_filter()->stale());
+
+  // 偶数都插入索引中
+  for (int i = 0; i < KEY_NUM; i++) {
+    const int key = i * 2;
+    RID rid(i / 100 + 1, i % 100);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry(reinterpret_cast<const char *>(&key), &rid));
+  }
+
+  auto count_entries = [&handler](int key) {
+    std::list<RID> rids;
+    EXPECT_EQ(RC::SUCCESS, handler.get_entry(reinterpret_cast<const char *>(&key), sizeof(key), rids));
+    return static_cast<int>(rids.size());
+  };
+
+  // 第一次查询时扫描索引构建过滤器
+  ASSERT_EQ(1, count_entries(0));
+  ASSERT_FALSE(handler.bloom_filter()->stale());
+
+  int filtered = 0;
+  for (int i = 0; i < KEY_NUM; i++) {
+    const int even = i * 2;
+    const int odd = i * 2 + 1;
+    ASSERT_TRUE(handler.bloom_filter()->may_contain(reinterpret_cast<const char *>(&even), sizeof(even)));
+    if (!handler.bloom_filter()->may_contain(reinterpret_cast<const char *>(&odd), sizeof(odd))) {
+      filtered++;
+    }
+    ASSERT_EQ(1, count_entries(even));
+    ASSERT_EQ(0, count_entries(odd));
+  }
+  ASSERT_GT(filtered, KEY_NUM * 9 / 10);
+
+  // 删除一多半的数据以后过滤器过期，重新构建后仍然能查到剩下的数据
+  for (int i = 0; i < KEY_NUM * 2 / 3; i++) {
+    const int key = i * 2;
+    RID rid(i / 100 + 1, i % 100);
+    ASSERT_EQ(RC::SUCCESS, handler.delete_entry(reinterpret_cast<const char *>(&key), &rid));
+  }
+  ASSERT_TRUE(handler.bloom_filter()->stale());
+  for (int i = 0; i < KEY_NUM; i++) {
+    ASSERT_EQ(i < KEY_NUM * 2 / 3 ? 0 : 1, count_entries(i * 2));
+  }
+  ASSERT_FALSE(handler.bloom_filter()->stale());
+
+  // 插入的数据超过容量时也会过期
+  const int capacity = static_cast<int>(handler.bloom_filter()->capacity());
+  for (int i = 0; i <= capacity; i++) {
+    const int key = -i - 1;
+    RID rid(i / 100 + 1, i % 100);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry(reinterpret_cast<const char *>(&key), &rid));
+  }
+  ASSERT_TRUE(handler.bloom_filter()->stale());
+  ASSERT_EQ(1, count_entries(-capacity - 1));
+  ASSERT_GT(static_cast<int>(handler.bloom_filter()->capacity()), capacity);
+
+  // 正常关闭时保存过滤器，打开时加载并删除文件
+  ASSERT_EQ(RC::SUCCESS, handler.close());
+  ASSERT_EQ(0, ::access(bloom_file.c_str(), F_OK));
+
+  BplusTreeHandler handler2;
+  ASSERT_EQ(RC::SUCCESS, handler2.open(index_file));
+  ASSERT_EQ(RC::SUCCESS, handler2.enable_bloom_filter(index_file));
+  ASSERT_FALSE(handler2.bloom_filter()->stale());
+  ASSERT_NE(0, ::access(bloom_file.c_str(), F_OK));
+  for (int i = KEY_NUM * 2 / 3; i < KEY_NUM; i++) {
+    const int key = i * 2;
+    ASSERT_TRUE(handler2.bloom_filter()->may_contain(reinterpret_cast<const char *>(&key), sizeof(key)));
+  }
+  ASSERT_EQ(RC::SUCCESS, handler2.close());
+
+  ::remove(index_file);
+  ::remove(bloom_file.c_str());
+}
+
+TEST(test_bloom_filter, test_chars_key)
+{
+  const char *index_file = "bloom_filter_chars_test.btree";
+  const std::string bloom_file = std::string(index_file) + IndexBloomFilter::FILE_SUFFIX;
+  ::remove(index_file);
+  ::remove(bloom_file.c_str());
+
+  const int attr_length = 8;
+  BplusTreeHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(index_file, CHARS, attr_length));
+  ASSERT_EQ(RC::SUCCESS, handler.enable_bloom_filter(index_file));
+
+  for (int i = 0; i < 1000; i++) {
+    char key[attr_length] = {0};
+    snprintf(key, sizeof(key), "k%d", i);
+    RID rid(i / 100 + 1, i % 100);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry(key, &rid));
+  }
+
+  // 查询的字符串长度与字段不同，'\0'之后的内容也不应该影响结果
+  for (int i = 0; i < 1000; i++) {
+    std::string key = "k" + std::to_string(i);
+    std::list<RID> rids;
+    ASSERT_EQ(RC::SUCCESS, handler.get_entry(key.c_str(), static_cast<int>(key.size()), rids));
+    ASSERT_EQ(1, static_cast<int>(rids.size()));
+  }
+
+  ASSERT_EQ(RC::SUCCESS, handler.close());
+  ::remove(index_file);
+  ::remove(bloom_file.c_str());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
@@ -718,6 +718,158 @@ TEST(test_bplus_tree, test_scanner)
   scanner.close();
 }
 
+TEST(test_bplus_tree, test_reverse_scanner)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_name = "reverse_scanner.btree";
+  ::remove(index_name);
+  handler = new BplusTreeHandler();
+  handler->create(index_name, INTS, sizeof(int), ORDER, ORDER);
+
+  RC rc = RC::SUCCESS;
+  RID rid;
+  // 乱序插入数据[1 - 199] 所有奇数，让节点在不同的位置分裂
+  for (int i = 0; i < 100; i++) {
+    int key = (i * 37 % 100) * 2 + 1;
+    rid.page_num = 0;
+    rid.slot_num = key;
+    rc = handler->insert_entry((const char *)&key, &rid);
+    ASSERT_EQ(RC::SUCCESS, rc);
+  }
+  ASSERT_TRUE(handler->validate_tree());
+
+  // 反向扫描[begin, end]，返回的数据应该是从end开始递减的奇数
+  auto check_reverse_scan = [](const int *begin, bool begin_inclusive, const int *end, bool end_inclusive,
+                               int expect_first, int expect_count, int step) {
+    BplusTreeScanner scanner(*handler);
+    RC rc = scanner.open((const char *)begin, 4, begin_inclusive, (const char *)end, 4, end_inclusive, true/*reverse*/);
+    ASSERT_EQ(RC::SUCCESS, rc);
+    RID rid;
+    int count = 0;
+    while ((rc = scanner.next_entry(rid)) == RC::SUCCESS) {
+      ASSERT_EQ(expect_first - count * step, rid.slot_num);
+      count++;
+    }
+    ASSERT_EQ(RC::RECORD_EOF, rc);
+    ASSERT_EQ(expect_count, count);
+    scanner.close();
+  };
+
+  int begin = 11;
+  int end = 21;
+  check_reverse_scan(&begin, true, &end, true, 21, 6, 2);
+  check_reverse_scan(&begin, false, &end, false, 19, 4, 2);
+
+  begin = -100;
+  end = 1;
+  check_reverse_scan(&begin, false, &end, false, 0, 0, 2);
+  check_reverse_scan(&begin, false, &end, true, 1, 1, 2);
+
+  begin = 190;
+  end = 300;
+  check_reverse_scan(&begin, true, &end, true, 199, 5, 2);
+  check_reverse_scan(&begin, true, nullptr, true, 199, 5, 2);
+
+  end = 10;
+  check_reverse_scan(nullptr, true, &end, true, 9, 5, 2);
+  check_reverse_scan(nullptr, true, nullptr, true, 199, 100, 2);
+
+  // 删除一部分数据，触发节点的合并和重新分配后，左兄弟指针仍然正确
+  for (int i = 0; i < 100; i += 2) {
+    int key = (i * 37 % 100) * 2 + 1;
+    if (key % 4 != 1) {
+      continue;
+    }
+    rid.page_num = 0;
+    rid.slot_num = key;
+    rc = handler->delete_entry((const char *)&key, &rid);
+    ASSERT_EQ(RC::SUCCESS, rc);
+  }
+  for (int key = 1; key < 200; key += 4) {
+    rid.page_num = 0;
+    rid.slot_num = key;
+    rc = handler->delete_entry((const char *)&key, &rid);
+    ASSERT_TRUE(rc == RC::SUCCESS || rc == RC::RECORD_NOT_EXIST);
+  }
+  ASSERT_TRUE(handler->validate_tree());
+
+  // 剩下的数据是 3, 7, 11, ..., 199
+  check_reverse_scan(nullptr, true, nullptr, true, 199, 50, 4);
+  begin = 100;
+  end = 150;
+  check_reverse_scan(&begin, true, &end, true, 147, 12, 4);
+
+  handler->close();
+  delete handler;
+  handler = nullptr;
+}
+
+TEST(test_bplus_tree, test_unique_insert)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_name = "unique_insert.btree";
+  ::remove(index_name);
+  handler = new BplusTreeHandler();
+  handler->create(index_name, INTS, sizeof(int), ORDER, ORDER);
+
+  RC rc = RC::SUCCESS;
+  RID rid;
+  for (int i = 0; i < 50; i++) {
+    int key = i * 37 % 50;
+    rid.page_num = 0;
+    rid.slot_num = key;
+    rc = handler->insert_unique_entry((const char *)&key, &rid, nullptr);
+    ASSERT_EQ(RC::SUCCESS, rc);
+  }
+
+  // 没有指定检查函数时，相同的键值都是冲突
+  int key = 10;
+  rid.page_num = 1;
+  rid.slot_num = 0;
+  rc = handler->insert_unique_entry((const char *)&key, &rid, nullptr);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, rc);
+
+  // 已经存在的数据都不冲突，比如都已经删除了，相同的键值会跨越多个叶子节点
+  auto no_conflict = [](const RID &) { return false; };
+  for (int i = 0; i < 20; i++) {
+    rid.page_num = 1;
+    rid.slot_num = i;
+    rc = handler->insert_unique_entry((const char *)&key, &rid, no_conflict);
+    ASSERT_EQ(RC::SUCCESS, rc);
+  }
+  ASSERT_TRUE(handler->validate_tree());
+
+  // 检查时会经过所有相同键值的索引项，最后一个冲突也能发现
+  int checked_count = 0;
+  auto last_conflict = [&checked_count](const RID &exist_rid) {
+    checked_count++;
+    return exist_rid.page_num == 1 && exist_rid.slot_num == 19;
+  };
+  rid.page_num = 2;
+  rid.slot_num = 0;
+  rc = handler->insert_unique_entry((const char *)&key, &rid, last_conflict);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, rc);
+  ASSERT_EQ(21, checked_count);
+
+  // 其它键值不受影响
+  key = 50;
+  rc = handler->insert_unique_entry((const char *)&key, &rid, nullptr);
+  ASSERT_EQ(RC::SUCCESS, rc);
+
+  std::list<RID> rids;
+  key = 10;
+  rc = handler->get_entry((const char *)&key, sizeof(key), rids);
+  ASSERT_EQ(RC::SUCCESS, rc);
+  ASSERT_EQ(21, (int)rids.size());
+  ASSERT_TRUE(handler->validate_tree());
+
+  handler->close();
+  delete handler;
+  handler = nullptr;
+}
+
 TEST(test_bplus_tree, test_bplus_tree_insert)
 {
   LoggerFactory::init_default("test.log");
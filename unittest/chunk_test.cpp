@@ -0,0 +1,143 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string>
+#include <vector>
+
+#include "sql/expr/chunk.h"
+#include "sql/expr/expression.h"
+#include "storage/field/field.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+static const int ROWS = 100;
+
+// 没有初始化的表，名字是空的
+static Table table;
+
+static void fill_chunk(Chunk &chunk)
+{
+  chunk.reset();
+  chunk.add_column(table.name(), "id", INTS, sizeof(int));
+  chunk.add_column(table.name(), "score", FLOATS, sizeof(float));
+  chunk.add_column(table.name(), "name", CHARS, 4);
+  Column &id = chunk.column(0);
+  Column &score = chunk.column(1);
+  Column &name = chunk.column(2);
+  for (int i = 0; i < ROWS; i++) {
+    const float f = i / 10.0f;
+    const string s = "n" + to_string(i % 10);
+    id.append(reinterpret_cast<const char *>(&i), sizeof(i));
+    score.append(reinterpret_cast<const char *>(&f), sizeof(f));
+    name.append(s.c_str(), static_cast<int>(s.size()));
+  }
+  chunk.set_rows(ROWS);
+}
+
+/**
+ * @brief 逐行计算表达式的结果，与批量计算的结果比较
+ */
+static vector<int> filter_by_row(const Chunk &chunk, const Expression &expr)
+{
+  vector<int> result;
+  ChunkRowTuple tuple(chunk);
+  Value value;
+  for (int row : chunk.selection()) {
+    tuple.set_row(row);
+    EXPECT_EQ(RC::SUCCESS, expr.get_value(tuple, value));
+    if (value.get_boolean()) {
+      result.push_back(row);
+    }
+  }
+  return result;
+}
+
+static unique_ptr<Expression> field_expr(const FieldMeta &field_meta)
+{
+  return make_unique<FieldExpr>(Field(&table, &field_meta));
+}
+
+TEST(test_chunk, test_column)
+{
+  Chunk chunk;
+  fill_chunk(chunk);
+  ASSERT_EQ(3, chunk.column_num());
+  ASSERT_EQ(ROWS, chunk.size());
+  ASSERT_EQ(1, chunk.find_column(table.name(), "score"));
+  ASSERT_EQ(-1, chunk.find_column("t", "score"));
+
+  Value value;
+  chunk.column(2).get_value(13, value);
+  ASSERT_EQ(string("n3"), value.get_string());
+
+  // 追加更长的字符串时整列变长，已有的数据不变
+  Column column(nullptr, nullptr, CHARS, 2, ROWS);
+  column.append_value(Value("ab"));
+  column.append_value(Value("abcdef"));
+  ASSERT_EQ(6, column.attr_len());
+  column.get_value(0, value);
+  ASSERT_EQ(string("ab"), value.get_string());
+  column.get_value(1, value);
+  ASSERT_EQ(string("abcdef"), value.get_string());
+}
+
+TEST(test_chunk, test_filter)
+{
+  FieldMeta id_meta;
+  FieldMeta score_meta;
+  FieldMeta name_meta;
+  ASSERT_EQ(RC::SUCCESS, id_meta.init("id", INTS, 0, sizeof(int), true));
+  ASSERT_EQ(RC::SUCCESS, score_meta.init("score", FLOATS, 4, sizeof(float), true));
+  ASSERT_EQ(RC::SUCCESS, name_meta.init("name", CHARS, 8, 4, true));
+
+  Chunk chunk;
+  fill_chunk(chunk);
+  // 过滤一部分行以后再计算
+  vector<int> &chunk_selection = chunk.selection();
+  chunk_selection.erase(chunk_selection.begin(), chunk_selection.begin() + 3);
+
+  const CompOp ops[] = {EQUAL_TO, LESS_EQUAL, NOT_EQUAL, LESS_THAN, GREAT_EQUAL, GREAT_THAN};
+  for (CompOp op : ops) {
+    vector<unique_ptr<Expression>> exprs;
+    exprs.emplace_back(make_unique<ComparisonExpr>(op, field_expr(id_meta), make_unique<ValueExpr>(Value(50))));
+    exprs.emplace_back(make_unique<ComparisonExpr>(op, make_unique<ValueExpr>(Value(2.5f)), field_expr(score_meta)));
+    exprs.emplace_back(make_unique<ComparisonExpr>(op, field_expr(name_meta), make_unique<ValueExpr>(Value("n5"))));
+    // 类型不同，逐行计算
+    exprs.emplace_back(make_unique<ComparisonExpr>(op, field_expr(score_meta), make_unique<ValueExpr>(Value(3))));
+
+    for (unique_ptr<Expression> &expr : exprs) {
+      vector<int> selection = chunk.selection();
+      ASSERT_EQ(RC::SUCCESS, expr->filter_chunk(chunk, selection));
+      ASSERT_EQ(filter_by_row(chunk, *expr), selection);
+    }
+
+    vector<unique_ptr<Expression>> and_children;
+    and_children.swap(exprs);
+    vector<unique_ptr<Expression>> or_children;
+    or_children.emplace_back(make_unique<ComparisonExpr>(op, field_expr(id_meta), make_unique<ValueExpr>(Value(7))));
+    or_children.emplace_back(make_unique<ConjunctionExpr>(ConjunctionExpr::Type::AND, and_children));
+    ConjunctionExpr or_expr(ConjunctionExpr::Type::OR, or_children);
+
+    vector<int> selection = chunk.selection();
+    ASSERT_EQ(RC::SUCCESS, or_expr.filter_chunk(chunk, selection));
+    ASSERT_EQ(filter_by_row(chunk, or_expr), selection);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,190 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <vector>
+
+#include "storage/index/extendible_hash.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "common/log/log.h"
+#include "gtest/gtest.h"
+
+using namespace common;
+
+// 每个桶只放4个数据项，很快就会触发桶分裂和目录翻倍，KEY_NUM个数据使目录占用多个目录页
+#define BUCKET_CAPACITY 4
+#define KEY_NUM 6000
+
+BufferPoolManager bpm;
+
+static RID make_rid(int i)
+{
+  RID rid;
+  rid.page_num = i / 100;
+  rid.slot_num = i % 100;
+  return rid;
+}
+
+TEST(test_extendible_hash, test_insert_get_delete)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_name = "test.hash";
+  ::remove(index_name);
+  ExtendibleHashHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(index_name, INTS, sizeof(int), BUCKET_CAPACITY));
+
+  for (int i = 0; i < KEY_NUM; i++) {
+    RID rid = make_rid(i);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry((const char *)&i, &rid));
+  }
+  ASSERT_TRUE(handler.validate());
+  ASSERT_GT(handler.global_depth(), 0);
+
+  // 相同的数据项不能重复插入
+  int key = 7;
+  RID rid = make_rid(key);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, handler.insert_entry((const char *)&key, &rid));
+
+  // 同一个键值的多个数据分裂不开，使用溢出页
+  for (int i = 0; i < 20; i++) {
+    rid = make_rid(KEY_NUM + i);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry((const char *)&key, &rid));
+  }
+  ASSERT_TRUE(handler.validate());
+
+  std::vector<RID> rids;
+  ASSERT_EQ(RC::SUCCESS, handler.get_entry((const char *)&key, rids));
+  ASSERT_EQ(21, (int)rids.size());
+
+  for (int i = 0; i < KEY_NUM; i++) {
+    rids.clear();
+    ASSERT_EQ(RC::SUCCESS, handler.get_entry((const char *)&i, rids));
+    ASSERT_EQ(i == key ? 21 : 1, (int)rids.size());
+  }
+
+  // 删除一半的数据
+  for (int i = 0; i < KEY_NUM; i += 2) {
+    rid = make_rid(i);
+    ASSERT_EQ(RC::SUCCESS, handler.delete_entry((const char *)&i, &rid));
+  }
+  key = 0;
+  rid = make_rid(0);
+  ASSERT_EQ(RC::RECORD_INVALID_KEY, handler.delete_entry((const char *)&key, &rid));
+  ASSERT_TRUE(handler.validate());
+
+  // 关闭以后重新打开，数据还在
+  ASSERT_EQ(RC::SUCCESS, handler.close());
+  ExtendibleHashHandler handler2;
+  ASSERT_EQ(RC::SUCCESS, handler2.open(index_name));
+  ASSERT_TRUE(handler2.validate());
+  for (int i = 0; i < KEY_NUM; i++) {
+    rids.clear();
+    ASSERT_EQ(RC::SUCCESS, handler2.get_entry((const char *)&i, rids));
+    int expect = (i % 2 == 0) ? 0 : 1;
+    if (i == 7) {
+      expect = 21;
+    }
+    ASSERT_EQ(expect, (int)rids.size());
+  }
+
+  ExtendibleHashScanner scanner(handler2);
+  key = 7;
+  ASSERT_EQ(RC::SUCCESS, scanner.open((const char *)&key, sizeof(key)));
+  int count = 0;
+  while (RC::SUCCESS == scanner.next_entry(rid)) {
+    ASSERT_EQ(0, memcmp(&key, scanner.key(), sizeof(key)));
+    count++;
+  }
+  ASSERT_EQ(21, count);
+  handler2.close();
+}
+
+TEST(test_extendible_hash, test_chars_key)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_name = "chars.hash";
+  ::remove(index_name);
+  ExtendibleHashHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(index_name, CHARS, 8, BUCKET_CAPACITY));
+
+  char key[8];
+  for (int i = 0; i < 100; i++) {
+    memset(key, 0, sizeof(key));
+    snprintf(key, sizeof(key), "k%d", i);
+    RID rid = make_rid(i);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_entry(key, &rid));
+  }
+  ASSERT_TRUE(handler.validate());
+
+  // 查询的字符串长度与字段长度不同
+  ExtendibleHashScanner scanner(handler);
+  ASSERT_EQ(RC::SUCCESS, scanner.open("k42", 3));
+  RID rid;
+  ASSERT_EQ(RC::SUCCESS, scanner.next_entry(rid));
+  ASSERT_EQ(make_rid(42), rid);
+  ASSERT_EQ(RC::RECORD_EOF, scanner.next_entry(rid));
+
+  // 比字段长的字符串不会等于任何数据
+  ExtendibleHashScanner long_scanner(handler);
+  ASSERT_EQ(RC::SUCCESS, long_scanner.open("k42xxxxxxxxx", 12));
+  ASSERT_EQ(RC::RECORD_EOF, long_scanner.next_entry(rid));
+  handler.close();
+}
+
+TEST(test_extendible_hash, test_unique_insert)
+{
+  LoggerFactory::init_default("test.log");
+
+  const char *index_name = "unique.hash";
+  ::remove(index_name);
+  ExtendibleHashHandler handler;
+  ASSERT_EQ(RC::SUCCESS, handler.create(index_name, INTS, sizeof(int), BUCKET_CAPACITY));
+
+  for (int i = 0; i < 100; i++) {
+    RID rid = make_rid(i);
+    ASSERT_EQ(RC::SUCCESS, handler.insert_unique_entry((const char *)&i, &rid, nullptr));
+  }
+
+  int key = 10;
+  RID rid = make_rid(1000);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, handler.insert_unique_entry((const char *)&key, &rid, nullptr));
+
+  // 已经存在的数据都不冲突时可以插入
+  auto no_conflict = [](const RID &) { return false; };
+  ASSERT_EQ(RC::SUCCESS, handler.insert_unique_entry((const char *)&key, &rid, no_conflict));
+
+  int checked_count = 0;
+  auto conflict = [&checked_count](const RID &) {
+    checked_count++;
+    return true;
+  };
+  rid = make_rid(1001);
+  ASSERT_EQ(RC::RECORD_DUPLICATE_KEY, handler.insert_unique_entry((const char *)&key, &rid, conflict));
+  ASSERT_EQ(1, checked_count);
+
+  std::vector<RID> rids;
+  ASSERT_EQ(RC::SUCCESS, handler.get_entry((const char *)&key, rids));
+  ASSERT_EQ(2, (int)rids.size());
+  ASSERT_TRUE(handler.validate());
+  handler.close();
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "sql/operator/external_sorter.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+BufferPoolManager bpm;
+
+static int key_compare(const string &key1, const string &key2)
+{
+  return SortKey::compare(key1.data(), key1.size(), key2.data(), key2.size());
+}
+
+static string make_key(const Value &value, bool asc = true)
+{
+  string key;
+  SortKey::append(key, value, asc);
+  return key;
+}
+
+TEST(test_external_sorter, test_sort_key)
+{
+  ASSERT_LT(key_compare(make_key(Value(-5)), make_key(Value(-1))), 0);
+  ASSERT_LT(key_compare(make_key(Value(-1)), make_key(Value(0))), 0);
+  ASSERT_LT(key_compare(make_key(Value(3)), make_key(Value(256))), 0);
+  ASSERT_EQ(key_compare(make_key(Value(7)), make_key(Value(7))), 0);
+
+  ASSERT_LT(key_compare(make_key(Value(-2.5f)), make_key(Value(-1.0f))), 0);
+  ASSERT_LT(key_compare(make_key(Value(-1.0f)), make_key(Value(0.5f))), 0);
+  ASSERT_LT(key_compare(make_key(Value(0.5f)), make_key(Value(100.0f))), 0);
+
+  ASSERT_LT(key_compare(make_key(Value("ab")), make_key(Value("abc"))), 0);
+  ASSERT_LT(key_compare(make_key(Value("abc")), make_key(Value("b"))), 0);
+
+  ASSERT_GT(key_compare(make_key(Value(1), false), make_key(Value(2), false)), 0);
+  ASSERT_GT(key_compare(make_key(Value("ab"), false), make_key(Value("abc"), false)), 0);
+
+  // 多个值的key，前一个值相同时比较后一个值
+  string key1 = make_key(Value("a"));
+  SortKey::append(key1, Value(9));
+  string key2 = make_key(Value("ab"));
+  SortKey::append(key2, Value(1));
+  ASSERT_LT(key_compare(key1, key2), 0);
+}
+
+static void check_sort(int row_num, size_t memory_limit, bool expect_spill)
+{
+  ExternalSorter sorter;
+  sorter.init(".", memory_limit);
+
+  srand(row_num);
+  for (int i = 0; i < row_num; i++) {
+    const int k = rand() % (row_num / 4 + 1);
+    Value cells[2] = {Value(k), Value(i)};
+    ASSERT_EQ(RC::SUCCESS, sorter.add(make_key(cells[0]), cells, 2));
+  }
+  ASSERT_EQ(RC::SUCCESS, sorter.sort());
+  ASSERT_EQ(expect_spill, sorter.run_num() > 0);
+
+  string key;
+  vector<Value> cells;
+  int count = 0;
+  int last_k = -1;
+  int last_i = -1;
+  RC rc = RC::SUCCESS;
+  while (RC::SUCCESS == (rc = sorter.next(key, cells))) {
+    ASSERT_EQ(2, static_cast<int>(cells.size()));
+    ASSERT_EQ(make_key(cells[0]), key);
+    const int k = cells[0].get_int();
+    const int i = cells[1].get_int();
+    ASSERT_LE(last_k, k);
+    if (last_k == k) {
+      // key相同的行保持添加的顺序
+      ASSERT_LT(last_i, i);
+    }
+    last_k = k;
+    last_i = i;
+    count++;
+  }
+  ASSERT_EQ(RC::RECORD_EOF, rc);
+  ASSERT_EQ(row_num, count);
+
+  sorter.reset();
+}
+
+TEST(test_external_sorter, test_in_memory)
+{
+  check_sort(1000, ExternalSorter::DEFAULT_MEMORY_LIMIT, false);
+}
+
+TEST(test_external_sorter, test_spill)
+{
+  // 内存限制很小，数据会写成很多个段再归并
+  check_sort(50000, 64 * 1024, true);
+}
+
+TEST(test_external_sorter, test_empty)
+{
+  ExternalSorter sorter;
+  sorter.init(".");
+  ASSERT_EQ(RC::SUCCESS, sorter.sort());
+
+  string key;
+  vector<Value> cells;
+  ASSERT_EQ(RC::RECORD_EOF, sorter.next(key, cells));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
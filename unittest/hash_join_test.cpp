@@ -0,0 +1,100 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string>
+#include <vector>
+
+#include "sql/operator/hash_join_physical_operator.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+TEST(test_join_hash_table, test_int_key)
+{
+  const int rows = 10000;
+  const int distinct = 1000;
+
+  JoinHashTable hash_table;
+  hash_table.init(1, 2);
+  for (int i = 0; i < rows; i++) {
+    Value key(i % distinct);
+    Value cells[2] = {Value(i % distinct), Value(i)};
+    hash_table.append(&key, cells);
+  }
+  hash_table.build();
+  ASSERT_EQ(rows, hash_table.row_num());
+
+  for (int k = 0; k < distinct; k++) {
+    Value key(k);
+    // key相同的行按照追加的顺序返回
+    int expect = k;
+    for (int row = hash_table.find(&key); row >= 0; row = hash_table.next(row)) {
+      const Value *cells = hash_table.cells(row);
+      ASSERT_EQ(k, cells[0].get_int());
+      ASSERT_EQ(expect, cells[1].get_int());
+      expect += distinct;
+    }
+    ASSERT_EQ(rows + k, expect);
+  }
+
+  Value missing(distinct);
+  ASSERT_EQ(-1, hash_table.find(&missing));
+}
+
+TEST(test_join_hash_table, test_multi_key)
+{
+  JoinHashTable hash_table;
+  hash_table.init(2, 1);
+  for (int i = 0; i < 100; i++) {
+    Value keys[2] = {Value(i % 10), Value(("s" + to_string(i % 7)).c_str())};
+    Value cell(i);
+    hash_table.append(keys, &cell);
+  }
+  hash_table.build();
+
+  for (int a = 0; a < 10; a++) {
+    for (int b = 0; b < 7; b++) {
+      Value keys[2] = {Value(a), Value(("s" + to_string(b)).c_str())};
+      vector<int> result;
+      for (int row = hash_table.find(keys); row >= 0; row = hash_table.next(row)) {
+        result.push_back(hash_table.cells(row)->get_int());
+      }
+
+      vector<int> expect;
+      for (int i = 0; i < 100; i++) {
+        if (i % 10 == a && i % 7 == b) {
+          expect.push_back(i);
+        }
+      }
+      ASSERT_EQ(expect, result);
+    }
+  }
+}
+
+TEST(test_join_hash_table, test_empty)
+{
+  JoinHashTable hash_table;
+  hash_table.init(1, 1);
+  Value key(1);
+  ASSERT_EQ(-1, hash_table.find(&key));
+  hash_table.build();
+  ASSERT_EQ(0, hash_table.row_num());
+  ASSERT_EQ(-1, hash_table.find(&key));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
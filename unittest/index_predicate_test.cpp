@@ -0,0 +1,105 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+
+#include "storage/index/index_meta.h"
+#include "storage/field/field_meta.h"
+#include "gtest/gtest.h"
+
+static IndexPredicate make_predicate(const FieldMeta &field, CompOp comp, int value)
+{
+  IndexPredicate predicate;
+  EXPECT_EQ(RC::SUCCESS, predicate.init(field, comp, Value(value)));
+  return predicate;
+}
+
+TEST(test_index_predicate, test_implied_by)
+{
+  FieldMeta id_field("id", INTS, 0, 4, true);
+  FieldMeta v_field("v", INTS, 4, 4, true);
+
+  // id > 10
+  IndexPredicate greater = make_predicate(id_field, GREAT_THAN, 10);
+  ASSERT_TRUE(greater.implied_by(make_predicate(id_field, EQUAL_TO, 11)));
+  ASSERT_FALSE(greater.implied_by(make_predicate(id_field, EQUAL_TO, 10)));
+  ASSERT_TRUE(greater.implied_by(make_predicate(id_field, GREAT_THAN, 10)));
+  ASSERT_TRUE(greater.implied_by(make_predicate(id_field, GREAT_EQUAL, 11)));
+  ASSERT_FALSE(greater.implied_by(make_predicate(id_field, GREAT_EQUAL, 10)));
+  ASSERT_FALSE(greater.implied_by(make_predicate(id_field, LESS_THAN, 100)));
+  ASSERT_FALSE(greater.implied_by(make_predicate(v_field, EQUAL_TO, 11)));
+
+  // id <= 10
+  IndexPredicate less_equal = make_predicate(id_field, LESS_EQUAL, 10);
+  ASSERT_TRUE(less_equal.implied_by(make_predicate(id_field, LESS_THAN, 10)));
+  ASSERT_TRUE(less_equal.implied_by(make_predicate(id_field, LESS_EQUAL, 10)));
+  ASSERT_FALSE(less_equal.implied_by(make_predicate(id_field, LESS_EQUAL, 11)));
+
+  // id <> 10
+  IndexPredicate not_equal = make_predicate(id_field, NOT_EQUAL, 10);
+  ASSERT_TRUE(not_equal.implied_by(make_predicate(id_field, NOT_EQUAL, 10)));
+  ASSERT_TRUE(not_equal.implied_by(make_predicate(id_field, GREAT_THAN, 10)));
+  ASSERT_TRUE(not_equal.implied_by(make_predicate(id_field, LESS_THAN, 10)));
+  ASSERT_FALSE(not_equal.implied_by(make_predicate(id_field, LESS_EQUAL, 10)));
+  ASSERT_FALSE(not_equal.implied_by(make_predicate(id_field, NOT_EQUAL, 9)));
+
+  // id = 10 只能由相同的等值条件推出
+  IndexPredicate equal = make_predicate(id_field, EQUAL_TO, 10);
+  ASSERT_TRUE(equal.implied_by(make_predicate(id_field, EQUAL_TO, 10)));
+  ASSERT_FALSE(equal.implied_by(make_predicate(id_field, GREAT_EQUAL, 10)));
+}
+
+TEST(test_index_predicate, test_index_meta)
+{
+  FieldMeta id_field("id", INTS, 0, 4, true);
+  FieldMeta v_field("v", INTS, 4, 4, true);
+
+  IndexMeta index_meta;
+  ASSERT_EQ(RC::SUCCESS, index_meta.init("i_id", id_field));
+  ASSERT_FALSE(index_meta.partial());
+
+  // 字段类型与常量不同
+  IndexPredicate predicate;
+  ASSERT_NE(RC::SUCCESS, predicate.init(v_field, EQUAL_TO, Value("a")));
+
+  // v >= 0 and v < 100
+  std::vector<IndexPredicate> predicates;
+  predicates.push_back(make_predicate(v_field, GREAT_EQUAL, 0));
+  predicates.push_back(make_predicate(v_field, LESS_THAN, 100));
+  index_meta.set_predicates(predicates);
+  ASSERT_TRUE(index_meta.partial());
+
+  int record[2] = {1, 50};
+  ASSERT_TRUE(index_meta.covers(reinterpret_cast<const char *>(record)));
+  record[1] = 100;
+  ASSERT_FALSE(index_meta.covers(reinterpret_cast<const char *>(record)));
+  record[1] = -1;
+  ASSERT_FALSE(index_meta.covers(reinterpret_cast<const char *>(record)));
+
+  std::vector<IndexPredicate> conditions;
+  conditions.push_back(make_predicate(v_field, GREAT_THAN, 10));
+  ASSERT_FALSE(index_meta.implied_by(conditions));
+  conditions.push_back(make_predicate(v_field, LESS_EQUAL, 20));
+  ASSERT_TRUE(index_meta.implied_by(conditions));
+
+  conditions.clear();
+  conditions.push_back(make_predicate(v_field, EQUAL_TO, 99));
+  ASSERT_TRUE(index_meta.implied_by(conditions));
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,211 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include "sql/optimizer/join_order_optimizer.h"
+#include "sql/optimizer/cost_model.h"
+#include "gtest/gtest.h"
+
+using Algorithm = JoinOrderOptimizer::Algorithm;
+using Plan = JoinOrderOptimizer::Plan;
+
+static int add_relation(JoinOrderOptimizer &optimizer, double rows, double filter_selectivity = 1)
+{
+  JoinOrderOptimizer::Relation relation;
+  relation.table_rows = rows;
+  relation.pages = std::max(rows / 100, 1.0);
+  relation.rows = rows * filter_selectivity;
+  relation.cost = CostModel::table_scan_cost(relation.table_rows, relation.pages);
+  return optimizer.add_relation(relation);
+}
+
+static JoinOrderOptimizer::Edge make_edge(int left, int right, double selectivity)
+{
+  JoinOrderOptimizer::Edge edge;
+  edge.relations = ((uint64_t)1 << left) | ((uint64_t)1 << right);
+  edge.selectivity = selectivity;
+  edge.equi = true;
+  edge.left = left;
+  edge.right = right;
+  return edge;
+}
+
+/**
+ * @brief 检查连接树中没有笛卡尔积，并且每个表正好出现一次
+ */
+static void check_tree(const JoinOrderOptimizer &optimizer, int plan_index, uint64_t &relations)
+{
+  const Plan &plan = optimizer.plan(plan_index);
+  if (plan.relation >= 0) {
+    ASSERT_EQ(0, relations & plan.relations);
+    relations |= plan.relations;
+    return;
+  }
+
+  const Plan &left = optimizer.plan(plan.left);
+  const Plan &right = optimizer.plan(plan.right);
+  ASSERT_EQ(0, left.relations & right.relations);
+  ASSERT_EQ(plan.relations, left.relations | right.relations);
+
+  bool connected = false;
+  for (const JoinOrderOptimizer::Edge &edge : optimizer.edges()) {
+    if ((edge.relations & ~plan.relations) == 0 && (edge.relations & left.relations) != 0 &&
+        (edge.relations & right.relations) != 0) {
+      connected = true;
+    }
+  }
+  ASSERT_TRUE(connected);
+  ASSERT_NE(Algorithm::NESTED_LOOP, plan.algorithm);
+  ASSERT_GE(plan.cost, left.cost);
+  ASSERT_GE(plan.cost, right.cost);
+
+  check_tree(optimizer, plan.left, relations);
+  check_tree(optimizer, plan.right, relations);
+}
+
+TEST(test_join_order_optimizer, test_single)
+{
+  JoinOrderOptimizer optimizer;
+  add_relation(optimizer, 100);
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+  ASSERT_EQ(0, optimizer.plan(optimizer.best()).relation);
+}
+
+TEST(test_join_order_optimizer, test_avoid_cross_product)
+{
+  // a - b - c，a 和 c 都比较小，但是它们之间没有连接条件
+  JoinOrderOptimizer optimizer;
+  const int a = add_relation(optimizer, 100);
+  const int b = add_relation(optimizer, 100000);
+  const int c = add_relation(optimizer, 100);
+  optimizer.add_edge(make_edge(a, b, 1.0 / 100000));
+  optimizer.add_edge(make_edge(b, c, 1.0 / 100000));
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  uint64_t relations = 0;
+  check_tree(optimizer, optimizer.best(), relations);
+  ASSERT_EQ(7, relations);
+  ASSERT_NEAR(1.0, optimizer.plan(optimizer.best()).rows, 0.01);
+}
+
+TEST(test_join_order_optimizer, test_selective_join_first)
+{
+  // 事实表与两个维度表连接，d1 经过过滤以后只剩很少的行，应该先与事实表连接
+  JoinOrderOptimizer optimizer;
+  const int d2 = add_relation(optimizer, 10000);
+  const int fact = add_relation(optimizer, 100000);
+  const int d1 = add_relation(optimizer, 10000, 0.001);
+  optimizer.add_edge(make_edge(fact, d2, 1.0 / 10000));
+  optimizer.add_edge(make_edge(fact, d1, 1.0 / 10000));
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  const Plan &root = optimizer.plan(optimizer.best());
+  const uint64_t first = ((uint64_t)1 << fact) | ((uint64_t)1 << d1);
+  ASSERT_TRUE(optimizer.plan(root.left).relations == first || optimizer.plan(root.right).relations == first);
+  ASSERT_NEAR(100, root.rows, 0.01);
+}
+
+TEST(test_join_order_optimizer, test_build_side)
+{
+  JoinOrderOptimizer optimizer;
+  const int big = add_relation(optimizer, 50000);
+  const int small = add_relation(optimizer, 5000);
+  optimizer.add_edge(make_edge(big, small, 1.0 / 50000));
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  const Plan &root = optimizer.plan(optimizer.best());
+  ASSERT_EQ(Algorithm::HASH, root.algorithm);
+  const bool small_on_left = optimizer.plan(root.left).relation == small;
+  ASSERT_EQ(small_on_left, root.build_left);
+}
+
+TEST(test_join_order_optimizer, test_index_nested_loop)
+{
+  // 外表很小，内表很大并且连接字段上有索引
+  JoinOrderOptimizer optimizer;
+  const int outer = add_relation(optimizer, 10);
+  const int inner = add_relation(optimizer, 1000000);
+  JoinOrderOptimizer::Edge edge = make_edge(outer, inner, 1.0 / 1000000);
+  edge.indexed[1] = true;
+  optimizer.add_edge(edge);
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  const Plan &root = optimizer.plan(optimizer.best());
+  ASSERT_EQ(Algorithm::INDEX_NESTED_LOOP, root.algorithm);
+  ASSERT_EQ(inner, optimizer.plan(root.right).relation);
+  ASSERT_EQ(0, root.key_edge);
+}
+
+TEST(test_join_order_optimizer, test_merge)
+{
+  // 两边都很大，hash表放不下
+  JoinOrderOptimizer optimizer;
+  const int left = add_relation(optimizer, 200000);
+  const int right = add_relation(optimizer, 300000);
+  JoinOrderOptimizer::Edge edge = make_edge(left, right, 1.0 / 300000);
+  optimizer.add_edge(edge);
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+  ASSERT_EQ(Algorithm::MERGE, optimizer.plan(optimizer.best()).algorithm);
+  ASSERT_FALSE(optimizer.plan(optimizer.best()).left_sorted);
+
+  // 可以按照索引的顺序读取时不需要排序
+  JoinOrderOptimizer ordered_optimizer;
+  add_relation(ordered_optimizer, 200000);
+  add_relation(ordered_optimizer, 300000);
+  edge.ordered_cost[0] = CostModel::index_scan_cost(200000, 2000, true /*index_only*/);
+  edge.ordered_cost[1] = CostModel::index_scan_cost(300000, 3000, true /*index_only*/);
+  ordered_optimizer.add_edge(edge);
+  ASSERT_EQ(RC::SUCCESS, ordered_optimizer.optimize());
+
+  const Plan &root = ordered_optimizer.plan(ordered_optimizer.best());
+  ASSERT_EQ(Algorithm::MERGE, root.algorithm);
+  ASSERT_TRUE(root.left_sorted);
+  ASSERT_TRUE(root.right_sorted);
+  ASSERT_LT(root.cost, optimizer.plan(optimizer.best()).cost);
+}
+
+TEST(test_join_order_optimizer, test_cross_product)
+{
+  JoinOrderOptimizer optimizer;
+  add_relation(optimizer, 10);
+  add_relation(optimizer, 20);
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  const Plan &root = optimizer.plan(optimizer.best());
+  ASSERT_EQ(Algorithm::NESTED_LOOP, root.algorithm);
+  ASSERT_NEAR(200, root.rows, 0.01);
+}
+
+TEST(test_join_order_optimizer, test_greedy)
+{
+  // 表很多的时候使用贪心算法，仍然不能出现笛卡尔积
+  const int relation_num = JoinOrderOptimizer::DP_MAX_RELATIONS + 6;
+  JoinOrderOptimizer optimizer;
+  for (int i = 0; i < relation_num; i++) {
+    add_relation(optimizer, 1000 * (i % 5 + 1));
+  }
+  for (int i = 1; i < relation_num; i++) {
+    optimizer.add_edge(make_edge(i - 1, i, 1.0 / 5000));
+  }
+  ASSERT_EQ(RC::SUCCESS, optimizer.optimize());
+
+  uint64_t relations = 0;
+  check_tree(optimizer, optimizer.best(), relations);
+  ASSERT_EQ(((uint64_t)1 << relation_num) - 1, relations);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
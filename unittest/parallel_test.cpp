@@ -0,0 +1,208 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sql/operator/gather_physical_operator.h"
+#include "sql/operator/morsel_scheduler.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/**
+ * @brief 按批输出一段连续整数的算子，模拟并行扫描中的一个工作线程
+ */
+class RangePhysicalOperator : public PhysicalOperator
+{
+public:
+  RangePhysicalOperator(int begin, int end) : begin_(begin), end_(end) {}
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::STRING_LIST; }
+
+  RC open(Trx *) override
+  {
+    current_ = begin_;
+    return RC::SUCCESS;
+  }
+  RC next() override { return RC::UNIMPLENMENT; }
+  RC close() override { return RC::SUCCESS; }
+  Tuple *current_tuple() override { return nullptr; }
+
+  RC next_chunk(Chunk &chunk) override
+  {
+    chunk.reset();
+    if (current_ >= end_) {
+      return RC::RECORD_EOF;
+    }
+
+    Column &column = chunk.add_column("t", "id", INTS, sizeof(int));
+    int rows = 0;
+    for (; rows < chunk.capacity() && current_ < end_; rows++, current_++) {
+      column.append_value(Value(current_));
+    }
+    chunk.set_rows(rows);
+
+    // 过滤掉奇数
+    vector<int> &selection = chunk.selection();
+    selection.erase(std::remove_if(selection.begin(), selection.end(),
+                        [&column](int row) { return *(const int *)column.data_at(row) % 2 != 0; }),
+        selection.end());
+    return RC::SUCCESS;
+  }
+  bool support_chunk() const override { return true; }
+
+private:
+  int begin_ = 0;
+  int end_ = 0;
+  int current_ = 0;
+};
+
+static unique_ptr<GatherPhysicalOperator> create_gather(int worker_num, int rows_per_worker)
+{
+  auto gather = make_unique<GatherPhysicalOperator>(nullptr /*scheduler*/, nullptr /*table*/);
+  for (int i = 0; i < worker_num; i++) {
+    gather->add_child(make_unique<RangePhysicalOperator>(i * rows_per_worker, (i + 1) * rows_per_worker));
+  }
+  return gather;
+}
+
+TEST(test_parallel, test_morsel_scheduler)
+{
+  // 第0页是文件头，需要扫描的是 [1, 1001)
+  const PageNum page_count = 1001;
+  MorselScheduler scheduler(4, 8);
+  scheduler.init(page_count);
+
+  // 只有一个线程在取，取完自己的以后窃取其它线程的
+  vector<int> visited(page_count, 0);
+  MorselScheduler::Morsel morsel;
+  PageNum last_end = 1;
+  while (scheduler.next(0, morsel)) {
+    ASSERT_LT(morsel.begin_page, morsel.end_page);
+    ASSERT_LE(morsel.end_page - morsel.begin_page, 8);
+    if (scheduler.steal_count() == 0) {
+      // 自己的队列按照页号的顺序
+      ASSERT_EQ(last_end, morsel.begin_page);
+      last_end = morsel.end_page;
+    }
+    for (PageNum page = morsel.begin_page; page < morsel.end_page; page++) {
+      visited[page]++;
+    }
+  }
+  ASSERT_EQ(0, visited[0]);
+  ASSERT_TRUE(std::all_of(visited.begin() + 1, visited.end(), [](int count) { return count == 1; }));
+  ASSERT_GT(scheduler.steal_count(), 0);
+  ASSERT_FALSE(scheduler.next(3, morsel));
+
+  // 没有数据页
+  scheduler.init(1);
+  ASSERT_FALSE(scheduler.next(0, morsel));
+}
+
+TEST(test_parallel, test_morsel_scheduler_concurrent)
+{
+  const PageNum page_count = 100001;
+  const int     worker_num = 8;
+  MorselScheduler scheduler(worker_num, 4);
+  scheduler.init(page_count);
+
+  mutex          lock;
+  vector<int>    visited(page_count, 0);
+  vector<thread> threads;
+  for (int i = 0; i < worker_num; i++) {
+    threads.emplace_back([&, i] {
+      MorselScheduler::Morsel morsel;
+      vector<PageNum>         pages;
+      while (scheduler.next(i, morsel)) {
+        for (PageNum page = morsel.begin_page; page < morsel.end_page; page++) {
+          pages.push_back(page);
+        }
+        // 有的线程比较慢，其它线程会窃取它的morsel
+        if (i == 0) {
+          this_thread::yield();
+        }
+      }
+      lock_guard<mutex> guard(lock);
+      for (PageNum page : pages) {
+        visited[page]++;
+      }
+    });
+  }
+  for (thread &t : threads) {
+    t.join();
+  }
+  ASSERT_TRUE(std::all_of(visited.begin() + 1, visited.end(), [](int count) { return count == 1; }));
+}
+
+TEST(test_parallel, test_gather)
+{
+  const int worker_num = 4;
+  const int rows_per_worker = 10000;
+  unique_ptr<GatherPhysicalOperator> gather = create_gather(worker_num, rows_per_worker);
+  ASSERT_EQ(string("WORKERS 4"), gather->param());
+
+  // 逐行读取，按名字获取字段
+  for (int round = 0; round < 2; round++) {
+    ASSERT_EQ(RC::SUCCESS, gather->open(nullptr));
+    vector<int> ids;
+    RC rc = RC::SUCCESS;
+    Value value;
+    while (RC::SUCCESS == (rc = gather->next())) {
+      ASSERT_EQ(RC::SUCCESS, gather->current_tuple()->find_cell(TupleCellSpec("t", "id"), value));
+      ids.push_back(value.get_int());
+    }
+    ASSERT_EQ(RC::RECORD_EOF, rc);
+    ASSERT_EQ(RC::SUCCESS, gather->close());
+
+    std::sort(ids.begin(), ids.end());
+    ASSERT_EQ(static_cast<size_t>(worker_num * rows_per_worker / 2), ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+      ASSERT_EQ(static_cast<int>(i * 2), ids[i]);
+    }
+  }
+
+  // 按批读取
+  ASSERT_EQ(RC::SUCCESS, gather->open(nullptr));
+  Chunk chunk;
+  int   count = 0;
+  while (RC::SUCCESS == gather->next_chunk(chunk)) {
+    count += chunk.size();
+  }
+  ASSERT_EQ(worker_num * rows_per_worker / 2, count);
+  ASSERT_EQ(RC::SUCCESS, gather->close());
+}
+
+TEST(test_parallel, test_gather_early_close)
+{
+  // 数据比队列能放下的多很多，只读取几行就关闭，工作线程不会一直等待
+  unique_ptr<GatherPhysicalOperator> gather = create_gather(4, 1000000);
+  ASSERT_EQ(RC::SUCCESS, gather->open(nullptr));
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(RC::SUCCESS, gather->next());
+  }
+  ASSERT_EQ(RC::SUCCESS, gather->close());
+
+  // 没有读取数据就关闭
+  ASSERT_EQ(RC::SUCCESS, gather->open(nullptr));
+  ASSERT_EQ(RC::SUCCESS, gather->close());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
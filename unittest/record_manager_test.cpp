@@ -184,6 +184,111 @@ TEST(test_record_page_handler, test_record_file_iterator)
   delete bpm;
 }
 
+TEST(test_record_page_handler, test_record_file_page_range)
+{
+  const char *record_manager_file = "record_manager_range.bp";
+  ::remove(record_manager_file);
+
+  BufferPoolManager *bpm = new BufferPoolManager();
+  DiskBufferPool *bp = nullptr;
+  ASSERT_EQ(RC::SUCCESS, bpm->create_file(record_manager_file));
+  ASSERT_EQ(RC::SUCCESS, bpm->open_file(record_manager_file, bp));
+
+  RecordFileHandler file_handler;
+  ASSERT_EQ(RC::SUCCESS, file_handler.init(bp));
+
+  const int record_insert_num = 2000;
+  char record_data[100] = {0};
+  for (int i = 0; i < record_insert_num; i++) {
+    RID rid;
+    ASSERT_EQ(RC::SUCCESS, file_handler.insert_record(record_data, sizeof(record_data), &rid));
+  }
+  const PageNum page_count = bp->page_count();
+  ASSERT_GT(page_count, 10);
+
+  // 按照不同的范围分段扫描，每条记录正好扫描到一次
+  VacuousTrx trx;
+  RecordFileScanner file_scanner;
+  Record record;
+  for (PageNum step : {1, 3, 7, 1000}) {
+    int count = 0;
+    for (PageNum begin = 1; begin < page_count; begin += step) {
+      const PageNum end = begin + step;
+      ASSERT_EQ(RC::SUCCESS,
+          file_scanner.open_scan(nullptr /*table*/, *bp, &trx, true /*readonly*/, nullptr, begin, end));
+      while (file_scanner.has_next()) {
+        ASSERT_EQ(RC::SUCCESS, file_scanner.next(record));
+        ASSERT_GE(record.rid().page_num, begin);
+        ASSERT_LT(record.rid().page_num, end);
+        count++;
+      }
+      file_scanner.close_scan();
+    }
+    ASSERT_EQ(record_insert_num, count);
+  }
+
+  // 范围中没有页面
+  ASSERT_EQ(RC::SUCCESS, file_scanner.open_scan(nullptr, *bp, &trx, true, nullptr, page_count, page_count + 10));
+  ASSERT_FALSE(file_scanner.has_next());
+  file_scanner.close_scan();
+
+  bpm->close_file(record_manager_file);
+  delete bpm;
+}
+
+TEST(test_record_page_handler, test_page_all_visible)
+{
+  const char *record_manager_file = "record_manager.bp";
+  ::remove(record_manager_file);
+
+  BufferPoolManager *bpm = new BufferPoolManager();
+  DiskBufferPool *bp = nullptr;
+  RC rc = bpm->create_file(record_manager_file);
+  ASSERT_EQ(rc, RC::SUCCESS);
+
+  rc = bpm->open_file(record_manager_file, bp);
+  ASSERT_EQ(rc, RC::SUCCESS);
+
+  RecordFileHandler file_handler;
+  rc = file_handler.init(bp);
+  ASSERT_EQ(rc, RC::SUCCESS);
+
+  char record_data[20];
+  RID rid;
+  rc = file_handler.insert_record(record_data, sizeof(record_data), &rid);
+  ASSERT_EQ(rc, RC::SUCCESS);
+  ASSERT_FALSE(file_handler.is_page_all_visible(rid.page_num));
+
+  file_handler.set_page_all_visible(rid.page_num);
+  ASSERT_TRUE(file_handler.is_page_all_visible(rid.page_num));
+
+  // 只读访问不会影响标记
+  rc = file_handler.visit_record(rid, true/*readonly*/, [](Record &) {});
+  ASSERT_EQ(rc, RC::SUCCESS);
+  ASSERT_TRUE(file_handler.is_page_all_visible(rid.page_num));
+
+  // 以写模式访问页面时，都需要清除标记
+  rc = file_handler.visit_record(rid, false/*readonly*/, [](Record &) {});
+  ASSERT_EQ(rc, RC::SUCCESS);
+  ASSERT_FALSE(file_handler.is_page_all_visible(rid.page_num));
+
+  file_handler.set_page_all_visible(rid.page_num);
+  RID rid2;
+  rc = file_handler.insert_record(record_data, sizeof(record_data), &rid2);
+  ASSERT_EQ(rc, RC::SUCCESS);
+  ASSERT_EQ(rid.page_num, rid2.page_num);
+  ASSERT_FALSE(file_handler.is_page_all_visible(rid.page_num));
+
+  file_handler.set_page_all_visible(rid.page_num);
+  rc = file_handler.delete_record(&rid2);
+  ASSERT_EQ(rc, RC::SUCCESS);
+  ASSERT_FALSE(file_handler.is_page_all_visible(rid.page_num));
+
+  file_handler.close();
+  bpm->close_file(record_manager_file);
+  delete bpm;
+}
+
 int main(int argc, char **argv)
 {
   // 分析gtest程序的命令行参数
@@ -0,0 +1,117 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/lang/roaring_bitmap.h"
+
+using namespace common;
+
+static std::vector<uint32_t> to_vector(const RoaringBitmap &bitmap)
+{
+  std::vector<uint32_t> values;
+  RoaringBitmap::Iterator iter(bitmap);
+  uint32_t value = 0;
+  while (iter.next(value)) {
+    values.push_back(value);
+  }
+  return values;
+}
+
+TEST(test_roaring_bitmap, test_container_convert)
+{
+  RoaringContainer container;
+  for (int i = 0; i < RoaringContainer::ARRAY_MAX_SIZE; i++) {
+    ASSERT_TRUE(container.add(i * 2));
+  }
+  ASSERT_EQ(RoaringContainer::Type::ARRAY, container.type());
+  ASSERT_FALSE(container.add(0));
+
+  // 数组满了以后转换成位图
+  ASSERT_TRUE(container.add(1));
+  ASSERT_EQ(RoaringContainer::Type::BITMAP, container.type());
+  ASSERT_EQ(RoaringContainer::ARRAY_MAX_SIZE + 1, container.cardinality());
+  ASSERT_TRUE(container.contains(1));
+  ASSERT_TRUE(container.contains(100));
+  ASSERT_FALSE(container.contains(101));
+
+  // 序列化以后再恢复
+  std::vector<char> buf(container.serialized_size());
+  container.serialize(buf.data());
+  RoaringContainer other;
+  other.deserialize(container.type(), container.cardinality(), buf.data());
+  ASSERT_EQ(container.cardinality(), other.cardinality());
+  ASSERT_TRUE(other.contains(1));
+
+  // 删除以后又转换成数组
+  ASSERT_TRUE(container.remove(1));
+  ASSERT_EQ(RoaringContainer::Type::ARRAY, container.type());
+  ASSERT_FALSE(container.remove(1));
+  ASSERT_TRUE(container.contains(4094));
+}
+
+TEST(test_roaring_bitmap, test_and_or)
+{
+  RoaringBitmap bitmap1;
+  RoaringBitmap bitmap2;
+  std::set<uint32_t> set1;
+  std::set<uint32_t> set2;
+
+  // 稠密的数据和稀疏的数据都有，覆盖数组、位图两种容器的组合
+  for (uint32_t i = 0; i < 100000; i += 3) {
+    bitmap1.add(i);
+    set1.insert(i);
+  }
+  for (uint32_t i = 0; i < 1000000; i += 7) {
+    bitmap2.add(i);
+    set2.insert(i);
+  }
+  for (uint32_t i = 4000000; i < 4000100; i++) {
+    bitmap1.add(i);
+    set1.insert(i);
+  }
+  ASSERT_EQ(set1.size(), bitmap1.cardinality());
+  ASSERT_EQ(set2.size(), bitmap2.cardinality());
+
+  RoaringBitmap and_bitmap = bitmap1;
+  and_bitmap.and_with(bitmap2);
+  std::vector<uint32_t> expect;
+  std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(expect));
+  ASSERT_EQ(expect, to_vector(and_bitmap));
+
+  RoaringBitmap or_bitmap = bitmap1;
+  or_bitmap.or_with(bitmap2);
+  expect.clear();
+  std::set_union(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(expect));
+  ASSERT_EQ(expect, to_vector(or_bitmap));
+
+  for (uint32_t i = 4000000; i < 4000100; i++) {
+    ASSERT_TRUE(or_bitmap.remove(i));
+  }
+  ASSERT_FALSE(or_bitmap.contains(4000000));
+  ASSERT_EQ(expect.size() - 100, or_bitmap.cardinality());
+
+  RoaringBitmap empty;
+  or_bitmap.and_with(empty);
+  ASSERT_TRUE(or_bitmap.empty());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
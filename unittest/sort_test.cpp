@@ -0,0 +1,234 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "sql/operator/limit_physical_operator.h"
+#include "sql/operator/sort_physical_operator.h"
+#include "sql/operator/top_n_physical_operator.h"
+#include "storage/buffer/disk_buffer_pool.h"
+#include "storage/table/table.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+
+BufferPoolManager bpm;
+
+// 没有初始化的表，名字是空的
+static Table     table;
+static FieldMeta id_meta;
+static FieldMeta name_meta;
+
+/**
+ * @brief 按顺序输出给定数据的算子，记录下层被读取了多少行
+ */
+class ValuesPhysicalOperator : public PhysicalOperator
+{
+public:
+  ValuesPhysicalOperator(const vector<vector<Value>> &rows) : rows_(rows)
+  {
+    speces_.emplace_back(table.name(), id_meta.name());
+    speces_.emplace_back(table.name(), name_meta.name());
+    tuple_.set_schema(&speces_);
+  }
+
+  PhysicalOperatorType type() const override { return PhysicalOperatorType::STRING_LIST; }
+
+  RC open(Trx *) override
+  {
+    current_ = -1;
+    return RC::SUCCESS;
+  }
+  RC next() override
+  {
+    if (++current_ >= static_cast<int>(rows_.size())) {
+      return RC::RECORD_EOF;
+    }
+    tuple_.set_cells(rows_[current_].data());
+    return RC::SUCCESS;
+  }
+  RC close() override { return RC::SUCCESS; }
+
+  Tuple *current_tuple() override { return &tuple_; }
+
+  int fetched_rows() const { return std::min(current_ + 1, static_cast<int>(rows_.size())); }
+
+private:
+  vector<vector<Value>> rows_;
+  int                   current_ = -1;
+  vector<TupleCellSpec> speces_;
+  MaterializedTuple     tuple_;
+};
+
+/**
+ * @brief order by name desc, id
+ */
+static vector<unique_ptr<Expression>> sort_exprs()
+{
+  vector<unique_ptr<Expression>> exprs;
+  exprs.emplace_back(new FieldExpr(Field(&table, &name_meta)));
+  exprs.back()->set_name(name_meta.name());
+  exprs.emplace_back(new FieldExpr(Field(&table, &id_meta)));
+  exprs.back()->set_name(id_meta.name());
+  return exprs;
+}
+
+static const vector<bool> sort_asc = {false, true};
+
+static vector<vector<Value>> make_rows(int row_num)
+{
+  vector<vector<Value>> rows;
+  for (int i = 0; i < row_num; i++) {
+    const int id = (i * 7919) % row_num - row_num / 2;
+    const string name = "name" + to_string(i % 97);
+    rows.push_back({Value(id), Value(name.c_str())});
+  }
+  return rows;
+}
+
+static vector<pair<string, int>> expected_result(const vector<vector<Value>> &rows, int offset, int limit)
+{
+  vector<pair<string, int>> result;
+  for (const vector<Value> &row : rows) {
+    result.emplace_back(row[1].get_string(), row[0].get_int());
+  }
+  std::sort(result.begin(), result.end(), [](const pair<string, int> &a, const pair<string, int> &b) {
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+  });
+  result.erase(result.begin(), result.begin() + std::min<size_t>(offset, result.size()));
+  if (limit >= 0 && static_cast<size_t>(limit) < result.size()) {
+    result.resize(limit);
+  }
+  return result;
+}
+
+static void check_result(PhysicalOperator &oper, const vector<pair<string, int>> &expected)
+{
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+  RC     rc = RC::SUCCESS;
+  size_t count = 0;
+  Value  value;
+  while (RC::SUCCESS == (rc = oper.next())) {
+    ASSERT_LT(count, expected.size());
+    Tuple *tuple = oper.current_tuple();
+    ASSERT_EQ(RC::SUCCESS, tuple->cell_at(0, value));
+    ASSERT_EQ(expected[count].second, value.get_int());
+    ASSERT_EQ(RC::SUCCESS, tuple->find_cell(TupleCellSpec(table.name(), name_meta.name()), value));
+    ASSERT_EQ(expected[count].first, value.get_string());
+    count++;
+  }
+  ASSERT_EQ(RC::RECORD_EOF, rc);
+  ASSERT_EQ(expected.size(), count);
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+}
+
+TEST(test_sort, test_sort)
+{
+  const vector<vector<Value>> rows = make_rows(10000);
+  SortPhysicalOperator oper(sort_exprs(), sort_asc, ".");
+  oper.add_child(make_unique<ValuesPhysicalOperator>(rows));
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+  ASSERT_EQ(0, oper.run_num());
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+
+  check_result(oper, expected_result(rows, 0, -1));
+}
+
+TEST(test_sort, test_external_sort)
+{
+  // 内存只能放下一部分数据，排序的段写到临时文件中再归并
+  const vector<vector<Value>> rows = make_rows(50000);
+  SortPhysicalOperator oper(sort_exprs(), sort_asc, ".");
+  oper.set_memory_limit(64 * 1024);
+  oper.add_child(make_unique<ValuesPhysicalOperator>(rows));
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+  ASSERT_GT(oper.run_num(), 1);
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+
+  check_result(oper, expected_result(rows, 0, -1));
+}
+
+TEST(test_sort, test_top_n)
+{
+  const vector<vector<Value>> rows = make_rows(10000);
+  for (int limit : {0, 1, 10, 97, 1000, 20000}) {
+    TopNPhysicalOperator oper(sort_exprs(), sort_asc, limit);
+    oper.add_child(make_unique<ValuesPhysicalOperator>(rows));
+    check_result(oper, expected_result(rows, 0, limit));
+  }
+
+  // key相同时保持输入的顺序，与排序算子的结果一致
+  vector<vector<Value>> same_keys;
+  for (int i = 0; i < 100; i++) {
+    same_keys.push_back({Value(i), Value("same")});
+  }
+  vector<unique_ptr<Expression>> exprs;
+  exprs.emplace_back(new FieldExpr(Field(&table, &name_meta)));
+  TopNPhysicalOperator oper(std::move(exprs), {true}, 10);
+  oper.add_child(make_unique<ValuesPhysicalOperator>(same_keys));
+  ASSERT_EQ(RC::SUCCESS, oper.open(nullptr));
+  Value value;
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(RC::SUCCESS, oper.next());
+    ASSERT_EQ(RC::SUCCESS, oper.current_tuple()->cell_at(0, value));
+    ASSERT_EQ(i, value.get_int());
+  }
+  ASSERT_EQ(RC::RECORD_EOF, oper.next());
+  ASSERT_EQ(RC::SUCCESS, oper.close());
+}
+
+TEST(test_sort, test_limit)
+{
+  const vector<vector<Value>> rows = make_rows(1000);
+
+  // 排序以后跳过前面的行
+  LimitPhysicalOperator limit_oper(10, 95);
+  unique_ptr<PhysicalOperator> top_n_oper(new TopNPhysicalOperator(sort_exprs(), sort_asc, 105));
+  top_n_oper->add_child(make_unique<ValuesPhysicalOperator>(rows));
+  limit_oper.add_child(std::move(top_n_oper));
+  check_result(limit_oper, expected_result(rows, 95, 10));
+
+  // 输出足够的行数以后不再读取下层算子
+  LimitPhysicalOperator scan_limit_oper(5, 3);
+  scan_limit_oper.add_child(make_unique<ValuesPhysicalOperator>(rows));
+  ASSERT_EQ(RC::SUCCESS, scan_limit_oper.open(nullptr));
+  Value value;
+  for (int i = 0; i < 5; i++) {
+    ASSERT_EQ(RC::SUCCESS, scan_limit_oper.next());
+    ASSERT_EQ(RC::SUCCESS, scan_limit_oper.current_tuple()->cell_at(0, value));
+    ASSERT_EQ(rows[i + 3][0].get_int(), value.get_int());
+  }
+  ASSERT_EQ(RC::RECORD_EOF, scan_limit_oper.next());
+  ASSERT_EQ(8, static_cast<ValuesPhysicalOperator &>(*scan_limit_oper.children()[0]).fetched_rows());
+  ASSERT_EQ(RC::SUCCESS, scan_limit_oper.close());
+
+  // 跳过的行数超过输入
+  LimitPhysicalOperator empty_limit_oper(5, 2000);
+  empty_limit_oper.add_child(make_unique<ValuesPhysicalOperator>(rows));
+  ASSERT_EQ(RC::SUCCESS, empty_limit_oper.open(nullptr));
+  ASSERT_EQ(RC::RECORD_EOF, empty_limit_oper.next());
+  ASSERT_EQ(RC::SUCCESS, empty_limit_oper.close());
+}
+
+int main(int argc, char **argv)
+{
+  id_meta.init("id", INTS, 0, sizeof(int), true);
+  name_meta.init("name", CHARS, 4, 8, true);
+
+  testing::InitGoogleTest(&argc, argv);
+  BufferPoolManager::set_instance(&bpm);
+  return RUN_ALL_TESTS();
+}
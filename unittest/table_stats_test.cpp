@@ -0,0 +1,177 @@
+/* Copyright (c) 2021 OceanBase and/or its affiliates. All rights reserved.
+miniob is licensed under Mulan PSL v2.
+You can use this software according to the terms and conditions of the Mulan PSL v2.
+You may obtain a copy of Mulan PSL v2 at:
+         http://license.coscl.org.cn/MulanPSL2
+THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+See the Mulan PSL v2 for more details. */
+
+//
+// Created on 2026/10/19.
+//
+
+#include <string.h>
+#include <sstream>
+#include <vector>
+
+#include "common/lang/bloom_filter.h"
+#include "common/math/hyperloglog.h"
+#include "storage/table/table_meta.h"
+#include "storage/table/table_stats.h"
+#include "storage/trx/trx.h"
+#include "gtest/gtest.h"
+
+using namespace common;
+
+#define ROW_NUM 10000
+
+TEST(test_table_stats, test_hyperloglog)
+{
+  HyperLogLog hll;
+  for (int i = 0; i < ROW_NUM * 10; i++) {
+    hll.add(BlockedBloomFilter::hash_bytes(&i, sizeof(i)));
+  }
+  ASSERT_NEAR(ROW_NUM * 10, hll.estimate(), ROW_NUM * 10 * 0.05);
+
+  // 值比较少时使用线性计数，结果基本准确
+  HyperLogLog small;
+  for (int i = 0; i < ROW_NUM; i++) {
+    const int value = i % 10;
+    small.add(BlockedBloomFilter::hash_bytes(&value, sizeof(value)));
+  }
+  ASSERT_NEAR(10, small.estimate(), 0.5);
+
+  HyperLogLog other;
+  for (int i = ROW_NUM * 10; i < ROW_NUM * 20; i++) {
+    other.add(BlockedBloomFilter::hash_bytes(&i, sizeof(i)));
+  }
+  hll.merge(other);
+  ASSERT_NEAR(ROW_NUM * 20, hll.estimate(), ROW_NUM * 20 * 0.05);
+}
+
+/**
+ * 表中有三个字段：id 从0开始递增，v 90%是1，s 是100个不同的字符串
+ */
+static void collect_stats(const TableMeta &table_meta, int32_t total_pages, int32_t sampled_pages, TableStats &stats)
+{
+  const int sys_field_num = table_meta.sys_field_num();
+  const FieldMeta *id_field = table_meta.field(sys_field_num);
+  const FieldMeta *v_field = table_meta.field(sys_field_num + 1);
+  const FieldMeta *s_field = table_meta.field(sys_field_num + 2);
+
+  TableStatsCollector collector(table_meta);
+  std::vector<char> record(table_meta.record_size());
+  for (int i = 0; i < ROW_NUM; i++) {
+    memset(record.data(), 0, record.size());
+    const int v = (i % 10 == 0) ? i : 1;
+    memcpy(record.data() + id_field->offset(), &i, sizeof(i));
+    memcpy(record.data() + v_field->offset(), &v, sizeof(v));
+    snprintf(record.data() + s_field->offset(), s_field->len(), "s%d", i % 100);
+    collector.add_record(record.data());
+  }
+  collector.finish(total_pages, sampled_pages, stats);
+}
+
+static void init_table_meta(TableMeta &table_meta)
+{
+  AttrInfoSqlNode attrs[3];
+  attrs[0] = AttrInfoSqlNode{INTS, "id", sizeof(int)};
+  attrs[1] = AttrInfoSqlNode{INTS, "v", sizeof(int)};
+  attrs[2] = AttrInfoSqlNode{CHARS, "s", 8};
+  ASSERT_EQ(RC::SUCCESS, table_meta.init(1, "t", 3, attrs));
+}
+
+TEST(test_table_stats, test_collect)
+{
+  TableMeta table_meta;
+  init_table_meta(table_meta);
+
+  TableStats stats;
+  collect_stats(table_meta, 10, 10, stats);
+  ASSERT_TRUE(stats.analyzed());
+  ASSERT_EQ(ROW_NUM, stats.row_count());
+  ASSERT_EQ(3, static_cast<int>(stats.columns().size()));
+
+  const ColumnStats *id_stats = stats.column("id");
+  ASSERT_NE(nullptr, id_stats);
+  ASSERT_NEAR(ROW_NUM, id_stats->distinct_count(), ROW_NUM * 0.05);
+  ASSERT_EQ(TableStatsCollector::HISTOGRAM_BUCKETS + 1, static_cast<int>(id_stats->bounds().size()));
+  ASSERT_EQ(0, id_stats->bounds().front().get_int());
+  ASSERT_EQ(ROW_NUM - 1, id_stats->bounds().back().get_int());
+  ASSERT_EQ(0, id_stats->null_fraction());
+
+  // 均匀分布的字段，范围条件的估算比较准确
+  Value left(1000);
+  Value right(3000);
+  ASSERT_NEAR(0.2, id_stats->range_selectivity(&left, true, &right, false), 0.02);
+  ASSERT_NEAR(0.9, id_stats->range_selectivity(&left, true, nullptr, false), 0.02);
+  ASSERT_NEAR(0.1, id_stats->range_selectivity(nullptr, false, &left, false), 0.02);
+  ASSERT_EQ(0, id_stats->range_selectivity(&right, false, &left, false));
+  Value outside(ROW_NUM * 2);
+  ASSERT_EQ(0, id_stats->equal_selectivity(outside));
+  ASSERT_LT(id_stats->equal_selectivity(left), 0.001);
+
+  // 倾斜的字段，常见的值占满了多个桶
+  const ColumnStats *v_stats = stats.column("v");
+  ASSERT_NE(nullptr, v_stats);
+  Value frequent(1);
+  Value rare(10);
+  ASSERT_NEAR(0.9, v_stats->equal_selectivity(frequent), 0.05);
+  ASSERT_LT(v_stats->equal_selectivity(rare), 0.01);
+
+  const ColumnStats *s_stats = stats.column("s");
+  ASSERT_NE(nullptr, s_stats);
+  ASSERT_NEAR(100, s_stats->distinct_count(), 2);
+
+  double selectivity = 0;
+  ASSERT_TRUE(stats.selectivity("v", &frequent, true, &frequent, true, selectivity));
+  ASSERT_NEAR(0.9, selectivity, 0.05);
+  ASSERT_FALSE(stats.selectivity("no_such_field", &frequent, true, &frequent, true, selectivity));
+
+  // 只采样了一半的页面，记录数按比例放大，几乎都是不同值的字段也按比例放大
+  TableStats sampled_stats;
+  collect_stats(table_meta, 20, 10, sampled_stats);
+  ASSERT_EQ(ROW_NUM * 2, sampled_stats.row_count());
+  ASSERT_NEAR(ROW_NUM * 2, sampled_stats.column("id")->distinct_count(), ROW_NUM * 2 * 0.05);
+  ASSERT_NEAR(100, sampled_stats.column("s")->distinct_count(), 2);
+}
+
+TEST(test_table_stats, test_serialize)
+{
+  TableMeta table_meta;
+  init_table_meta(table_meta);
+
+  TableStats stats;
+  collect_stats(table_meta, 10, 10, stats);
+  table_meta.set_stats(stats);
+
+  std::stringstream ss;
+  ASSERT_GT(table_meta.serialize(ss), 0);
+
+  TableMeta other;
+  ASSERT_GT(other.deserialize(ss), 0);
+  const TableStats &other_stats = other.stats();
+  ASSERT_TRUE(other_stats.analyzed());
+  ASSERT_EQ(stats.row_count(), other_stats.row_count());
+  ASSERT_EQ(stats.page_count(), other_stats.page_count());
+  ASSERT_EQ(stats.columns().size(), other_stats.columns().size());
+  for (size_t i = 0; i < stats.columns().size(); i++) {
+    const ColumnStats &column = stats.columns()[i];
+    const ColumnStats &other_column = other_stats.columns()[i];
+    ASSERT_EQ(column.field_name(), other_column.field_name());
+    ASSERT_EQ(column.distinct_count(), other_column.distinct_count());
+    ASSERT_EQ(column.bounds().size(), other_column.bounds().size());
+    for (size_t b = 0; b < column.bounds().size(); b++) {
+      ASSERT_EQ(0, column.bounds()[b].compare(other_column.bounds()[b]));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  TrxKit::init_global("vacuous");
+  return RUN_ALL_TESTS();
+}